@@ -74,6 +74,8 @@
 * N is the maximum FFT Size supported    
 */
 
+#ifndef ARM_FFT_TABLES_SPECIALISED
+
 /*    
 * @brief  Table for bit reversal process    
 */
@@ -21187,6 +21189,8 @@ const q15_t twiddleCoef_4096_q15[6144] =
 * @} end of CFFT_CIFFT group    
 */
 
+#endif /* ARM_FFT_TABLES_SPECIALISED */
+
 /*    
 * @brief  Q15 table for reciprocal    
 */
@@ -21221,6 +21225,7 @@ const q31_t armRecipTableQ31[64] = {
   0x41CCDDB6, 0x4146A3C6, 0x40C28923, 0x40408102
 };
 
+#ifndef ARM_FFT_TABLES_SPECIALISED
 const uint16_t armBitRevIndexTable16[ARMBITREVINDEXTABLE__16_TABLE_LENGTH] = 
 {
    //8x2, size 20
@@ -26972,6 +26977,8 @@ const float32_t twiddleCoef_rfft_4096[4096] = {
 };
 
 
+#endif /* ARM_FFT_TABLES_SPECIALISED */
+
 /**   
  * \par    
  * Example code for the generation of the floating-point sine table:
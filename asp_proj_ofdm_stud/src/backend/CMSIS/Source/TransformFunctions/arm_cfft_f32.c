@@ -596,6 +596,7 @@ void arm_cfft_f32(
     case 16: 
     case 128:
     case 1024:
+    case 8192:
         arm_cfft_radix8by2_f32  ( (arm_cfft_instance_f32 *) S, p1);
         break;
     case 32:
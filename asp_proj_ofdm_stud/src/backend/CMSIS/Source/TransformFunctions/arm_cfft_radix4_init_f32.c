@@ -42,6 +42,8 @@
 #include "arm_math.h"
 #include "arm_common_tables.h"
 
+#ifndef ARM_FFT_TABLES_SPECIALISED
+
 /**    
  * @ingroup groupTransforms    
  */
@@ -163,3 +165,5 @@ arm_status arm_cfft_radix4_init_f32(
 /**    
  * @} end of ComplexFFT group    
  */
+
+#endif /* ARM_FFT_TABLES_SPECIALISED */
@@ -41,6 +41,8 @@
 
 #include "arm_math.h"
 
+#ifndef ARM_FFT_TABLES_SPECIALISED
+
 /**    
  * @ingroup groupTransforms    
  */
@@ -16517,3 +16519,5 @@ arm_status arm_dct4_init_f32(
 /**    
    * @} end of DCT4_IDCT4 group    
    */
+
+#endif /* ARM_FFT_TABLES_SPECIALISED */
@@ -41,6 +41,8 @@
 #include "arm_math.h"
 #include "arm_common_tables.h"
 
+#ifndef ARM_FFT_TABLES_SPECIALISED
+
 /**   
  * @ingroup groupTransforms   
  */
@@ -141,3 +143,5 @@ arm_status arm_rfft_fast_init_f32(
 /**   
  * @} end of RealFFT group   
  */
+
+#endif /* ARM_FFT_TABLES_SPECIALISED */
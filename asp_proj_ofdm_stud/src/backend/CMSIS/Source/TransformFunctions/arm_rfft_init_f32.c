@@ -41,6 +41,8 @@
 
 #include "arm_math.h"
 
+#ifndef ARM_FFT_TABLES_SPECIALISED
+
 /**    
  * @ingroup groupTransforms    
  */
@@ -8374,3 +8376,5 @@ arm_status arm_rfft_init_f32(
   /**    
    * @} end of RealFFT group    
    */
+
+#endif /* ARM_FFT_TABLES_SPECIALISED */
@@ -0,0 +1,22 @@
+#include "arena.h"
+#include <stddef.h>
+#include "../util.h"
+
+void arena_new(arena_s * const a, float * const pool, const uint_fast32_t len){
+	a->pool = pool;
+	a->len = len;
+	a->top = 0;
+	a->high_water = 0;
+}
+
+float * arena_alloc(arena_s * const a, const uint_fast32_t len){
+	if(len > a->len - a->top){
+		halt_error("Scratch arena overflow\n");
+	}
+	float * const buf = &a->pool[a->top];
+	a->top += len;
+	if(a->top > a->high_water){
+		a->high_water = a->top;
+	}
+	return buf;
+}
@@ -0,0 +1,56 @@
+/** @file Stack-like scratch memory allocator.
+ * Scratch buffers are allocated from the top of a statically sized pool and
+ * released in reverse order by returning to a mark taken earlier. Code whose
+ * buffers are never live at the same time, such as two processing chains that
+ * never run concurrently, can thereby overlay each other in the same pool.
+ * The largest amount of memory ever allocated is kept as a high-water mark, so
+ * the pool can be sized from a report rather than by guessing. */
+
+#ifndef ARENA_H_
+#define ARENA_H_
+
+#include <stdint.h>
+
+/** @brief Position in an arena to return to, see arena_push/arena_pop */
+typedef uint_fast32_t arena_mark_t;
+
+/** @brief Memory storage element for a single arena */
+typedef struct {
+	float * pool;				//!<- Memory to allocate from
+	uint_fast32_t len;			//!<- Total number of elements in pool
+	uint_fast32_t top;			//!<- Number of elements currently allocated
+	uint_fast32_t high_water;	//!<- Largest number of elements allocated at any time
+} arena_s;
+
+/** @brief Initialize an arena
+ * @param a Pointer to the arena_s structure to initialize
+ * @param pool Pointer to an array of floats to allocate from
+ * @param len The number of elements in pool */
+void arena_new(arena_s * const a, float * const pool, const uint_fast32_t len);
+
+/** @brief Allocates len elements from an arena a.
+ * Halts with an error message if the arena does not have room for the buffer.
+ * @return Pointer to the first element of the buffer */
+float * arena_alloc(arena_s * const a, const uint_fast32_t len);
+
+/** @brief Returns a mark for an arena a, releasing everything allocated after it when passed to arena_pop */
+static inline arena_mark_t arena_push(const arena_s * const a){
+	return a->top;
+}
+
+/** @brief Releases all buffers allocated from an arena a since the mark was taken */
+static inline void arena_pop(arena_s * const a, const arena_mark_t mark){
+	a->top = mark;
+}
+
+/** @brief Releases all buffers allocated from an arena a */
+static inline void arena_reset(arena_s * const a){
+	a->top = 0;
+}
+
+/** @brief Returns the largest number of elements allocated from an arena a at any time */
+static inline uint_fast32_t arena_high_water(const arena_s * const a){
+	return a->high_water;
+}
+
+#endif /* ARENA_H_ */
@@ -0,0 +1,188 @@
+#include "capture.h"
+#include "../../config.h"
+#include "../../macro.h"
+#include "../../util.h"
+#include "../spsc.h"
+#include "../serframe/serframe.h"
+#include "../hw/board.h"
+#include "../hw/headphone.h"
+#include "../pcm/pcm.h"
+
+static uint_fast32_t capture_drops = 0;
+
+#if CAPTURE_RING_SAMPLES > 0
+
+/** @brief Payload sizes of the frames [bytes] */
+#define CAPTURE_HEADER_LEN		(12)
+#define CAPTURE_DATA_LEN(n)		(6 + 2*(n))
+
+/** @brief A capture queued in the ring */
+struct capture_rec_s {
+	uint16_t seq;				//!<- Sequence number, incremented for every capture
+	uint8_t kind;				//!<- One of capture_kind_e
+	uint32_t sample_rate;		//!<- Sample rate at the time of capture [Hz]
+	uint32_t len;				//!<- Number of samples
+};
+
+/** @brief The ring of samples, written by the capture functions and read by capture_poll */
+static spsc_s capture_ring;
+static spsc_elem_t capture_ring_pool[CAPTURE_RING_SAMPLES];
+
+/** @brief The queue of complete captures, indexed like the sample ring */
+static struct capture_rec_s capture_recs[CAPTURE_MAX_RECORDS];
+static volatile uint32_t capture_rec_head = 0;
+static volatile uint32_t capture_rec_tail = 0;
+
+/** @brief The running microphone capture */
+static struct capture_rec_s capture_mic_rec;
+static uint_fast32_t capture_mic_blocks = 0;
+
+/** @brief State of the capture being sent */
+static bool capture_sending = false;
+static uint32_t capture_sent = 0;			//!<- Samples of the oldest capture sent so far
+
+static uint16_t capture_seq = 0;
+
+void capture_init(void){
+	BUILD_BUG_ON(!ISPOW2(CAPTURE_RING_SAMPLES));
+	BUILD_BUG_ON(!ISPOW2(CAPTURE_MAX_RECORDS));
+	spsc_new(&capture_ring, capture_ring_pool, NUMEL(capture_ring_pool));
+}
+
+/** @brief Converts len samples of data into the ring, which must have room for them */
+static void capture_put(const float * data, uint_fast32_t len){
+	while(len > 0){
+		spsc_elem_t * span;
+		const spsc_idx_t n = MIN(spsc_write_span(&capture_ring, &span), len);
+		//Convert like the output path, the ring stores the 16-bit samples as unsigned elements
+		pcm_f32_to_i16(data, (int16_t *) span, n);
+		spsc_write_commit(&capture_ring, n);
+		data += n;
+		len -= n;
+	}
+}
+
+/** @brief Starts a new capture record of a given kind and length
+ * @return True if both the ring and the record queue have room for it */
+static bool capture_rec_new(struct capture_rec_s * const rec, const enum capture_kind_e kind, const uint_fast32_t len){
+	//The samples of a capture must be contiguous in the ring, so nothing else is captured during a microphone capture
+	if(capture_mic_blocks > 0 || capture_rec_head - capture_rec_tail >= CAPTURE_MAX_RECORDS ||
+			spsc_elems_free(&capture_ring) < len){
+		capture_drops++;
+		return false;
+	}
+	rec->seq = capture_seq++;
+	rec->kind = kind;
+	rec->sample_rate = audio_get_sample_rate();
+	rec->len = len;
+	return true;
+}
+
+/** @brief Makes a capture whose samples are all in the ring visible to capture_poll */
+static void capture_rec_commit(const struct capture_rec_s * const rec){
+	capture_recs[capture_rec_head % CAPTURE_MAX_RECORDS] = *rec;
+	SPSC_BARRIER();
+	capture_rec_head++;
+}
+
+bool capture_frame(const float * data, const uint_fast32_t len){
+	struct capture_rec_s rec;
+	if(!capture_rec_new(&rec, capture_kind_frame, len)){
+		return false;
+	}
+	capture_put(data, len);
+	capture_rec_commit(&rec);
+	return true;
+}
+
+bool capture_microphone_start(const uint_fast32_t blocks){
+	if(blocks == 0 || !capture_rec_new(&capture_mic_rec, capture_kind_microphone, blocks * AUDIO_BLOCKSIZE)){
+		return false;
+	}
+	capture_mic_blocks = blocks;
+	return true;
+}
+
+void capture_microphone(const float * block){
+	if(capture_mic_blocks == 0){
+		return;
+	}
+	capture_put(block, AUDIO_BLOCKSIZE);
+	if(--capture_mic_blocks == 0){
+		capture_rec_commit(&capture_mic_rec);
+	}
+}
+
+void capture_poll(void){
+	struct serframe_s f;
+	while(capture_rec_tail != capture_rec_head){
+		const struct capture_rec_s * const rec = &capture_recs[capture_rec_tail % CAPTURE_MAX_RECORDS];
+		if(!capture_sending){
+			if(board_usart_tx_free() < SERFRAME_OVERHEAD + CAPTURE_HEADER_LEN){
+				return;
+			}
+			const uint8_t head[CAPTURE_HEADER_LEN] = {
+					rec->seq & 0xFF, rec->seq >> 8, rec->kind, 0,
+					rec->sample_rate & 0xFF, (rec->sample_rate >> 8) & 0xFF, (rec->sample_rate >> 16) & 0xFF, rec->sample_rate >> 24,
+					rec->len & 0xFF, (rec->len >> 8) & 0xFF, (rec->len >> 16) & 0xFF, rec->len >> 24};
+			serframe_begin(&f, serframe_type_capture_header, sizeof(head));
+			serframe_write(&f, head, sizeof(head));
+			serframe_end(&f);
+			capture_sending = true;
+			capture_sent = 0;
+		}
+		while(capture_sent < rec->len){
+			const spsc_elem_t * span;
+			spsc_idx_t n = MIN(spsc_read_span(&capture_ring, &span), rec->len - capture_sent);
+			n = MIN(n, CAPTURE_CHUNK_SAMPLES);
+			if(board_usart_tx_free() < SERFRAME_OVERHEAD + CAPTURE_DATA_LEN(n)){
+				return;
+			}
+			const uint8_t head[6] = {
+					rec->seq & 0xFF, rec->seq >> 8,
+					capture_sent & 0xFF, (capture_sent >> 8) & 0xFF, (capture_sent >> 16) & 0xFF, capture_sent >> 24};
+			serframe_begin(&f, serframe_type_capture_data, CAPTURE_DATA_LEN(n));
+			serframe_write(&f, head, sizeof(head));
+			//The samples are stored little endian, as sent
+			serframe_write(&f, span, 2*n);
+			serframe_end(&f);
+			spsc_read_commit(&capture_ring, n);
+			capture_sent += n;
+		}
+		capture_sending = false;
+		capture_rec_tail++;
+	}
+}
+
+#else
+
+/* Without a ring, every capture is dropped and nothing is sent */
+
+void capture_init(void){
+}
+
+bool capture_frame(const float * data, const uint_fast32_t len){
+	(void) data;
+	(void) len;
+	capture_drops++;
+	return false;
+}
+
+bool capture_microphone_start(const uint_fast32_t blocks){
+	(void) blocks;
+	capture_drops++;
+	return false;
+}
+
+void capture_microphone(const float * block){
+	(void) block;
+}
+
+void capture_poll(void){
+}
+
+#endif
+
+uint_fast32_t capture_dropped(void){
+	return capture_drops;
+}
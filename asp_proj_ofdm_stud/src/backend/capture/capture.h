@@ -0,0 +1,61 @@
+/** @file Binary capture of received signals over the debug USART.
+ * Signals are snapshot into a ring of 16-bit samples, either a whole frame
+ * (such as the aligned envelope_data frame of the OFDM lab) or a number of
+ * consecutive raw microphone blocks, and streamed out in the background from
+ * main_idle as serframe frames (see backend/serframe/serframe.h). Each
+ * capture is sent as a header frame followed by data frames holding up to
+ * CAPTURE_CHUNK_SAMPLES samples at a given offset, so the host can tell a
+ * complete capture from one with lost frames. tools/capture2wav.py turns a
+ * log of the serial output into one WAV file per capture.
+ *
+ * Header payload:	seq (2), kind (1), 0 (1), sample rate [Hz] (4), samples (4)
+ * Data payload:	seq (2), offset [samples] (4), samples (2 each)
+ *
+ * Samples are saturated to [-1, 1] and scaled by INT16_MAX. Captures are
+ * dropped, and counted, when the ring has no room for them, while a
+ * microphone capture is still running, or always if CAPTURE_RING_SAMPLES in
+ * config.h is zero. Except for capture_poll, all functions may be called from
+ * the audio callback. */
+
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Maximum number of samples per data frame */
+#define CAPTURE_CHUNK_SAMPLES	(256)
+
+/** @brief Maximum number of captures held in the ring at a time */
+#define CAPTURE_MAX_RECORDS		(8)
+
+/** @brief Kinds of captures, sent in the header frame */
+enum capture_kind_e {
+	capture_kind_frame = 0,			//!<- A frame passed to capture_frame
+	capture_kind_microphone = 1,	//!<- Consecutive microphone blocks
+};
+
+/** @brief Initializes the capture ring. Called once by main before any capture. */
+void capture_init(void);
+
+/** @brief Snapshots len samples of data as one capture
+ * @return True if the capture was queued, false if it was dropped for lack of room */
+bool capture_frame(const float * data, const uint_fast32_t len);
+
+/** @brief Captures the next blocks microphone blocks as one capture.
+ * The room for all blocks is reserved immediately.
+ * @return True if the capture was started, false if a capture is already running or there is no room */
+bool capture_microphone_start(const uint_fast32_t blocks);
+
+/** @brief Adds a microphone block of AUDIO_BLOCKSIZE samples to a running microphone capture.
+ * To be called by the backend subsystem only, once per audio block. */
+void capture_microphone(const float * block);
+
+/** @brief Sends as many frames of the pending captures as fit in the USART transmit buffer.
+ * To be called from main_idle. */
+void capture_poll(void);
+
+/** @brief Returns the number of captures dropped since startup */
+uint_fast32_t capture_dropped(void);
+
+#endif /* CAPTURE_H_ */
@@ -1,5 +1,6 @@
 #include "cbuf.h"
 #include <stddef.h>
+#include <string.h>
 #include "macro.h"
 
 void cbuf_new(cbuf_s * const cb, cbuf_elem_t * const pool, const cbuf_idx_t elems){
@@ -12,6 +13,8 @@ void cbuf_new(cbuf_s * const cb, cbuf_elem_t * const pool, const cbuf_idx_t elem
 	cb->elems = elems;
 	cb->head = 0;
 	cb->tail = 0;
+	cb->reserve = 0;
+	cb->writers = 0;
 }
 
 cbuf_idx_t cbuf_elems_used(cbuf_s * const cb){
@@ -31,7 +34,7 @@ cbuf_idx_t cbuf_elems_free(cbuf_s * const cb){
 		return elems_free;
 	}
 
-	ATOMIC(elems_free = cb->elems - ((cb->head - cb->tail + cb->elems) % cb->elems) - 1);
+	ATOMIC(elems_free = cb->elems - ((cb->reserve - cb->tail + cb->elems) % cb->elems) - 1);
 
 	return elems_free;
 }
@@ -43,6 +46,7 @@ void cbuf_flush(cbuf_s * const cb){
 	ATOMIC(				\
 		cb->head = 0; 	\
 		cb->tail = 0; 	\
+		cb->reserve = 0;	\
 	);
 }
 
@@ -52,11 +56,14 @@ bool cbuf_write(cbuf_s * const cb, cbuf_elem_t const data){
 		return retval;
 	}
 
-	// If buffer is not full, write data to it
+	// If buffer is not full, write data to it. It is readable at once unless a block write is still copying.
 	ATOMIC(												\
-		if((cb->head + 1) % cb->elems != cb->tail){		\
-			cb->buf[cb->head] = data;					\
-			cb->head = (cb->head + 1) % cb->elems;		\
+		if((cb->reserve + 1) % cb->elems != cb->tail){	\
+			cb->buf[cb->reserve] = data;				\
+			cb->reserve = (cb->reserve + 1) % cb->elems;	\
+			if(cb->writers == 0){						\
+				cb->head = cb->reserve;					\
+			}											\
 			retval = true;								\
 		}												\
 	);
@@ -99,3 +106,58 @@ bool cbuf_peek(cbuf_s * const cb, cbuf_elem_t * const data){
 	return retval;
 }
 
+cbuf_idx_t cbuf_write_block(cbuf_s * const cb, const cbuf_elem_t * data, const cbuf_idx_t len){
+	cbuf_idx_t written = 0;
+	cbuf_idx_t start = 0;
+	if(cb == NULL || data == NULL){
+		return written;
+	}
+
+	//Reserve the space, so that other writers continue after it while it is filled
+	ATOMIC(																	\
+		const cbuf_idx_t avail = cb->elems - ((cb->reserve - cb->tail + cb->elems) % cb->elems) - 1;	\
+		written = MIN(len, avail);											\
+		start = cb->reserve;												\
+		cb->reserve = (start + written) % cb->elems;						\
+		cb->writers++;														\
+	);
+
+	//Copy as (at most) two contiguous pieces, up to the end of the pool and from its start
+	const cbuf_idx_t first = MIN(written, cb->elems - start);
+	memcpy(&cb->buf[start], data, first * sizeof(cbuf_elem_t));
+	memcpy(cb->buf, &data[first], (written - first) * sizeof(cbuf_elem_t));
+
+	//The last writer to finish publishes all reservations, its own and those made meanwhile
+	ATOMIC(									\
+		if(--cb->writers == 0){				\
+			cb->head = cb->reserve;			\
+		}									\
+	);
+
+	return written;
+}
+
+cbuf_idx_t cbuf_read_span(cbuf_s * const cb, const cbuf_elem_t ** const span){
+	cbuf_idx_t len = 0;
+	if(cb == NULL || span == NULL){
+		return len;
+	}
+
+	ATOMIC(												\
+		*span = &cb->buf[cb->tail];						\
+		if(cb->head >= cb->tail){						\
+			len = cb->head - cb->tail;					\
+		}else{											\
+			len = cb->elems - cb->tail;					\
+		}												\
+	);
+
+	return len;
+}
+
+void cbuf_read_commit(cbuf_s * const cb, const cbuf_idx_t len){
+	if(cb == NULL){
+		return;
+	}
+	ATOMIC(cb->tail = (cb->tail + len) % cb->elems);
+}
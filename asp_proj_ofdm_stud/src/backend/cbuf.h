@@ -19,6 +19,8 @@ typedef struct {
 	cbuf_idx_t	head;	//!<- Index of last element that has been written to
 	cbuf_idx_t	tail;	//!<- Index of last element that has been read from
 	cbuf_idx_t	elems;	//!<- Total number of elements in buffer
+	cbuf_idx_t	reserve;	//!<- Index of last element reserved for writing, ahead of head while a block is copied in
+	cbuf_idx_t	writers;	//!<- Number of block writes still copying into their reservation
 } cbuf_s;
 
 /** @brief Initialize a buffer
@@ -52,4 +54,21 @@ bool cbuf_read(cbuf_s * const cb, cbuf_elem_t * const data);
  * @return True on read success, false otherwise */
 bool cbuf_peek(cbuf_s * const cb, cbuf_elem_t * const data);
 
+/** @brief Writes up to len elements from data to a buffer cb, as far as space is available.
+ * The space is reserved with interrupts disabled, but the data is copied with
+ * interrupts enabled. The elements become readable once no block write into
+ * the buffer is still copying.
+ * @return The number of elements written */
+cbuf_idx_t cbuf_write_block(cbuf_s * const cb, const cbuf_elem_t * data, const cbuf_idx_t len);
+
+/** @brief Gets the largest contiguous span of unread elements in a buffer cb,
+ * starting at the oldest element. The elements stay in the buffer until
+ * removed by cbuf_read_commit, so they may for example be read by a DMA
+ * transfer in the meantime.
+ * @return The number of elements in span */
+cbuf_idx_t cbuf_read_span(cbuf_s * const cb, const cbuf_elem_t ** const span);
+
+/** @brief Removes len elements previously read through cbuf_read_span from a buffer cb */
+void cbuf_read_commit(cbuf_s * const cb, const cbuf_idx_t len);
+
 #endif /* CBUF_H_ */
@@ -0,0 +1,101 @@
+#include "dlog.h"
+#include <string.h>
+#include "../../macro.h"
+#include "../spsc.h"
+#include "../serframe/serframe.h"
+#include "../systime/systime.h"
+#include "../hw/board.h"
+
+/** @brief Ring elements of the header of a message; format identifier, length, timestamp */
+#define DLOG_HEADER_ELEMS	(4)
+
+/** @brief Largest number of ring elements of a message */
+#define DLOG_ENTRY_ELEMS	(DLOG_HEADER_ELEMS + DLOG_MAX_ARGS * (1 + DLOG_STRING_MAX / 2))
+
+/** @brief Start of the section holding the format strings, defined by the linker */
+extern const char __start_dlog_fmt[];
+
+/** @brief Format of the message announcing dropped messages. Also ensures
+ * that the section exists when no other message is logged. */
+static const char dlog_dropped_fmt[] __attribute__((section("dlog_fmt"), used)) = "[%lu log messages dropped]\n";
+
+/** @brief The ring of messages, written by dlog_write and read by dlog_poll.
+ * Every message is stored as the format identifier, the number of elements
+ * following these first two, the timestamp and the arguments, all in the
+ * byte order of the frame payload. */
+static spsc_s dlog_ring;
+static spsc_elem_t dlog_ring_pool[DLOG_RING_LEN];
+
+static uint_fast32_t dlog_drops = 0;
+static uint_fast32_t dlog_drops_queued = 0;		//!<- Dropped messages already announced in the ring
+
+void dlog_init(void){
+	BUILD_BUG_ON(!ISPOW2(DLOG_RING_LEN));
+	BUILD_BUG_ON(DLOG_RING_LEN < DLOG_ENTRY_ELEMS);
+	BUILD_BUG_ON(DLOG_STRING_MAX % 2 != 0);
+	spsc_new(&dlog_ring, dlog_ring_pool, NUMEL(dlog_ring_pool));
+}
+
+uint_fast32_t dlog_dropped(void){
+	return dlog_drops;
+}
+
+void dlog_write(const char * fmt, const uint_fast8_t nargs, const uint_fast8_t strings, const uintptr_t * args){
+	spsc_elem_t entry[DLOG_ENTRY_ELEMS];
+	const uint32_t stamp = systime_get();
+	uint_fast32_t n = DLOG_HEADER_ELEMS;
+	uint_fast8_t i;
+	entry[0] = fmt - __start_dlog_fmt;
+	entry[2] = stamp & 0xFFFF;
+	entry[3] = stamp >> 16;
+	for(i = 0; i < nargs; i++){
+		if(strings & (1 << i)){
+			const char * const s = (const char *) args[i];
+			const uint_fast32_t len = strnlen(s, DLOG_STRING_MAX);
+			entry[n++] = len;
+			if(len & 1){
+				//Pad with a zero character to a whole element
+				entry[n + len / 2] = 0;
+			}
+			memcpy(&entry[n], s, len);
+			n += (len + 1) / 2;
+		}else{
+			entry[n++] = args[i] & 0xFFFF;
+			entry[n++] = (args[i] >> 16) & 0xFFFF;
+		}
+	}
+	entry[1] = n - 2;
+	//Announce dropped messages where they were lost, ahead of the next message that fits
+	const uint_fast32_t dropped = dlog_drops - dlog_drops_queued;
+	if(spsc_elems_free(&dlog_ring) < n + (dropped > 0 ? DLOG_HEADER_ELEMS + 2 : 0)){
+		dlog_drops++;
+		return;
+	}
+	if(dropped > 0){
+		const spsc_elem_t notice[DLOG_HEADER_ELEMS + 2] = {
+				dlog_dropped_fmt - __start_dlog_fmt, DLOG_HEADER_ELEMS, entry[2], entry[3],
+				dropped & 0xFFFF, (dropped >> 16) & 0xFFFF};
+		spsc_write_block(&dlog_ring, notice, NUMEL(notice));
+		dlog_drops_queued += dropped;
+	}
+	spsc_write_block(&dlog_ring, entry, n);
+}
+
+void dlog_poll(void){
+	struct serframe_s f;
+	spsc_elem_t entry[DLOG_ENTRY_ELEMS];
+	spsc_elem_t len;
+	while(spsc_peek(&dlog_ring, 1, &len)){
+		if(spsc_elems_used(&dlog_ring) < 2 + (spsc_idx_t) len ||
+				board_usart_tx_free() < SERFRAME_OVERHEAD + 2*(uint_fast32_t) len + 2){
+			return;
+		}
+		spsc_read_block(&dlog_ring, entry, 2 + len);
+		//The payload is the timestamp, the format identifier and the arguments
+		serframe_begin(&f, serframe_type_log, 2*len + 2);
+		serframe_write(&f, &entry[2], 4);
+		serframe_write(&f, &entry[0], 2);
+		serframe_write(&f, &entry[DLOG_HEADER_ELEMS], 2*(len + 2 - DLOG_HEADER_ELEMS));
+		serframe_end(&f);
+	}
+}
@@ -0,0 +1,132 @@
+/** @file Deferred printf formatting.
+ * Formatting with printf costs thousands of cycles per call, mostly for
+ * floating point conversions, which is a poor fit for the audio callback.
+ * DLOG takes the same arguments as printf, but only records an identifier of
+ * the format string and the raw argument values in a lock-free ring; the text
+ * is formatted on the PC. The ring is drained from main_idle, one serframe
+ * frame (see backend/serframe/serframe.h) per message, and
+ * tools/dlog_decode.py expands the messages with the format strings it reads
+ * from the firmware ELF file:
+ *
+ *	DLOG("RMSE %f in band %d\n", err_norm, band);
+ *
+ * The format string must be a string literal. It is placed in the "dlog_fmt"
+ * section, kept in flash by dlog_fmt.ld, and its offset into that section is
+ * its identifier. Arguments are sent as 32-bit values; floating point values
+ * in single precision, 64-bit integers truncated. Strings passed as char
+ * pointers are copied into the ring, at most DLOG_STRING_MAX characters each.
+ * Other pointers are sent as addresses and only suit %p. At most DLOG_MAX_ARGS arguments are supported,
+ * and '*' field widths are not. Messages are dropped, and counted, when the
+ * ring is full; the PC is told how many before the next message is sent.
+ *
+ * Frame payload:	timestamp [us] (4), format identifier (2), arguments
+ *
+ * Numeric arguments take 4 bytes each, strings 2 bytes of length followed by
+ * the characters padded to an even length. Dropped messages are announced
+ * by a message of their own, so a decoder needs no special cases. The dlog_fmt
+ * section must stay below 64 KiB, as identifiers are 16-bit.
+ *
+ * With DLOG_DEFERRED set to 0, DLOG simply calls printf, so that the output
+ * can be read with any terminal program. DLOG must be called from a single
+ * non-interrupt context, like printf. */
+
+#ifndef DLOG_H_
+#define DLOG_H_
+
+#include <stdint.h>
+#include "../../config.h"
+#include "../printfn/printfn.h"
+
+/** @brief Maximum number of arguments of a message */
+#define DLOG_MAX_ARGS		(6)
+
+/** @brief Maximum number of characters copied per string argument */
+#define DLOG_STRING_MAX		(64)
+
+/** @brief Initializes the ring. Called once by main before any message. */
+void dlog_init(void);
+
+/** @brief Sends the queued messages as room in the USART transmit buffer permits. Called from main_idle. */
+void dlog_poll(void);
+
+/** @brief Returns the number of messages dropped since startup */
+uint_fast32_t dlog_dropped(void);
+
+/** @brief Queues a message, use DLOG instead
+ * @param fmt		The format string, in the dlog_fmt section
+ * @param nargs		The number of arguments
+ * @param strings	Bit i set if argument i is a string
+ * @param args		The arguments, see DLOG_ARG_ */
+void dlog_write(const char * fmt, const uint_fast8_t nargs, const uint_fast8_t strings, const uintptr_t * args);
+
+/** @brief Converts arguments to the values passed to dlog_write */
+static inline uintptr_t dlog_arg_f(const float x){
+	union {float f; uint32_t u;} v = {.f = x};
+	return v.u;
+}
+
+static inline uintptr_t dlog_arg_i(const uint32_t x){
+	return x;
+}
+
+static inline uintptr_t dlog_arg_p(const volatile void * x){
+	return (uintptr_t) x;
+}
+
+/** @brief Selects the conversion by the type of the argument. The integer
+ * types are listed, so that any pointer takes the default. */
+#define DLOG_ARG_(x)	_Generic((x),			\
+		float: dlog_arg_f,						\
+		double: dlog_arg_f,						\
+		_Bool: dlog_arg_i,						\
+		char: dlog_arg_i,						\
+		signed char: dlog_arg_i,				\
+		unsigned char: dlog_arg_i,				\
+		short: dlog_arg_i,						\
+		unsigned short: dlog_arg_i,				\
+		int: dlog_arg_i,						\
+		unsigned int: dlog_arg_i,				\
+		long: dlog_arg_i,						\
+		unsigned long: dlog_arg_i,				\
+		long long: dlog_arg_i,					\
+		unsigned long long: dlog_arg_i,			\
+		default: dlog_arg_p)(x)
+
+/** @brief Evaluates as 1 for string arguments, which are copied into the ring */
+#define DLOG_STR_(x)	_Generic((x), char *: 1, const char *: 1, default: 0)
+
+/** @brief Places the format string in the dlog_fmt section and queues the message */
+#define DLOG_WRITE_(fmt, nargs, strings, ...)	do{											\
+		static const char dlog_fmt_[] __attribute__((section("dlog_fmt"), used)) = fmt;		\
+		dlog_write(dlog_fmt_, nargs, strings, (const uintptr_t []){__VA_ARGS__});			\
+	}while(0)
+
+#define DLOG_0_(fmt)						DLOG_WRITE_(fmt, 0, 0, 0)
+#define DLOG_1_(fmt, a)						DLOG_WRITE_(fmt, 1, DLOG_STR_(a),				\
+		DLOG_ARG_(a))
+#define DLOG_2_(fmt, a, b)					DLOG_WRITE_(fmt, 2, DLOG_STR_(a) | DLOG_STR_(b) << 1,	\
+		DLOG_ARG_(a), DLOG_ARG_(b))
+#define DLOG_3_(fmt, a, b, c)				DLOG_WRITE_(fmt, 3, DLOG_STR_(a) | DLOG_STR_(b) << 1 |	\
+		DLOG_STR_(c) << 2,																	\
+		DLOG_ARG_(a), DLOG_ARG_(b), DLOG_ARG_(c))
+#define DLOG_4_(fmt, a, b, c, d)			DLOG_WRITE_(fmt, 4, DLOG_STR_(a) | DLOG_STR_(b) << 1 |	\
+		DLOG_STR_(c) << 2 | DLOG_STR_(d) << 3,												\
+		DLOG_ARG_(a), DLOG_ARG_(b), DLOG_ARG_(c), DLOG_ARG_(d))
+#define DLOG_5_(fmt, a, b, c, d, e)			DLOG_WRITE_(fmt, 5, DLOG_STR_(a) | DLOG_STR_(b) << 1 |	\
+		DLOG_STR_(c) << 2 | DLOG_STR_(d) << 3 | DLOG_STR_(e) << 4,							\
+		DLOG_ARG_(a), DLOG_ARG_(b), DLOG_ARG_(c), DLOG_ARG_(d), DLOG_ARG_(e))
+#define DLOG_6_(fmt, a, b, c, d, e, f)		DLOG_WRITE_(fmt, 6, DLOG_STR_(a) | DLOG_STR_(b) << 1 |	\
+		DLOG_STR_(c) << 2 | DLOG_STR_(d) << 3 | DLOG_STR_(e) << 4 | DLOG_STR_(f) << 5,		\
+		DLOG_ARG_(a), DLOG_ARG_(b), DLOG_ARG_(c), DLOG_ARG_(d), DLOG_ARG_(e), DLOG_ARG_(f))
+
+/** @brief Selects the DLOG_n_ macro by the number of arguments */
+#define DLOG_SELECT_(fmt, _1, _2, _3, _4, _5, _6, m, ...)	m
+
+/** @brief Logs a message with printf syntax, see the description above */
+#if DLOG_DEFERRED
+#define DLOG(...)	DLOG_SELECT_(__VA_ARGS__, DLOG_6_, DLOG_5_, DLOG_4_, DLOG_3_, DLOG_2_, DLOG_1_, DLOG_0_, _)(__VA_ARGS__)
+#else
+#define DLOG(...)	printf(__VA_ARGS__)
+#endif
+
+#endif /* DLOG_H_ */
@@ -0,0 +1,27 @@
+#include "fft_tables.h"
+
+#ifdef ARM_FFT_TABLES_SPECIALISED
+
+#include "arm_const_structs.h"
+#include "../../macro.h"
+
+/* Generated by fft_tables.py, currently for the complex FFT length used by
+ * the OFDM project (64) and the real FFT lengths used by SYSMODE_FFT (512)
+ * and SYSMODE_TEST3 (1024) */
+#include "fft_tables_.h"
+
+/* Replaces the CMSIS-DSP version, which references the tables of every length */
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 * S, uint16_t fftLen){
+	uint_fast32_t i;
+	for(i = 0; i < NUMEL(fft_tables_rfft); i++){
+		if(fft_tables_rfft[i].len == fftLen){
+			S->Sint = *fft_tables_rfft[i].cfft;
+			S->fftLenRFFT = fftLen;
+			S->pTwiddleRFFT = (float32_t *) fft_tables_rfft[i].twiddle;
+			return ARM_MATH_SUCCESS;
+		}
+	}
+	return ARM_MATH_ARGUMENT_ERROR;
+}
+
+#endif
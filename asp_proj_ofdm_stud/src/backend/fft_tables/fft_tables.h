@@ -0,0 +1,26 @@
+/** @file Specialised CMSIS-DSP floating-point FFT tables.
+ * The vendored CMSIS-DSP library defines twiddle and bit-reversal tables for
+ * every supported FFT length. When ARM_FFT_TABLES_SPECIALISED is defined those
+ * are left out of the build, and only the tables for the lengths listed when
+ * fft_tables_.h was generated are included, see fft_tables.py. The cfft
+ * instances keep their CMSIS names, arm_cfft_sR_f32_len<N>, so using a length
+ * that was not generated gives an undefined reference when linking.
+ * The generated tables also allow complex FFT lengths up to 8192, beyond the
+ * largest length supported by CMSIS-DSP. */
+
+#ifndef FFT_TABLES_H_
+#define FFT_TABLES_H_
+
+#include "arm_math.h"
+
+/** @brief Complex FFT instance for 8192 points, only available if generated */
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len8192;
+
+/** @brief Table entry for a real FFT length */
+struct fft_tables_rfft_s {
+	uint16_t len;						//Real FFT length
+	const arm_cfft_instance_f32 * cfft;	//Complex FFT of half the length
+	const float32_t * twiddle;			//Real FFT twiddle factors
+};
+
+#endif /* FFT_TABLES_H_ */
@@ -0,0 +1,105 @@
+# Generates the CMSIS-DSP floating-point FFT tables for a selected set of
+# transform lengths, for use with ARM_FFT_TABLES_SPECIALISED, see fft_tables.h.
+#
+# Usage: python fft_tables.py <cfft lengths> <rfft lengths> > fft_tables_.h
+# where the lengths are comma-separated, for example
+#   python fft_tables.py 64,1024 512 > fft_tables_.h
+# Each real FFT of length L also brings in the complex FFT of length L/2.
+import sys
+import math
+
+CFFT_MIN_LEN = 16
+CFFT_MAX_LEN = 8192 # The bit-reversal table holds byte offsets in 16 bits
+
+def parse_lengths(arg):
+	return sorted(set([int(x) for x in arg.split(',') if x]))
+
+def radices(n):
+	# arm_cfft_f32 runs a radix-2 or radix-4 stage first when log2(n) is not a
+	# multiple of three, followed by radix-8 stages
+	bits = n.bit_length() - 1
+	return {0: [], 1: [2], 2: [4]}[bits % 3] + [8] * (bits // 3)
+
+def digit_reversal(n):
+	# Position of each output sample in the order left by the butterflies
+	rs = radices(n)
+	perm = []
+	for k in range(n):
+		p = 0
+		for r in rs:
+			p = p * r + k % r
+			k //= r
+		perm.append(p)
+	return perm
+
+def bitrev_swaps(n):
+	# Swaps, as pairs of byte offsets of complex samples, that restore the
+	# natural order when applied in sequence by arm_bitreversal_32
+	perm = digit_reversal(n)
+	cur = list(range(n))
+	pos = list(range(n))
+	swaps = []
+	for i in range(n):
+		j = pos[perm[i]]
+		if j != i:
+			swaps += [i * 8, j * 8]
+			a, b = cur[i], cur[j]
+			cur[i], cur[j] = b, a
+			pos[a], pos[b] = j, i
+	return swaps
+
+def print_list(fmt, vals, per_line):
+	for i in range(0, len(vals), per_line):
+		sys.stdout.write('\t' + ', '.join([fmt % v for v in vals[i:i + per_line]]) + ',\n')
+
+def print_cfft(n):
+	tw = []
+	for i in range(n):
+		tw += [math.cos(2 * math.pi * i / n), math.sin(2 * math.pi * i / n)]
+	swaps = bitrev_swaps(n)
+	# arm_bitreversal_32 in arm_bitreversal2.S runs (len+1)>>2 iterations of
+	# two swaps each, so the last swap of a table whose length is 2 modulo 4
+	# would be skipped on the target while the C version applies it
+	assert len(swaps) % 4 == 0, 'bit-reversal table of length %d for a %d-point FFT' % (len(swaps), n)
+	sys.stdout.write('static const float32_t fft_tables_twiddle_%d[%d] = {\n' % (n, len(tw)))
+	print_list('%.9ef', tw, 4)
+	sys.stdout.write('};\n')
+	sys.stdout.write('static const uint16_t fft_tables_bitrev_%d[%d] = {\n' % (n, len(swaps)))
+	print_list('%d', swaps, 12)
+	sys.stdout.write('};\n')
+	sys.stdout.write('const arm_cfft_instance_f32 arm_cfft_sR_f32_len%d = {\n' % n)
+	sys.stdout.write('\t%d, fft_tables_twiddle_%d, fft_tables_bitrev_%d, %d\n' % (n, n, n, len(swaps)))
+	sys.stdout.write('};\n\n')
+
+def print_rfft(n):
+	tw = []
+	for i in range(n // 2):
+		tw += [math.sin(2 * math.pi * i / n), math.cos(2 * math.pi * i / n)]
+	sys.stdout.write('static const float32_t fft_tables_twiddle_rfft_%d[%d] = {\n' % (n, len(tw)))
+	print_list('%.9ef', tw, 4)
+	sys.stdout.write('};\n\n')
+
+def main():
+	if len(sys.argv) != 3:
+		sys.stderr.write('usage: %s <cfft lengths> <rfft lengths>\n' % sys.argv[0])
+		sys.exit(1)
+	cfft = parse_lengths(sys.argv[1])
+	rfft = parse_lengths(sys.argv[2])
+	for n in cfft + [r // 2 for r in rfft]:
+		if n & (n - 1) or n < CFFT_MIN_LEN or n > CFFT_MAX_LEN:
+			sys.stderr.write('unsupported complex FFT length %d\n' % n)
+			sys.exit(1)
+	cfft = sorted(set(cfft + [r // 2 for r in rfft]))
+
+	sys.stdout.write('/* Generated by fft_tables.py %s %s */\n' % (sys.argv[1], sys.argv[2]))
+	for n in cfft:
+		print_cfft(n)
+	for n in rfft:
+		print_rfft(n)
+	sys.stdout.write('static const struct fft_tables_rfft_s fft_tables_rfft[] = {\n')
+	for n in rfft:
+		sys.stdout.write('\t{%d, &arm_cfft_sR_f32_len%d, fft_tables_twiddle_rfft_%d},\n' % (n, n // 2, n))
+	sys.stdout.write('};\n')
+
+if __name__ == '__main__':
+	main()
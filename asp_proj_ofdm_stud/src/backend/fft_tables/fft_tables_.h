@@ -0,0 +1,915 @@
+/* Generated by fft_tables.py 64 512,1024 */
+static const float32_t fft_tables_twiddle_64[128] = {
+	1.000000000e+00f, 0.000000000e+00f, 9.951847267e-01f, 9.801714033e-02f,
+	9.807852804e-01f, 1.950903220e-01f, 9.569403357e-01f, 2.902846773e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 8.819212643e-01f, 4.713967368e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 7.730104534e-01f, 6.343932842e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 6.343932842e-01f, 7.730104534e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 4.713967368e-01f, 8.819212643e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 2.902846773e-01f, 9.569403357e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 9.801714033e-02f, 9.951847267e-01f,
+	6.123233996e-17f, 1.000000000e+00f, -9.801714033e-02f, 9.951847267e-01f,
+	-1.950903220e-01f, 9.807852804e-01f, -2.902846773e-01f, 9.569403357e-01f,
+	-3.826834324e-01f, 9.238795325e-01f, -4.713967368e-01f, 8.819212643e-01f,
+	-5.555702330e-01f, 8.314696123e-01f, -6.343932842e-01f, 7.730104534e-01f,
+	-7.071067812e-01f, 7.071067812e-01f, -7.730104534e-01f, 6.343932842e-01f,
+	-8.314696123e-01f, 5.555702330e-01f, -8.819212643e-01f, 4.713967368e-01f,
+	-9.238795325e-01f, 3.826834324e-01f, -9.569403357e-01f, 2.902846773e-01f,
+	-9.807852804e-01f, 1.950903220e-01f, -9.951847267e-01f, 9.801714033e-02f,
+	-1.000000000e+00f, 1.224646799e-16f, -9.951847267e-01f, -9.801714033e-02f,
+	-9.807852804e-01f, -1.950903220e-01f, -9.569403357e-01f, -2.902846773e-01f,
+	-9.238795325e-01f, -3.826834324e-01f, -8.819212643e-01f, -4.713967368e-01f,
+	-8.314696123e-01f, -5.555702330e-01f, -7.730104534e-01f, -6.343932842e-01f,
+	-7.071067812e-01f, -7.071067812e-01f, -6.343932842e-01f, -7.730104534e-01f,
+	-5.555702330e-01f, -8.314696123e-01f, -4.713967368e-01f, -8.819212643e-01f,
+	-3.826834324e-01f, -9.238795325e-01f, -2.902846773e-01f, -9.569403357e-01f,
+	-1.950903220e-01f, -9.807852804e-01f, -9.801714033e-02f, -9.951847267e-01f,
+	-1.836970199e-16f, -1.000000000e+00f, 9.801714033e-02f, -9.951847267e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 2.902846773e-01f, -9.569403357e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 4.713967368e-01f, -8.819212643e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 6.343932842e-01f, -7.730104534e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 7.730104534e-01f, -6.343932842e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.819212643e-01f, -4.713967368e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.569403357e-01f, -2.902846773e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.951847267e-01f, -9.801714033e-02f,
+};
+static const uint16_t fft_tables_bitrev_64[56] = {
+	8, 64, 16, 128, 24, 192, 32, 256, 40, 320, 48, 384,
+	56, 448, 80, 136, 88, 200, 96, 264, 104, 328, 112, 392,
+	120, 456, 152, 208, 160, 272, 168, 336, 176, 400, 184, 464,
+	224, 280, 232, 344, 240, 408, 248, 472, 296, 352, 304, 416,
+	312, 480, 368, 424, 376, 488, 440, 496,
+};
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len64 = {
+	64, fft_tables_twiddle_64, fft_tables_bitrev_64, 56
+};
+
+static const float32_t fft_tables_twiddle_256[512] = {
+	1.000000000e+00f, 0.000000000e+00f, 9.996988187e-01f, 2.454122852e-02f,
+	9.987954562e-01f, 4.906767433e-02f, 9.972904567e-01f, 7.356456360e-02f,
+	9.951847267e-01f, 9.801714033e-02f, 9.924795346e-01f, 1.224106752e-01f,
+	9.891765100e-01f, 1.467304745e-01f, 9.852776424e-01f, 1.709618888e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.757021300e-01f, 2.191012402e-01f,
+	9.700312532e-01f, 2.429801799e-01f, 9.637760658e-01f, 2.667127575e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.495281806e-01f, 3.136817404e-01f,
+	9.415440652e-01f, 3.368898534e-01f, 9.329927988e-01f, 3.598950365e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.142097557e-01f, 4.052413140e-01f,
+	9.039892931e-01f, 4.275550934e-01f, 8.932243012e-01f, 4.496113297e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.700869911e-01f, 4.928981922e-01f,
+	8.577286100e-01f, 5.141027442e-01f, 8.448535652e-01f, 5.349976199e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.175848132e-01f, 5.758081914e-01f,
+	8.032075315e-01f, 5.956993045e-01f, 7.883464276e-01f, 6.152315906e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.572088465e-01f, 6.531728430e-01f,
+	7.409511254e-01f, 6.715589548e-01f, 7.242470830e-01f, 6.895405447e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 6.895405447e-01f, 7.242470830e-01f,
+	6.715589548e-01f, 7.409511254e-01f, 6.531728430e-01f, 7.572088465e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 6.152315906e-01f, 7.883464276e-01f,
+	5.956993045e-01f, 8.032075315e-01f, 5.758081914e-01f, 8.175848132e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.349976199e-01f, 8.448535652e-01f,
+	5.141027442e-01f, 8.577286100e-01f, 4.928981922e-01f, 8.700869911e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.496113297e-01f, 8.932243012e-01f,
+	4.275550934e-01f, 9.039892931e-01f, 4.052413140e-01f, 9.142097557e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 3.598950365e-01f, 9.329927988e-01f,
+	3.368898534e-01f, 9.415440652e-01f, 3.136817404e-01f, 9.495281806e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 2.667127575e-01f, 9.637760658e-01f,
+	2.429801799e-01f, 9.700312532e-01f, 2.191012402e-01f, 9.757021300e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 1.709618888e-01f, 9.852776424e-01f,
+	1.467304745e-01f, 9.891765100e-01f, 1.224106752e-01f, 9.924795346e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 7.356456360e-02f, 9.972904567e-01f,
+	4.906767433e-02f, 9.987954562e-01f, 2.454122852e-02f, 9.996988187e-01f,
+	6.123233996e-17f, 1.000000000e+00f, -2.454122852e-02f, 9.996988187e-01f,
+	-4.906767433e-02f, 9.987954562e-01f, -7.356456360e-02f, 9.972904567e-01f,
+	-9.801714033e-02f, 9.951847267e-01f, -1.224106752e-01f, 9.924795346e-01f,
+	-1.467304745e-01f, 9.891765100e-01f, -1.709618888e-01f, 9.852776424e-01f,
+	-1.950903220e-01f, 9.807852804e-01f, -2.191012402e-01f, 9.757021300e-01f,
+	-2.429801799e-01f, 9.700312532e-01f, -2.667127575e-01f, 9.637760658e-01f,
+	-2.902846773e-01f, 9.569403357e-01f, -3.136817404e-01f, 9.495281806e-01f,
+	-3.368898534e-01f, 9.415440652e-01f, -3.598950365e-01f, 9.329927988e-01f,
+	-3.826834324e-01f, 9.238795325e-01f, -4.052413140e-01f, 9.142097557e-01f,
+	-4.275550934e-01f, 9.039892931e-01f, -4.496113297e-01f, 8.932243012e-01f,
+	-4.713967368e-01f, 8.819212643e-01f, -4.928981922e-01f, 8.700869911e-01f,
+	-5.141027442e-01f, 8.577286100e-01f, -5.349976199e-01f, 8.448535652e-01f,
+	-5.555702330e-01f, 8.314696123e-01f, -5.758081914e-01f, 8.175848132e-01f,
+	-5.956993045e-01f, 8.032075315e-01f, -6.152315906e-01f, 7.883464276e-01f,
+	-6.343932842e-01f, 7.730104534e-01f, -6.531728430e-01f, 7.572088465e-01f,
+	-6.715589548e-01f, 7.409511254e-01f, -6.895405447e-01f, 7.242470830e-01f,
+	-7.071067812e-01f, 7.071067812e-01f, -7.242470830e-01f, 6.895405447e-01f,
+	-7.409511254e-01f, 6.715589548e-01f, -7.572088465e-01f, 6.531728430e-01f,
+	-7.730104534e-01f, 6.343932842e-01f, -7.883464276e-01f, 6.152315906e-01f,
+	-8.032075315e-01f, 5.956993045e-01f, -8.175848132e-01f, 5.758081914e-01f,
+	-8.314696123e-01f, 5.555702330e-01f, -8.448535652e-01f, 5.349976199e-01f,
+	-8.577286100e-01f, 5.141027442e-01f, -8.700869911e-01f, 4.928981922e-01f,
+	-8.819212643e-01f, 4.713967368e-01f, -8.932243012e-01f, 4.496113297e-01f,
+	-9.039892931e-01f, 4.275550934e-01f, -9.142097557e-01f, 4.052413140e-01f,
+	-9.238795325e-01f, 3.826834324e-01f, -9.329927988e-01f, 3.598950365e-01f,
+	-9.415440652e-01f, 3.368898534e-01f, -9.495281806e-01f, 3.136817404e-01f,
+	-9.569403357e-01f, 2.902846773e-01f, -9.637760658e-01f, 2.667127575e-01f,
+	-9.700312532e-01f, 2.429801799e-01f, -9.757021300e-01f, 2.191012402e-01f,
+	-9.807852804e-01f, 1.950903220e-01f, -9.852776424e-01f, 1.709618888e-01f,
+	-9.891765100e-01f, 1.467304745e-01f, -9.924795346e-01f, 1.224106752e-01f,
+	-9.951847267e-01f, 9.801714033e-02f, -9.972904567e-01f, 7.356456360e-02f,
+	-9.987954562e-01f, 4.906767433e-02f, -9.996988187e-01f, 2.454122852e-02f,
+	-1.000000000e+00f, 1.224646799e-16f, -9.996988187e-01f, -2.454122852e-02f,
+	-9.987954562e-01f, -4.906767433e-02f, -9.972904567e-01f, -7.356456360e-02f,
+	-9.951847267e-01f, -9.801714033e-02f, -9.924795346e-01f, -1.224106752e-01f,
+	-9.891765100e-01f, -1.467304745e-01f, -9.852776424e-01f, -1.709618888e-01f,
+	-9.807852804e-01f, -1.950903220e-01f, -9.757021300e-01f, -2.191012402e-01f,
+	-9.700312532e-01f, -2.429801799e-01f, -9.637760658e-01f, -2.667127575e-01f,
+	-9.569403357e-01f, -2.902846773e-01f, -9.495281806e-01f, -3.136817404e-01f,
+	-9.415440652e-01f, -3.368898534e-01f, -9.329927988e-01f, -3.598950365e-01f,
+	-9.238795325e-01f, -3.826834324e-01f, -9.142097557e-01f, -4.052413140e-01f,
+	-9.039892931e-01f, -4.275550934e-01f, -8.932243012e-01f, -4.496113297e-01f,
+	-8.819212643e-01f, -4.713967368e-01f, -8.700869911e-01f, -4.928981922e-01f,
+	-8.577286100e-01f, -5.141027442e-01f, -8.448535652e-01f, -5.349976199e-01f,
+	-8.314696123e-01f, -5.555702330e-01f, -8.175848132e-01f, -5.758081914e-01f,
+	-8.032075315e-01f, -5.956993045e-01f, -7.883464276e-01f, -6.152315906e-01f,
+	-7.730104534e-01f, -6.343932842e-01f, -7.572088465e-01f, -6.531728430e-01f,
+	-7.409511254e-01f, -6.715589548e-01f, -7.242470830e-01f, -6.895405447e-01f,
+	-7.071067812e-01f, -7.071067812e-01f, -6.895405447e-01f, -7.242470830e-01f,
+	-6.715589548e-01f, -7.409511254e-01f, -6.531728430e-01f, -7.572088465e-01f,
+	-6.343932842e-01f, -7.730104534e-01f, -6.152315906e-01f, -7.883464276e-01f,
+	-5.956993045e-01f, -8.032075315e-01f, -5.758081914e-01f, -8.175848132e-01f,
+	-5.555702330e-01f, -8.314696123e-01f, -5.349976199e-01f, -8.448535652e-01f,
+	-5.141027442e-01f, -8.577286100e-01f, -4.928981922e-01f, -8.700869911e-01f,
+	-4.713967368e-01f, -8.819212643e-01f, -4.496113297e-01f, -8.932243012e-01f,
+	-4.275550934e-01f, -9.039892931e-01f, -4.052413140e-01f, -9.142097557e-01f,
+	-3.826834324e-01f, -9.238795325e-01f, -3.598950365e-01f, -9.329927988e-01f,
+	-3.368898534e-01f, -9.415440652e-01f, -3.136817404e-01f, -9.495281806e-01f,
+	-2.902846773e-01f, -9.569403357e-01f, -2.667127575e-01f, -9.637760658e-01f,
+	-2.429801799e-01f, -9.700312532e-01f, -2.191012402e-01f, -9.757021300e-01f,
+	-1.950903220e-01f, -9.807852804e-01f, -1.709618888e-01f, -9.852776424e-01f,
+	-1.467304745e-01f, -9.891765100e-01f, -1.224106752e-01f, -9.924795346e-01f,
+	-9.801714033e-02f, -9.951847267e-01f, -7.356456360e-02f, -9.972904567e-01f,
+	-4.906767433e-02f, -9.987954562e-01f, -2.454122852e-02f, -9.996988187e-01f,
+	-1.836970199e-16f, -1.000000000e+00f, 2.454122852e-02f, -9.996988187e-01f,
+	4.906767433e-02f, -9.987954562e-01f, 7.356456360e-02f, -9.972904567e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 1.224106752e-01f, -9.924795346e-01f,
+	1.467304745e-01f, -9.891765100e-01f, 1.709618888e-01f, -9.852776424e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 2.191012402e-01f, -9.757021300e-01f,
+	2.429801799e-01f, -9.700312532e-01f, 2.667127575e-01f, -9.637760658e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 3.136817404e-01f, -9.495281806e-01f,
+	3.368898534e-01f, -9.415440652e-01f, 3.598950365e-01f, -9.329927988e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 4.052413140e-01f, -9.142097557e-01f,
+	4.275550934e-01f, -9.039892931e-01f, 4.496113297e-01f, -8.932243012e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 4.928981922e-01f, -8.700869911e-01f,
+	5.141027442e-01f, -8.577286100e-01f, 5.349976199e-01f, -8.448535652e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.758081914e-01f, -8.175848132e-01f,
+	5.956993045e-01f, -8.032075315e-01f, 6.152315906e-01f, -7.883464276e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.531728430e-01f, -7.572088465e-01f,
+	6.715589548e-01f, -7.409511254e-01f, 6.895405447e-01f, -7.242470830e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 7.242470830e-01f, -6.895405447e-01f,
+	7.409511254e-01f, -6.715589548e-01f, 7.572088465e-01f, -6.531728430e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 7.883464276e-01f, -6.152315906e-01f,
+	8.032075315e-01f, -5.956993045e-01f, 8.175848132e-01f, -5.758081914e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.448535652e-01f, -5.349976199e-01f,
+	8.577286100e-01f, -5.141027442e-01f, 8.700869911e-01f, -4.928981922e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 8.932243012e-01f, -4.496113297e-01f,
+	9.039892931e-01f, -4.275550934e-01f, 9.142097557e-01f, -4.052413140e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.329927988e-01f, -3.598950365e-01f,
+	9.415440652e-01f, -3.368898534e-01f, 9.495281806e-01f, -3.136817404e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.637760658e-01f, -2.667127575e-01f,
+	9.700312532e-01f, -2.429801799e-01f, 9.757021300e-01f, -2.191012402e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.852776424e-01f, -1.709618888e-01f,
+	9.891765100e-01f, -1.467304745e-01f, 9.924795346e-01f, -1.224106752e-01f,
+	9.951847267e-01f, -9.801714033e-02f, 9.972904567e-01f, -7.356456360e-02f,
+	9.987954562e-01f, -4.906767433e-02f, 9.996988187e-01f, -2.454122852e-02f,
+};
+static const uint16_t fft_tables_bitrev_256[440] = {
+	8, 512, 16, 1024, 24, 1536, 32, 64, 40, 576, 48, 1088,
+	56, 1600, 64, 128, 72, 640, 80, 1152, 88, 1664, 96, 192,
+	104, 704, 112, 1216, 120, 1728, 128, 256, 136, 768, 144, 1280,
+	152, 1792, 160, 320, 168, 832, 176, 1344, 184, 1856, 192, 384,
+	200, 896, 208, 1408, 216, 1920, 224, 448, 232, 960, 240, 1472,
+	248, 1984, 256, 512, 264, 520, 272, 1032, 280, 1544, 288, 640,
+	296, 584, 304, 1096, 312, 1608, 320, 768, 328, 648, 336, 1160,
+	344, 1672, 352, 896, 360, 712, 368, 1224, 376, 1736, 384, 520,
+	392, 776, 400, 1288, 408, 1800, 416, 648, 424, 840, 432, 1352,
+	440, 1864, 448, 776, 456, 904, 464, 1416, 472, 1928, 480, 904,
+	488, 968, 496, 1480, 504, 1992, 512, 1024, 520, 528, 528, 1040,
+	536, 1552, 544, 1152, 552, 592, 560, 1104, 568, 1616, 576, 1280,
+	584, 656, 592, 1168, 600, 1680, 608, 1408, 616, 720, 624, 1232,
+	632, 1744, 640, 1032, 648, 784, 656, 1296, 664, 1808, 672, 1160,
+	680, 848, 688, 1360, 696, 1872, 704, 1288, 712, 912, 720, 1424,
+	728, 1936, 736, 1416, 744, 976, 752, 1488, 760, 2000, 768, 1536,
+	776, 1552, 784, 1048, 792, 1560, 800, 1664, 808, 1680, 816, 1112,
+	824, 1624, 832, 1792, 840, 1808, 848, 1176, 856, 1688, 864, 1920,
+	872, 1936, 880, 1240, 888, 1752, 896, 1544, 904, 1560, 912, 1304,
+	920, 1816, 928, 1672, 936, 1688, 944, 1368, 952, 1880, 960, 1800,
+	968, 1816, 976, 1432, 984, 1944, 992, 1928, 1000, 1944, 1008, 1496,
+	1016, 2008, 1032, 1152, 1040, 1056, 1048, 1568, 1064, 1408, 1072, 1120,
+	1080, 1632, 1088, 1536, 1096, 1160, 1104, 1184, 1112, 1696, 1120, 1552,
+	1128, 1416, 1136, 1248, 1144, 1760, 1160, 1664, 1168, 1312, 1176, 1824,
+	1184, 1544, 1192, 1920, 1200, 1376, 1208, 1888, 1216, 1568, 1224, 1672,
+	1232, 1440, 1240, 1952, 1248, 1560, 1256, 1928, 1264, 1504, 1272, 2016,
+	1288, 1312, 1296, 1408, 1304, 1576, 1320, 1424, 1328, 1416, 1336, 1640,
+	1344, 1792, 1352, 1824, 1360, 1920, 1368, 1704, 1376, 1800, 1384, 1432,
+	1392, 1928, 1400, 1768, 1416, 1680, 1432, 1832, 1440, 1576, 1448, 1936,
+	1456, 1832, 1464, 1896, 1472, 1808, 1480, 1688, 1488, 1936, 1496, 1960,
+	1504, 1816, 1512, 1944, 1520, 1944, 1528, 2024, 1560, 1584, 1592, 1648,
+	1600, 1792, 1608, 1920, 1616, 1800, 1624, 1712, 1632, 1808, 1640, 1936,
+	1648, 1816, 1656, 1776, 1672, 1696, 1688, 1840, 1704, 1952, 1712, 1928,
+	1720, 1904, 1728, 1824, 1736, 1952, 1744, 1832, 1752, 1968, 1760, 1840,
+	1768, 1960, 1776, 1944, 1784, 2032, 1848, 1944, 1864, 1872, 1872, 1888,
+	1880, 1904, 1888, 1984, 1896, 2000, 1904, 2016, 1912, 2032, 1960, 1968,
+	1976, 2032, 1992, 2016, 2008, 2032, 2024, 2032,
+};
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len256 = {
+	256, fft_tables_twiddle_256, fft_tables_bitrev_256, 440
+};
+
+static const float32_t fft_tables_twiddle_512[1024] = {
+	1.000000000e+00f, 0.000000000e+00f, 9.999247018e-01f, 1.227153829e-02f,
+	9.996988187e-01f, 2.454122852e-02f, 9.993223846e-01f, 3.680722294e-02f,
+	9.987954562e-01f, 4.906767433e-02f, 9.981181129e-01f, 6.132073630e-02f,
+	9.972904567e-01f, 7.356456360e-02f, 9.963126122e-01f, 8.579731234e-02f,
+	9.951847267e-01f, 9.801714033e-02f, 9.939069700e-01f, 1.102222073e-01f,
+	9.924795346e-01f, 1.224106752e-01f, 9.909026354e-01f, 1.345807085e-01f,
+	9.891765100e-01f, 1.467304745e-01f, 9.873014182e-01f, 1.588581433e-01f,
+	9.852776424e-01f, 1.709618888e-01f, 9.831054874e-01f, 1.830398880e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.783173707e-01f, 2.071113762e-01f,
+	9.757021300e-01f, 2.191012402e-01f, 9.729399522e-01f, 2.310581083e-01f,
+	9.700312532e-01f, 2.429801799e-01f, 9.669764710e-01f, 2.548656596e-01f,
+	9.637760658e-01f, 2.667127575e-01f, 9.604305194e-01f, 2.785196894e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.533060404e-01f, 3.020059493e-01f,
+	9.495281806e-01f, 3.136817404e-01f, 9.456073254e-01f, 3.253102922e-01f,
+	9.415440652e-01f, 3.368898534e-01f, 9.373390119e-01f, 3.484186802e-01f,
+	9.329927988e-01f, 3.598950365e-01f, 9.285060805e-01f, 3.713171940e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.191138517e-01f, 3.939920401e-01f,
+	9.142097557e-01f, 4.052413140e-01f, 9.091679831e-01f, 4.164295601e-01f,
+	9.039892931e-01f, 4.275550934e-01f, 8.986744657e-01f, 4.386162385e-01f,
+	8.932243012e-01f, 4.496113297e-01f, 8.876396204e-01f, 4.605387110e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.760700942e-01f, 4.821837721e-01f,
+	8.700869911e-01f, 4.928981922e-01f, 8.639728561e-01f, 5.035383837e-01f,
+	8.577286100e-01f, 5.141027442e-01f, 8.513551931e-01f, 5.245896827e-01f,
+	8.448535652e-01f, 5.349976199e-01f, 8.382247056e-01f, 5.453249884e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.245893028e-01f, 5.657318108e-01f,
+	8.175848132e-01f, 5.758081914e-01f, 8.104571983e-01f, 5.857978575e-01f,
+	8.032075315e-01f, 5.956993045e-01f, 7.958369046e-01f, 6.055110414e-01f,
+	7.883464276e-01f, 6.152315906e-01f, 7.807372286e-01f, 6.248594881e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.651672656e-01f, 6.438315429e-01f,
+	7.572088465e-01f, 6.531728430e-01f, 7.491363945e-01f, 6.624157776e-01f,
+	7.409511254e-01f, 6.715589548e-01f, 7.326542717e-01f, 6.806009978e-01f,
+	7.242470830e-01f, 6.895405447e-01f, 7.157308253e-01f, 6.983762494e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 6.983762494e-01f, 7.157308253e-01f,
+	6.895405447e-01f, 7.242470830e-01f, 6.806009978e-01f, 7.326542717e-01f,
+	6.715589548e-01f, 7.409511254e-01f, 6.624157776e-01f, 7.491363945e-01f,
+	6.531728430e-01f, 7.572088465e-01f, 6.438315429e-01f, 7.651672656e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 6.248594881e-01f, 7.807372286e-01f,
+	6.152315906e-01f, 7.883464276e-01f, 6.055110414e-01f, 7.958369046e-01f,
+	5.956993045e-01f, 8.032075315e-01f, 5.857978575e-01f, 8.104571983e-01f,
+	5.758081914e-01f, 8.175848132e-01f, 5.657318108e-01f, 8.245893028e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.453249884e-01f, 8.382247056e-01f,
+	5.349976199e-01f, 8.448535652e-01f, 5.245896827e-01f, 8.513551931e-01f,
+	5.141027442e-01f, 8.577286100e-01f, 5.035383837e-01f, 8.639728561e-01f,
+	4.928981922e-01f, 8.700869911e-01f, 4.821837721e-01f, 8.760700942e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.605387110e-01f, 8.876396204e-01f,
+	4.496113297e-01f, 8.932243012e-01f, 4.386162385e-01f, 8.986744657e-01f,
+	4.275550934e-01f, 9.039892931e-01f, 4.164295601e-01f, 9.091679831e-01f,
+	4.052413140e-01f, 9.142097557e-01f, 3.939920401e-01f, 9.191138517e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 3.713171940e-01f, 9.285060805e-01f,
+	3.598950365e-01f, 9.329927988e-01f, 3.484186802e-01f, 9.373390119e-01f,
+	3.368898534e-01f, 9.415440652e-01f, 3.253102922e-01f, 9.456073254e-01f,
+	3.136817404e-01f, 9.495281806e-01f, 3.020059493e-01f, 9.533060404e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 2.785196894e-01f, 9.604305194e-01f,
+	2.667127575e-01f, 9.637760658e-01f, 2.548656596e-01f, 9.669764710e-01f,
+	2.429801799e-01f, 9.700312532e-01f, 2.310581083e-01f, 9.729399522e-01f,
+	2.191012402e-01f, 9.757021300e-01f, 2.071113762e-01f, 9.783173707e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 1.830398880e-01f, 9.831054874e-01f,
+	1.709618888e-01f, 9.852776424e-01f, 1.588581433e-01f, 9.873014182e-01f,
+	1.467304745e-01f, 9.891765100e-01f, 1.345807085e-01f, 9.909026354e-01f,
+	1.224106752e-01f, 9.924795346e-01f, 1.102222073e-01f, 9.939069700e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 8.579731234e-02f, 9.963126122e-01f,
+	7.356456360e-02f, 9.972904567e-01f, 6.132073630e-02f, 9.981181129e-01f,
+	4.906767433e-02f, 9.987954562e-01f, 3.680722294e-02f, 9.993223846e-01f,
+	2.454122852e-02f, 9.996988187e-01f, 1.227153829e-02f, 9.999247018e-01f,
+	6.123233996e-17f, 1.000000000e+00f, -1.227153829e-02f, 9.999247018e-01f,
+	-2.454122852e-02f, 9.996988187e-01f, -3.680722294e-02f, 9.993223846e-01f,
+	-4.906767433e-02f, 9.987954562e-01f, -6.132073630e-02f, 9.981181129e-01f,
+	-7.356456360e-02f, 9.972904567e-01f, -8.579731234e-02f, 9.963126122e-01f,
+	-9.801714033e-02f, 9.951847267e-01f, -1.102222073e-01f, 9.939069700e-01f,
+	-1.224106752e-01f, 9.924795346e-01f, -1.345807085e-01f, 9.909026354e-01f,
+	-1.467304745e-01f, 9.891765100e-01f, -1.588581433e-01f, 9.873014182e-01f,
+	-1.709618888e-01f, 9.852776424e-01f, -1.830398880e-01f, 9.831054874e-01f,
+	-1.950903220e-01f, 9.807852804e-01f, -2.071113762e-01f, 9.783173707e-01f,
+	-2.191012402e-01f, 9.757021300e-01f, -2.310581083e-01f, 9.729399522e-01f,
+	-2.429801799e-01f, 9.700312532e-01f, -2.548656596e-01f, 9.669764710e-01f,
+	-2.667127575e-01f, 9.637760658e-01f, -2.785196894e-01f, 9.604305194e-01f,
+	-2.902846773e-01f, 9.569403357e-01f, -3.020059493e-01f, 9.533060404e-01f,
+	-3.136817404e-01f, 9.495281806e-01f, -3.253102922e-01f, 9.456073254e-01f,
+	-3.368898534e-01f, 9.415440652e-01f, -3.484186802e-01f, 9.373390119e-01f,
+	-3.598950365e-01f, 9.329927988e-01f, -3.713171940e-01f, 9.285060805e-01f,
+	-3.826834324e-01f, 9.238795325e-01f, -3.939920401e-01f, 9.191138517e-01f,
+	-4.052413140e-01f, 9.142097557e-01f, -4.164295601e-01f, 9.091679831e-01f,
+	-4.275550934e-01f, 9.039892931e-01f, -4.386162385e-01f, 8.986744657e-01f,
+	-4.496113297e-01f, 8.932243012e-01f, -4.605387110e-01f, 8.876396204e-01f,
+	-4.713967368e-01f, 8.819212643e-01f, -4.821837721e-01f, 8.760700942e-01f,
+	-4.928981922e-01f, 8.700869911e-01f, -5.035383837e-01f, 8.639728561e-01f,
+	-5.141027442e-01f, 8.577286100e-01f, -5.245896827e-01f, 8.513551931e-01f,
+	-5.349976199e-01f, 8.448535652e-01f, -5.453249884e-01f, 8.382247056e-01f,
+	-5.555702330e-01f, 8.314696123e-01f, -5.657318108e-01f, 8.245893028e-01f,
+	-5.758081914e-01f, 8.175848132e-01f, -5.857978575e-01f, 8.104571983e-01f,
+	-5.956993045e-01f, 8.032075315e-01f, -6.055110414e-01f, 7.958369046e-01f,
+	-6.152315906e-01f, 7.883464276e-01f, -6.248594881e-01f, 7.807372286e-01f,
+	-6.343932842e-01f, 7.730104534e-01f, -6.438315429e-01f, 7.651672656e-01f,
+	-6.531728430e-01f, 7.572088465e-01f, -6.624157776e-01f, 7.491363945e-01f,
+	-6.715589548e-01f, 7.409511254e-01f, -6.806009978e-01f, 7.326542717e-01f,
+	-6.895405447e-01f, 7.242470830e-01f, -6.983762494e-01f, 7.157308253e-01f,
+	-7.071067812e-01f, 7.071067812e-01f, -7.157308253e-01f, 6.983762494e-01f,
+	-7.242470830e-01f, 6.895405447e-01f, -7.326542717e-01f, 6.806009978e-01f,
+	-7.409511254e-01f, 6.715589548e-01f, -7.491363945e-01f, 6.624157776e-01f,
+	-7.572088465e-01f, 6.531728430e-01f, -7.651672656e-01f, 6.438315429e-01f,
+	-7.730104534e-01f, 6.343932842e-01f, -7.807372286e-01f, 6.248594881e-01f,
+	-7.883464276e-01f, 6.152315906e-01f, -7.958369046e-01f, 6.055110414e-01f,
+	-8.032075315e-01f, 5.956993045e-01f, -8.104571983e-01f, 5.857978575e-01f,
+	-8.175848132e-01f, 5.758081914e-01f, -8.245893028e-01f, 5.657318108e-01f,
+	-8.314696123e-01f, 5.555702330e-01f, -8.382247056e-01f, 5.453249884e-01f,
+	-8.448535652e-01f, 5.349976199e-01f, -8.513551931e-01f, 5.245896827e-01f,
+	-8.577286100e-01f, 5.141027442e-01f, -8.639728561e-01f, 5.035383837e-01f,
+	-8.700869911e-01f, 4.928981922e-01f, -8.760700942e-01f, 4.821837721e-01f,
+	-8.819212643e-01f, 4.713967368e-01f, -8.876396204e-01f, 4.605387110e-01f,
+	-8.932243012e-01f, 4.496113297e-01f, -8.986744657e-01f, 4.386162385e-01f,
+	-9.039892931e-01f, 4.275550934e-01f, -9.091679831e-01f, 4.164295601e-01f,
+	-9.142097557e-01f, 4.052413140e-01f, -9.191138517e-01f, 3.939920401e-01f,
+	-9.238795325e-01f, 3.826834324e-01f, -9.285060805e-01f, 3.713171940e-01f,
+	-9.329927988e-01f, 3.598950365e-01f, -9.373390119e-01f, 3.484186802e-01f,
+	-9.415440652e-01f, 3.368898534e-01f, -9.456073254e-01f, 3.253102922e-01f,
+	-9.495281806e-01f, 3.136817404e-01f, -9.533060404e-01f, 3.020059493e-01f,
+	-9.569403357e-01f, 2.902846773e-01f, -9.604305194e-01f, 2.785196894e-01f,
+	-9.637760658e-01f, 2.667127575e-01f, -9.669764710e-01f, 2.548656596e-01f,
+	-9.700312532e-01f, 2.429801799e-01f, -9.729399522e-01f, 2.310581083e-01f,
+	-9.757021300e-01f, 2.191012402e-01f, -9.783173707e-01f, 2.071113762e-01f,
+	-9.807852804e-01f, 1.950903220e-01f, -9.831054874e-01f, 1.830398880e-01f,
+	-9.852776424e-01f, 1.709618888e-01f, -9.873014182e-01f, 1.588581433e-01f,
+	-9.891765100e-01f, 1.467304745e-01f, -9.909026354e-01f, 1.345807085e-01f,
+	-9.924795346e-01f, 1.224106752e-01f, -9.939069700e-01f, 1.102222073e-01f,
+	-9.951847267e-01f, 9.801714033e-02f, -9.963126122e-01f, 8.579731234e-02f,
+	-9.972904567e-01f, 7.356456360e-02f, -9.981181129e-01f, 6.132073630e-02f,
+	-9.987954562e-01f, 4.906767433e-02f, -9.993223846e-01f, 3.680722294e-02f,
+	-9.996988187e-01f, 2.454122852e-02f, -9.999247018e-01f, 1.227153829e-02f,
+	-1.000000000e+00f, 1.224646799e-16f, -9.999247018e-01f, -1.227153829e-02f,
+	-9.996988187e-01f, -2.454122852e-02f, -9.993223846e-01f, -3.680722294e-02f,
+	-9.987954562e-01f, -4.906767433e-02f, -9.981181129e-01f, -6.132073630e-02f,
+	-9.972904567e-01f, -7.356456360e-02f, -9.963126122e-01f, -8.579731234e-02f,
+	-9.951847267e-01f, -9.801714033e-02f, -9.939069700e-01f, -1.102222073e-01f,
+	-9.924795346e-01f, -1.224106752e-01f, -9.909026354e-01f, -1.345807085e-01f,
+	-9.891765100e-01f, -1.467304745e-01f, -9.873014182e-01f, -1.588581433e-01f,
+	-9.852776424e-01f, -1.709618888e-01f, -9.831054874e-01f, -1.830398880e-01f,
+	-9.807852804e-01f, -1.950903220e-01f, -9.783173707e-01f, -2.071113762e-01f,
+	-9.757021300e-01f, -2.191012402e-01f, -9.729399522e-01f, -2.310581083e-01f,
+	-9.700312532e-01f, -2.429801799e-01f, -9.669764710e-01f, -2.548656596e-01f,
+	-9.637760658e-01f, -2.667127575e-01f, -9.604305194e-01f, -2.785196894e-01f,
+	-9.569403357e-01f, -2.902846773e-01f, -9.533060404e-01f, -3.020059493e-01f,
+	-9.495281806e-01f, -3.136817404e-01f, -9.456073254e-01f, -3.253102922e-01f,
+	-9.415440652e-01f, -3.368898534e-01f, -9.373390119e-01f, -3.484186802e-01f,
+	-9.329927988e-01f, -3.598950365e-01f, -9.285060805e-01f, -3.713171940e-01f,
+	-9.238795325e-01f, -3.826834324e-01f, -9.191138517e-01f, -3.939920401e-01f,
+	-9.142097557e-01f, -4.052413140e-01f, -9.091679831e-01f, -4.164295601e-01f,
+	-9.039892931e-01f, -4.275550934e-01f, -8.986744657e-01f, -4.386162385e-01f,
+	-8.932243012e-01f, -4.496113297e-01f, -8.876396204e-01f, -4.605387110e-01f,
+	-8.819212643e-01f, -4.713967368e-01f, -8.760700942e-01f, -4.821837721e-01f,
+	-8.700869911e-01f, -4.928981922e-01f, -8.639728561e-01f, -5.035383837e-01f,
+	-8.577286100e-01f, -5.141027442e-01f, -8.513551931e-01f, -5.245896827e-01f,
+	-8.448535652e-01f, -5.349976199e-01f, -8.382247056e-01f, -5.453249884e-01f,
+	-8.314696123e-01f, -5.555702330e-01f, -8.245893028e-01f, -5.657318108e-01f,
+	-8.175848132e-01f, -5.758081914e-01f, -8.104571983e-01f, -5.857978575e-01f,
+	-8.032075315e-01f, -5.956993045e-01f, -7.958369046e-01f, -6.055110414e-01f,
+	-7.883464276e-01f, -6.152315906e-01f, -7.807372286e-01f, -6.248594881e-01f,
+	-7.730104534e-01f, -6.343932842e-01f, -7.651672656e-01f, -6.438315429e-01f,
+	-7.572088465e-01f, -6.531728430e-01f, -7.491363945e-01f, -6.624157776e-01f,
+	-7.409511254e-01f, -6.715589548e-01f, -7.326542717e-01f, -6.806009978e-01f,
+	-7.242470830e-01f, -6.895405447e-01f, -7.157308253e-01f, -6.983762494e-01f,
+	-7.071067812e-01f, -7.071067812e-01f, -6.983762494e-01f, -7.157308253e-01f,
+	-6.895405447e-01f, -7.242470830e-01f, -6.806009978e-01f, -7.326542717e-01f,
+	-6.715589548e-01f, -7.409511254e-01f, -6.624157776e-01f, -7.491363945e-01f,
+	-6.531728430e-01f, -7.572088465e-01f, -6.438315429e-01f, -7.651672656e-01f,
+	-6.343932842e-01f, -7.730104534e-01f, -6.248594881e-01f, -7.807372286e-01f,
+	-6.152315906e-01f, -7.883464276e-01f, -6.055110414e-01f, -7.958369046e-01f,
+	-5.956993045e-01f, -8.032075315e-01f, -5.857978575e-01f, -8.104571983e-01f,
+	-5.758081914e-01f, -8.175848132e-01f, -5.657318108e-01f, -8.245893028e-01f,
+	-5.555702330e-01f, -8.314696123e-01f, -5.453249884e-01f, -8.382247056e-01f,
+	-5.349976199e-01f, -8.448535652e-01f, -5.245896827e-01f, -8.513551931e-01f,
+	-5.141027442e-01f, -8.577286100e-01f, -5.035383837e-01f, -8.639728561e-01f,
+	-4.928981922e-01f, -8.700869911e-01f, -4.821837721e-01f, -8.760700942e-01f,
+	-4.713967368e-01f, -8.819212643e-01f, -4.605387110e-01f, -8.876396204e-01f,
+	-4.496113297e-01f, -8.932243012e-01f, -4.386162385e-01f, -8.986744657e-01f,
+	-4.275550934e-01f, -9.039892931e-01f, -4.164295601e-01f, -9.091679831e-01f,
+	-4.052413140e-01f, -9.142097557e-01f, -3.939920401e-01f, -9.191138517e-01f,
+	-3.826834324e-01f, -9.238795325e-01f, -3.713171940e-01f, -9.285060805e-01f,
+	-3.598950365e-01f, -9.329927988e-01f, -3.484186802e-01f, -9.373390119e-01f,
+	-3.368898534e-01f, -9.415440652e-01f, -3.253102922e-01f, -9.456073254e-01f,
+	-3.136817404e-01f, -9.495281806e-01f, -3.020059493e-01f, -9.533060404e-01f,
+	-2.902846773e-01f, -9.569403357e-01f, -2.785196894e-01f, -9.604305194e-01f,
+	-2.667127575e-01f, -9.637760658e-01f, -2.548656596e-01f, -9.669764710e-01f,
+	-2.429801799e-01f, -9.700312532e-01f, -2.310581083e-01f, -9.729399522e-01f,
+	-2.191012402e-01f, -9.757021300e-01f, -2.071113762e-01f, -9.783173707e-01f,
+	-1.950903220e-01f, -9.807852804e-01f, -1.830398880e-01f, -9.831054874e-01f,
+	-1.709618888e-01f, -9.852776424e-01f, -1.588581433e-01f, -9.873014182e-01f,
+	-1.467304745e-01f, -9.891765100e-01f, -1.345807085e-01f, -9.909026354e-01f,
+	-1.224106752e-01f, -9.924795346e-01f, -1.102222073e-01f, -9.939069700e-01f,
+	-9.801714033e-02f, -9.951847267e-01f, -8.579731234e-02f, -9.963126122e-01f,
+	-7.356456360e-02f, -9.972904567e-01f, -6.132073630e-02f, -9.981181129e-01f,
+	-4.906767433e-02f, -9.987954562e-01f, -3.680722294e-02f, -9.993223846e-01f,
+	-2.454122852e-02f, -9.996988187e-01f, -1.227153829e-02f, -9.999247018e-01f,
+	-1.836970199e-16f, -1.000000000e+00f, 1.227153829e-02f, -9.999247018e-01f,
+	2.454122852e-02f, -9.996988187e-01f, 3.680722294e-02f, -9.993223846e-01f,
+	4.906767433e-02f, -9.987954562e-01f, 6.132073630e-02f, -9.981181129e-01f,
+	7.356456360e-02f, -9.972904567e-01f, 8.579731234e-02f, -9.963126122e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 1.102222073e-01f, -9.939069700e-01f,
+	1.224106752e-01f, -9.924795346e-01f, 1.345807085e-01f, -9.909026354e-01f,
+	1.467304745e-01f, -9.891765100e-01f, 1.588581433e-01f, -9.873014182e-01f,
+	1.709618888e-01f, -9.852776424e-01f, 1.830398880e-01f, -9.831054874e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 2.071113762e-01f, -9.783173707e-01f,
+	2.191012402e-01f, -9.757021300e-01f, 2.310581083e-01f, -9.729399522e-01f,
+	2.429801799e-01f, -9.700312532e-01f, 2.548656596e-01f, -9.669764710e-01f,
+	2.667127575e-01f, -9.637760658e-01f, 2.785196894e-01f, -9.604305194e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 3.020059493e-01f, -9.533060404e-01f,
+	3.136817404e-01f, -9.495281806e-01f, 3.253102922e-01f, -9.456073254e-01f,
+	3.368898534e-01f, -9.415440652e-01f, 3.484186802e-01f, -9.373390119e-01f,
+	3.598950365e-01f, -9.329927988e-01f, 3.713171940e-01f, -9.285060805e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 3.939920401e-01f, -9.191138517e-01f,
+	4.052413140e-01f, -9.142097557e-01f, 4.164295601e-01f, -9.091679831e-01f,
+	4.275550934e-01f, -9.039892931e-01f, 4.386162385e-01f, -8.986744657e-01f,
+	4.496113297e-01f, -8.932243012e-01f, 4.605387110e-01f, -8.876396204e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 4.821837721e-01f, -8.760700942e-01f,
+	4.928981922e-01f, -8.700869911e-01f, 5.035383837e-01f, -8.639728561e-01f,
+	5.141027442e-01f, -8.577286100e-01f, 5.245896827e-01f, -8.513551931e-01f,
+	5.349976199e-01f, -8.448535652e-01f, 5.453249884e-01f, -8.382247056e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.657318108e-01f, -8.245893028e-01f,
+	5.758081914e-01f, -8.175848132e-01f, 5.857978575e-01f, -8.104571983e-01f,
+	5.956993045e-01f, -8.032075315e-01f, 6.055110414e-01f, -7.958369046e-01f,
+	6.152315906e-01f, -7.883464276e-01f, 6.248594881e-01f, -7.807372286e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.438315429e-01f, -7.651672656e-01f,
+	6.531728430e-01f, -7.572088465e-01f, 6.624157776e-01f, -7.491363945e-01f,
+	6.715589548e-01f, -7.409511254e-01f, 6.806009978e-01f, -7.326542717e-01f,
+	6.895405447e-01f, -7.242470830e-01f, 6.983762494e-01f, -7.157308253e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 7.157308253e-01f, -6.983762494e-01f,
+	7.242470830e-01f, -6.895405447e-01f, 7.326542717e-01f, -6.806009978e-01f,
+	7.409511254e-01f, -6.715589548e-01f, 7.491363945e-01f, -6.624157776e-01f,
+	7.572088465e-01f, -6.531728430e-01f, 7.651672656e-01f, -6.438315429e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 7.807372286e-01f, -6.248594881e-01f,
+	7.883464276e-01f, -6.152315906e-01f, 7.958369046e-01f, -6.055110414e-01f,
+	8.032075315e-01f, -5.956993045e-01f, 8.104571983e-01f, -5.857978575e-01f,
+	8.175848132e-01f, -5.758081914e-01f, 8.245893028e-01f, -5.657318108e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.382247056e-01f, -5.453249884e-01f,
+	8.448535652e-01f, -5.349976199e-01f, 8.513551931e-01f, -5.245896827e-01f,
+	8.577286100e-01f, -5.141027442e-01f, 8.639728561e-01f, -5.035383837e-01f,
+	8.700869911e-01f, -4.928981922e-01f, 8.760700942e-01f, -4.821837721e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 8.876396204e-01f, -4.605387110e-01f,
+	8.932243012e-01f, -4.496113297e-01f, 8.986744657e-01f, -4.386162385e-01f,
+	9.039892931e-01f, -4.275550934e-01f, 9.091679831e-01f, -4.164295601e-01f,
+	9.142097557e-01f, -4.052413140e-01f, 9.191138517e-01f, -3.939920401e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.285060805e-01f, -3.713171940e-01f,
+	9.329927988e-01f, -3.598950365e-01f, 9.373390119e-01f, -3.484186802e-01f,
+	9.415440652e-01f, -3.368898534e-01f, 9.456073254e-01f, -3.253102922e-01f,
+	9.495281806e-01f, -3.136817404e-01f, 9.533060404e-01f, -3.020059493e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.604305194e-01f, -2.785196894e-01f,
+	9.637760658e-01f, -2.667127575e-01f, 9.669764710e-01f, -2.548656596e-01f,
+	9.700312532e-01f, -2.429801799e-01f, 9.729399522e-01f, -2.310581083e-01f,
+	9.757021300e-01f, -2.191012402e-01f, 9.783173707e-01f, -2.071113762e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.831054874e-01f, -1.830398880e-01f,
+	9.852776424e-01f, -1.709618888e-01f, 9.873014182e-01f, -1.588581433e-01f,
+	9.891765100e-01f, -1.467304745e-01f, 9.909026354e-01f, -1.345807085e-01f,
+	9.924795346e-01f, -1.224106752e-01f, 9.939069700e-01f, -1.102222073e-01f,
+	9.951847267e-01f, -9.801714033e-02f, 9.963126122e-01f, -8.579731234e-02f,
+	9.972904567e-01f, -7.356456360e-02f, 9.981181129e-01f, -6.132073630e-02f,
+	9.987954562e-01f, -4.906767433e-02f, 9.993223846e-01f, -3.680722294e-02f,
+	9.996988187e-01f, -2.454122852e-02f, 9.999247018e-01f, -1.227153829e-02f,
+};
+static const uint16_t fft_tables_bitrev_512[448] = {
+	8, 512, 16, 1024, 24, 1536, 32, 2048, 40, 2560, 48, 3072,
+	56, 3584, 72, 576, 80, 1088, 88, 1600, 96, 2112, 104, 2624,
+	112, 3136, 120, 3648, 136, 640, 144, 1152, 152, 1664, 160, 2176,
+	168, 2688, 176, 3200, 184, 3712, 200, 704, 208, 1216, 216, 1728,
+	224, 2240, 232, 2752, 240, 3264, 248, 3776, 264, 768, 272, 1280,
+	280, 1792, 288, 2304, 296, 2816, 304, 3328, 312, 3840, 328, 832,
+	336, 1344, 344, 1856, 352, 2368, 360, 2880, 368, 3392, 376, 3904,
+	392, 896, 400, 1408, 408, 1920, 416, 2432, 424, 2944, 432, 3456,
+	440, 3968, 456, 960, 464, 1472, 472, 1984, 480, 2496, 488, 3008,
+	496, 3520, 504, 4032, 528, 1032, 536, 1544, 544, 2056, 552, 2568,
+	560, 3080, 568, 3592, 592, 1096, 600, 1608, 608, 2120, 616, 2632,
+	624, 3144, 632, 3656, 656, 1160, 664, 1672, 672, 2184, 680, 2696,
+	688, 3208, 696, 3720, 720, 1224, 728, 1736, 736, 2248, 744, 2760,
+	752, 3272, 760, 3784, 784, 1288, 792, 1800, 800, 2312, 808, 2824,
+	816, 3336, 824, 3848, 848, 1352, 856, 1864, 864, 2376, 872, 2888,
+	880, 3400, 888, 3912, 912, 1416, 920, 1928, 928, 2440, 936, 2952,
+	944, 3464, 952, 3976, 976, 1480, 984, 1992, 992, 2504, 1000, 3016,
+	1008, 3528, 1016, 4040, 1048, 1552, 1056, 2064, 1064, 2576, 1072, 3088,
+	1080, 3600, 1112, 1616, 1120, 2128, 1128, 2640, 1136, 3152, 1144, 3664,
+	1176, 1680, 1184, 2192, 1192, 2704, 1200, 3216, 1208, 3728, 1240, 1744,
+	1248, 2256, 1256, 2768, 1264, 3280, 1272, 3792, 1304, 1808, 1312, 2320,
+	1320, 2832, 1328, 3344, 1336, 3856, 1368, 1872, 1376, 2384, 1384, 2896,
+	1392, 3408, 1400, 3920, 1432, 1936, 1440, 2448, 1448, 2960, 1456, 3472,
+	1464, 3984, 1496, 2000, 1504, 2512, 1512, 3024, 1520, 3536, 1528, 4048,
+	1568, 2072, 1576, 2584, 1584, 3096, 1592, 3608, 1632, 2136, 1640, 2648,
+	1648, 3160, 1656, 3672, 1696, 2200, 1704, 2712, 1712, 3224, 1720, 3736,
+	1760, 2264, 1768, 2776, 1776, 3288, 1784, 3800, 1824, 2328, 1832, 2840,
+	1840, 3352, 1848, 3864, 1888, 2392, 1896, 2904, 1904, 3416, 1912, 3928,
+	1952, 2456, 1960, 2968, 1968, 3480, 1976, 3992, 2016, 2520, 2024, 3032,
+	2032, 3544, 2040, 4056, 2088, 2592, 2096, 3104, 2104, 3616, 2152, 2656,
+	2160, 3168, 2168, 3680, 2216, 2720, 2224, 3232, 2232, 3744, 2280, 2784,
+	2288, 3296, 2296, 3808, 2344, 2848, 2352, 3360, 2360, 3872, 2408, 2912,
+	2416, 3424, 2424, 3936, 2472, 2976, 2480, 3488, 2488, 4000, 2536, 3040,
+	2544, 3552, 2552, 4064, 2608, 3112, 2616, 3624, 2672, 3176, 2680, 3688,
+	2736, 3240, 2744, 3752, 2800, 3304, 2808, 3816, 2864, 3368, 2872, 3880,
+	2928, 3432, 2936, 3944, 2992, 3496, 3000, 4008, 3056, 3560, 3064, 4072,
+	3128, 3632, 3192, 3696, 3256, 3760, 3320, 3824, 3384, 3888, 3448, 3952,
+	3512, 4016, 3576, 4080,
+};
+const arm_cfft_instance_f32 arm_cfft_sR_f32_len512 = {
+	512, fft_tables_twiddle_512, fft_tables_bitrev_512, 448
+};
+
+static const float32_t fft_tables_twiddle_rfft_512[512] = {
+	0.000000000e+00f, 1.000000000e+00f, 1.227153829e-02f, 9.999247018e-01f,
+	2.454122852e-02f, 9.996988187e-01f, 3.680722294e-02f, 9.993223846e-01f,
+	4.906767433e-02f, 9.987954562e-01f, 6.132073630e-02f, 9.981181129e-01f,
+	7.356456360e-02f, 9.972904567e-01f, 8.579731234e-02f, 9.963126122e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 1.102222073e-01f, 9.939069700e-01f,
+	1.224106752e-01f, 9.924795346e-01f, 1.345807085e-01f, 9.909026354e-01f,
+	1.467304745e-01f, 9.891765100e-01f, 1.588581433e-01f, 9.873014182e-01f,
+	1.709618888e-01f, 9.852776424e-01f, 1.830398880e-01f, 9.831054874e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 2.071113762e-01f, 9.783173707e-01f,
+	2.191012402e-01f, 9.757021300e-01f, 2.310581083e-01f, 9.729399522e-01f,
+	2.429801799e-01f, 9.700312532e-01f, 2.548656596e-01f, 9.669764710e-01f,
+	2.667127575e-01f, 9.637760658e-01f, 2.785196894e-01f, 9.604305194e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 3.020059493e-01f, 9.533060404e-01f,
+	3.136817404e-01f, 9.495281806e-01f, 3.253102922e-01f, 9.456073254e-01f,
+	3.368898534e-01f, 9.415440652e-01f, 3.484186802e-01f, 9.373390119e-01f,
+	3.598950365e-01f, 9.329927988e-01f, 3.713171940e-01f, 9.285060805e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 3.939920401e-01f, 9.191138517e-01f,
+	4.052413140e-01f, 9.142097557e-01f, 4.164295601e-01f, 9.091679831e-01f,
+	4.275550934e-01f, 9.039892931e-01f, 4.386162385e-01f, 8.986744657e-01f,
+	4.496113297e-01f, 8.932243012e-01f, 4.605387110e-01f, 8.876396204e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.821837721e-01f, 8.760700942e-01f,
+	4.928981922e-01f, 8.700869911e-01f, 5.035383837e-01f, 8.639728561e-01f,
+	5.141027442e-01f, 8.577286100e-01f, 5.245896827e-01f, 8.513551931e-01f,
+	5.349976199e-01f, 8.448535652e-01f, 5.453249884e-01f, 8.382247056e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.657318108e-01f, 8.245893028e-01f,
+	5.758081914e-01f, 8.175848132e-01f, 5.857978575e-01f, 8.104571983e-01f,
+	5.956993045e-01f, 8.032075315e-01f, 6.055110414e-01f, 7.958369046e-01f,
+	6.152315906e-01f, 7.883464276e-01f, 6.248594881e-01f, 7.807372286e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 6.438315429e-01f, 7.651672656e-01f,
+	6.531728430e-01f, 7.572088465e-01f, 6.624157776e-01f, 7.491363945e-01f,
+	6.715589548e-01f, 7.409511254e-01f, 6.806009978e-01f, 7.326542717e-01f,
+	6.895405447e-01f, 7.242470830e-01f, 6.983762494e-01f, 7.157308253e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 7.157308253e-01f, 6.983762494e-01f,
+	7.242470830e-01f, 6.895405447e-01f, 7.326542717e-01f, 6.806009978e-01f,
+	7.409511254e-01f, 6.715589548e-01f, 7.491363945e-01f, 6.624157776e-01f,
+	7.572088465e-01f, 6.531728430e-01f, 7.651672656e-01f, 6.438315429e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.807372286e-01f, 6.248594881e-01f,
+	7.883464276e-01f, 6.152315906e-01f, 7.958369046e-01f, 6.055110414e-01f,
+	8.032075315e-01f, 5.956993045e-01f, 8.104571983e-01f, 5.857978575e-01f,
+	8.175848132e-01f, 5.758081914e-01f, 8.245893028e-01f, 5.657318108e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.382247056e-01f, 5.453249884e-01f,
+	8.448535652e-01f, 5.349976199e-01f, 8.513551931e-01f, 5.245896827e-01f,
+	8.577286100e-01f, 5.141027442e-01f, 8.639728561e-01f, 5.035383837e-01f,
+	8.700869911e-01f, 4.928981922e-01f, 8.760700942e-01f, 4.821837721e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.876396204e-01f, 4.605387110e-01f,
+	8.932243012e-01f, 4.496113297e-01f, 8.986744657e-01f, 4.386162385e-01f,
+	9.039892931e-01f, 4.275550934e-01f, 9.091679831e-01f, 4.164295601e-01f,
+	9.142097557e-01f, 4.052413140e-01f, 9.191138517e-01f, 3.939920401e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.285060805e-01f, 3.713171940e-01f,
+	9.329927988e-01f, 3.598950365e-01f, 9.373390119e-01f, 3.484186802e-01f,
+	9.415440652e-01f, 3.368898534e-01f, 9.456073254e-01f, 3.253102922e-01f,
+	9.495281806e-01f, 3.136817404e-01f, 9.533060404e-01f, 3.020059493e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.604305194e-01f, 2.785196894e-01f,
+	9.637760658e-01f, 2.667127575e-01f, 9.669764710e-01f, 2.548656596e-01f,
+	9.700312532e-01f, 2.429801799e-01f, 9.729399522e-01f, 2.310581083e-01f,
+	9.757021300e-01f, 2.191012402e-01f, 9.783173707e-01f, 2.071113762e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.831054874e-01f, 1.830398880e-01f,
+	9.852776424e-01f, 1.709618888e-01f, 9.873014182e-01f, 1.588581433e-01f,
+	9.891765100e-01f, 1.467304745e-01f, 9.909026354e-01f, 1.345807085e-01f,
+	9.924795346e-01f, 1.224106752e-01f, 9.939069700e-01f, 1.102222073e-01f,
+	9.951847267e-01f, 9.801714033e-02f, 9.963126122e-01f, 8.579731234e-02f,
+	9.972904567e-01f, 7.356456360e-02f, 9.981181129e-01f, 6.132073630e-02f,
+	9.987954562e-01f, 4.906767433e-02f, 9.993223846e-01f, 3.680722294e-02f,
+	9.996988187e-01f, 2.454122852e-02f, 9.999247018e-01f, 1.227153829e-02f,
+	1.000000000e+00f, 6.123233996e-17f, 9.999247018e-01f, -1.227153829e-02f,
+	9.996988187e-01f, -2.454122852e-02f, 9.993223846e-01f, -3.680722294e-02f,
+	9.987954562e-01f, -4.906767433e-02f, 9.981181129e-01f, -6.132073630e-02f,
+	9.972904567e-01f, -7.356456360e-02f, 9.963126122e-01f, -8.579731234e-02f,
+	9.951847267e-01f, -9.801714033e-02f, 9.939069700e-01f, -1.102222073e-01f,
+	9.924795346e-01f, -1.224106752e-01f, 9.909026354e-01f, -1.345807085e-01f,
+	9.891765100e-01f, -1.467304745e-01f, 9.873014182e-01f, -1.588581433e-01f,
+	9.852776424e-01f, -1.709618888e-01f, 9.831054874e-01f, -1.830398880e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.783173707e-01f, -2.071113762e-01f,
+	9.757021300e-01f, -2.191012402e-01f, 9.729399522e-01f, -2.310581083e-01f,
+	9.700312532e-01f, -2.429801799e-01f, 9.669764710e-01f, -2.548656596e-01f,
+	9.637760658e-01f, -2.667127575e-01f, 9.604305194e-01f, -2.785196894e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.533060404e-01f, -3.020059493e-01f,
+	9.495281806e-01f, -3.136817404e-01f, 9.456073254e-01f, -3.253102922e-01f,
+	9.415440652e-01f, -3.368898534e-01f, 9.373390119e-01f, -3.484186802e-01f,
+	9.329927988e-01f, -3.598950365e-01f, 9.285060805e-01f, -3.713171940e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.191138517e-01f, -3.939920401e-01f,
+	9.142097557e-01f, -4.052413140e-01f, 9.091679831e-01f, -4.164295601e-01f,
+	9.039892931e-01f, -4.275550934e-01f, 8.986744657e-01f, -4.386162385e-01f,
+	8.932243012e-01f, -4.496113297e-01f, 8.876396204e-01f, -4.605387110e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 8.760700942e-01f, -4.821837721e-01f,
+	8.700869911e-01f, -4.928981922e-01f, 8.639728561e-01f, -5.035383837e-01f,
+	8.577286100e-01f, -5.141027442e-01f, 8.513551931e-01f, -5.245896827e-01f,
+	8.448535652e-01f, -5.349976199e-01f, 8.382247056e-01f, -5.453249884e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.245893028e-01f, -5.657318108e-01f,
+	8.175848132e-01f, -5.758081914e-01f, 8.104571983e-01f, -5.857978575e-01f,
+	8.032075315e-01f, -5.956993045e-01f, 7.958369046e-01f, -6.055110414e-01f,
+	7.883464276e-01f, -6.152315906e-01f, 7.807372286e-01f, -6.248594881e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 7.651672656e-01f, -6.438315429e-01f,
+	7.572088465e-01f, -6.531728430e-01f, 7.491363945e-01f, -6.624157776e-01f,
+	7.409511254e-01f, -6.715589548e-01f, 7.326542717e-01f, -6.806009978e-01f,
+	7.242470830e-01f, -6.895405447e-01f, 7.157308253e-01f, -6.983762494e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 6.983762494e-01f, -7.157308253e-01f,
+	6.895405447e-01f, -7.242470830e-01f, 6.806009978e-01f, -7.326542717e-01f,
+	6.715589548e-01f, -7.409511254e-01f, 6.624157776e-01f, -7.491363945e-01f,
+	6.531728430e-01f, -7.572088465e-01f, 6.438315429e-01f, -7.651672656e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.248594881e-01f, -7.807372286e-01f,
+	6.152315906e-01f, -7.883464276e-01f, 6.055110414e-01f, -7.958369046e-01f,
+	5.956993045e-01f, -8.032075315e-01f, 5.857978575e-01f, -8.104571983e-01f,
+	5.758081914e-01f, -8.175848132e-01f, 5.657318108e-01f, -8.245893028e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.453249884e-01f, -8.382247056e-01f,
+	5.349976199e-01f, -8.448535652e-01f, 5.245896827e-01f, -8.513551931e-01f,
+	5.141027442e-01f, -8.577286100e-01f, 5.035383837e-01f, -8.639728561e-01f,
+	4.928981922e-01f, -8.700869911e-01f, 4.821837721e-01f, -8.760700942e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 4.605387110e-01f, -8.876396204e-01f,
+	4.496113297e-01f, -8.932243012e-01f, 4.386162385e-01f, -8.986744657e-01f,
+	4.275550934e-01f, -9.039892931e-01f, 4.164295601e-01f, -9.091679831e-01f,
+	4.052413140e-01f, -9.142097557e-01f, 3.939920401e-01f, -9.191138517e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 3.713171940e-01f, -9.285060805e-01f,
+	3.598950365e-01f, -9.329927988e-01f, 3.484186802e-01f, -9.373390119e-01f,
+	3.368898534e-01f, -9.415440652e-01f, 3.253102922e-01f, -9.456073254e-01f,
+	3.136817404e-01f, -9.495281806e-01f, 3.020059493e-01f, -9.533060404e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 2.785196894e-01f, -9.604305194e-01f,
+	2.667127575e-01f, -9.637760658e-01f, 2.548656596e-01f, -9.669764710e-01f,
+	2.429801799e-01f, -9.700312532e-01f, 2.310581083e-01f, -9.729399522e-01f,
+	2.191012402e-01f, -9.757021300e-01f, 2.071113762e-01f, -9.783173707e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 1.830398880e-01f, -9.831054874e-01f,
+	1.709618888e-01f, -9.852776424e-01f, 1.588581433e-01f, -9.873014182e-01f,
+	1.467304745e-01f, -9.891765100e-01f, 1.345807085e-01f, -9.909026354e-01f,
+	1.224106752e-01f, -9.924795346e-01f, 1.102222073e-01f, -9.939069700e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 8.579731234e-02f, -9.963126122e-01f,
+	7.356456360e-02f, -9.972904567e-01f, 6.132073630e-02f, -9.981181129e-01f,
+	4.906767433e-02f, -9.987954562e-01f, 3.680722294e-02f, -9.993223846e-01f,
+	2.454122852e-02f, -9.996988187e-01f, 1.227153829e-02f, -9.999247018e-01f,
+};
+
+static const float32_t fft_tables_twiddle_rfft_1024[1024] = {
+	0.000000000e+00f, 1.000000000e+00f, 6.135884649e-03f, 9.999811753e-01f,
+	1.227153829e-02f, 9.999247018e-01f, 1.840672991e-02f, 9.998305818e-01f,
+	2.454122852e-02f, 9.996988187e-01f, 3.067480318e-02f, 9.995294175e-01f,
+	3.680722294e-02f, 9.993223846e-01f, 4.293825693e-02f, 9.990777278e-01f,
+	4.906767433e-02f, 9.987954562e-01f, 5.519524435e-02f, 9.984755806e-01f,
+	6.132073630e-02f, 9.981181129e-01f, 6.744391956e-02f, 9.977230666e-01f,
+	7.356456360e-02f, 9.972904567e-01f, 7.968243797e-02f, 9.968202993e-01f,
+	8.579731234e-02f, 9.963126122e-01f, 9.190895650e-02f, 9.957674145e-01f,
+	9.801714033e-02f, 9.951847267e-01f, 1.041216339e-01f, 9.945645707e-01f,
+	1.102222073e-01f, 9.939069700e-01f, 1.163186309e-01f, 9.932119492e-01f,
+	1.224106752e-01f, 9.924795346e-01f, 1.284981108e-01f, 9.917097537e-01f,
+	1.345807085e-01f, 9.909026354e-01f, 1.406582393e-01f, 9.900582103e-01f,
+	1.467304745e-01f, 9.891765100e-01f, 1.527971853e-01f, 9.882575677e-01f,
+	1.588581433e-01f, 9.873014182e-01f, 1.649131205e-01f, 9.863080972e-01f,
+	1.709618888e-01f, 9.852776424e-01f, 1.770042204e-01f, 9.842100924e-01f,
+	1.830398880e-01f, 9.831054874e-01f, 1.890686641e-01f, 9.819638691e-01f,
+	1.950903220e-01f, 9.807852804e-01f, 2.011046348e-01f, 9.795697657e-01f,
+	2.071113762e-01f, 9.783173707e-01f, 2.131103199e-01f, 9.770281427e-01f,
+	2.191012402e-01f, 9.757021300e-01f, 2.250839114e-01f, 9.743393828e-01f,
+	2.310581083e-01f, 9.729399522e-01f, 2.370236060e-01f, 9.715038910e-01f,
+	2.429801799e-01f, 9.700312532e-01f, 2.489276057e-01f, 9.685220943e-01f,
+	2.548656596e-01f, 9.669764710e-01f, 2.607941179e-01f, 9.653944417e-01f,
+	2.667127575e-01f, 9.637760658e-01f, 2.726213554e-01f, 9.621214043e-01f,
+	2.785196894e-01f, 9.604305194e-01f, 2.844075372e-01f, 9.587034749e-01f,
+	2.902846773e-01f, 9.569403357e-01f, 2.961508882e-01f, 9.551411683e-01f,
+	3.020059493e-01f, 9.533060404e-01f, 3.078496400e-01f, 9.514350210e-01f,
+	3.136817404e-01f, 9.495281806e-01f, 3.195020308e-01f, 9.475855910e-01f,
+	3.253102922e-01f, 9.456073254e-01f, 3.311063058e-01f, 9.435934582e-01f,
+	3.368898534e-01f, 9.415440652e-01f, 3.426607173e-01f, 9.394592236e-01f,
+	3.484186802e-01f, 9.373390119e-01f, 3.541635254e-01f, 9.351835099e-01f,
+	3.598950365e-01f, 9.329927988e-01f, 3.656129978e-01f, 9.307669611e-01f,
+	3.713171940e-01f, 9.285060805e-01f, 3.770074102e-01f, 9.262102421e-01f,
+	3.826834324e-01f, 9.238795325e-01f, 3.883450467e-01f, 9.215140393e-01f,
+	3.939920401e-01f, 9.191138517e-01f, 3.996241998e-01f, 9.166790599e-01f,
+	4.052413140e-01f, 9.142097557e-01f, 4.108431711e-01f, 9.117060320e-01f,
+	4.164295601e-01f, 9.091679831e-01f, 4.220002708e-01f, 9.065957045e-01f,
+	4.275550934e-01f, 9.039892931e-01f, 4.330938189e-01f, 9.013488470e-01f,
+	4.386162385e-01f, 8.986744657e-01f, 4.441221446e-01f, 8.959662498e-01f,
+	4.496113297e-01f, 8.932243012e-01f, 4.550835871e-01f, 8.904487232e-01f,
+	4.605387110e-01f, 8.876396204e-01f, 4.659764958e-01f, 8.847970984e-01f,
+	4.713967368e-01f, 8.819212643e-01f, 4.767992301e-01f, 8.790122264e-01f,
+	4.821837721e-01f, 8.760700942e-01f, 4.875501601e-01f, 8.730949784e-01f,
+	4.928981922e-01f, 8.700869911e-01f, 4.982276670e-01f, 8.670462455e-01f,
+	5.035383837e-01f, 8.639728561e-01f, 5.088301425e-01f, 8.608669386e-01f,
+	5.141027442e-01f, 8.577286100e-01f, 5.193559902e-01f, 8.545579884e-01f,
+	5.245896827e-01f, 8.513551931e-01f, 5.298036247e-01f, 8.481203448e-01f,
+	5.349976199e-01f, 8.448535652e-01f, 5.401714727e-01f, 8.415549774e-01f,
+	5.453249884e-01f, 8.382247056e-01f, 5.504579729e-01f, 8.348628750e-01f,
+	5.555702330e-01f, 8.314696123e-01f, 5.606615762e-01f, 8.280450453e-01f,
+	5.657318108e-01f, 8.245893028e-01f, 5.707807459e-01f, 8.211025150e-01f,
+	5.758081914e-01f, 8.175848132e-01f, 5.808139581e-01f, 8.140363297e-01f,
+	5.857978575e-01f, 8.104571983e-01f, 5.907597019e-01f, 8.068475535e-01f,
+	5.956993045e-01f, 8.032075315e-01f, 6.006164794e-01f, 7.995372691e-01f,
+	6.055110414e-01f, 7.958369046e-01f, 6.103828063e-01f, 7.921065773e-01f,
+	6.152315906e-01f, 7.883464276e-01f, 6.200572118e-01f, 7.845565972e-01f,
+	6.248594881e-01f, 7.807372286e-01f, 6.296382389e-01f, 7.768884657e-01f,
+	6.343932842e-01f, 7.730104534e-01f, 6.391244449e-01f, 7.691033376e-01f,
+	6.438315429e-01f, 7.651672656e-01f, 6.485144010e-01f, 7.612023855e-01f,
+	6.531728430e-01f, 7.572088465e-01f, 6.578066933e-01f, 7.531867990e-01f,
+	6.624157776e-01f, 7.491363945e-01f, 6.669999223e-01f, 7.450577854e-01f,
+	6.715589548e-01f, 7.409511254e-01f, 6.760927036e-01f, 7.368165689e-01f,
+	6.806009978e-01f, 7.326542717e-01f, 6.850836678e-01f, 7.284643904e-01f,
+	6.895405447e-01f, 7.242470830e-01f, 6.939714609e-01f, 7.200025080e-01f,
+	6.983762494e-01f, 7.157308253e-01f, 7.027547445e-01f, 7.114321957e-01f,
+	7.071067812e-01f, 7.071067812e-01f, 7.114321957e-01f, 7.027547445e-01f,
+	7.157308253e-01f, 6.983762494e-01f, 7.200025080e-01f, 6.939714609e-01f,
+	7.242470830e-01f, 6.895405447e-01f, 7.284643904e-01f, 6.850836678e-01f,
+	7.326542717e-01f, 6.806009978e-01f, 7.368165689e-01f, 6.760927036e-01f,
+	7.409511254e-01f, 6.715589548e-01f, 7.450577854e-01f, 6.669999223e-01f,
+	7.491363945e-01f, 6.624157776e-01f, 7.531867990e-01f, 6.578066933e-01f,
+	7.572088465e-01f, 6.531728430e-01f, 7.612023855e-01f, 6.485144010e-01f,
+	7.651672656e-01f, 6.438315429e-01f, 7.691033376e-01f, 6.391244449e-01f,
+	7.730104534e-01f, 6.343932842e-01f, 7.768884657e-01f, 6.296382389e-01f,
+	7.807372286e-01f, 6.248594881e-01f, 7.845565972e-01f, 6.200572118e-01f,
+	7.883464276e-01f, 6.152315906e-01f, 7.921065773e-01f, 6.103828063e-01f,
+	7.958369046e-01f, 6.055110414e-01f, 7.995372691e-01f, 6.006164794e-01f,
+	8.032075315e-01f, 5.956993045e-01f, 8.068475535e-01f, 5.907597019e-01f,
+	8.104571983e-01f, 5.857978575e-01f, 8.140363297e-01f, 5.808139581e-01f,
+	8.175848132e-01f, 5.758081914e-01f, 8.211025150e-01f, 5.707807459e-01f,
+	8.245893028e-01f, 5.657318108e-01f, 8.280450453e-01f, 5.606615762e-01f,
+	8.314696123e-01f, 5.555702330e-01f, 8.348628750e-01f, 5.504579729e-01f,
+	8.382247056e-01f, 5.453249884e-01f, 8.415549774e-01f, 5.401714727e-01f,
+	8.448535652e-01f, 5.349976199e-01f, 8.481203448e-01f, 5.298036247e-01f,
+	8.513551931e-01f, 5.245896827e-01f, 8.545579884e-01f, 5.193559902e-01f,
+	8.577286100e-01f, 5.141027442e-01f, 8.608669386e-01f, 5.088301425e-01f,
+	8.639728561e-01f, 5.035383837e-01f, 8.670462455e-01f, 4.982276670e-01f,
+	8.700869911e-01f, 4.928981922e-01f, 8.730949784e-01f, 4.875501601e-01f,
+	8.760700942e-01f, 4.821837721e-01f, 8.790122264e-01f, 4.767992301e-01f,
+	8.819212643e-01f, 4.713967368e-01f, 8.847970984e-01f, 4.659764958e-01f,
+	8.876396204e-01f, 4.605387110e-01f, 8.904487232e-01f, 4.550835871e-01f,
+	8.932243012e-01f, 4.496113297e-01f, 8.959662498e-01f, 4.441221446e-01f,
+	8.986744657e-01f, 4.386162385e-01f, 9.013488470e-01f, 4.330938189e-01f,
+	9.039892931e-01f, 4.275550934e-01f, 9.065957045e-01f, 4.220002708e-01f,
+	9.091679831e-01f, 4.164295601e-01f, 9.117060320e-01f, 4.108431711e-01f,
+	9.142097557e-01f, 4.052413140e-01f, 9.166790599e-01f, 3.996241998e-01f,
+	9.191138517e-01f, 3.939920401e-01f, 9.215140393e-01f, 3.883450467e-01f,
+	9.238795325e-01f, 3.826834324e-01f, 9.262102421e-01f, 3.770074102e-01f,
+	9.285060805e-01f, 3.713171940e-01f, 9.307669611e-01f, 3.656129978e-01f,
+	9.329927988e-01f, 3.598950365e-01f, 9.351835099e-01f, 3.541635254e-01f,
+	9.373390119e-01f, 3.484186802e-01f, 9.394592236e-01f, 3.426607173e-01f,
+	9.415440652e-01f, 3.368898534e-01f, 9.435934582e-01f, 3.311063058e-01f,
+	9.456073254e-01f, 3.253102922e-01f, 9.475855910e-01f, 3.195020308e-01f,
+	9.495281806e-01f, 3.136817404e-01f, 9.514350210e-01f, 3.078496400e-01f,
+	9.533060404e-01f, 3.020059493e-01f, 9.551411683e-01f, 2.961508882e-01f,
+	9.569403357e-01f, 2.902846773e-01f, 9.587034749e-01f, 2.844075372e-01f,
+	9.604305194e-01f, 2.785196894e-01f, 9.621214043e-01f, 2.726213554e-01f,
+	9.637760658e-01f, 2.667127575e-01f, 9.653944417e-01f, 2.607941179e-01f,
+	9.669764710e-01f, 2.548656596e-01f, 9.685220943e-01f, 2.489276057e-01f,
+	9.700312532e-01f, 2.429801799e-01f, 9.715038910e-01f, 2.370236060e-01f,
+	9.729399522e-01f, 2.310581083e-01f, 9.743393828e-01f, 2.250839114e-01f,
+	9.757021300e-01f, 2.191012402e-01f, 9.770281427e-01f, 2.131103199e-01f,
+	9.783173707e-01f, 2.071113762e-01f, 9.795697657e-01f, 2.011046348e-01f,
+	9.807852804e-01f, 1.950903220e-01f, 9.819638691e-01f, 1.890686641e-01f,
+	9.831054874e-01f, 1.830398880e-01f, 9.842100924e-01f, 1.770042204e-01f,
+	9.852776424e-01f, 1.709618888e-01f, 9.863080972e-01f, 1.649131205e-01f,
+	9.873014182e-01f, 1.588581433e-01f, 9.882575677e-01f, 1.527971853e-01f,
+	9.891765100e-01f, 1.467304745e-01f, 9.900582103e-01f, 1.406582393e-01f,
+	9.909026354e-01f, 1.345807085e-01f, 9.917097537e-01f, 1.284981108e-01f,
+	9.924795346e-01f, 1.224106752e-01f, 9.932119492e-01f, 1.163186309e-01f,
+	9.939069700e-01f, 1.102222073e-01f, 9.945645707e-01f, 1.041216339e-01f,
+	9.951847267e-01f, 9.801714033e-02f, 9.957674145e-01f, 9.190895650e-02f,
+	9.963126122e-01f, 8.579731234e-02f, 9.968202993e-01f, 7.968243797e-02f,
+	9.972904567e-01f, 7.356456360e-02f, 9.977230666e-01f, 6.744391956e-02f,
+	9.981181129e-01f, 6.132073630e-02f, 9.984755806e-01f, 5.519524435e-02f,
+	9.987954562e-01f, 4.906767433e-02f, 9.990777278e-01f, 4.293825693e-02f,
+	9.993223846e-01f, 3.680722294e-02f, 9.995294175e-01f, 3.067480318e-02f,
+	9.996988187e-01f, 2.454122852e-02f, 9.998305818e-01f, 1.840672991e-02f,
+	9.999247018e-01f, 1.227153829e-02f, 9.999811753e-01f, 6.135884649e-03f,
+	1.000000000e+00f, 6.123233996e-17f, 9.999811753e-01f, -6.135884649e-03f,
+	9.999247018e-01f, -1.227153829e-02f, 9.998305818e-01f, -1.840672991e-02f,
+	9.996988187e-01f, -2.454122852e-02f, 9.995294175e-01f, -3.067480318e-02f,
+	9.993223846e-01f, -3.680722294e-02f, 9.990777278e-01f, -4.293825693e-02f,
+	9.987954562e-01f, -4.906767433e-02f, 9.984755806e-01f, -5.519524435e-02f,
+	9.981181129e-01f, -6.132073630e-02f, 9.977230666e-01f, -6.744391956e-02f,
+	9.972904567e-01f, -7.356456360e-02f, 9.968202993e-01f, -7.968243797e-02f,
+	9.963126122e-01f, -8.579731234e-02f, 9.957674145e-01f, -9.190895650e-02f,
+	9.951847267e-01f, -9.801714033e-02f, 9.945645707e-01f, -1.041216339e-01f,
+	9.939069700e-01f, -1.102222073e-01f, 9.932119492e-01f, -1.163186309e-01f,
+	9.924795346e-01f, -1.224106752e-01f, 9.917097537e-01f, -1.284981108e-01f,
+	9.909026354e-01f, -1.345807085e-01f, 9.900582103e-01f, -1.406582393e-01f,
+	9.891765100e-01f, -1.467304745e-01f, 9.882575677e-01f, -1.527971853e-01f,
+	9.873014182e-01f, -1.588581433e-01f, 9.863080972e-01f, -1.649131205e-01f,
+	9.852776424e-01f, -1.709618888e-01f, 9.842100924e-01f, -1.770042204e-01f,
+	9.831054874e-01f, -1.830398880e-01f, 9.819638691e-01f, -1.890686641e-01f,
+	9.807852804e-01f, -1.950903220e-01f, 9.795697657e-01f, -2.011046348e-01f,
+	9.783173707e-01f, -2.071113762e-01f, 9.770281427e-01f, -2.131103199e-01f,
+	9.757021300e-01f, -2.191012402e-01f, 9.743393828e-01f, -2.250839114e-01f,
+	9.729399522e-01f, -2.310581083e-01f, 9.715038910e-01f, -2.370236060e-01f,
+	9.700312532e-01f, -2.429801799e-01f, 9.685220943e-01f, -2.489276057e-01f,
+	9.669764710e-01f, -2.548656596e-01f, 9.653944417e-01f, -2.607941179e-01f,
+	9.637760658e-01f, -2.667127575e-01f, 9.621214043e-01f, -2.726213554e-01f,
+	9.604305194e-01f, -2.785196894e-01f, 9.587034749e-01f, -2.844075372e-01f,
+	9.569403357e-01f, -2.902846773e-01f, 9.551411683e-01f, -2.961508882e-01f,
+	9.533060404e-01f, -3.020059493e-01f, 9.514350210e-01f, -3.078496400e-01f,
+	9.495281806e-01f, -3.136817404e-01f, 9.475855910e-01f, -3.195020308e-01f,
+	9.456073254e-01f, -3.253102922e-01f, 9.435934582e-01f, -3.311063058e-01f,
+	9.415440652e-01f, -3.368898534e-01f, 9.394592236e-01f, -3.426607173e-01f,
+	9.373390119e-01f, -3.484186802e-01f, 9.351835099e-01f, -3.541635254e-01f,
+	9.329927988e-01f, -3.598950365e-01f, 9.307669611e-01f, -3.656129978e-01f,
+	9.285060805e-01f, -3.713171940e-01f, 9.262102421e-01f, -3.770074102e-01f,
+	9.238795325e-01f, -3.826834324e-01f, 9.215140393e-01f, -3.883450467e-01f,
+	9.191138517e-01f, -3.939920401e-01f, 9.166790599e-01f, -3.996241998e-01f,
+	9.142097557e-01f, -4.052413140e-01f, 9.117060320e-01f, -4.108431711e-01f,
+	9.091679831e-01f, -4.164295601e-01f, 9.065957045e-01f, -4.220002708e-01f,
+	9.039892931e-01f, -4.275550934e-01f, 9.013488470e-01f, -4.330938189e-01f,
+	8.986744657e-01f, -4.386162385e-01f, 8.959662498e-01f, -4.441221446e-01f,
+	8.932243012e-01f, -4.496113297e-01f, 8.904487232e-01f, -4.550835871e-01f,
+	8.876396204e-01f, -4.605387110e-01f, 8.847970984e-01f, -4.659764958e-01f,
+	8.819212643e-01f, -4.713967368e-01f, 8.790122264e-01f, -4.767992301e-01f,
+	8.760700942e-01f, -4.821837721e-01f, 8.730949784e-01f, -4.875501601e-01f,
+	8.700869911e-01f, -4.928981922e-01f, 8.670462455e-01f, -4.982276670e-01f,
+	8.639728561e-01f, -5.035383837e-01f, 8.608669386e-01f, -5.088301425e-01f,
+	8.577286100e-01f, -5.141027442e-01f, 8.545579884e-01f, -5.193559902e-01f,
+	8.513551931e-01f, -5.245896827e-01f, 8.481203448e-01f, -5.298036247e-01f,
+	8.448535652e-01f, -5.349976199e-01f, 8.415549774e-01f, -5.401714727e-01f,
+	8.382247056e-01f, -5.453249884e-01f, 8.348628750e-01f, -5.504579729e-01f,
+	8.314696123e-01f, -5.555702330e-01f, 8.280450453e-01f, -5.606615762e-01f,
+	8.245893028e-01f, -5.657318108e-01f, 8.211025150e-01f, -5.707807459e-01f,
+	8.175848132e-01f, -5.758081914e-01f, 8.140363297e-01f, -5.808139581e-01f,
+	8.104571983e-01f, -5.857978575e-01f, 8.068475535e-01f, -5.907597019e-01f,
+	8.032075315e-01f, -5.956993045e-01f, 7.995372691e-01f, -6.006164794e-01f,
+	7.958369046e-01f, -6.055110414e-01f, 7.921065773e-01f, -6.103828063e-01f,
+	7.883464276e-01f, -6.152315906e-01f, 7.845565972e-01f, -6.200572118e-01f,
+	7.807372286e-01f, -6.248594881e-01f, 7.768884657e-01f, -6.296382389e-01f,
+	7.730104534e-01f, -6.343932842e-01f, 7.691033376e-01f, -6.391244449e-01f,
+	7.651672656e-01f, -6.438315429e-01f, 7.612023855e-01f, -6.485144010e-01f,
+	7.572088465e-01f, -6.531728430e-01f, 7.531867990e-01f, -6.578066933e-01f,
+	7.491363945e-01f, -6.624157776e-01f, 7.450577854e-01f, -6.669999223e-01f,
+	7.409511254e-01f, -6.715589548e-01f, 7.368165689e-01f, -6.760927036e-01f,
+	7.326542717e-01f, -6.806009978e-01f, 7.284643904e-01f, -6.850836678e-01f,
+	7.242470830e-01f, -6.895405447e-01f, 7.200025080e-01f, -6.939714609e-01f,
+	7.157308253e-01f, -6.983762494e-01f, 7.114321957e-01f, -7.027547445e-01f,
+	7.071067812e-01f, -7.071067812e-01f, 7.027547445e-01f, -7.114321957e-01f,
+	6.983762494e-01f, -7.157308253e-01f, 6.939714609e-01f, -7.200025080e-01f,
+	6.895405447e-01f, -7.242470830e-01f, 6.850836678e-01f, -7.284643904e-01f,
+	6.806009978e-01f, -7.326542717e-01f, 6.760927036e-01f, -7.368165689e-01f,
+	6.715589548e-01f, -7.409511254e-01f, 6.669999223e-01f, -7.450577854e-01f,
+	6.624157776e-01f, -7.491363945e-01f, 6.578066933e-01f, -7.531867990e-01f,
+	6.531728430e-01f, -7.572088465e-01f, 6.485144010e-01f, -7.612023855e-01f,
+	6.438315429e-01f, -7.651672656e-01f, 6.391244449e-01f, -7.691033376e-01f,
+	6.343932842e-01f, -7.730104534e-01f, 6.296382389e-01f, -7.768884657e-01f,
+	6.248594881e-01f, -7.807372286e-01f, 6.200572118e-01f, -7.845565972e-01f,
+	6.152315906e-01f, -7.883464276e-01f, 6.103828063e-01f, -7.921065773e-01f,
+	6.055110414e-01f, -7.958369046e-01f, 6.006164794e-01f, -7.995372691e-01f,
+	5.956993045e-01f, -8.032075315e-01f, 5.907597019e-01f, -8.068475535e-01f,
+	5.857978575e-01f, -8.104571983e-01f, 5.808139581e-01f, -8.140363297e-01f,
+	5.758081914e-01f, -8.175848132e-01f, 5.707807459e-01f, -8.211025150e-01f,
+	5.657318108e-01f, -8.245893028e-01f, 5.606615762e-01f, -8.280450453e-01f,
+	5.555702330e-01f, -8.314696123e-01f, 5.504579729e-01f, -8.348628750e-01f,
+	5.453249884e-01f, -8.382247056e-01f, 5.401714727e-01f, -8.415549774e-01f,
+	5.349976199e-01f, -8.448535652e-01f, 5.298036247e-01f, -8.481203448e-01f,
+	5.245896827e-01f, -8.513551931e-01f, 5.193559902e-01f, -8.545579884e-01f,
+	5.141027442e-01f, -8.577286100e-01f, 5.088301425e-01f, -8.608669386e-01f,
+	5.035383837e-01f, -8.639728561e-01f, 4.982276670e-01f, -8.670462455e-01f,
+	4.928981922e-01f, -8.700869911e-01f, 4.875501601e-01f, -8.730949784e-01f,
+	4.821837721e-01f, -8.760700942e-01f, 4.767992301e-01f, -8.790122264e-01f,
+	4.713967368e-01f, -8.819212643e-01f, 4.659764958e-01f, -8.847970984e-01f,
+	4.605387110e-01f, -8.876396204e-01f, 4.550835871e-01f, -8.904487232e-01f,
+	4.496113297e-01f, -8.932243012e-01f, 4.441221446e-01f, -8.959662498e-01f,
+	4.386162385e-01f, -8.986744657e-01f, 4.330938189e-01f, -9.013488470e-01f,
+	4.275550934e-01f, -9.039892931e-01f, 4.220002708e-01f, -9.065957045e-01f,
+	4.164295601e-01f, -9.091679831e-01f, 4.108431711e-01f, -9.117060320e-01f,
+	4.052413140e-01f, -9.142097557e-01f, 3.996241998e-01f, -9.166790599e-01f,
+	3.939920401e-01f, -9.191138517e-01f, 3.883450467e-01f, -9.215140393e-01f,
+	3.826834324e-01f, -9.238795325e-01f, 3.770074102e-01f, -9.262102421e-01f,
+	3.713171940e-01f, -9.285060805e-01f, 3.656129978e-01f, -9.307669611e-01f,
+	3.598950365e-01f, -9.329927988e-01f, 3.541635254e-01f, -9.351835099e-01f,
+	3.484186802e-01f, -9.373390119e-01f, 3.426607173e-01f, -9.394592236e-01f,
+	3.368898534e-01f, -9.415440652e-01f, 3.311063058e-01f, -9.435934582e-01f,
+	3.253102922e-01f, -9.456073254e-01f, 3.195020308e-01f, -9.475855910e-01f,
+	3.136817404e-01f, -9.495281806e-01f, 3.078496400e-01f, -9.514350210e-01f,
+	3.020059493e-01f, -9.533060404e-01f, 2.961508882e-01f, -9.551411683e-01f,
+	2.902846773e-01f, -9.569403357e-01f, 2.844075372e-01f, -9.587034749e-01f,
+	2.785196894e-01f, -9.604305194e-01f, 2.726213554e-01f, -9.621214043e-01f,
+	2.667127575e-01f, -9.637760658e-01f, 2.607941179e-01f, -9.653944417e-01f,
+	2.548656596e-01f, -9.669764710e-01f, 2.489276057e-01f, -9.685220943e-01f,
+	2.429801799e-01f, -9.700312532e-01f, 2.370236060e-01f, -9.715038910e-01f,
+	2.310581083e-01f, -9.729399522e-01f, 2.250839114e-01f, -9.743393828e-01f,
+	2.191012402e-01f, -9.757021300e-01f, 2.131103199e-01f, -9.770281427e-01f,
+	2.071113762e-01f, -9.783173707e-01f, 2.011046348e-01f, -9.795697657e-01f,
+	1.950903220e-01f, -9.807852804e-01f, 1.890686641e-01f, -9.819638691e-01f,
+	1.830398880e-01f, -9.831054874e-01f, 1.770042204e-01f, -9.842100924e-01f,
+	1.709618888e-01f, -9.852776424e-01f, 1.649131205e-01f, -9.863080972e-01f,
+	1.588581433e-01f, -9.873014182e-01f, 1.527971853e-01f, -9.882575677e-01f,
+	1.467304745e-01f, -9.891765100e-01f, 1.406582393e-01f, -9.900582103e-01f,
+	1.345807085e-01f, -9.909026354e-01f, 1.284981108e-01f, -9.917097537e-01f,
+	1.224106752e-01f, -9.924795346e-01f, 1.163186309e-01f, -9.932119492e-01f,
+	1.102222073e-01f, -9.939069700e-01f, 1.041216339e-01f, -9.945645707e-01f,
+	9.801714033e-02f, -9.951847267e-01f, 9.190895650e-02f, -9.957674145e-01f,
+	8.579731234e-02f, -9.963126122e-01f, 7.968243797e-02f, -9.968202993e-01f,
+	7.356456360e-02f, -9.972904567e-01f, 6.744391956e-02f, -9.977230666e-01f,
+	6.132073630e-02f, -9.981181129e-01f, 5.519524435e-02f, -9.984755806e-01f,
+	4.906767433e-02f, -9.987954562e-01f, 4.293825693e-02f, -9.990777278e-01f,
+	3.680722294e-02f, -9.993223846e-01f, 3.067480318e-02f, -9.995294175e-01f,
+	2.454122852e-02f, -9.996988187e-01f, 1.840672991e-02f, -9.998305818e-01f,
+	1.227153829e-02f, -9.999247018e-01f, 6.135884649e-03f, -9.999811753e-01f,
+};
+
+static const struct fft_tables_rfft_s fft_tables_rfft[] = {
+	{512, &arm_cfft_sR_f32_len256, fft_tables_twiddle_rfft_512},
+	{1024, &arm_cfft_sR_f32_len512, fft_tables_twiddle_rfft_1024},
+};
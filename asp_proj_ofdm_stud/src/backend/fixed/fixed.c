@@ -0,0 +1,284 @@
+#include "fixed.h"
+#include <math.h>
+#include <string.h>
+#include "../../macro.h"
+
+/** @brief Largest magnitude of the real and imaginary parts for which an FFT
+ * butterfly cannot overflow, 32767/(1+sqrt(2)) */
+#define FIXED_CFFT_BFP_LIMIT	(13572)
+
+/** @brief One period of a sine, with the first entry repeated at the end for interpolation */
+static q15_t fixed_nco_table[(1 << FIXED_NCO_TABLE_BITS) + 1];
+static bool fixed_nco_table_ready = false;
+
+/** @brief Shifts x right by shift bits, rounding to nearest */
+static inline int64_t fixed_round_shift(const int64_t x, const uint_fast8_t shift){
+	if(shift == 0){
+		return x;
+	}
+	return (x + ((int64_t) 1 << (shift - 1))) >> shift;
+}
+
+/** @brief Returns the accumulator shift that keeps a filter output within the
+ * q15 range, given the largest sum of coefficient magnitudes l1 contributing
+ * to one output */
+static uint_fast8_t fixed_headroom_shift(const int64_t l1){
+	uint_fast8_t shift = 0;
+	while((l1 << 15) > ((int64_t) INT16_MAX << shift)){
+		shift++;
+	}
+	return shift;
+}
+
+int_fast8_t fixed_exponent_f32(const float * src, const uint_fast32_t len){
+	uint_fast32_t i;
+	float max = 0;
+	for(i = 0; i < len; i++){
+		const float a = fabsf(src[i]);
+		if(a > max){
+			max = a;
+		}
+	}
+	if(max == 0){
+		return 0;
+	}
+	int exp;
+	frexpf(max, &exp);
+	return exp;
+}
+
+void fixed_from_f32(const float * src, const int_fast8_t exp, q15_t * dst, const uint_fast32_t len){
+	uint_fast32_t i;
+	const float scale = ldexpf(1.0f, 15 - exp);
+	for(i = 0; i < len; i++){
+		const float x = src[i] * scale;
+		dst[i] = fixed_sat_q15((int32_t) (x >= 0 ? x + 0.5f : x - 0.5f));
+	}
+}
+
+int_fast8_t fixed_from_f32_auto(const float * src, q15_t * dst, const uint_fast32_t len){
+	const int_fast8_t exp = fixed_exponent_f32(src, len);
+	fixed_from_f32(src, exp, dst, len);
+	return exp;
+}
+
+void fixed_to_f32(const q15_t * src, const int_fast8_t exp, float * dst, const uint_fast32_t len){
+	uint_fast32_t i;
+	const float scale = ldexpf(1.0f, exp - 15);
+	for(i = 0; i < len; i++){
+		dst[i] = src[i] * scale;
+	}
+}
+
+void fixed_to_f32_add(const q15_t * src, const int_fast8_t exp, float * dst, const uint_fast32_t len){
+	uint_fast32_t i;
+	const float scale = ldexpf(1.0f, exp - 15);
+	for(i = 0; i < len; i++){
+		dst[i] += src[i] * scale;
+	}
+}
+
+void fixed_shift_right(q15_t * data, const uint_fast8_t shift, const uint_fast32_t len){
+	uint_fast32_t i;
+	if(shift == 0){
+		return;
+	}
+	for(i = 0; i < len; i++){
+		data[i] = fixed_sat_q15(fixed_round_shift(data[i], shift));
+	}
+}
+
+bool fixed_cfft_init(struct fixed_cfft_s * const s, const uint_fast16_t len){
+	uint_fast16_t k;
+	if(len < 2 || len > FIXED_CFFT_MAX_LEN || !ISPOW2(len)){
+		return false;
+	}
+	s->len = len;
+	for(k = 0; k < len / 2; k++){
+		const float w = M_TWOPI * k / len;
+		s->twiddle[2*k] = fixed_sat_q15((int32_t) roundf(arm_cos_f32(w) * 32768.0f));
+		s->twiddle[2*k+1] = fixed_sat_q15((int32_t) roundf(arm_sin_f32(w) * 32768.0f));
+	}
+	return true;
+}
+
+uint_fast8_t fixed_cfft_q15(const struct fixed_cfft_s * const s, q15_t * data, const bool inverse){
+	const uint_fast16_t n = s->len;
+	uint_fast16_t i, j, k, half;
+	uint_fast8_t scalings = 0;
+
+	//Reorder the input, so that the radix-2 decimation in time stages give the output in normal order
+	for(i = 1, j = 0; i < n; i++){
+		uint_fast16_t bit = n >> 1;
+		for(; j & bit; bit >>= 1){
+			j ^= bit;
+		}
+		j ^= bit;
+		if(i < j){
+			const q15_t re = data[2*i], im = data[2*i+1];
+			data[2*i] = data[2*j];
+			data[2*i+1] = data[2*j+1];
+			data[2*j] = re;
+			data[2*j+1] = im;
+		}
+	}
+
+	for(half = 1; half < n; half <<= 1){
+		//Halve the block if any butterfly of this stage could overflow
+		int_fast32_t max = 0;
+		for(i = 0; i < 2*n; i++){
+			const int_fast32_t a = data[i] < 0 ? -data[i] : data[i];
+			if(a > max){
+				max = a;
+			}
+		}
+		if(max > FIXED_CFFT_BFP_LIMIT){
+			fixed_shift_right(data, 1, 2*n);
+			scalings++;
+		}
+
+		const uint_fast16_t tw_step = n / (2 * half);
+		for(k = 0; k < half; k++){
+			const int32_t wr = s->twiddle[2*k*tw_step];
+			const int32_t wi = inverse ? s->twiddle[2*k*tw_step+1] : -s->twiddle[2*k*tw_step+1];
+			for(i = k; i < n; i += 2 * half){
+				j = i + half;
+				const int32_t tr = (int32_t) fixed_round_shift((int64_t) data[2*j] * wr - (int64_t) data[2*j+1] * wi, 15);
+				const int32_t ti = (int32_t) fixed_round_shift((int64_t) data[2*j] * wi + (int64_t) data[2*j+1] * wr, 15);
+				const int32_t ar = data[2*i], ai = data[2*i+1];
+				data[2*j] = fixed_sat_q15(ar - tr);
+				data[2*j+1] = fixed_sat_q15(ai - ti);
+				data[2*i] = fixed_sat_q15(ar + tr);
+				data[2*i+1] = fixed_sat_q15(ai + ti);
+			}
+		}
+	}
+	return scalings;
+}
+
+void fixed_fir_interpolate_init(struct fixed_fir_interpolate_s * const s,
+		const uint_fast8_t L,
+		const uint_fast16_t num_taps,
+		const q15_t * const coeffs,
+		const int_fast8_t coeffs_exp,
+		q15_t * const state){
+	uint_fast16_t phase, k;
+	int64_t l1_max = 1;
+	s->L = L;
+	s->phase_len = num_taps / L;
+	s->coeffs = coeffs;
+	s->state = state;
+	//Each output is formed by one polyphase component, so the largest of their norms sets the headroom
+	for(phase = 0; phase < L; phase++){
+		int64_t l1 = 0;
+		for(k = 0; k < s->phase_len; k++){
+			const int32_t c = coeffs[phase + k*L];
+			l1 += c < 0 ? -c : c;
+		}
+		if(l1 > l1_max){
+			l1_max = l1;
+		}
+	}
+	s->shift = fixed_headroom_shift(l1_max);
+	s->exp_delta = coeffs_exp + s->shift - 15;
+	memset(state, 0, (s->phase_len - 1) * sizeof(q15_t));
+}
+
+void fixed_fir_interpolate_q15(const struct fixed_fir_interpolate_s * const s, const q15_t * src, q15_t * dst, const uint_fast32_t len){
+	const uint_fast16_t phase_len = s->phase_len;
+	q15_t * state_cur = s->state + (phase_len - 1);
+	const q15_t * state = s->state;
+	uint_fast32_t n;
+	uint_fast16_t i, k;
+	for(n = 0; n < len; n++){
+		*state_cur++ = src[n];
+		for(i = s->L; i > 0; i--){
+			const q15_t * x = state;
+			const q15_t * c = s->coeffs + (i - 1);
+			int64_t acc = 0;
+			for(k = 0; k < phase_len; k++){
+				acc += (int32_t) *x++ * *c;
+				c += s->L;
+			}
+			*dst++ = fixed_sat_q15(fixed_round_shift(acc, s->shift));
+		}
+		state++;
+	}
+	//Keep the last phase_len - 1 samples for the next call
+	memmove(s->state, state, (phase_len - 1) * sizeof(q15_t));
+}
+
+void fixed_fir_decimate_init(struct fixed_fir_decimate_s * const s,
+		const uint_fast8_t M,
+		const uint_fast16_t num_taps,
+		const q15_t * const coeffs,
+		const int_fast8_t coeffs_exp,
+		q15_t * const state){
+	uint_fast16_t k;
+	int64_t l1 = 1;
+	s->M = M;
+	s->num_taps = num_taps;
+	s->coeffs = coeffs;
+	s->state = state;
+	for(k = 0; k < num_taps; k++){
+		const int32_t c = coeffs[k];
+		l1 += c < 0 ? -c : c;
+	}
+	s->shift = fixed_headroom_shift(l1);
+	s->exp_delta = coeffs_exp + s->shift - 15;
+	memset(state, 0, (num_taps - 1) * sizeof(q15_t));
+}
+
+void fixed_fir_decimate_q15(const struct fixed_fir_decimate_s * const s, const q15_t * src, q15_t * dst, const uint_fast32_t len){
+	const uint_fast16_t num_taps = s->num_taps;
+	q15_t * state_cur = s->state + (num_taps - 1);
+	const q15_t * state = s->state;
+	uint_fast32_t n;
+	uint_fast16_t k;
+	for(n = 0; n < len / s->M; n++){
+		for(k = 0; k < s->M; k++){
+			*state_cur++ = *src++;
+		}
+		int64_t acc = 0;
+		for(k = 0; k < num_taps; k++){
+			acc += (int32_t) state[k] * s->coeffs[k];
+		}
+		*dst++ = fixed_sat_q15(fixed_round_shift(acc, s->shift));
+		state += s->M;
+	}
+	//Keep the last num_taps - 1 samples for the next call
+	memmove(s->state, state, (num_taps - 1) * sizeof(q15_t));
+}
+
+void fixed_nco_init(struct fixed_nco_s * const s, const float f){
+	uint_fast16_t i;
+	if(!fixed_nco_table_ready){
+		for(i = 0; i <= (1 << FIXED_NCO_TABLE_BITS); i++){
+			const float w = M_TWOPI * i / (1 << FIXED_NCO_TABLE_BITS);
+			fixed_nco_table[i] = fixed_sat_q15((int32_t) roundf(arm_sin_f32(w) * 32768.0f));
+		}
+		fixed_nco_table_ready = true;
+	}
+	s->phase = 0;
+	s->inc = (uint32_t) (int64_t) (f * 4294967296.0f);
+}
+
+/** @brief Returns sin(2*pi*phase/2^32) as a q15 value, interpolated from the sine table */
+static inline int32_t fixed_nco_sin(const uint32_t phase){
+	const uint32_t idx = phase >> (32 - FIXED_NCO_TABLE_BITS);
+	const int32_t frac = (phase >> (32 - FIXED_NCO_TABLE_BITS - 15)) & 0x7FFF;
+	const int32_t a = fixed_nco_table[idx];
+	return a + (((fixed_nco_table[idx + 1] - a) * frac + (1 << 14)) >> 15);
+}
+
+void fixed_modulate_q15(struct fixed_nco_s * const s, const q15_t * re, const q15_t * im, q15_t * dst, const uint_fast32_t len){
+	uint_fast32_t i;
+	uint32_t phase = s->phase;
+	for(i = 0; i < len; i++){
+		const int32_t c = fixed_nco_sin(phase + (1UL << 30));
+		const int32_t sn = fixed_nco_sin(phase);
+		dst[i] = fixed_sat_q15(fixed_round_shift((int64_t) re[i] * c - (int64_t) im[i] * sn, 16));
+		phase += s->inc;
+	}
+	s->phase = phase;
+}
@@ -0,0 +1,148 @@
+/** @file Fixed-point signal processing kernels.
+ * The vendored CMSIS-DSP subset only contains floating point kernels, so the
+ * q15 kernels needed by the fixed-point OFDM chain are implemented here.
+ * Signals are stored as q15 mantissas sharing a block exponent, so that an
+ * element q of a block with exponent exp represents the value
+ * q * 2^exp / 32768. Each kernel either returns or documents by how much it
+ * changes the exponent, leaving the bookkeeping to the caller. Products are
+ * accumulated in 64 bits and all shifts round to nearest.
+ * The filters reserve headroom from the L1 norm of their coefficients, which
+ * guarantees that their outputs never saturate, while the FFT checks the
+ * magnitude of the block before every stage and only scales it down when a
+ * stage could overflow. */
+
+#ifndef FIXED_H_
+#define FIXED_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../arm_math.h"
+
+/** @brief Largest supported FFT length */
+#define FIXED_CFFT_MAX_LEN		(64)
+
+/** @brief Base two logarithm of the number of entries per period in the oscillator sine table */
+#define FIXED_NCO_TABLE_BITS	(8)
+
+/** @brief Saturates a 32-bit value to the q15 range */
+static inline q15_t fixed_sat_q15(const int32_t x){
+	if(x > INT16_MAX){
+		return INT16_MAX;
+	}else if(x < INT16_MIN){
+		return INT16_MIN;
+	}
+	return (q15_t) x;
+}
+
+/** @brief Returns the smallest exponent for which all len elements of src can be
+ * represented as q15 mantissas without saturating */
+int_fast8_t fixed_exponent_f32(const float * src, const uint_fast32_t len);
+
+/** @brief Converts len floats in src to q15 mantissas with exponent exp */
+void fixed_from_f32(const float * src, const int_fast8_t exp, q15_t * dst, const uint_fast32_t len);
+
+/** @brief Converts len floats in src to q15 mantissas with the smallest exponent that avoids saturation
+ * @return The exponent of dst */
+int_fast8_t fixed_from_f32_auto(const float * src, q15_t * dst, const uint_fast32_t len);
+
+/** @brief Converts len q15 mantissas with exponent exp in src to floats */
+void fixed_to_f32(const q15_t * src, const int_fast8_t exp, float * dst, const uint_fast32_t len);
+
+/** @brief Converts len q15 mantissas with exponent exp in src to floats and adds them to dst */
+void fixed_to_f32_add(const q15_t * src, const int_fast8_t exp, float * dst, const uint_fast32_t len);
+
+/** @brief Shifts len q15 mantissas in data right by shift bits, increasing their exponent by shift */
+void fixed_shift_right(q15_t * data, const uint_fast8_t shift, const uint_fast32_t len);
+
+/** @brief Instance for a complex q15 FFT */
+struct fixed_cfft_s {
+	uint_fast16_t len;						//!<- Number of complex points, a power of two
+	q15_t twiddle[FIXED_CFFT_MAX_LEN];		//!<- cos and sin of 2*pi*k/len for k < len/2, interleaved
+};
+
+/** @brief Initializes an FFT instance s for len complex points
+ * @return True on success, false if len is not a power of two in the range [2, FIXED_CFFT_MAX_LEN] */
+bool fixed_cfft_init(struct fixed_cfft_s * const s, const uint_fast16_t len);
+
+/** @brief Computes an in-place complex FFT with block floating point scaling.
+ * As for arm_cfft_f32, data holds interleaved real and imaginary parts and
+ * the output is in normal order. The inverse transform is not scaled by 1/len.
+ * @param s			The FFT instance to use
+ * @param data		Pointer to 2*len q15 values
+ * @param inverse	True for the inverse transform
+ * @return The number of times the block was halved, to be added to its exponent */
+uint_fast8_t fixed_cfft_q15(const struct fixed_cfft_s * const s, q15_t * data, const bool inverse);
+
+/** @brief Instance for a q15 polyphase interpolator, see arm_fir_interpolate_f32 */
+struct fixed_fir_interpolate_s {
+	uint_fast8_t L;				//!<- Interpolation factor
+	uint_fast16_t phase_len;	//!<- Number of coefficients per polyphase component
+	const q15_t * coeffs;		//!<- Coefficients, in the same order as for arm_fir_interpolate_f32
+	q15_t * state;				//!<- State buffer of phase_len + block_len - 1 samples
+	uint_fast8_t shift;			//!<- Right shift of the accumulator to the output
+	int_fast8_t exp_delta;		//!<- Exponent of the output minus the exponent of the input
+};
+
+/** @brief Initializes an interpolator
+ * @param s				The interpolator to initialize
+ * @param L				The interpolation factor
+ * @param num_taps		The number of coefficients, a multiple of L
+ * @param coeffs		The coefficients as q15 mantissas
+ * @param coeffs_exp	The exponent of coeffs
+ * @param state			State buffer of num_taps/L + block_len - 1 samples, where
+ * 						block_len is the largest number of input samples per call */
+void fixed_fir_interpolate_init(struct fixed_fir_interpolate_s * const s,
+		const uint_fast8_t L,
+		const uint_fast16_t num_taps,
+		const q15_t * const coeffs,
+		const int_fast8_t coeffs_exp,
+		q15_t * const state);
+
+/** @brief Interpolates len input samples in src to L*len output samples in dst.
+ * The exponent of dst is that of src plus s->exp_delta. */
+void fixed_fir_interpolate_q15(const struct fixed_fir_interpolate_s * const s, const q15_t * src, q15_t * dst, const uint_fast32_t len);
+
+/** @brief Instance for a q15 decimator, see arm_fir_decimate_f32 */
+struct fixed_fir_decimate_s {
+	uint_fast8_t M;				//!<- Decimation factor
+	uint_fast16_t num_taps;		//!<- Number of coefficients
+	const q15_t * coeffs;		//!<- Coefficients, in the same order as for arm_fir_decimate_f32
+	q15_t * state;				//!<- State buffer of num_taps + block_len - 1 samples
+	uint_fast8_t shift;			//!<- Right shift of the accumulator to the output
+	int_fast8_t exp_delta;		//!<- Exponent of the output minus the exponent of the input
+};
+
+/** @brief Initializes a decimator
+ * @param s				The decimator to initialize
+ * @param M				The decimation factor
+ * @param num_taps		The number of coefficients
+ * @param coeffs		The coefficients as q15 mantissas
+ * @param coeffs_exp	The exponent of coeffs
+ * @param state			State buffer of num_taps + block_len - 1 samples, where
+ * 						block_len is the largest number of input samples per call.
+ * 						Cleared on initialization. */
+void fixed_fir_decimate_init(struct fixed_fir_decimate_s * const s,
+		const uint_fast8_t M,
+		const uint_fast16_t num_taps,
+		const q15_t * const coeffs,
+		const int_fast8_t coeffs_exp,
+		q15_t * const state);
+
+/** @brief Decimates len input samples in src to len/M output samples in dst.
+ * The exponent of dst is that of src plus s->exp_delta. */
+void fixed_fir_decimate_q15(const struct fixed_fir_decimate_s * const s, const q15_t * src, q15_t * dst, const uint_fast32_t len);
+
+/** @brief Memory element for a numerically controlled oscillator */
+struct fixed_nco_s {
+	uint32_t phase;				//!<- Current phase, a full turn being 2^32
+	uint32_t inc;				//!<- Phase increment per sample
+};
+
+/** @brief Initializes an oscillator s to zero phase at frequency f [cycles/sample] */
+void fixed_nco_init(struct fixed_nco_s * const s, const float f);
+
+/** @brief Modulates a complex signal onto the carrier of oscillator s, keeping the real part.
+ * Computes dst = re*cos(w*n) - im*sin(w*n). The exponent of dst is one more than that of re and im. */
+void fixed_modulate_q15(struct fixed_nco_s * const s, const q15_t * re, const q15_t * im, q15_t * dst, const uint_fast32_t len);
+
+#endif /* FIXED_H_ */
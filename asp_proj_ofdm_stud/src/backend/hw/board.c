@@ -1,13 +1,13 @@
 #include "board.h"
 #include <stm32f4xx.h>
 #include <stm32f4xx_usart.h>
+#include <stm32f4xx_dma.h>
 #include <stm32f4xx_adc.h>
 #include "stm32f4_discovery.h"
 #include "stm32f4_discovery_audio_codec.h"
 #include "stm32f4xx_it.h"
 #include "headphone.h"
 #include "microphone.h"
-#include "pdm_filter.h"
 #include "../cbuf.h"
 #include "../../config.h"
 #include "../../util.h"
@@ -20,12 +20,21 @@
 #define SREG1_CMP	313
 #define BOARD_FINALIZE(x)	do{BUILD_BUG_ON(NUMEL(SREG1_INIT) >= PRINTF_MAX_STRING_SIZE);printf(SREG1_INIT);}while(0)
 
+/** @brief DMA stream and channel serving the USART2 transmitter */
+#define USART_TX_DMA_STREAM		DMA1_Stream6
+#define USART_TX_DMA_CHANNEL	DMA_Channel_4
+#define USART_TX_DMA_IRQ		DMA1_Stream6_IRQn
+#define USART_TX_DMA_FLAGS		(DMA_FLAG_TCIF6 | DMA_FLAG_HTIF6 | DMA_FLAG_TEIF6 | DMA_FLAG_DMEIF6 | DMA_FLAG_FEIF6)
+
 /** @brief Allocate space for the UART circular buffers */
 static cbuf_s usart_tx_cbuf;
 static cbuf_elem_t usart_tx_cbuf_pool[DEBUG_USART_TX_BUF_LEN];
 static cbuf_s usart_rx_cbuf;
 static cbuf_elem_t usart_rx_cbuf_pool[DEBUG_USART_RX_BUF_LEN];
 
+/** @brief Number of elements of usart_tx_cbuf being sent by the DMA, zero when idle */
+static volatile cbuf_idx_t usart_tx_dma_len = 0;
+
 /** @brief Store the button debouncer */
 struct btn_debounce_s btn_state = {
 		.int_top = ((DEBOUNCE_TIME_MIN_ms * 1.0e3) / BOARD_SYSTICK_FREQ_Hz),
@@ -44,6 +53,9 @@ static void board_init_systick(void);
 /** @brief Initialize the user button */
 static void board_init_userbtn(void);
 
+/** @brief Initialize the DWT cycle counter */
+static void board_init_cyccnt(void);
+
 /** @brief Finalizes all initialization */
 static void board_init_finalize(void);
 
@@ -55,6 +67,7 @@ void board_init(void){
 	board_init_diag_leds();
 	board_init_systick();
 	board_init_userbtn();
+	board_init_cyccnt();
 	board_init_finalize();
 }
 
@@ -121,15 +134,49 @@ bool board_get_btn(void){
 	return retval;
 }
 
+/** @brief Starts sending the oldest contiguous span of the transmit buffer, unless a transfer is already running.
+ * Must be called with interrupts disabled or from the DMA interrupt. */
+static void board_usart_tx_start(void){
+	const cbuf_elem_t * span;
+	if(usart_tx_dma_len != 0){
+		return;
+	}
+	const cbuf_idx_t len = cbuf_read_span(&usart_tx_cbuf, &span);
+	if(len == 0){
+		return;
+	}
+	usart_tx_dma_len = len;
+	DMA_ClearFlag(USART_TX_DMA_STREAM, USART_TX_DMA_FLAGS);
+	USART_TX_DMA_STREAM->M0AR = (uint32_t) span;
+	USART_TX_DMA_STREAM->NDTR = len;
+	DMA_Cmd(USART_TX_DMA_STREAM, ENABLE);
+}
+
 void board_usart_write(char data){
 	//Wait until there is free space in the buffer
 	while(cbuf_elems_free(&usart_tx_cbuf) == 0){};
 	ATOMIC(												\
 		cbuf_write(&usart_tx_cbuf, data);				\
-		USART_ITConfig(USART2, USART_IT_TXE, ENABLE);	\
+		board_usart_tx_start();							\
 	);
 }
 
+void board_usart_write_block(const void * data, uint_fast32_t len){
+	const cbuf_elem_t * ptr = data;
+	while(len > 0){
+		//Wait until there is free space in the buffer
+		while(cbuf_elems_free(&usart_tx_cbuf) == 0){};
+		const cbuf_idx_t written = cbuf_write_block(&usart_tx_cbuf, ptr, len);
+		ATOMIC(board_usart_tx_start());
+		ptr += written;
+		len -= written;
+	}
+}
+
+uint_fast32_t board_usart_tx_free(void){
+	return cbuf_elems_free(&usart_tx_cbuf);
+}
+
 bool board_get_usart_char(char * const data){
 	uint8_t data_t;
 	bool retval = cbuf_read(&usart_rx_cbuf, &data_t);
@@ -189,17 +236,44 @@ void board_toggle_led(enum board_led_e led){
 	}
 }
 
-void USART2_IRQHandler(){
-	if(USART_GetITStatus(USART2,USART_IT_TXE)){
-		cbuf_elem_t data;
-		ATOMIC(													\
-			if(cbuf_read(&usart_tx_cbuf, &data)){				\
-				USART_SendData(USART2, (char) data);			\
-			}else{												\
-				USART_ITConfig(USART2, USART_IT_TXE, DISABLE);	\
-			}													\
-		);
+uint32_t board_get_cycles(void){
+	return DWT->CYCCNT;
+}
+
+uint32_t board_get_block_cycles(void){
+	return (uint32_t) ((1.0f * SystemCoreClock * AUDIO_BLOCKSIZE) / audio_get_sample_rate());
+}
+
+/** @brief Releases the span of the finished or failed transfer and continues with the next one, if any */
+static void board_usart_tx_next(void){
+	ATOMIC(														\
+		cbuf_read_commit(&usart_tx_cbuf, usart_tx_dma_len);		\
+		usart_tx_dma_len = 0;									\
+		board_usart_tx_start();									\
+	);
+}
+
+void DMA1_Stream6_IRQHandler(){
+	if(DMA_GetFlagStatus(USART_TX_DMA_STREAM, DMA_FLAG_TEIF6) || DMA_GetFlagStatus(USART_TX_DMA_STREAM, DMA_FLAG_DMEIF6)){
+		//It is unknown how much of the span was sent, so it is dropped. Only a transfer error disables the stream,
+		//so it is stopped here before being restarted with the next span.
+		DMA_Cmd(USART_TX_DMA_STREAM, DISABLE);
+		while(DMA_GetCmdStatus(USART_TX_DMA_STREAM) != DISABLE){};
+		DMA_ClearFlag(USART_TX_DMA_STREAM, USART_TX_DMA_FLAGS);
+		board_usart_tx_next();
+		return;
+	}
+	//The FIFO is not used, so a FIFO error loses no data and only needs to be cleared
+	if(DMA_GetFlagStatus(USART_TX_DMA_STREAM, DMA_FLAG_FEIF6)){
+		DMA_ClearFlag(USART_TX_DMA_STREAM, DMA_FLAG_FEIF6);
+	}
+	if(DMA_GetITStatus(USART_TX_DMA_STREAM, DMA_IT_TCIF6)){
+		DMA_ClearITPendingBit(USART_TX_DMA_STREAM, DMA_IT_TCIF6);
+		board_usart_tx_next();
 	}
+}
+
+void USART2_IRQHandler(){
 	if(USART_GetITStatus(USART2, USART_IT_RXNE) || USART_GetITStatus(USART2, USART_IT_ORE)){
 		const char data = USART_ReceiveData(USART2);
 		cbuf_write(&usart_rx_cbuf, data);
@@ -235,6 +309,14 @@ static void board_init_userbtn(void){
 	btn_debounce_init(&btn_state);
 }
 
+static void board_init_cyccnt(void){
+	/* The cycle counter is part of the debug trace unit, which must be enabled
+	 * before the counter itself can be started */
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
 static void board_init_diag_leds(void){
 	/* Initialize LEDs */
 	STM_EVAL_LEDInit(LED3);
@@ -251,6 +333,7 @@ static void board_init_usart(void){
 	// Allocate space for initializer structures
 	GPIO_InitTypeDef GPIO_InitStruct;
 	USART_InitTypeDef USART_InitStruct;
+	DMA_InitTypeDef DMA_InitStruct;
 	NVIC_InitTypeDef NVIC_InitStructure;
 
 	// Enable APB1 peripheral clock for USART2
@@ -287,8 +370,29 @@ static void board_init_usart(void){
 	USART_Init(USART2, &USART_InitStruct);
 
 
-	// Configure interrupts, enable on transmit buffer empty and on recieve not empty. Set the interrupt priority to the lowest possible level
-	USART_ITConfig(USART2, USART_IT_TXE, ENABLE);
+	// Configure the DMA stream to feed the transmitter from usart_tx_cbuf, one contiguous span at a time
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA1, ENABLE);
+	DMA_DeInit(USART_TX_DMA_STREAM);
+	DMA_InitStruct.DMA_Channel = USART_TX_DMA_CHANNEL;
+	DMA_InitStruct.DMA_PeripheralBaseAddr = (uint32_t) &USART2->DR;
+	DMA_InitStruct.DMA_Memory0BaseAddr = (uint32_t) usart_tx_cbuf_pool;		// Set per transfer
+	DMA_InitStruct.DMA_DIR = DMA_DIR_MemoryToPeripheral;
+	DMA_InitStruct.DMA_BufferSize = 1;											// Set per transfer
+	DMA_InitStruct.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStruct.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStruct.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+	DMA_InitStruct.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+	DMA_InitStruct.DMA_Mode = DMA_Mode_Normal;
+	DMA_InitStruct.DMA_Priority = DMA_Priority_Low;
+	DMA_InitStruct.DMA_FIFOMode = DMA_FIFOMode_Disable;
+	DMA_InitStruct.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+	DMA_InitStruct.DMA_MemoryBurst = DMA_MemoryBurst_Single;
+	DMA_InitStruct.DMA_PeripheralBurst = DMA_PeripheralBurst_Single;
+	DMA_Init(USART_TX_DMA_STREAM, &DMA_InitStruct);
+	DMA_ITConfig(USART_TX_DMA_STREAM, DMA_IT_TC | DMA_IT_TE | DMA_IT_DME, ENABLE);
+	USART_DMACmd(USART2, USART_DMAReq_Tx, ENABLE);
+
+	// Configure interrupts, enable on recieve not empty and on completed or failed transmit DMA transfers. Set the interrupt priority to the lowest possible level
 	USART_ITConfig(USART2, USART_IT_RXNE, ENABLE);
 
 	NVIC_InitStructure.NVIC_IRQChannel = USART2_IRQn;
@@ -297,6 +401,9 @@ static void board_init_usart(void){
 	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
 	NVIC_Init(&NVIC_InitStructure);
 
+	NVIC_InitStructure.NVIC_IRQChannel = USART_TX_DMA_IRQ;
+	NVIC_Init(&NVIC_InitStructure);
+
 	// Finally, enable the USART
 	USART_Cmd(USART2, ENABLE);
 }
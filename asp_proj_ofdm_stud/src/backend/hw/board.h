@@ -4,6 +4,7 @@
 #define SRC_HW_BOARD_H_
 
 #include <stdbool.h>
+#include <stdint.h>
 
 /** @brief Enumerated type for designating a given status LED */
 enum board_led_e {board_led_red = 0, board_led_orange, board_led_green, board_led_blue};
@@ -17,6 +18,13 @@ bool board_get_btn(void);
 /** @brief Queues a character of data in the USART transmit buffer, if space is available */
 void board_usart_write(char data);
 
+/** @brief Queues len bytes of data in the USART transmit buffer, waiting for space as needed.
+ * Unlike repeated board_usart_write calls, the data is copied in contiguous pieces. */
+void board_usart_write_block(const void * data, uint_fast32_t len);
+
+/** @brief Returns the number of characters that can be queued in the USART transmit buffer without waiting */
+uint_fast32_t board_usart_tx_free(void);
+
 /** @brief Gets a character of data from the USART recieve buffer, if any is pending. Returns true if a character was available. */
 bool board_get_usart_char(char * data);
 
@@ -29,4 +37,12 @@ void board_set_led(enum board_led_e led, bool state);
 /** @brief Toggles a given LED's state */
 void board_toggle_led(enum board_led_e led);
 
+/** @brief Returns the free-running CPU cycle counter.
+ * Wraps around every 2^32 cycles (~25 s at 168 MHz), so only differences
+ * between two readings are meaningful. */
+uint32_t board_get_cycles(void);
+
+/** @brief Returns the number of CPU cycles corresponding to one block of AUDIO_BLOCKSIZE samples */
+uint32_t board_get_block_cycles(void);
+
 #endif /* SRC_HW_BOARD_H_ */
@@ -11,6 +11,7 @@
 #include <string.h>
 #include <math.h>
 #include "headphone.h"
+#include "outring.h"
 #include "../../main.h"
 #include "../../config.h"
 #include "microphone.h"
@@ -21,19 +22,27 @@
 #include "../systime/systime.h"
 #include "../../blocks/sources.h"
 #include "../printfn/printfn.h"
+#include "../profile/profile.h"
+#include "../pcm/pcm.h"
+#include "../capture/capture.h"
+#include "../../util.h"
+#include "arm_math.h"
 #include "blocks/sinks.h"
 
 /*
- * We have three buffers: two output buffers used in a ping-pong arrangement, and an input
- * (microphone) circular buffer. Because the output buffers are written directly to the I2S
- * interface with DMA, they must be stereo. The microphone buffer is mono and its duration
- * is exactly 3 times the length of one of the ping-pong buffers. The idea is that during
- * normal operation, the microphone buffer will vary between about 1/3 full and 2/3 full
- * (with a 1/3 buffer margin on either side).
+ * We have two buffers: an output ring of AUDIO_OUT_BUFFERS blocks which is played by circular
+ * DMA, and an input (microphone) circular buffer. Because the output ring is written directly to
+ * the I2S interface with DMA, it must be stereo. The DMA half transfer and transfer complete
+ * interrupts each release half of the output blocks, which the main loop then refills. The
+ * microphone buffer is mono and holds two blocks more than are released at a time. The idea is
+ * that during normal operation, the microphone buffer will never hold less than about one block
+ * nor more than AUDIO_OUT_BUFFERS/2 + 1 blocks (with a one block margin on either side).
  */
-#define MIC_BUFFER_SAMPLES (OUTRAW_BUFFER_SAMPLES * 3 / 2)
+#define MIC_BUFFER_SAMPLES (AUDIO_BLOCKSIZE * (AUDIO_OUT_BUFFERS / 2 + 2))
 
-static int16_t buff0 [OUTRAW_BUFFER_SAMPLES], buff1 [OUTRAW_BUFFER_SAMPLES], micbuff [MIC_BUFFER_SAMPLES];
+//The output ring is written a stereo sample pair at a time, so it must be 32-bit aligned
+static int16_t outbuff [AUDIO_OUT_BUFFERS][OUTRAW_BUFFER_SAMPLES] __attribute__((aligned(4)));
+static int16_t micbuff [MIC_BUFFER_SAMPLES];
 
 /** @brief For ease of use every call to fill_buffer will also fill this array
  * with the oldest pending data in the microphone buffer. This ensures that the
@@ -46,7 +55,9 @@ float processed_micdata[AUDIO_BLOCKSIZE] = {0.0f};
 static volatile uint16_t mic_head = 0;
 static volatile uint16_t mic_tail = 0;
 
-static volatile uint8_t next_buff = 0;	// next output buffer to write
+//Free-running counts of output blocks filled by the main loop and played by the DMA
+static volatile uint32_t out_filled = 0;
+static volatile uint32_t out_played = 0;
 
 //Data location to store new left and right data streams
 float * WavePlayBackLeftData;
@@ -54,8 +65,12 @@ float * WavePlayBackRightData;
 
 static void fill_buffer (int16_t *buffer);
 
+/** @brief The sample rate requested by the application, and the rate the hardware was started at */
+static volatile uint32_t sample_rate = AUDIO_SAMPLE_RATE;
+static uint32_t hw_sample_rate;
+
 /** @brief Is set true if we get a buffer underflow during operation */
-static bool buf_underflow = false;
+static volatile bool buf_underflow = false;
 
 /** @brief Initialize all playback */
 static void WavePlayerInit(void);
@@ -89,53 +104,83 @@ void WaveRecorderCallback (int16_t *buffer, int num_samples){
 	}
 }
 
-void WavePlayBack(void){
+bool audio_set_sample_rate(uint32_t fs){
+	if(!AUDIO_SAMPLE_RATE_IS_VALID(fs)){
+		return false;
+	}
+	sample_rate = fs;
+	return true;
+}
+
+uint32_t audio_get_sample_rate(void){
+	return sample_rate;
+}
+
+/** @brief Cycle count at the start of fill_buffer */
+static uint32_t block_start_cycles = 0;
+
+uint32_t audio_get_block_start_cycles(void){
+	return block_start_cycles;
+}
+
+/** @brief Starts the microphone and the output at the requested sample rate */
+static void WavePlayBackStart(void){
+	hw_sample_rate = sample_rate;
+	mic_head = 0;
+	mic_tail = 0;
+
 	/* First, we start sampling internal microphone */
 	WaveRecorderBeginSampling();
 
 	/* Initialize wave player (Codec, DMA, I2C) */
 	WavePlayerInit();
 
-	/* Let the microphone data buffer get 2/3 full (which is 2 playback buffers) */
-	while(mic_head < MIC_BUFFER_SAMPLES * 2 / 3){};
-
-	/* Fill the second playback buffer (the first will just be zeros to start) */
-	fill_buffer (buff1);
+	/* Let the microphone data buffer hold one block as a margin */
+	while(mic_head < AUDIO_BLOCKSIZE){};
+
+	/* Start circular audio playback of the output ring (which is all zeros now).
+	 * The whole ring is regarded as filled, so the first blocks are requested
+	 * once the first half has been played. */
+	BUILD_BUG_ON(NUMEL(outbuff) * OUTRAW_BUFFER_SAMPLES > DMA_MAX_SZE);
+	memset(outbuff, 0, sizeof(outbuff));
+	buf_underflow = false;
+	out_played = 0;
+	out_filled = outring_start_filled(AUDIO_OUT_BUFFERS);
+	Audio_MAL_Play((uint32_t)outbuff, sizeof(outbuff));
+}
 
-	/* Start audio playback on the first buffer (which is all zeros now) */
-	Audio_MAL_Play((uint32_t)buff0, OUTRAW_BUFFER_SAMPLES * 2);
-	next_buff = 1;
+/** @brief Stops the output and the microphone */
+static void WavePlayBackStop(void){
+	EVAL_AUDIO_Stop(CODEC_PDWN_SW);
+	EVAL_AUDIO_DeInit();
+	WaveRecorderEndSampling();
+}
 
-	bool exec_time = false;	//Used to ensure the execution time does not exceed the maximum processing time allowed per AUDIO_BLOCKSIZE samples
+void WavePlayBack(void){
+	WavePlayBackStart();
 
-	/* This is the main loop of the program. We simply wait for a buffer to be exhausted
-	* and then we refill it. The callback (which is triggered by DMA completion) actually
-	* handles starting the next buffer playing, so we don't need to be worried about that
-	* latency here.
+	/* This is the main loop of the program. We simply wait for an output block to be released
+	* and then we refill it. The DMA keeps playing the ring on its own, and the callbacks
+	* (which are triggered by DMA half and full completion) only account for the blocks played,
+	* so we don't need to be worried about that latency here. As long as the main loop stays
+	* ahead of the DMA, processing a single block may take more than one block period.
 	*/
-
-	int16_t *nextbuf_ptr = buff0;
-	int16_t next_buff_idx = 1;
-
 	for(;;){
-		exec_time = false;
-		while (next_buff == next_buff_idx){
+		while (!outring_can_fill(out_filled, out_played, AUDIO_OUT_BUFFERS)){
 			main_idle();
-			exec_time = true;
 		}
-		if(exec_time == false){
-			//We spent too much time in main_idle. Send an error message and halt.
+		if(buf_underflow){
+			//The DMA reached blocks that were not yet filled. Send an error message and halt.
 			halt_error(DEBUG_TIME_OVERFLOWMSG);
 		}
 
-		fill_buffer(nextbuf_ptr);
+		fill_buffer(outbuff[outring_fill_index(out_filled, AUDIO_OUT_BUFFERS)]);
+		out_filled++;
 
-		if(next_buff_idx == 1){
-			next_buff_idx = 0;
-			nextbuf_ptr = buff1;
-		}else{
-			next_buff_idx = 1;
-			nextbuf_ptr = buff0;
+		if(sample_rate != hw_sample_rate){
+			//The application changed the sample rate, restart all audio hardware at the new rate
+			WavePlayBackStop();
+			WavePlayBackStart();
 		}
 	}
 }
@@ -145,26 +190,29 @@ static void WavePlayerInit(void){
 	EVAL_AUDIO_SetAudioInterface(AUDIO_INTERFACE_I2S);
 
 	/* Initialize the Audio codec and all related peripherals (I2S, I2C, IOExpander, IOs...) */
-	EVAL_AUDIO_Init(OUTPUT_DEVICE_AUTO, AUDIO_VOLUME, AUDIO_SAMPLE_RATE);
+	EVAL_AUDIO_Init(OUTPUT_DEVICE_AUTO, AUDIO_VOLUME, hw_sample_rate);
 
 	//Update the pointers to the output buffers
 	WavePlayBackRightData = blocks_sinks_rightout_ptr();
 	WavePlayBackLeftData = blocks_sinks_leftout_ptr();
 }
 
-void EVAL_AUDIO_TransferComplete_CallBack(uint32_t pBuffer, uint32_t Size){
-	if(!buf_underflow){
-		if (next_buff == 0) {
-			Audio_MAL_Play((uint32_t)buff0, OUTRAW_BUFFER_SAMPLES * 2);
-			next_buff = 1;
-		}else{
-			Audio_MAL_Play((uint32_t)buff1, OUTRAW_BUFFER_SAMPLES * 2);
-			next_buff = 0;
-		}
+/** @brief Releases the half of the output ring the DMA has just finished playing.
+ * The DMA has now started on the other half, which must already be filled. */
+static void WavePlayerReleaseHalf(void){
+	out_played = outring_release_half(out_played, AUDIO_OUT_BUFFERS);
+	if(outring_underflow(out_filled, out_played, AUDIO_OUT_BUFFERS)){
+		buf_underflow = true;
 	}
 }
+
+void EVAL_AUDIO_TransferComplete_CallBack(uint32_t pBuffer, uint32_t Size){
+	WavePlayerReleaseHalf();
+}
  
-void EVAL_AUDIO_HalfTransfer_CallBack(uint32_t pBuffer, uint32_t Size){}
+void EVAL_AUDIO_HalfTransfer_CallBack(uint32_t pBuffer, uint32_t Size){
+	WavePlayerReleaseHalf();
+}
 
 void EVAL_AUDIO_Error_CallBack(void* pData){
 	for(;;){};	//Hang on error
@@ -174,35 +222,48 @@ uint16_t EVAL_AUDIO_GetSampleCallBack(void){
   return 0;
 }
 
+/** @brief Profiling scopes for the parts of each block handled by the backend */
+static PROFILE_SCOPE(mic_prof, "mic convert");
+static PROFILE_SCOPE(callback_prof, "audio callback");
+static PROFILE_SCOPE(out_prof, "output convert");
+
 static void fill_buffer (int16_t *buffer){
+	block_start_cycles = board_get_cycles();
+	profile_block_begin();
 	//Prepare the microphone data
+	profile_begin(&mic_prof);
 	{
-		int i;
-		for(i = 0; i < AUDIO_BLOCKSIZE; i++){
-			if(mic_tail != mic_head){
-				processed_micdata[i] = (micbuff[mic_tail]*1.0f)/INT16_MAX;
-				mic_tail = (mic_tail + 1 >= MIC_BUFFER_SAMPLES) ? 0 : mic_tail + 1;
-			}else{
-				processed_micdata[i] = 0.0f;
-			}
+		//Convert the pending samples as (at most) two contiguous spans of the ring, padding with zeros on underflow
+		const uint_fast32_t head = mic_head;
+		uint_fast32_t tail = mic_tail;
+		const uint_fast32_t pending = MIN((head + MIC_BUFFER_SAMPLES - tail) % MIC_BUFFER_SAMPLES, AUDIO_BLOCKSIZE);
+		uint_fast32_t done = 0;
+		while(done < pending){
+			const uint_fast32_t span = MIN(pending - done, MIC_BUFFER_SAMPLES - tail);
+			pcm_i16_to_f32(&micbuff[tail], &processed_micdata[done], span, 1.0f/INT16_MAX);
+			tail = (tail + span) % MIC_BUFFER_SAMPLES;
+			done += span;
+		}
+		mic_tail = tail;
+		if(done < AUDIO_BLOCKSIZE){
+			arm_fill_f32(0.0f, &processed_micdata[done], AUDIO_BLOCKSIZE - done);
 		}
 	}
+	capture_microphone(processed_micdata);
+	profile_end(&mic_prof);
 	//Update all varying signals
 	blocks_sources_update();
 	
 	//Calculate all output to generate.
+	profile_begin(&callback_prof);
 	main_audio_callback();
+	profile_end(&callback_prof);
+	blocks_sinks_update();
 
 	//Convert floating-point output to the machine representation
-	int i = 0;
-	while (i < AUDIO_BLOCKSIZE){
-		//Note that it is critical that the left data is written first, followed by the right data, to ensure the channels are not reversed
-		const float right_n = fsat(*(WavePlayBackRightData + i), -1.0f, 1.0f);
-		const float left_n = fsat(*(WavePlayBackLeftData + i), -1.0f, 1.0f);
-
-		*buffer++ = FtoI16(left_n);
-		*buffer++ = FtoI16(right_n);
-
-		i++;
-	}
+	//Note that it is critical that the left data is written first, followed by the right data, to ensure the channels are not reversed
+	profile_begin(&out_prof);
+	pcm_f32_to_i16_stereo(WavePlayBackLeftData, WavePlayBackRightData, buffer, AUDIO_BLOCKSIZE);
+	profile_end(&out_prof);
+	profile_block_end();
 }
@@ -10,6 +10,7 @@
 #define __HEADPHONE_H
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "../../config.h"
 
 /*
@@ -22,7 +23,24 @@
 void WaveRecorderCallback (int16_t *buffer, int num_samples);
 void WavePlayBack();
 
-/** @brief The oldest unread microphone data, filled before main_audio_callback is called */
+/** @brief Changes the sample rate of the microphone and the output.
+ * The new rate is returned by audio_get_sample_rate immediately, while the
+ * hardware is restarted at the new rate once the current block has been
+ * processed. Any output still queued at the old rate is discarded.
+ * @param fs	The new sample rate [Hz], see AUDIO_SAMPLE_RATE_IS_VALID
+ * @return True if the rate is valid and has been set */
+bool audio_set_sample_rate(uint32_t fs);
+
+/** @brief Returns the current sample rate [Hz] */
+uint32_t audio_get_sample_rate(void);
+
+/** @brief Returns the cycle count, as read by board_get_cycles, at which the
+ * processing of the current block started. Time budgets within
+ * main_audio_callback are measured from here. */
+uint32_t audio_get_block_start_cycles(void);
+
+/** @brief The oldest unread microphone data, filled before main_audio_callback is called.
+ * Converted directly from the microphone buffer, so it is the only copy of the block. */
 extern float processed_micdata[AUDIO_BLOCKSIZE];
 
 /** @brief Pointers to locations to write AUDIO_BLOCKSIZE samples to before main_audio_callback terminates */
@@ -42,9 +60,9 @@ void WavePlayerAddSamples(float * leftdata, float * rightdata);
  
 /*
  * @brief  Calculates the remaining file size and new position of the pointer.
- * Called when the previous DMA playback buffer is completed. Here we simply
- * start playing the other buffer and signal the main loop that it can refill
- * the buffer we just played.
+ * Called when the DMA has played the second half of the circular output ring.
+ * Here we simply signal the main loop that it can refill the blocks we just
+ * played.
  */
 void EVAL_AUDIO_TransferComplete_CallBack(uint32_t pBuffer, uint32_t Size);
 
@@ -54,7 +72,9 @@ void EVAL_AUDIO_TransferComplete_CallBack(uint32_t pBuffer, uint32_t Size);
  * a streaming scheme is used: When first Half buffer is already transferred load 
  * the new data to the first half of buffer while DMA is transferring data from 
  * the second half. And when Transfer complete occurs, load the second half of 
- * the buffer while the DMA is transferring from the first half
+ * the buffer while the DMA is transferring from the first half.
+ * Here it releases the first half of the output ring, like the transfer
+ * complete callback does for the second half.
  */
 void EVAL_AUDIO_HalfTransfer_CallBack(uint32_t pBuffer, uint32_t Size);
 
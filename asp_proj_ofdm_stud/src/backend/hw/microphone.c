@@ -11,11 +11,16 @@
 #include <stm32f4xx_rcc.h>
 #include <stm32f4xx_spi.h>
 #include <misc.h>
+#include <math.h>
 #include "microphone.h"
 #include "headphone.h"
 #include "../../config.h"
+#include "backend/pdm_fir/pdm_fir.h"
+#if MIC_PDM_LIBPDMFILTER
 #include "pdm_filter.h"
-#include "backend/cbuf.h"
+#endif
+#include "backend/spsc.h"
+#include "backend/profile/profile.h"
 #include "util.h"
 
 /* SPI Configuration defines */
@@ -32,24 +37,53 @@
 
 #define AUDIO_REC_SPI_IRQHANDLER          SPI2_IRQHandler
 
-/* The PDM filter used assumes that it will process 1 ms worth of samples. We
- * don't necessarily want this to be the case, so configure the filter for a
- * different sample rate (of our choosing), allowing us to set up a sample
- * length that is better. Furthermore, to avoid microphone SPI interrupt
- * overrruns perform all PCM processing in a lower-priority context. */
-#define PDM_DEC_FAC				(64)	    // Decimation rate for PDM/PCM conversion
-#define PDM_FILT_VIRT_FS		(16000)    	// Sample rate to simulate for PDM filter to achieve some desired block length
-#define PDM_BLOCK_LENGTH      	(PDM_FILT_VIRT_FS * PDM_DEC_FAC / (1000 * 8))       // Length of a single PDM block (bytes)
-#define PCM_BLOCK_LENGTH        (PDM_BLOCK_LENGTH/8)        // PCM buffer output size (16-bit words)
-#define PDM_BUF_BLOCKS			(8)			// Number of blocks that can be stored in PDM buffer
-
-static PDMFilter_InitStruct Filter;       	// PDM filter instance
-
-static cbuf_s pdm_buf;
-static cbuf_elem_t pdm_buf_pool[PDM_BLOCK_LENGTH * PDM_BUF_BLOCKS];
+/* The PDM bitstream is converted to PCM in two stages (see backend/pdm_fir): a
+ * lookup-table FIR filter on the PDM bits decimates to twice the audio sample
+ * rate, and a second FIR filter halves that rate, with its stopband starting at
+ * half the audio sample rate. The PDM bit rate is PDM_DEC_FAC times the audio
+ * sample rate, and the filter frequencies scale with it, so the filters suit
+ * any of the supported sample rates. The SPI clock and pre-filters are set up
+ * for the current sample rate each time sampling begins. To avoid microphone
+ * SPI interrupt overrruns all PCM processing is performed in a lower-priority
+ * context. */
+#define PDM_DEC_FAC				(64)	    // Decimation rate for PDM/PCM conversion, fixed by the filter tables generated by pdm_fir.py
+#define PDM_DEC_WORDS			(PDM_DEC_FAC/16)	// Number of 16-bit SPI words per PCM sample
+#define PCM_BLOCK_LENGTH        (16)        // Number of PCM samples converted at a time
+#define PDM_BLOCK_WORDS			(PCM_BLOCK_LENGTH*PDM_DEC_WORDS)	// Length of a single PDM block (16-bit SPI words)
+#define PDM_BUF_BLOCKS			(8)			// Number of blocks that can be stored in PDM buffer, must be a power of two
+#define PDM_MAX_GAIN			(16.0f)		// Gain applied to the filtered PDM signal at the maximum MIC_VOLUME
+
+static struct pdm_fir_filter pdm_filter;	// PDM decimation filter instance
+static struct pdm_fir_dec2 pdm_dec2;		// Second decimation stage
+
+#if MIC_PDM_LIBPDMFILTER
+/* The closed library converts 1 ms of PDM at its configured rate per call, so
+ * it is configured for 16 kHz, which gives the block length used here, with
+ * its filter frequencies scaled accordingly. */
+#define PDM_LIB_VIRT_FS			(16000)
+static PDMFilter_InitStruct pdm_lib_filter;	// PDM library filter instance
+#endif
+
+/** @brief State of the first-order PCM pre-filters, see WaveRecorderPCMFilter */
+struct pcm_prefilt_s {
+	float gain;		//Linear gain applied to the decimated signal
+	float hp_a;		//High-pass pole, or one if disabled
+	float lp_b;		//Low-pass update factor, or one if disabled
+	float hp_x1;	//Previous high-pass input
+	float hp_y1;	//Previous high-pass output
+	float lp_y1;	//Previous low-pass output
+};
+static struct pcm_prefilt_s prefilt;
+
+/* The SPI interrupt is the only writer and the SysTick PCM conversion the only
+ * reader of the PDM buffer, so a lock-free buffer can be used. */
+static spsc_s pdm_buf;
+static spsc_elem_t pdm_buf_pool[PDM_BLOCK_WORDS * PDM_BUF_BLOCKS];
 
 static bool micbuf_ovf = false;
 
+static PROFILE_SCOPE(pdm_prof, "pdm decimate");
+
 static void WaveRecorder_GPIO_Init(void);
 static void WaveRecorder_SPI_Init(void);
 static void WaveRecorder_NVIC_Init(void);
@@ -61,23 +95,37 @@ void WaveRecorderBeginSampling (void){
 	WaveRecorderStart();
 }
 
-static void WaveRecorderInit(){
-	/* Reset and enable CRC module */
-	CRC->CR = CRC_CR_RESET;
-	RCC->AHB1ENR |= RCC_AHB1ENR_CRCEN;
+void WaveRecorderEndSampling(void){
+	SPI_I2S_ITConfig(SPI2, SPI_I2S_IT_RXNE, DISABLE);
+	I2S_Cmd(SPI2, DISABLE);
+}
 
+static void WaveRecorderInit(){
 	//Set up the PDM buffer
-	cbuf_new(&pdm_buf, pdm_buf_pool, NUMEL(pdm_buf_pool));
+	BUILD_BUG_ON(!ISPOW2(NUMEL(pdm_buf_pool)));
+	spsc_new(&pdm_buf, pdm_buf_pool, NUMEL(pdm_buf_pool));
 
 	/* Filter LP & HP Init */
-	//Perform minimal input filtering
-	Filter.LP_HZ = MIC_LP_FC * (1.0f * PDM_FILT_VIRT_FS/AUDIO_SAMPLE_RATE);	//Scale the desired cutoff frequency with the simulated sample rate send to the PDM filter
-	Filter.HP_HZ = MIC_HP_FC * (1.0f * PDM_FILT_VIRT_FS/AUDIO_SAMPLE_RATE);
-	Filter.Fs = PDM_FILT_VIRT_FS;	//Force the PDM filter to assume a samplerate of 16khz, as this implies reading 8*64 PDM bits and outputting 16 PCM words
-	Filter.Out_MicChannels = 1;
-	Filter.In_MicChannels = 1;
-
-	PDM_Filter_Init((PDMFilter_InitStruct *)&Filter);
+	BUILD_BUG_ON(PDM_DEC_FAC != 64);
+	const float fs = audio_get_sample_rate();
+#if MIC_PDM_LIBPDMFILTER
+	BUILD_BUG_ON(PCM_BLOCK_LENGTH != PDM_LIB_VIRT_FS / 1000);
+	/* Reset and enable CRC module, which the library checks */
+	CRC->CR = CRC_CR_RESET;
+	RCC->AHB1ENR |= RCC_AHB1ENR_CRCEN;
+	pdm_lib_filter.LP_HZ = MIC_LP_FC * (PDM_LIB_VIRT_FS / fs);
+	pdm_lib_filter.HP_HZ = MIC_HP_FC * (PDM_LIB_VIRT_FS / fs);
+	pdm_lib_filter.Fs = PDM_LIB_VIRT_FS;
+	pdm_lib_filter.Out_MicChannels = 1;
+	pdm_lib_filter.In_MicChannels = 1;
+	PDM_Filter_Init(&pdm_lib_filter);
+#endif
+	pdm_fir_flt_init(&pdm_filter);
+	pdm_fir_dec2_init(&pdm_dec2);
+	prefilt.gain = PDM_MAX_GAIN * MIC_VOLUME / 100.0f;
+	prefilt.hp_a = MIC_HP_FC > 0 ? expf(-M_TWOPI * MIC_HP_FC / fs) : 1;
+	prefilt.lp_b = MIC_LP_FC > 0 ? 1 - expf(-M_TWOPI * MIC_LP_FC / fs) : 1;
+	prefilt.hp_x1 = prefilt.hp_y1 = prefilt.lp_y1 = 0;
 
 	/* Configure the GPIOs */
 	WaveRecorder_GPIO_Init();
@@ -100,26 +148,54 @@ static void WaveRecorderStart(void){
 void AUDIO_REC_SPI_IRQHANDLER(void){
 	/* Check if data are available in SPI Data register */
 	if (SPI_GetITStatus(SPI2, SPI_I2S_IT_RXNE) != RESET){
-		uint16_t raw = SPI_I2S_ReceiveData(SPI2);
-		if(!cbuf_write(&pdm_buf, (raw >> 8) & 0xFF) || !cbuf_write(&pdm_buf, raw & 0xFF)){
+		if(!spsc_write(&pdm_buf, SPI_I2S_ReceiveData(SPI2))){
 			micbuf_ovf = true;
 		}
 	}
 }
 
+/** @brief Applies the microphone gain and the optional first-order high- and
+ * low-pass filters to a block of decimated samples, saturating the output to
+ * the 16-bit range. */
+static void WaveRecorderPCMFilter(const int * in, int16_t * out, uint_fast32_t len){
+	uint_fast32_t i;
+	for(i = 0; i < len; i++){
+		float x = prefilt.gain * in[i];
+		float y = x - prefilt.hp_x1 + prefilt.hp_a * prefilt.hp_y1;
+		prefilt.hp_x1 = x;
+		prefilt.hp_y1 = y;
+		prefilt.lp_y1 += prefilt.lp_b * (y - prefilt.lp_y1);
+		y = prefilt.lp_y1;
+		out[i] = y > INT16_MAX ? INT16_MAX : y < INT16_MIN ? INT16_MIN : (int16_t) y;
+	}
+}
+
 void WaveRecorderPDMFiltCallback(void){
 	if(micbuf_ovf){
 		halt_error(DEBUG_MICBUG_OVERFLOWMSG);
 		for(;;){};
 	}
-	while(cbuf_elems_used(&pdm_buf) > PDM_BLOCK_LENGTH){
-		uint8_t pdm_bytes[PDM_BLOCK_LENGTH];
+	while(spsc_elems_used(&pdm_buf) >= PDM_BLOCK_WORDS){
+		uint16_t pdm_words[PDM_BLOCK_WORDS];
 		int16_t pcm_words[PCM_BLOCK_LENGTH];
+		spsc_read_block(&pdm_buf, pdm_words, NUMEL(pdm_words));
+		profile_begin(&pdm_prof);
+#if MIC_PDM_LIBPDMFILTER
+		uint8_t pdm_bytes[2*PDM_BLOCK_WORDS];
 		uint_fast32_t i;
-		for(i = 0; i < NUMEL(pdm_bytes); i++){
-			cbuf_read(&pdm_buf, &pdm_bytes[i]);
+		for(i = 0; i < NUMEL(pdm_words); i++){
+			pdm_bytes[2*i] = pdm_words[i] >> 8;
+			pdm_bytes[2*i + 1] = pdm_words[i] & 0xFF;
 		}
-		PDM_Filter_64_LSB(pdm_bytes, (uint16_t*) pcm_words, MIC_VOLUME, &Filter);
+		PDM_Filter_64_LSB(pdm_bytes, (uint16_t*) pcm_words, MIC_VOLUME, &pdm_lib_filter);
+#else
+		int pcm_2x[2*PCM_BLOCK_LENGTH];
+		int pcm_raw[PCM_BLOCK_LENGTH];
+		pdm_fir_flt_decimate(&pdm_filter, pdm_words, NUMEL(pdm_words), PDM_DEC_WORDS/2, pcm_2x, 16);
+		pdm_fir_dec2_decimate(&pdm_dec2, pcm_2x, NUMEL(pcm_2x), pcm_raw);
+		WaveRecorderPCMFilter(pcm_raw, pcm_words, NUMEL(pcm_words));
+#endif
+		profile_end(&pdm_prof);
 		WaveRecorderCallback(pcm_words, NUMEL(pcm_words));
 	}
 }
@@ -159,7 +235,7 @@ static void WaveRecorder_SPI_Init(void){
 
 	/* SPI configuration */
 	SPI_I2S_DeInit(SPI2);
-	I2S_InitStructure.I2S_AudioFreq = AUDIO_SAMPLE_RATE*2;
+	I2S_InitStructure.I2S_AudioFreq = audio_get_sample_rate()*2;
 	I2S_InitStructure.I2S_Standard = I2S_Standard_LSB;
 	I2S_InitStructure.I2S_DataFormat = I2S_DataFormat_16b;
 	I2S_InitStructure.I2S_CPOL = I2S_CPOL_High;
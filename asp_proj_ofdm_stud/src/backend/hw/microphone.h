@@ -13,9 +13,12 @@
 #include <stdbool.h>
 #include "stm32f4xx.h"
 
-/** @brief Triggers microphone sampling */
+/** @brief Triggers microphone sampling at the current sample rate */
 void WaveRecorderBeginSampling(void);
 
+/** @brief Stops microphone sampling, discarding any buffered PDM data */
+void WaveRecorderEndSampling(void);
+
 /** @brief Triggers filting any buffered PDM data */
 void WaveRecorderPDMFiltCallback(void);
 
@@ -0,0 +1,48 @@
+/** @file Accounting of the output ring played by circular DMA.
+ * The main loop fills the blocks of the ring in order and the DMA half
+ * transfer and transfer complete interrupts each release half of them. Both
+ * sides only count blocks, in free-running counters of the blocks filled and
+ * played, so that the ring can be indexed modulo its size. The DMA keeps
+ * playing when the main loop falls behind, so the played count can pass the
+ * filled count, and their difference is compared as a signed number. The
+ * functions are pure, taking the counters and the number of blocks in the
+ * ring, so that the accounting can be simulated on the PC (see
+ * tools/outring_sim.c). */
+
+#ifndef OUTRING_H_
+#define OUTRING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief Returns the number of blocks regarded as filled when the DMA is
+ * started, which is the whole ring, as the DMA must be started on a full ring */
+static inline uint32_t outring_start_filled(const uint32_t blocks){
+	return blocks;
+}
+
+/** @brief Returns whether the main loop may fill another block, or must wait
+ * for the DMA to release a half of the ring */
+static inline bool outring_can_fill(const uint32_t filled, const uint32_t played, const uint32_t blocks){
+	return (int32_t) (filled - played) < (int32_t) blocks;
+}
+
+/** @brief Returns the index in the ring of the next block to fill */
+static inline uint32_t outring_fill_index(const uint32_t filled, const uint32_t blocks){
+	return filled % blocks;
+}
+
+/** @brief Returns the number of blocks played after the DMA has released the
+ * half of the ring it just finished */
+static inline uint32_t outring_release_half(const uint32_t played, const uint32_t blocks){
+	return played + blocks / 2;
+}
+
+/** @brief Returns whether the half of the ring the DMA has started on after a
+ * release was not completely filled, which is a buffer underflow.
+ * @param played	Number of blocks played, after the release */
+static inline bool outring_underflow(const uint32_t filled, const uint32_t played, const uint32_t blocks){
+	return (int32_t) (filled - played) < (int32_t) (blocks / 2);
+}
+
+#endif /* OUTRING_H_ */
@@ -0,0 +1,175 @@
+#include "pcm.h"
+#include "../../macro.h"
+#include "../../util.h"
+#if defined(__ARM_FEATURE_DSP)
+#include "arm_math.h"
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/** @brief Saturates and converts one sample, as pcm_f32_to_i16_stereo.
+ * NaN is not ordered with the limits and is converted to 0 explicitly. */
+static inline int16_t pcm_sample(const float x){
+	return (x == x) ? FtoI16(fsat(x, -1.0f, 1.0f)) : 0;
+}
+
+#if defined(__ARM_FEATURE_DSP)
+
+/** @brief Converts a float to a 32-bit integer, rounding towards zero,
+ * saturating out-of-range values and converting NaN to 0.
+ * In C an out-of-range conversion is undefined, so on target VCVT is issued
+ * explicitly rather than relying on the compiler emitting it for a cast.
+ * Elsewhere the value is clamped before the cast. A host build emulating this
+ * path may define its own. */
+#ifndef PCM_CVT_S32
+#if defined(__arm__)
+static inline int32_t pcm_cvt_s32(const float x){
+	union {
+		float f;
+		int32_t i;
+	} y;
+	__asm__("vcvt.s32.f32 %0, %1" : "=t" (y.f) : "t" (x));
+	return y.i;
+}
+#else
+static inline int32_t pcm_cvt_s32(const float x){
+	if(x != x){
+		return 0;
+	}else if(x >= 2147483648.0f){
+		return INT32_MAX;
+	}else if(x < -2147483648.0f){
+		return INT32_MIN;
+	}
+	return (int32_t) x;
+}
+#endif
+#define PCM_CVT_S32(x)	pcm_cvt_s32(x)
+#endif
+
+/** @brief Converts one sample, as pcm_sample.
+ * The conversion to 32 bits saturates, so the scaled sample only needs to be
+ * saturated to 16 bits afterwards. Samples below -1 saturate to INT16_MIN,
+ * which is raised to -INT16_MAX to match the other implementations. */
+static inline int32_t pcm_sample_dsp(const float x){
+	return MAX(__SSAT(PCM_CVT_S32(x * INT16_MAX), 16), -INT16_MAX);
+}
+
+void pcm_f32_to_i16_stereo(const float * left, const float * right, int16_t * out, uint_fast32_t len){
+	uint32_t * out32 = (uint32_t *) out;
+	uint_fast32_t i;
+	for(i = 0; i < len; i += 2){
+		out32[i] = __PKHBT(pcm_sample_dsp(left[i]), pcm_sample_dsp(right[i]), 16);
+		out32[i + 1] = __PKHBT(pcm_sample_dsp(left[i + 1]), pcm_sample_dsp(right[i + 1]), 16);
+	}
+}
+
+void pcm_f32_to_i16(const float * in, int16_t * out, uint_fast32_t len){
+	uint_fast32_t i;
+	for(i = 0; i < len; i++){
+		out[i] = pcm_sample_dsp(in[i]);
+	}
+}
+
+#elif defined(__SSE2__)
+
+void pcm_f32_to_i16_stereo(const float * left, const float * right, int16_t * out, uint_fast32_t len){
+	const __m128 lim_hi = _mm_set1_ps(1.0f);
+	const __m128 lim_lo = _mm_set1_ps(-1.0f);
+	const __m128 scale = _mm_set1_ps(INT16_MAX);
+	uint_fast32_t i;
+	for(i = 0; i + 4 <= len; i += 4){
+		__m128 l = _mm_loadu_ps(&left[i]);
+		__m128 r = _mm_loadu_ps(&right[i]);
+		//Clear NaN lanes, which max and min would turn into -1
+		l = _mm_and_ps(l, _mm_cmpord_ps(l, l));
+		r = _mm_and_ps(r, _mm_cmpord_ps(r, r));
+		l = _mm_mul_ps(_mm_min_ps(_mm_max_ps(l, lim_lo), lim_hi), scale);
+		r = _mm_mul_ps(_mm_min_ps(_mm_max_ps(r, lim_lo), lim_hi), scale);
+		const __m128i lr = _mm_packs_epi32(_mm_cvttps_epi32(l), _mm_cvttps_epi32(r));
+		//Interleave the packed left samples (low half) with the right samples (high half)
+		_mm_storeu_si128((__m128i *) &out[2 * i], _mm_unpacklo_epi16(lr, _mm_srli_si128(lr, 8)));
+	}
+	for(; i < len; i++){
+		out[2 * i] = pcm_sample(left[i]);
+		out[2 * i + 1] = pcm_sample(right[i]);
+	}
+}
+
+void pcm_f32_to_i16(const float * in, int16_t * out, uint_fast32_t len){
+	const __m128 lim_hi = _mm_set1_ps(1.0f);
+	const __m128 lim_lo = _mm_set1_ps(-1.0f);
+	const __m128 scale = _mm_set1_ps(INT16_MAX);
+	uint_fast32_t i;
+	for(i = 0; i + 8 <= len; i += 8){
+		__m128 a = _mm_loadu_ps(&in[i]);
+		__m128 b = _mm_loadu_ps(&in[i + 4]);
+		//Clear NaN lanes, which max and min would turn into -1
+		a = _mm_and_ps(a, _mm_cmpord_ps(a, a));
+		b = _mm_and_ps(b, _mm_cmpord_ps(b, b));
+		a = _mm_mul_ps(_mm_min_ps(_mm_max_ps(a, lim_lo), lim_hi), scale);
+		b = _mm_mul_ps(_mm_min_ps(_mm_max_ps(b, lim_lo), lim_hi), scale);
+		_mm_storeu_si128((__m128i *) &out[i], _mm_packs_epi32(_mm_cvttps_epi32(a), _mm_cvttps_epi32(b)));
+	}
+	for(; i < len; i++){
+		out[i] = pcm_sample(in[i]);
+	}
+}
+
+#else
+
+void pcm_f32_to_i16_stereo(const float * left, const float * right, int16_t * out, uint_fast32_t len){
+	uint_fast32_t i;
+	for(i = 0; i < len; i++){
+		out[2 * i] = pcm_sample(left[i]);
+		out[2 * i + 1] = pcm_sample(right[i]);
+	}
+}
+
+void pcm_f32_to_i16(const float * in, int16_t * out, uint_fast32_t len){
+	uint_fast32_t i;
+	for(i = 0; i < len; i++){
+		out[i] = pcm_sample(in[i]);
+	}
+}
+
+#endif
+
+#if defined(__SSE2__) && !defined(__ARM_FEATURE_DSP)
+
+void pcm_i16_to_f32(const int16_t * in, float * out, uint_fast32_t len, float scale){
+	const __m128 s = _mm_set1_ps(scale);
+	uint_fast32_t i;
+	for(i = 0; i + 8 <= len; i += 8){
+		const __m128i v = _mm_loadu_si128((const __m128i *) &in[i]);
+		//Sign extend by placing each sample in the upper half of a 32-bit lane and shifting back
+		const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+		const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+		_mm_storeu_ps(&out[i], _mm_mul_ps(_mm_cvtepi32_ps(lo), s));
+		_mm_storeu_ps(&out[i + 4], _mm_mul_ps(_mm_cvtepi32_ps(hi), s));
+	}
+	for(; i < len; i++){
+		out[i] = in[i] * scale;
+	}
+}
+
+#else
+
+void pcm_i16_to_f32(const int16_t * in, float * out, uint_fast32_t len, float scale){
+	uint_fast32_t i;
+	//Unroll by four so the loads, conversions and stores can be interleaved
+	for(i = 0; i + 4 <= len; i += 4){
+		const float v0 = in[i];
+		const float v1 = in[i + 1];
+		const float v2 = in[i + 2];
+		const float v3 = in[i + 3];
+		out[i] = v0 * scale;
+		out[i + 1] = v1 * scale;
+		out[i + 2] = v2 * scale;
+		out[i + 3] = v3 * scale;
+	}
+	for(; i < len; i++){
+		out[i] = in[i] * scale;
+	}
+}
+
+#endif
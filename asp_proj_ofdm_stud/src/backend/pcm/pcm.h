@@ -0,0 +1,40 @@
+/** @file Conversion kernels between the floating point sample blocks used by
+ * the signal processing and the 16-bit integer samples used by the hardware.
+ * Each kernel processes a whole block. On target the Cortex-M4 DSP
+ * instructions are used, on a host build SSE2 is used when available, and
+ * otherwise a plain C implementation. All implementations give identical
+ * results. */
+
+#ifndef PCM_H_
+#define PCM_H_
+
+#include <stdint.h>
+
+/** @brief Converts a block of left and right floating point samples to
+ * interleaved 16-bit stereo samples, as expected by the output DMA.
+ * Samples are saturated to the range [-1, 1] and scaled by INT16_MAX, rounding
+ * towards zero. NaN is converted to 0.
+ * @param left		Pointer to len left channel samples
+ * @param right		Pointer to len right channel samples
+ * @param out		Pointer to 2*len output samples, must be 32-bit aligned.
+ * The left sample is written first in each pair.
+ * @param len		Number of samples per channel, must be even */
+void pcm_f32_to_i16_stereo(const float * left, const float * right, int16_t * out, uint_fast32_t len);
+
+/** @brief Converts a block of floating point samples to 16-bit samples, with
+ * the same saturation, scaling and rounding as pcm_f32_to_i16_stereo.
+ * Used wherever float samples are stored as 16-bit integers, so that there is
+ * a single conversion.
+ * @param in		Pointer to len input samples
+ * @param out		Pointer to len output samples, needs no further alignment
+ * @param len		Number of samples, may be odd */
+void pcm_f32_to_i16(const float * in, int16_t * out, uint_fast32_t len);
+
+/** @brief Converts a block of 16-bit samples to floating point values
+ * @param in		Pointer to len input samples
+ * @param out		Pointer to len output samples
+ * @param len		Number of samples
+ * @param scale		Factor to multiply each converted sample with */
+void pcm_i16_to_f32(const int16_t * in, float * out, uint_fast32_t len, float scale);
+
+#endif /* PCM_H_ */
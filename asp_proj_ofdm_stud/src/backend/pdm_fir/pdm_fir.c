@@ -1,8 +1,10 @@
+#include <string.h>
+#include <stdint.h>
 #include "pdm_fir.h"
 
 /* PDM FIR filter.
  * The source frequency is expected to be 1024kHz so we are receiving 16 bit words at 64kHz rate MSB first.
- * The filter cutoff frequency is 8kHz.
+ * The first stage decimates by 32 and the second stage by two, see pdm_fir.h.
  */
 
 /* The following file contains tables generated by pdm_fir.py script. You can easily customize filter
@@ -15,14 +17,18 @@ void pdm_fir_flt_init(struct pdm_fir_filter* f)
 {
 	int t;
 	f->next_tap = 0;
-	for (t = 0; t < PDM_FTL_TAPS; ++t)
+	for (t = 0; t < PDM_FTL_TAPS*2; ++t)
 		f->buffer[t] = 0x5555;
 }
 
-/* Put 16 bits MSB first */
+/* Put 16 bits MSB first.
+ * Every word is stored twice, PDM_FTL_TAPS words apart, so that the last PDM_FTL_TAPS words always
+ * form a contiguous window starting at next_tap.
+ */
 void pdm_fir_flt_put(struct pdm_fir_filter* f, uint16_t bits)
 {
 	f->buffer[f->next_tap] = bits;
+	f->buffer[f->next_tap + PDM_FTL_TAPS] = bits;
 	if (++f->next_tap >= PDM_FTL_TAPS)
 		f->next_tap = 0;
 }
@@ -34,16 +40,106 @@ void pdm_fir_flt_put(struct pdm_fir_filter* f, uint16_t bits)
  */
 int pdm_fir_flt_get(struct pdm_fir_filter const* f, int out_bits)
 {
-	int t, i = 0, tot = 0;
-	for (t = f->next_tap;;) {
-		uint16_t v = f->buffer[t];
-		tot += byte_coeff[i++][(uint8_t)(v>>8)];
-		tot += byte_coeff[i++][(uint8_t)(v)];
-		if (++t >= PDM_FTL_TAPS)
-			t = 0;
-		if (t == f->next_tap)
-			break;
+	uint16_t const* w = &f->buffer[f->next_tap];
+	int t, tot = 0;
+	for (t = 0; t < PDM_FTL_TAPS; ++t) {
+		tot += byte_coeff[2*t][(uint8_t)(w[t]>>8)];
+		tot += byte_coeff[2*t+1][(uint8_t)(w[t])];
 	}
 	/* Rescale to output range */
 	return tot >> (PDM_FTL_SCALE_BITS - out_bits + 1);
 }
+
+/* Decimate a whole block of PDM input, retrieving one output value for every dec_words words put.
+ * The input is processed in chunks of up to PDM_FTL_BLOCK_WORDS words, which are appended to the
+ * filter history in a linear buffer. Each pair of byte tables is then applied to every output of
+ * the chunk before moving on to the next pair, so that only two 256 entry tables are in use at a
+ * time and no wrap around tests are needed.
+ */
+int pdm_fir_flt_decimate(struct pdm_fir_filter* f, uint16_t const* in, int in_words, int dec_words, int* out, int out_bits)
+{
+	uint16_t lin[PDM_FTL_TAPS + PDM_FTL_BLOCK_WORDS];
+	int const chunk_words = PDM_FTL_BLOCK_WORDS - PDM_FTL_BLOCK_WORDS % dec_words;
+	int const shift = PDM_FTL_SCALE_BITS - out_bits + 1;
+	int t, k, n = 0;
+
+	/* Linearise the history, oldest word first */
+	memcpy(lin, &f->buffer[f->next_tap], sizeof(lin[0]) * PDM_FTL_TAPS);
+
+	while (in_words > 0) {
+		int const len = in_words < chunk_words ? in_words : chunk_words;
+		int const n_out = len / dec_words;
+		memcpy(&lin[PDM_FTL_TAPS], in, sizeof(lin[0]) * len);
+
+		for (k = 0; k < n_out; ++k)
+			out[n + k] = 0;
+		for (t = 0; t < PDM_FTL_TAPS; ++t) {
+			int const* hi = byte_coeff[2*t];
+			int const* lo = byte_coeff[2*t+1];
+			/* Oldest word in the window of the first output */
+			uint16_t const* w = &lin[dec_words + t];
+			int* acc = &out[n];
+			for (k = 0; k < n_out; ++k, w += dec_words)
+				acc[k] += hi[(uint8_t)(*w>>8)] + lo[(uint8_t)(*w)];
+		}
+		/* Rescale to output range */
+		for (k = 0; k < n_out; ++k)
+			out[n + k] >>= shift;
+
+		memmove(lin, &lin[len], sizeof(lin[0]) * PDM_FTL_TAPS);
+		in += len;
+		in_words -= len;
+		n += n_out;
+	}
+
+	/* Store the history back, oldest word first */
+	for (t = 0; t < PDM_FTL_TAPS; ++t)
+		f->buffer[t] = f->buffer[t + PDM_FTL_TAPS] = lin[t];
+	f->next_tap = 0;
+	return n;
+}
+
+/* Maximum number of input values processed at a time by pdm_fir_dec2_decimate */
+#define PDM_FTL_DEC2_BLOCK 64
+
+/* Initialize the second decimation stage. A first stage initialized by pdm_fir_flt_init outputs zeros,
+ * which is the initial history.
+ */
+void pdm_fir_dec2_init(struct pdm_fir_dec2* f)
+{
+	memset(f->buffer, 0, sizeof(f->buffer));
+}
+
+/* Decimate by two, computing one output value for every second input value.
+ * As for pdm_fir_flt_decimate, the input is appended to a linear copy of the history in chunks. The
+ * taps are symmetric, so each coefficient is applied to the sum of the two values it multiplies.
+ */
+int pdm_fir_dec2_decimate(struct pdm_fir_dec2* f, int const* in, int in_len, int* out)
+{
+	int lin[PDM_FTL_DEC2_TAPS + PDM_FTL_DEC2_BLOCK];
+	int t, k, n = 0;
+
+	memcpy(lin, f->buffer, sizeof(f->buffer));
+
+	while (in_len > 0) {
+		int const len = in_len < PDM_FTL_DEC2_BLOCK ? in_len : PDM_FTL_DEC2_BLOCK;
+		memcpy(&lin[PDM_FTL_DEC2_TAPS], in, sizeof(lin[0]) * len);
+
+		for (k = 2; k <= len; k += 2) {
+			/* The window of this output ends with input value k - 1 */
+			int const* w = &lin[k];
+			int64_t acc = 0;
+			for (t = 0; t < PDM_FTL_DEC2_TAPS/2; ++t)
+				acc += (int64_t)dec2_coeff[t] * ((int64_t)w[t] + w[PDM_FTL_DEC2_TAPS-1-t]);
+			/* Rescale to input range */
+			out[n++] = (int)(acc >> PDM_FTL_DEC2_SCALE_BITS);
+		}
+
+		memmove(lin, &lin[len], sizeof(f->buffer));
+		in += len;
+		in_len -= len;
+	}
+
+	memcpy(f->buffer, lin, sizeof(f->buffer));
+	return n;
+}
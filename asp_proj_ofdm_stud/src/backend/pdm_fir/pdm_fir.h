@@ -2,19 +2,32 @@
 
 /* PDM FIR low pass filter.
  * The source frequency is expected to be 1024kHz so we are receiving 16 bit words at 64kHz rate MSB first.
- * The filter cutoff frequency is 8kHz. Filter parameters may be easily customized by modifying
- * the pdm_fir.py script and regenerating tables in pdm_fir_.h header.
+ * The signal is decimated in two stages. The first stage filter (pdm_fir_flt_*) is evaluated on the PDM
+ * bits and is meant to decimate by 32, to 32kHz, with its passband up to 8kHz and its stopband from 24kHz.
+ * The second stage (pdm_fir_dec2_*) decimates the result by two, to 16kHz, with its passband up to 6kHz
+ * and its stopband from 8kHz. All frequencies scale with the source frequency. Filter parameters may be
+ * easily customized by modifying the pdm_fir.py script and regenerating tables in pdm_fir_.h header,
+ * and "pdm_fir.py response" prints the measured response.
  */
 
 #include <stdint.h>
 
 #define PDM_FTL_TAPS 16
 
+/* Maximum number of input words processed at a time by pdm_fir_flt_decimate */
+#define PDM_FTL_BLOCK_WORDS 256
+
+#define PDM_FTL_DEC2_TAPS 64
+
 struct pdm_fir_filter {
-	uint16_t buffer[PDM_FTL_TAPS];
+	uint16_t buffer[PDM_FTL_TAPS*2];
 	int next_tap;
 };
 
+struct pdm_fir_dec2 {
+	int buffer[PDM_FTL_DEC2_TAPS];
+};
+
 /* Initialize filter */
 void pdm_fir_flt_init(struct pdm_fir_filter* f);
 
@@ -27,3 +40,19 @@ void pdm_fir_flt_put(struct pdm_fir_filter* f, uint16_t bits);
  * should truncate return value on its own if necessary.
  */
 int pdm_fir_flt_get(struct pdm_fir_filter const* f, int out_bits);
+
+/* Decimate a whole block of PDM input. The in_words 16 bit words (MSB first) are put into the filter
+ * and one output value is retrieved after every dec_words words, so the decimation factor is
+ * 16*dec_words, where dec_words may be at most PDM_FTL_BLOCK_WORDS. The number of input words must
+ * be a multiple of dec_words. Returns the number of output values written. The output range is the
+ * same as for pdm_fir_flt_get.
+ */
+int pdm_fir_flt_decimate(struct pdm_fir_filter* f, uint16_t const* in, int in_words, int dec_words, int* out, int out_bits);
+
+/* Initialize the second decimation stage */
+void pdm_fir_dec2_init(struct pdm_fir_dec2* f);
+
+/* Decimate a block of first stage output values by two. The number of input values must be even.
+ * Returns the number of output values written, which have the range of the input values.
+ */
+int pdm_fir_dec2_decimate(struct pdm_fir_dec2* f, int const* in, int in_len, int* out);
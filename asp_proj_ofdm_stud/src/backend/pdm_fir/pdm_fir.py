@@ -1,56 +1,225 @@
+"""Designs the PDM decimation filters and generates pdm_fir_.h.
+
+The PDM signal is decimated by 64 in two stages. The first stage is a 256 tap
+FIR filter evaluated with byte lookup tables on the PDM bits, decimating by 32
+to twice the output rate. Its transition band can be wide, as only what
+aliases into the passband of the second stage matters. The second stage is a
+64 tap FIR filter on the integer output of the first stage, decimating by two,
+with its stopband starting at half the output rate so that nothing aliases
+into the output band. Both are Kaiser windowed sinc filters, and the
+frequencies below are for an output rate of 16 kHz; they scale with it.
+
+    python3 pdm_fir.py > pdm_fir_.h                  generate the tables
+    python3 pdm_fir.py response                      print the measured response
+    python3 pdm_fir.py decimate <pdm file> [dec_words [out_bits]]
+                                                     reference model of the first stage
+    python3 pdm_fir.py decimate2 <pdm file>          reference model of both stages
+    python3 pdm_fir.py plot                          plot the response (needs matplotlib)
+
+Only the standard library is needed, except for plotting.
+"""
+
+import math
+import os
+import struct
 import sys
-import scipy.signal as signal
 
-PDM_FTL_TAPS       = 16
-PDM_FTL_SAMPLE_F   = 1024
-PDM_FTL_CUT_OFF    = 8
+PDM_FTL_TAPS       = 16		# 16 bit words of the first stage, 256 taps
+PDM_FTL_SAMPLE_F   = 1024	# PDM rate [kHz]
+PDM_FTL_CUT_OFF    = 16		# Between the 8 kHz passband and the 24 kHz stopband
+PDM_FTL_BETA       = 6.2	# Kaiser window parameter, about 63 dB stopband attenuation
 PDM_FTL_SCALE_BITS = 30
 
-taps1 = signal.firwin(PDM_FTL_TAPS*16, PDM_FTL_CUT_OFF, nyq=PDM_FTL_SAMPLE_F/2)
-taps  = (taps1 * (2**PDM_FTL_SCALE_BITS)).astype(int)
+PDM_FTL_DEC2_TAPS       = 64
+PDM_FTL_DEC2_SAMPLE_F   = 32	# Rate of the first stage output [kHz]
+PDM_FTL_DEC2_PASS       = 6		# Passband edge [kHz]
+PDM_FTL_DEC2_STOP       = 8		# Stopband edge, half the output rate [kHz]
+PDM_FTL_DEC2_BETA       = 6.0	# About 62 dB stopband attenuation
+PDM_FTL_DEC2_SCALE_BITS = 24
 
-def print_head():
-	print '/* Generated by pdm_fir.py */'
-	print '#define PDM_FTL_SCALE_BITS %d' % PDM_FTL_SCALE_BITS
+def bessel_i0(x):
+	# Modified Bessel function of the first kind and order zero, by its power series
+	tot, term, k = 1.0, 1.0, 1
+	while term > 1e-15 * tot:
+		term *= (x / (2 * k)) ** 2
+		tot += term
+		k += 1
+	return tot
 
-def print_taps():
-	print 'static int const tap_coeff[PDM_FTL_TAPS*16] = {'
-	print ','.join(['%i' % t for t in taps])
-	print '};'
+def kaiser_lowpass(n, cut_off, sample_f, beta):
+	# Windowed sinc low pass filter with unity gain at DC, as scipy.signal.firwin
+	# with window=('kaiser', beta)
+	m = (n - 1) / 2
+	taps = []
+	for i in range(n):
+		x = i - m
+		if x == 0:
+			h = 2 * cut_off / sample_f
+		else:
+			h = math.sin(2 * math.pi * cut_off / sample_f * x) / (math.pi * x)
+		taps.append(h * bessel_i0(beta * math.sqrt(1 - (x / m) ** 2)) / bessel_i0(beta))
+	gain = sum(taps)
+	return [h / gain for h in taps]
+
+def design():
+	# Returns the floating point taps of both stages
+	taps1 = kaiser_lowpass(PDM_FTL_TAPS*16, PDM_FTL_CUT_OFF, PDM_FTL_SAMPLE_F, PDM_FTL_BETA)
+	taps2 = kaiser_lowpass(PDM_FTL_DEC2_TAPS, (PDM_FTL_DEC2_PASS + PDM_FTL_DEC2_STOP) / 2,
+		PDM_FTL_DEC2_SAMPLE_F, PDM_FTL_DEC2_BETA)
+	return taps1, taps2
+
+def int_taps(taps, scale_bits):
+	# Truncates towards zero
+	return [int(t * (2**scale_bits)) for t in taps]
 
-def byte_coef(i, b):
+def print_head():
+	print('/* Generated by pdm_fir.py */')
+	print('#define PDM_FTL_SCALE_BITS %d' % PDM_FTL_SCALE_BITS)
+	print('#define PDM_FTL_DEC2_SCALE_BITS %d' % PDM_FTL_DEC2_SCALE_BITS)
+
+def byte_coef(taps, i, b):
 	bit, off, tot = 1<<7, i*8, 0
 	while bit:
 		if bit & b:
-			tot += taps[off];
+			tot += taps[off]
 		else:
-			tot -= taps[off];
+			tot -= taps[off]
 		bit >>= 1
 		off += 1
 	return tot
 
-def print_byte_coefs():
-	print 'static int const byte_coeff[PDM_FTL_TAPS*2][256] = {'
+def print_byte_coefs(taps):
+	print('static int const byte_coeff[PDM_FTL_TAPS*2][256] = {')
 	for i in range(PDM_FTL_TAPS*2):
-		print ' { // [%i]' % i
-		print ','.join(['%i' % byte_coef(i, b) for b in range(256)])
-		print ' },'
-	print '};'
+		print(' { // [%i]' % i)
+		print(','.join(['%i' % byte_coef(taps, i, b) for b in range(256)]))
+		print(' },')
+	print('};')
 
-if __name__ == '__main__':
-	if 'plot' in sys.argv:
-		import numpy as np
-		from matplotlib.pylab import *
-		title('Digital filter frequency response')
-		w, h = signal.freqz(taps1)
-		plot(w*PDM_FTL_SAMPLE_F/(2*np.pi), np.abs(h), 'b')
-		ylabel('Amplitude')
-		yscale('log')
-		xlabel('Frequency (kHz)')
-		xlim(0, PDM_FTL_SAMPLE_F/2)
-		show()
-	else:
+def print_dec2_coefs(taps):
+	print('static int const dec2_coeff[PDM_FTL_DEC2_TAPS] = {')
+	print(','.join(['%i' % t for t in taps]))
+	print('};')
+
+def response(taps, f, sample_f):
+	# Magnitude of the frequency response at f
+	w = 2 * math.pi * f / sample_f
+	re = sum(t * math.cos(w * i) for i, t in enumerate(taps))
+	im = sum(t * math.sin(w * i) for i, t in enumerate(taps))
+	return math.hypot(re, im)
+
+def chain_response(taps1, taps2, f):
+	return response(taps1, f, PDM_FTL_SAMPLE_F) * response(taps2, f, PDM_FTL_DEC2_SAMPLE_F)
+
+def db(v):
+	return 20 * math.log10(max(v, 1e-15))
+
+def print_response():
+	# Measures the passband ripple and the attenuation of everything that
+	# aliases into the output band, for the quantized taps
+	taps1, taps2 = design()
+	taps1 = [t / 2**PDM_FTL_SCALE_BITS for t in int_taps(taps1, PDM_FTL_SCALE_BITS)]
+	taps2 = [t / 2**PDM_FTL_DEC2_SCALE_BITS for t in int_taps(taps2, PDM_FTL_DEC2_SCALE_BITS)]
+	fs_out = PDM_FTL_DEC2_SAMPLE_F / 2
+	passband = [db(chain_response(taps1, taps2, PDM_FTL_DEC2_PASS * i / 100)) for i in range(101)]
+	print('passband 0-%g kHz: %.3f to %.3f dB' % (PDM_FTL_DEC2_PASS, min(passband), max(passband)))
+	print('at %g kHz: %.1f dB' % (fs_out / 2, db(chain_response(taps1, taps2, fs_out / 2))))
+	# Every frequency above half the output rate aliases into the output band;
+	# those within the passband edge of a multiple of the output rate alias into
+	# the passband
+	worst_band, worst_pass = -math.inf, -math.inf
+	steps = 20000
+	for i in range(steps + 1):
+		f = fs_out / 2 + (PDM_FTL_SAMPLE_F / 2 - fs_out / 2) * i / steps
+		v = db(chain_response(taps1, taps2, f))
+		worst_band = max(worst_band, v)
+		alias = abs(f - fs_out * round(f / fs_out))
+		if alias <= PDM_FTL_DEC2_PASS:
+			worst_pass = max(worst_pass, v)
+	print('alias rejection into 0-%g kHz: %.1f dB' % (fs_out / 2, -worst_band))
+	print('alias rejection into 0-%g kHz: %.1f dB' % (PDM_FTL_DEC2_PASS, -worst_pass))
+
+def load_coefs(path):
+	# Read the tables back from the generated header, so that the reference
+	# uses exactly the coefficients compiled into the target. Returns the rows
+	# of byte_coeff and dec2_coeff.
+	rows = []
+	for line in open(path):
+		line = line.strip()
+		if line and (line[0].isdigit() or line[0] == '-'):
+			rows.append([int(v) for v in line.rstrip(',').split(',')])
+	return rows[:PDM_FTL_TAPS*2], rows[PDM_FTL_TAPS*2]
+
+def decimate(words, dec_words, out_bits, coefs):
+	# Reference model of pdm_fir_flt_decimate, starting from the initial
+	# filter state set by pdm_fir_flt_init
+	buf = [0x5555] * PDM_FTL_TAPS
+	out = []
+	for n, v in enumerate(words):
+		buf = buf[1:] + [v]
+		if (n + 1) % dec_words == 0:
+			tot = 0
+			for t, w in enumerate(buf):
+				tot += coefs[2*t][w >> 8] + coefs[2*t+1][w & 0xFF]
+			out.append(tot >> (PDM_FTL_SCALE_BITS - out_bits + 1))
+	return out
+
+def decimate2(values, coefs):
+	# Reference model of pdm_fir_dec2_decimate, starting from the initial
+	# filter state set by pdm_fir_dec2_init
+	buf = [0] * PDM_FTL_DEC2_TAPS
+	out = []
+	for n, v in enumerate(values):
+		buf = buf[1:] + [v]
+		if n % 2 == 1:
+			out.append(sum(c * w for c, w in zip(coefs, buf)) >> PDM_FTL_DEC2_SCALE_BITS)
+	return out
+
+def read_words(path):
+	# The input file holds the recorded 16 bit PDM words in little-endian
+	# order, as received from the SPI peripheral
+	with open(path, 'rb') as f:
+		data = f.read()
+	return struct.unpack('<%dH' % (len(data) // 2), data[:len(data) // 2 * 2])
+
+def main():
+	args = sys.argv[1:]
+	header = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'pdm_fir_.h')
+	if args and args[0] == 'decimate':
+		byte_coefs, _ = load_coefs(header)
+		dec_words = int(args[2]) if len(args) > 2 else 4
+		out_bits = int(args[3]) if len(args) > 3 else 16
+		for v in decimate(read_words(args[1]), dec_words, out_bits, byte_coefs):
+			print('%i' % v)
+	elif args and args[0] == 'decimate2':
+		# The first stage decimates by 32 to 16 bits, as in microphone.c
+		byte_coefs, dec2_coefs = load_coefs(header)
+		for v in decimate2(decimate(read_words(args[1]), 2, 16, byte_coefs), dec2_coefs):
+			print('%i' % v)
+	elif args and args[0] == 'response':
+		print_response()
+	elif args and args[0] == 'plot':
+		from matplotlib import pyplot as plt
+		taps1, taps2 = design()
+		f = [PDM_FTL_SAMPLE_F / 2 * i / 4000 for i in range(4001)]
+		plt.title('PDM decimation frequency response')
+		plt.plot(f, [response(taps1, v, PDM_FTL_SAMPLE_F) for v in f], 'b', label='first stage')
+		plt.plot(f, [chain_response(taps1, taps2, v) for v in f], 'r', label='both stages')
+		plt.ylabel('Amplitude')
+		plt.yscale('log')
+		plt.xlabel('Frequency (kHz)')
+		plt.xlim(0, PDM_FTL_SAMPLE_F / 2)
+		plt.legend()
+		plt.show()
+	elif not args:
+		taps1, taps2 = design()
 		print_head()
-		# print_taps()
-		print_byte_coefs()
+		print_byte_coefs(int_taps(taps1, PDM_FTL_SCALE_BITS))
+		print_dec2_coefs(int_taps(taps2, PDM_FTL_DEC2_SCALE_BITS))
+	else:
+		print(__doc__, file=sys.stderr)
+		return 1
+	return 0
 
+if __name__ == '__main__':
+	sys.exit(main())
@@ -1,100 +1,104 @@
 /* Generated by pdm_fir.py */
 #define PDM_FTL_SCALE_BITS 30
+#define PDM_FTL_DEC2_SCALE_BITS 24
 static int const byte_coeff[PDM_FTL_TAPS*2][256] = {
  { // [0]
-360411,183839,210957,34385,236643,60071,87189,-89383,261075,84503,111621,-64951,137307,-39265,-12147,-188719,284437,107865,134983,-41589,160669,-15903,11215,-165357,185101,8529,35647,-140925,61333,-115239,-88121,-264693,306909,130337,157455,-19117,183141,6569,33687,-142885,207573,31001,58119,-118453,83805,-92767,-65649,-242221,230935,54363,81481,-95091,107167,-69405,-42287,-218859,131599,-44973,-17855,-194427,7831,-168741,-141623,-318195,328679,152107,179225,2653,204911,28339,55457,-121115,229343,52771,79889,-96683,105575,-70997,-43879,-220451,252705,76133,103251,-73321,128937,-47635,-20517,-197089,153369,-23203,3915,-172657,29601,-146971,-119853,-296425,275177,98605,125723,-50849,151409,-25163,1955,-174617,175841,-731,26387,-150185,52073,-124499,-97381,-273953,199203,22631,49749,-126823,75435,-101137,-74019,-250591,99867,-76705,-49587,-226159,-23901,-200473,-173355,-349927,349927,173355,200473,23901,226159,49587,76705,-99867,250591,74019,101137,-75435,126823,-49749,-22631,-199203,273953,97381,124499,-52073,150185,-26387,731,-175841,174617,-1955,25163,-151409,50849,-125723,-98605,-275177,296425,119853,146971,-29601,172657,-3915,23203,-153369,197089,20517,47635,-128937,73321,-103251,-76133,-252705,220451,43879,70997,-105575,96683,-79889,-52771,-229343,121115,-55457,-28339,-204911,-2653,-179225,-152107,-328679,318195,141623,168741,-7831,194427,17855,44973,-131599,218859,42287,69405,-107167,95091,-81481,-54363,-230935,242221,65649,92767,-83805,118453,-58119,-31001,-207573,142885,-33687,-6569,-183141,19117,-157455,-130337,-306909,264693,88121,115239,-61333,140925,-35647,-8529,-185101,165357,-11215,15903,-160669,41589,-134983,-107865,-284437,188719,12147,39265,-137307,64951,-111621,-84503,-261075,89383,-87189,-60071,-236643,-34385,-210957,-183839,-360411
+191923,82367,104807,-4749,124859,15303,37743,-71813,142453,32897,55337,-54219,75389,-34167,-11727,-121283,157569,48013,70453,-39103,90505,-19051,3389,-106167,108099,-1457,20983,-88573,41035,-68521,-46081,-155637,170247,60691,83131,-26425,103183,-6373,16067,-93489,120777,11221,33661,-75895,53713,-55843,-33403,-142959,135893,26337,48777,-60779,68829,-40727,-18287,-127843,86423,-23133,-693,-110249,19359,-90197,-67757,-177313,180571,71015,93455,-16101,113507,3951,26391,-83165,131101,21545,43985,-65571,64037,-45519,-23079,-132635,146217,36661,59101,-50455,79153,-30403,-7963,-117519,96747,-12809,9631,-99925,29683,-79873,-57433,-166989,158895,49339,71779,-37777,91831,-17725,4715,-104841,109425,-131,22309,-87247,42361,-67195,-44755,-154311,124541,14985,37425,-72131,57477,-52079,-29639,-139195,75071,-34485,-12045,-121601,8007,-101549,-79109,-188665,188665,79109,101549,-8007,121601,12045,34485,-75071,139195,29639,52079,-57477,72131,-37425,-14985,-124541,154311,44755,67195,-42361,87247,-22309,131,-109425,104841,-4715,17725,-91831,37777,-71779,-49339,-158895,166989,57433,79873,-29683,99925,-9631,12809,-96747,117519,7963,30403,-79153,50455,-59101,-36661,-146217,132635,23079,45519,-64037,65571,-43985,-21545,-131101,83165,-26391,-3951,-113507,16101,-93455,-71015,-180571,177313,67757,90197,-19359,110249,693,23133,-86423,127843,18287,40727,-68829,60779,-48777,-26337,-135893,142959,33403,55843,-53713,75895,-33661,-11221,-120777,93489,-16067,6373,-103183,26425,-83131,-60691,-170247,155637,46081,68521,-41035,88573,-20983,1457,-108099,106167,-3389,19051,-90505,39103,-70453,-48013,-157569,121283,11727,34167,-75389,54219,-55337,-32897,-142453,71813,-37743,-15303,-124859,4749,-104807,-82367,-191923
  },
  { // [1]
-1306358,842846,886692,423180,928064,464552,508398,44886,967034,503522,547368,83856,588740,125228,169074,-294438,1003698,540186,584032,120520,625404,161892,205738,-257774,664374,200862,244708,-218804,286080,-177432,-133586,-597098,1038170,574658,618504,154992,659876,196364,240210,-223302,698846,235334,279180,-184332,320552,-142960,-99114,-562626,735510,271998,315844,-147668,357216,-106296,-62450,-525962,396186,-67326,-23480,-486992,17892,-445620,-401774,-865286,1070578,607066,650912,187400,692284,228772,272618,-190894,731254,267742,311588,-151924,352960,-110552,-66706,-530218,767918,304406,348252,-115260,389624,-73888,-30042,-493554,428594,-34918,8928,-454584,50300,-413212,-369366,-832878,802390,338878,382724,-80788,424096,-39416,4430,-459082,463066,-446,43400,-420112,84772,-378740,-334894,-798406,499730,36218,80064,-383448,121436,-342076,-298230,-761742,160406,-303106,-259260,-722772,-217888,-681400,-637554,-1101066,1101066,637554,681400,217888,722772,259260,303106,-160406,761742,298230,342076,-121436,383448,-80064,-36218,-499730,798406,334894,378740,-84772,420112,-43400,446,-463066,459082,-4430,39416,-424096,80788,-382724,-338878,-802390,832878,369366,413212,-50300,454584,-8928,34918,-428594,493554,30042,73888,-389624,115260,-348252,-304406,-767918,530218,66706,110552,-352960,151924,-311588,-267742,-731254,190894,-272618,-228772,-692284,-187400,-650912,-607066,-1070578,865286,401774,445620,-17892,486992,23480,67326,-396186,525962,62450,106296,-357216,147668,-315844,-271998,-735510,562626,99114,142960,-320552,184332,-279180,-235334,-698846,223302,-240210,-196364,-659876,-154992,-618504,-574658,-1038170,597098,133586,177432,-286080,218804,-244708,-200862,-664374,257774,-205738,-161892,-625404,-120520,-584032,-540186,-1003698,294438,-169074,-125228,-588740,-83856,-547368,-503522,-967034,-44886,-508398,-464552,-928064,-423180,-886692,-842846,-1306358
+946045,602713,633197,289865,664441,321109,351593,8261,695795,352463,382947,39615,414191,70859,101343,-241989,726675,383343,413827,70495,445071,101739,132223,-211109,476425,133093,163577,-179755,194821,-148511,-118027,-461359,756577,413245,443729,100397,474973,131641,162125,-181207,506327,162995,193479,-149853,224723,-118609,-88125,-431457,537207,193875,224359,-118973,255603,-87729,-57245,-400577,286957,-56375,-25891,-369223,5353,-337979,-307495,-650827,785071,441739,472223,128891,503467,160135,190619,-152713,534821,191489,221973,-121359,253217,-90115,-59631,-402963,565701,222369,252853,-90479,284097,-59235,-28751,-372083,315451,-27881,2603,-340729,33847,-309485,-279001,-622333,595603,252271,282755,-60577,313999,-29333,1151,-342181,345353,2021,32505,-310827,63749,-279583,-249099,-592431,376233,32901,63385,-279947,94629,-248703,-218219,-561551,125983,-217349,-186865,-530197,-155621,-498953,-468469,-811801,811801,468469,498953,155621,530197,186865,217349,-125983,561551,218219,248703,-94629,279947,-63385,-32901,-376233,592431,249099,279583,-63749,310827,-32505,-2021,-345353,342181,-1151,29333,-313999,60577,-282755,-252271,-595603,622333,279001,309485,-33847,340729,-2603,27881,-315451,372083,28751,59235,-284097,90479,-252853,-222369,-565701,402963,59631,90115,-253217,121359,-221973,-191489,-534821,152713,-190619,-160135,-503467,-128891,-472223,-441739,-785071,650827,307495,337979,-5353,369223,25891,56375,-286957,400577,57245,87729,-255603,118973,-224359,-193875,-537207,431457,88125,118609,-224723,149853,-193479,-162995,-506327,181207,-162125,-131641,-474973,-100397,-443729,-413245,-756577,461359,118027,148511,-194821,179755,-163577,-133093,-476425,211109,-132223,-101739,-445071,-70495,-413827,-383343,-726675,241989,-101343,-70859,-414191,-39615,-382947,-352463,-695795,-8261,-351593,-321109,-664441,-289865,-633197,-602713,-946045
  },
  { // [2]
-2795410,1890488,1954038,1049116,2015390,1110468,1174018,269096,2074406,1169484,1233034,328112,1294386,389464,453014,-451908,2130988,1226066,1289616,384694,1350968,446046,509596,-395326,1409984,505062,568612,-336310,629964,-274958,-211408,-1116330,2185058,1280136,1343686,438764,1405038,500116,563666,-341256,1464054,559132,622682,-282240,684034,-220888,-157338,-1062260,1520636,615714,679264,-225658,740616,-164306,-100756,-1005678,799632,-105290,-41740,-946662,19612,-885310,-821760,-1726682,2236574,1331652,1395202,490280,1456554,551632,615182,-289740,1515570,610648,674198,-230724,735550,-169372,-105822,-1010744,1572152,667230,730780,-174142,792132,-112790,-49240,-954162,851148,-53774,9776,-895146,71128,-833794,-770244,-1675166,1626222,721300,784850,-120072,846202,-58720,4830,-900092,905218,296,63846,-841076,125198,-779724,-716174,-1621096,961800,56878,120428,-784494,181780,-723142,-659592,-1564514,240796,-664126,-600576,-1505498,-539224,-1444146,-1380596,-2285518,2285518,1380596,1444146,539224,1505498,600576,664126,-240796,1564514,659592,723142,-181780,784494,-120428,-56878,-961800,1621096,716174,779724,-125198,841076,-63846,-296,-905218,900092,-4830,58720,-846202,120072,-784850,-721300,-1626222,1675166,770244,833794,-71128,895146,-9776,53774,-851148,954162,49240,112790,-792132,174142,-730780,-667230,-1572152,1010744,105822,169372,-735550,230724,-674198,-610648,-1515570,289740,-615182,-551632,-1456554,-490280,-1395202,-1331652,-2236574,1726682,821760,885310,-19612,946662,41740,105290,-799632,1005678,100756,164306,-740616,225658,-679264,-615714,-1520636,1062260,157338,220888,-684034,282240,-622682,-559132,-1464054,341256,-563666,-500116,-1405038,-438764,-1343686,-1280136,-2185058,1116330,211408,274958,-629964,336310,-568612,-505062,-1409984,395326,-509596,-446046,-1350968,-384694,-1289616,-1226066,-2130988,451908,-453014,-389464,-1294386,-328112,-1233034,-1169484,-2074406,-269096,-1174018,-1110468,-2015390,-1049116,-1954038,-1890488,-2795410
+1745456,1282588,1277136,814268,1279350,816482,811030,348162,1288312,825444,819992,357124,822206,359338,353886,-108982,1303088,840220,834768,371900,836982,374114,368662,-94206,845944,383076,377624,-85244,379838,-83030,-88482,-551350,1322750,859882,854430,391562,856644,393776,388324,-74544,865606,402738,397286,-65582,399500,-63368,-68820,-531688,880382,417514,412062,-50806,414276,-48592,-54044,-516912,423238,-39630,-45082,-507950,-42868,-505736,-511188,-974056,1346388,883520,878068,415200,880282,417414,411962,-50906,889244,426376,420924,-41944,423138,-39730,-45182,-508050,904020,441152,435700,-27168,437914,-24954,-30406,-493274,446876,-15992,-21444,-484312,-19230,-482098,-487550,-950418,923682,460814,455362,-7506,457576,-5292,-10744,-473612,466538,3670,-1782,-464650,432,-462436,-467888,-930756,481314,18446,12994,-449874,15208,-447660,-453112,-915980,24170,-438698,-444150,-907018,-441936,-904804,-910256,-1373124,1373124,910256,904804,441936,907018,444150,438698,-24170,915980,453112,447660,-15208,449874,-12994,-18446,-481314,930756,467888,462436,-432,464650,1782,-3670,-466538,473612,10744,5292,-457576,7506,-455362,-460814,-923682,950418,487550,482098,19230,484312,21444,15992,-446876,493274,30406,24954,-437914,27168,-435700,-441152,-904020,508050,45182,39730,-423138,41944,-420924,-426376,-889244,50906,-411962,-417414,-880282,-415200,-878068,-883520,-1346388,974056,511188,505736,42868,507950,45082,39630,-423238,516912,54044,48592,-414276,50806,-412062,-417514,-880382,531688,68820,63368,-399500,65582,-397286,-402738,-865606,74544,-388324,-393776,-856644,-391562,-854430,-859882,-1322750,551350,88482,83030,-379838,85244,-377624,-383076,-845944,94206,-368662,-374114,-836982,-371900,-834768,-840220,-1303088,108982,-353886,-359338,-822206,-357124,-819992,-825444,-1288312,-348162,-811030,-816482,-1279350,-814268,-1277136,-1282588,-1745456
  },
  { // [3]
-4860691,3394935,3467359,2001603,3539833,2074077,2146501,680745,3611959,2146203,2218627,752871,2291101,825345,897769,-567987,3683371,2217615,2290039,824283,2362513,896757,969181,-496575,2434639,968883,1041307,-424449,1113781,-351975,-279551,-1745307,3753739,2287983,2360407,894651,2432881,967125,1039549,-426207,2505007,1039251,1111675,-354081,1184149,-281607,-209183,-1674939,2576419,1110663,1183087,-282669,1255561,-210195,-137771,-1603527,1327687,-138069,-65645,-1531401,6829,-1458927,-1386503,-2852259,3822765,2357009,2429433,963677,2501907,1036151,1108575,-357181,2574033,1108277,1180701,-285055,1253175,-212581,-140157,-1605913,2645445,1179689,1252113,-213643,1324587,-141169,-68745,-1534501,1396713,-69043,3381,-1462375,75855,-1389901,-1317477,-2783233,2715813,1250057,1322481,-143275,1394955,-70801,1623,-1464133,1467081,1325,73749,-1392007,146223,-1319533,-1247109,-2712865,1538493,72737,145161,-1320595,217635,-1248121,-1175697,-2641453,289761,-1175995,-1103571,-2569327,-1031097,-2496853,-2424429,-3890185,3890185,2424429,2496853,1031097,2569327,1103571,1175995,-289761,2641453,1175697,1248121,-217635,1320595,-145161,-72737,-1538493,2712865,1247109,1319533,-146223,1392007,-73749,-1325,-1467081,1464133,-1623,70801,-1394955,143275,-1322481,-1250057,-2715813,2783233,1317477,1389901,-75855,1462375,-3381,69043,-1396713,1534501,68745,141169,-1324587,213643,-1252113,-1179689,-2645445,1605913,140157,212581,-1253175,285055,-1180701,-1108277,-2574033,357181,-1108575,-1036151,-2501907,-963677,-2429433,-2357009,-3822765,2852259,1386503,1458927,-6829,1531401,65645,138069,-1327687,1603527,137771,210195,-1255561,282669,-1183087,-1110663,-2576419,1674939,209183,281607,-1184149,354081,-1111675,-1039251,-2505007,426207,-1039549,-967125,-2432881,-894651,-2360407,-2287983,-3753739,1745307,279551,351975,-1113781,424449,-1041307,-968883,-2434639,496575,-969181,-896757,-2362513,-824283,-2290039,-2217615,-3683371,567987,-897769,-825345,-2291101,-752871,-2218627,-2146203,-3611959,-680745,-2146501,-2074077,-3539833,-2001603,-3467359,-3394935,-4860691
+1161372,1110468,1017954,967050,937836,886932,794418,743514,869964,819060,726546,675642,646428,595524,503010,452106,814018,763114,670600,619696,590482,539578,447064,396160,522610,471706,379192,328288,299074,248170,155656,104752,769538,718634,626120,575216,546002,495098,402584,351680,478130,427226,334712,283808,254594,203690,111176,60272,422184,371280,278766,227862,198648,147744,55230,4326,130776,79872,-12642,-63546,-92760,-143664,-236178,-287082,735936,685032,592518,541614,512400,461496,368982,318078,444528,393624,301110,250206,220992,170088,77574,26670,388582,337678,245164,194260,165046,114142,21628,-29276,97174,46270,-46244,-97148,-126362,-177266,-269780,-320684,344102,293198,200684,149780,120566,69662,-22852,-73756,52694,1790,-90724,-141628,-170842,-221746,-314260,-365164,-3252,-54156,-146670,-197574,-226788,-277692,-370206,-421110,-294660,-345564,-438078,-488982,-518196,-569100,-661614,-712518,712518,661614,569100,518196,488982,438078,345564,294660,421110,370206,277692,226788,197574,146670,54156,3252,365164,314260,221746,170842,141628,90724,-1790,-52694,73756,22852,-69662,-120566,-149780,-200684,-293198,-344102,320684,269780,177266,126362,97148,46244,-46270,-97174,29276,-21628,-114142,-165046,-194260,-245164,-337678,-388582,-26670,-77574,-170088,-220992,-250206,-301110,-393624,-444528,-318078,-368982,-461496,-512400,-541614,-592518,-685032,-735936,287082,236178,143664,92760,63546,12642,-79872,-130776,-4326,-55230,-147744,-198648,-227862,-278766,-371280,-422184,-60272,-111176,-203690,-254594,-283808,-334712,-427226,-478130,-351680,-402584,-495098,-546002,-575216,-626120,-718634,-769538,-104752,-155656,-248170,-299074,-328288,-379192,-471706,-522610,-396160,-447064,-539578,-590482,-619696,-670600,-763114,-814018,-452106,-503010,-595524,-646428,-675642,-726546,-819060,-869964,-743514,-794418,-886932,-937836,-967050,-1017954,-1110468,-1161372
  },
  { // [4]
-7085303,5100205,5154131,3169033,5212397,3227299,3281225,1296127,5274375,3289277,3343203,1358105,3401469,1416371,1470297,-514801,5339451,3354353,3408279,1423181,3466545,1481447,1535373,-449725,3528523,1543425,1597351,-387747,1655617,-329481,-275555,-2260653,5407047,3421949,3475875,1490777,3534141,1549043,1602969,-382129,3596119,1611021,1664947,-320151,1723213,-261885,-207959,-2193057,3661195,1676097,1730023,-255075,1788289,-196809,-142883,-2127981,1850267,-134831,-80905,-2066003,-22639,-2007737,-1953811,-3938909,5476607,3491509,3545435,1560337,3603701,1618603,1672529,-312569,3665679,1680581,1734507,-250591,1792773,-192325,-138399,-2123497,3730755,1745657,1799583,-185515,1857849,-127249,-73323,-2058421,1919827,-65271,-11345,-1996443,46921,-1938177,-1884251,-3869349,3798351,1813253,1867179,-117919,1925445,-59653,-5727,-1990825,1987423,2325,56251,-1928847,114517,-1870581,-1816655,-3801753,2052499,67401,121327,-1863771,179593,-1805505,-1751579,-3736677,241571,-1743527,-1689601,-3674699,-1631335,-3616433,-3562507,-5547605,5547605,3562507,3616433,1631335,3674699,1689601,1743527,-241571,3736677,1751579,1805505,-179593,1863771,-121327,-67401,-2052499,3801753,1816655,1870581,-114517,1928847,-56251,-2325,-1987423,1990825,5727,59653,-1925445,117919,-1867179,-1813253,-3798351,3869349,1884251,1938177,-46921,1996443,11345,65271,-1919827,2058421,73323,127249,-1857849,185515,-1799583,-1745657,-3730755,2123497,138399,192325,-1792773,250591,-1734507,-1680581,-3665679,312569,-1672529,-1618603,-3603701,-1560337,-3545435,-3491509,-5476607,3938909,1953811,2007737,22639,2066003,80905,134831,-1850267,2127981,142883,196809,-1788289,255075,-1730023,-1676097,-3661195,2193057,207959,261885,-1723213,320151,-1664947,-1611021,-3596119,382129,-1602969,-1549043,-3534141,-1490777,-3475875,-3421949,-5407047,2260653,275555,329481,-1655617,387747,-1597351,-1543425,-3528523,449725,-1535373,-1481447,-3466545,-1423181,-3408279,-3354353,-5339451,514801,-1470297,-1416371,-3401469,-1358105,-3343203,-3289277,-5274375,-1296127,-3281225,-3227299,-5212397,-3169033,-5154131,-5100205,-7085303
+-2152138,-1064744,-1237260,-149866,-1403794,-316400,-488916,598478,-1562712,-475318,-647834,439560,-814368,273026,100510,1187904,-1712626,-625232,-797748,289646,-964282,123112,-49404,1037990,-1123200,-35806,-208322,879072,-374856,712538,540022,1627416,-1852400,-765006,-937522,149872,-1104056,-16662,-189178,898216,-1262974,-175580,-348096,739298,-514630,572764,400248,1487642,-1412888,-325494,-498010,589384,-664544,422850,250334,1337728,-823462,263932,91416,1178810,-75118,1012276,839760,1927154,-1981132,-893738,-1066254,21140,-1232788,-145394,-317910,769484,-1391706,-304312,-476828,610566,-643362,444032,271516,1358910,-1541620,-454226,-626742,460652,-793276,294118,121602,1208996,-952194,135200,-37316,1050078,-203850,883544,711028,1798422,-1681394,-594000,-766516,320878,-933050,154344,-18172,1069222,-1091968,-4574,-177090,910304,-343624,743770,571254,1658648,-1241882,-154488,-327004,760390,-493538,593856,421340,1508734,-652456,434938,262422,1349816,95888,1183282,1010766,2098160,-2098160,-1010766,-1183282,-95888,-1349816,-262422,-434938,652456,-1508734,-421340,-593856,493538,-760390,327004,154488,1241882,-1658648,-571254,-743770,343624,-910304,177090,4574,1091968,-1069222,18172,-154344,933050,-320878,766516,594000,1681394,-1798422,-711028,-883544,203850,-1050078,37316,-135200,952194,-1208996,-121602,-294118,793276,-460652,626742,454226,1541620,-1358910,-271516,-444032,643362,-610566,476828,304312,1391706,-769484,317910,145394,1232788,-21140,1066254,893738,1981132,-1927154,-839760,-1012276,75118,-1178810,-91416,-263932,823462,-1337728,-250334,-422850,664544,-589384,498010,325494,1412888,-1487642,-400248,-572764,514630,-739298,348096,175580,1262974,-898216,189178,16662,1104056,-149872,937522,765006,1852400,-1627416,-540022,-712538,374856,-879072,208322,35806,1123200,-1037990,49404,-123112,964282,-289646,797748,625232,1712626,-1187904,-100510,-273026,814368,-439560,647834,475318,1562712,-598478,488916,316400,1403794,149866,1237260,1064744,2152138
  },
  { // [5]
-8538097,6360345,6354491,4176739,6358667,4180915,4175061,1997309,6372129,4194377,4188523,2010771,4192699,2014947,2009093,-168659,6394129,4216377,4210523,2032771,4214699,2036947,2031093,-146659,4228161,2050409,2044555,-133197,2048731,-129021,-134875,-2312627,6423933,4246181,4240327,2062575,4244503,2066751,2060897,-116855,4257965,2080213,2074359,-103393,2078535,-99217,-105071,-2282823,4279965,2102213,2096359,-81393,2100535,-77217,-83071,-2260823,2113997,-63755,-69609,-2247361,-65433,-2243185,-2249039,-4426791,6460817,4283065,4277211,2099459,4281387,2103635,2097781,-79971,4294849,2117097,2111243,-66509,2115419,-62333,-68187,-2245939,4316849,2139097,2133243,-44509,2137419,-40333,-46187,-2223939,2150881,-26871,-32725,-2210477,-28549,-2206301,-2212155,-4389907,4346653,2168901,2163047,-14705,2167223,-10529,-16383,-2194135,2180685,2933,-2921,-2180673,1255,-2176497,-2182351,-4360103,2202685,24933,19079,-2158673,23255,-2154497,-2160351,-4338103,36717,-2141035,-2146889,-4324641,-2142713,-4320465,-4326319,-6504071,6504071,4326319,4320465,2142713,4324641,2146889,2141035,-36717,4338103,2160351,2154497,-23255,2158673,-19079,-24933,-2202685,4360103,2182351,2176497,-1255,2180673,2921,-2933,-2180685,2194135,16383,10529,-2167223,14705,-2163047,-2168901,-4346653,4389907,2212155,2206301,28549,2210477,32725,26871,-2150881,2223939,46187,40333,-2137419,44509,-2133243,-2139097,-4316849,2245939,68187,62333,-2115419,66509,-2111243,-2117097,-4294849,79971,-2097781,-2103635,-4281387,-2099459,-4277211,-4283065,-6460817,4426791,2249039,2243185,65433,2247361,69609,63755,-2113997,2260823,83071,77217,-2100535,81393,-2096359,-2102213,-4279965,2282823,105071,99217,-2078535,103393,-2074359,-2080213,-4257965,116855,-2060897,-2066751,-4244503,-2062575,-4240327,-4246181,-6423933,2312627,134875,129021,-2048731,133197,-2044555,-2050409,-4228161,146659,-2031093,-2036947,-4214699,-2032771,-4210523,-4216377,-6394129,168659,-2009093,-2014947,-4192699,-2010771,-4188523,-4194377,-6372129,-1997309,-4175061,-4180915,-6358667,-4176739,-6354491,-6360345,-8538097
+-7452843,-5041099,-5175987,-2764243,-5325611,-2913867,-3048755,-637011,-5486819,-3075075,-3209963,-798219,-3359587,-947843,-1082731,1329013,-5656563,-3244819,-3379707,-967963,-3529331,-1117587,-1252475,1159269,-3690539,-1278795,-1413683,998061,-1563307,848437,713549,3125293,-5831941,-3420197,-3555085,-1143341,-3704709,-1292965,-1427853,983891,-3865917,-1454173,-1589061,822683,-1738685,673059,538171,2949915,-4035661,-1623917,-1758805,652939,-1908429,503315,368427,2780171,-2069637,342107,207219,2618963,57595,2469339,2334451,4746195,-6010211,-3598467,-3733355,-1321611,-3882979,-1471235,-1606123,805621,-4044187,-1632443,-1767331,644413,-1916955,494789,359901,2771645,-4213931,-1802187,-1937075,474669,-2086699,325045,190157,2601901,-2247907,163837,28949,2440693,-120675,2291069,2156181,4567925,-4389309,-1977565,-2112453,299291,-2262077,149667,14779,2426523,-2423285,-11541,-146429,2265315,-296053,2115691,1980803,4392547,-2593029,-181285,-316173,2095571,-465797,1945947,1811059,4222803,-627005,1784739,1649851,4061595,1500227,3911971,3777083,6188827,-6188827,-3777083,-3911971,-1500227,-4061595,-1649851,-1784739,627005,-4222803,-1811059,-1945947,465797,-2095571,316173,181285,2593029,-4392547,-1980803,-2115691,296053,-2265315,146429,11541,2423285,-2426523,-14779,-149667,2262077,-299291,2112453,1977565,4389309,-4567925,-2156181,-2291069,120675,-2440693,-28949,-163837,2247907,-2601901,-190157,-325045,2086699,-474669,1937075,1802187,4213931,-2771645,-359901,-494789,1916955,-644413,1767331,1632443,4044187,-805621,1606123,1471235,3882979,1321611,3733355,3598467,6010211,-4746195,-2334451,-2469339,-57595,-2618963,-207219,-342107,2069637,-2780171,-368427,-503315,1908429,-652939,1758805,1623917,4035661,-2949915,-538171,-673059,1738685,-822683,1589061,1454173,3865917,-983891,1427853,1292965,3704709,1143341,3555085,3420197,5831941,-3125293,-713549,-848437,1563307,-998061,1413683,1278795,3690539,-1159269,1252475,1117587,3529331,967963,3379707,3244819,5656563,-1329013,1082731,947843,3359587,798219,3209963,3075075,5486819,637011,3048755,2913867,5325611,2764243,5175987,5041099,7452843
  },
  { // [6]
-7880783,6200115,6087457,4406789,5990629,4309961,4197303,2516635,5908959,4228291,4115633,2434965,4018805,2338137,2225479,544811,5841749,4161081,4048423,2367755,3951595,2270927,2158269,477601,3869925,2189257,2076599,395931,1979771,299103,186445,-1494223,5788285,4107617,3994959,2314291,3898131,2217463,2104805,424137,3816461,2135793,2023135,342467,1926307,245639,132981,-1547687,3749251,2068583,1955925,275257,1859097,178429,65771,-1614897,1777427,96759,-15899,-1696567,-112727,-1793395,-1906053,-3586721,5747837,4067169,3954511,2273843,3857683,2177015,2064357,383689,3776013,2095345,1982687,302019,1885859,205191,92533,-1588135,3708803,2028135,1915477,234809,1818649,137981,25323,-1655345,1736979,56311,-56347,-1737015,-153175,-1833843,-1946501,-3627169,3655339,1974671,1862013,181345,1765185,84517,-28141,-1708809,1683515,2847,-109811,-1790479,-206639,-1887307,-1999965,-3680633,1616305,-64363,-177021,-1857689,-273849,-1954517,-2067175,-3747843,-355519,-2036187,-2148845,-3829513,-2245673,-3926341,-4038999,-5719667,5719667,4038999,3926341,2245673,3829513,2148845,2036187,355519,3747843,2067175,1954517,273849,1857689,177021,64363,-1616305,3680633,1999965,1887307,206639,1790479,109811,-2847,-1683515,1708809,28141,-84517,-1765185,-181345,-1862013,-1974671,-3655339,3627169,1946501,1833843,153175,1737015,56347,-56311,-1736979,1655345,-25323,-137981,-1818649,-234809,-1915477,-2028135,-3708803,1588135,-92533,-205191,-1885859,-302019,-1982687,-2095345,-3776013,-383689,-2064357,-2177015,-3857683,-2273843,-3954511,-4067169,-5747837,3586721,1906053,1793395,112727,1696567,15899,-96759,-1777427,1614897,-65771,-178429,-1859097,-275257,-1955925,-2068583,-3749251,1547687,-132981,-245639,-1926307,-342467,-2023135,-2135793,-3816461,-424137,-2104805,-2217463,-3898131,-2314291,-3994959,-4107617,-5788285,1494223,-186445,-299103,-1979771,-395931,-2076599,-2189257,-3869925,-477601,-2158269,-2270927,-3951595,-2367755,-4048423,-4161081,-5841749,-544811,-2225479,-2338137,-4018805,-2434965,-4115633,-4228291,-5908959,-2516635,-4197303,-4309961,-5990629,-4406789,-6087457,-6200115,-7880783
+-10661820,-8083724,-7987678,-5409582,-7930494,-5352398,-5256352,-2678256,-7909700,-5331604,-5235558,-2657462,-5178374,-2600278,-2504232,73864,-7922570,-5344474,-5248428,-2670332,-5191244,-2613148,-2517102,60994,-5170450,-2592354,-2496308,81788,-2439124,138972,235018,2813114,-7966176,-5388080,-5292034,-2713938,-5234850,-2656754,-2560708,17388,-5214056,-2635960,-2539914,38182,-2482730,95366,191412,2769508,-5226926,-2648830,-2552784,25312,-2495600,82496,178542,2756638,-2474806,103290,199336,2777432,256520,2834616,2930662,5508758,-8037432,-5459336,-5363290,-2785194,-5306106,-2728010,-2631964,-53868,-5285312,-2707216,-2611170,-33074,-2553986,24110,120156,2698252,-5298182,-2720086,-2624040,-45944,-2566856,11240,107286,2685382,-2546062,32034,128080,2706176,185264,2763360,2859406,5437502,-5341788,-2763692,-2667646,-89550,-2610462,-32366,63680,2641776,-2589668,-11572,84474,2662570,141658,2719754,2815800,5393896,-2602538,-24442,71604,2649700,128788,2706884,2802930,5381026,149582,2727678,2823724,5401820,2880908,5459004,5555050,8133146,-8133146,-5555050,-5459004,-2880908,-5401820,-2823724,-2727678,-149582,-5381026,-2802930,-2706884,-128788,-2649700,-71604,24442,2602538,-5393896,-2815800,-2719754,-141658,-2662570,-84474,11572,2589668,-2641776,-63680,32366,2610462,89550,2667646,2763692,5341788,-5437502,-2859406,-2763360,-185264,-2706176,-128080,-32034,2546062,-2685382,-107286,-11240,2566856,45944,2624040,2720086,5298182,-2698252,-120156,-24110,2553986,33074,2611170,2707216,5285312,53868,2631964,2728010,5306106,2785194,5363290,5459336,8037432,-5508758,-2930662,-2834616,-256520,-2777432,-199336,-103290,2474806,-2756638,-178542,-82496,2495600,-25312,2552784,2648830,5226926,-2769508,-191412,-95366,2482730,-38182,2539914,2635960,5214056,-17388,2560708,2656754,5234850,2713938,5292034,5388080,7966176,-2813114,-235018,-138972,2439124,-81788,2496308,2592354,5170450,-60994,2517102,2613148,5191244,2670332,5248428,5344474,7922570,-73864,2504232,2600278,5178374,2657462,5235558,5331604,7909700,2678256,5256352,5352398,7930494,5409582,7987678,8083724,10661820
  },
  { // [7]
-3644268,3506572,3246474,3108778,3006480,2868784,2608686,2470990,2786196,2648500,2388402,2250706,2148408,2010712,1750614,1612918,2585184,2447488,2187390,2049694,1947396,1809700,1549602,1411906,1727112,1589416,1329318,1191622,1089324,951628,691530,553834,2402958,2265262,2005164,1867468,1765170,1627474,1367376,1229680,1544886,1407190,1147092,1009396,907098,769402,509304,371608,1343874,1206178,946080,808384,706086,568390,308292,170596,485802,348106,88008,-49688,-151986,-289682,-549780,-687476,2239000,2101304,1841206,1703510,1601212,1463516,1203418,1065722,1380928,1243232,983134,845438,743140,605444,345346,207650,1179916,1042220,782122,644426,542128,404432,144334,6638,321844,184148,-75950,-213646,-315944,-453640,-713738,-851434,997690,859994,599896,462200,359902,222206,-37892,-175588,139618,1922,-258176,-395872,-498170,-635866,-895964,-1033660,-61394,-199090,-459188,-596884,-699182,-836878,-1096976,-1234672,-919466,-1057162,-1317260,-1454956,-1557254,-1694950,-1955048,-2092744,2092744,1955048,1694950,1557254,1454956,1317260,1057162,919466,1234672,1096976,836878,699182,596884,459188,199090,61394,1033660,895964,635866,498170,395872,258176,-1922,-139618,175588,37892,-222206,-359902,-462200,-599896,-859994,-997690,851434,713738,453640,315944,213646,75950,-184148,-321844,-6638,-144334,-404432,-542128,-644426,-782122,-1042220,-1179916,-207650,-345346,-605444,-743140,-845438,-983134,-1243232,-1380928,-1065722,-1203418,-1463516,-1601212,-1703510,-1841206,-2101304,-2239000,687476,549780,289682,151986,49688,-88008,-348106,-485802,-170596,-308292,-568390,-706086,-808384,-946080,-1206178,-1343874,-371608,-509304,-769402,-907098,-1009396,-1147092,-1407190,-1544886,-1229680,-1367376,-1627474,-1765170,-1867468,-2005164,-2265262,-2402958,-553834,-691530,-951628,-1089324,-1191622,-1329318,-1589416,-1727112,-1411906,-1549602,-1809700,-1947396,-2049694,-2187390,-2447488,-2585184,-1612918,-1750614,-2010712,-2148408,-2250706,-2388402,-2648500,-2786196,-2470990,-2608686,-2868784,-3006480,-3108778,-3246474,-3506572,-3644268
+-5990526,-5750724,-5302468,-5062666,-4897586,-4657784,-4209528,-3969726,-4537410,-4297608,-3849352,-3609550,-3444470,-3204668,-2756412,-2516610,-4222656,-3982854,-3534598,-3294796,-3129716,-2889914,-2441658,-2201856,-2769540,-2529738,-2081482,-1841680,-1676600,-1436798,-988542,-748740,-3953450,-3713648,-3265392,-3025590,-2860510,-2620708,-2172452,-1932650,-2500334,-2260532,-1812276,-1572474,-1407394,-1167592,-719336,-479534,-2185580,-1945778,-1497522,-1257720,-1092640,-852838,-404582,-164780,-732464,-492662,-44406,195396,360476,600278,1048534,1288336,-3729370,-3489568,-3041312,-2801510,-2636430,-2396628,-1948372,-1708570,-2276254,-2036452,-1588196,-1348394,-1183314,-943512,-495256,-255454,-1961500,-1721698,-1273442,-1033640,-868560,-628758,-180502,59300,-508384,-268582,179674,419476,584556,824358,1272614,1512416,-1692294,-1452492,-1004236,-764434,-599354,-359552,88704,328506,-239178,624,448880,688682,853762,1093564,1541820,1781622,75576,315378,763634,1003436,1168516,1408318,1856574,2096376,1528692,1768494,2216750,2456552,2621632,2861434,3309690,3549492,-3549492,-3309690,-2861434,-2621632,-2456552,-2216750,-1768494,-1528692,-2096376,-1856574,-1408318,-1168516,-1003436,-763634,-315378,-75576,-1781622,-1541820,-1093564,-853762,-688682,-448880,-624,239178,-328506,-88704,359552,599354,764434,1004236,1452492,1692294,-1512416,-1272614,-824358,-584556,-419476,-179674,268582,508384,-59300,180502,628758,868560,1033640,1273442,1721698,1961500,255454,495256,943512,1183314,1348394,1588196,2036452,2276254,1708570,1948372,2396628,2636430,2801510,3041312,3489568,3729370,-1288336,-1048534,-600278,-360476,-195396,44406,492662,732464,164780,404582,852838,1092640,1257720,1497522,1945778,2185580,479534,719336,1167592,1407394,1572474,1812276,2260532,2500334,1932650,2172452,2620708,2860510,3025590,3265392,3713648,3953450,748740,988542,1436798,1676600,1841680,2081482,2529738,2769540,2201856,2441658,2889914,3129716,3294796,3534598,3982854,4222656,2516610,2756412,3204668,3444470,3609550,3849352,4297608,4537410,3969726,4209528,4657784,4897586,5062666,5302468,5750724,5990526
  },
  { // [8]
--5381447,-2684819,-3113483,-416855,-3520873,-824245,-1252909,1443719,-3906921,-1210293,-1638957,1057671,-2046347,650281,221617,2918245,-4271625,-1574997,-2003661,692967,-2411051,285577,-143087,2553541,-2797099,-100471,-529135,2167493,-936525,1760103,1331439,4028067,-4615049,-1918421,-2347085,349543,-2754475,-57847,-486511,2210117,-3140523,-443895,-872559,1824069,-1279949,1416679,988015,3684643,-3505227,-808599,-1237263,1459365,-1644653,1051975,623311,3319939,-2030701,665927,237263,2933891,-170127,2526501,2097837,4794465,-4937313,-2240685,-2669349,27279,-3076739,-380111,-808775,1887853,-3462787,-766159,-1194823,1501805,-1602213,1094415,665751,3362379,-3827491,-1130863,-1559527,1137101,-1966917,729711,301047,2997675,-2352965,343663,-85001,2611627,-492391,2204237,1775573,4472201,-4170915,-1474287,-1902951,793677,-2310341,386287,-42377,2654251,-2696389,239,-428425,2268203,-835815,1860813,1432149,4128777,-3061093,-364465,-793129,1903499,-1200519,1496109,1067445,3764073,-1586567,1110061,681397,3378025,274007,2970635,2541971,5238599,-5238599,-2541971,-2970635,-274007,-3378025,-681397,-1110061,1586567,-3764073,-1067445,-1496109,1200519,-1903499,793129,364465,3061093,-4128777,-1432149,-1860813,835815,-2268203,428425,-239,2696389,-2654251,42377,-386287,2310341,-793677,1902951,1474287,4170915,-4472201,-1775573,-2204237,492391,-2611627,85001,-343663,2352965,-2997675,-301047,-729711,1966917,-1137101,1559527,1130863,3827491,-3362379,-665751,-1094415,1602213,-1501805,1194823,766159,3462787,-1887853,808775,380111,3076739,-27279,2669349,2240685,4937313,-4794465,-2097837,-2526501,170127,-2933891,-237263,-665927,2030701,-3319939,-623311,-1051975,1644653,-1459365,1237263,808599,3505227,-3684643,-988015,-1416679,1279949,-1824069,872559,443895,3140523,-2210117,486511,57847,2754475,-349543,2347085,1918421,4615049,-4028067,-1331439,-1760103,936525,-2167493,529135,100471,2797099,-2553541,143087,-285577,2411051,-692967,2003661,1574997,4271625,-2918245,-221617,-650281,2046347,-1057671,1638957,1210293,3906921,-1443719,1252909,824245,3520873,416855,3113483,2684819,5381447
+9229644,4701156,5368392,839904,6027002,1498514,2165750,-2362738,6670312,2141824,2809060,-1719428,3467670,-1060818,-393582,-4922070,7292286,2763798,3431034,-1097454,4089644,-438844,228392,-4300096,4732954,204466,871702,-3656786,1530312,-2998176,-2330940,-6859428,7887542,3359054,4026290,-502198,4684900,156412,823648,-3704840,5328210,799722,1466958,-3061530,2125568,-2402920,-1735684,-6264172,5950184,1421696,2088932,-2439556,2747542,-1780946,-1113710,-5642198,3390852,-1137636,-470400,-4998888,188210,-4340278,-3673042,-8201530,8451382,3922894,4590130,61642,5248740,720252,1387488,-3141000,5892050,1363562,2030798,-2497690,2689408,-1839080,-1171844,-5700332,6514024,1985536,2652772,-1875716,3311382,-1217106,-549870,-5078358,3954692,-573796,93440,-4435048,752050,-3776438,-3109202,-7637690,7109280,2580792,3248028,-1280460,3906638,-621850,45386,-4483102,4549948,21460,688696,-3839792,1347306,-3181182,-2513946,-7042434,5171922,643434,1310670,-3217818,1969280,-2559208,-1891972,-6420460,2612590,-1915898,-1248662,-5777150,-590052,-5118540,-4451304,-8979792,8979792,4451304,5118540,590052,5777150,1248662,1915898,-2612590,6420460,1891972,2559208,-1969280,3217818,-1310670,-643434,-5171922,7042434,2513946,3181182,-1347306,3839792,-688696,-21460,-4549948,4483102,-45386,621850,-3906638,1280460,-3248028,-2580792,-7109280,7637690,3109202,3776438,-752050,4435048,-93440,573796,-3954692,5078358,549870,1217106,-3311382,1875716,-2652772,-1985536,-6514024,5700332,1171844,1839080,-2689408,2497690,-2030798,-1363562,-5892050,3141000,-1387488,-720252,-5248740,-61642,-4590130,-3922894,-8451382,8201530,3673042,4340278,-188210,4998888,470400,1137636,-3390852,5642198,1113710,1780946,-2747542,2439556,-2088932,-1421696,-5950184,6264172,1735684,2402920,-2125568,3061530,-1466958,-799722,-5328210,3704840,-823648,-156412,-4684900,502198,-4026290,-3359054,-7887542,6859428,2330940,2998176,-1530312,3656786,-871702,-204466,-4732954,4300096,-228392,438844,-4089644,1097454,-3431034,-2763798,-7292286,4922070,393582,1060818,-3467670,1719428,-2809060,-2141824,-6670312,2362738,-2165750,-1498514,-6027002,-839904,-5368392,-4701156,-9229644
  },
  { // [9]
--19741529,-12879787,-13468181,-6606439,-14038269,-7176527,-7764921,-903179,-14589439,-7727697,-8316091,-1454349,-8886179,-2024437,-2612831,4248911,-15121145,-8259403,-8847797,-1986055,-9417885,-2556143,-3144537,3717205,-9969055,-3107313,-3695707,3166035,-4265795,2595947,2007553,8869295,-15632915,-8771173,-9359567,-2497825,-9929655,-3067913,-3656307,3205435,-10480825,-3619083,-4207477,2654265,-4777565,2084177,1495783,8357525,-11012531,-4150789,-4739183,2122559,-5309271,1552471,964077,7825819,-5860441,1001301,412907,7274649,-157181,6704561,6116167,12977909,-16124343,-9262601,-9850995,-2989253,-10421083,-3559341,-4147735,2714007,-10972253,-4110511,-4698905,2162837,-5268993,1592749,1004355,7866097,-11503959,-4642217,-5230611,1631131,-5800699,1061043,472649,7334391,-6351869,509873,-78521,6783221,-648609,6213133,5624739,12486481,-12015729,-5153987,-5742381,1119361,-6312469,549273,-39121,6822621,-6863639,-1897,-590291,6271451,-1160379,5701363,5112969,11974711,-7395345,-533603,-1121997,5739745,-1692085,5169657,4581263,11443005,-2243255,4618487,4030093,10891835,3460005,10321747,9733353,16595095,-16595095,-9733353,-10321747,-3460005,-10891835,-4030093,-4618487,2243255,-11443005,-4581263,-5169657,1692085,-5739745,1121997,533603,7395345,-11974711,-5112969,-5701363,1160379,-6271451,590291,1897,6863639,-6822621,39121,-549273,6312469,-1119361,5742381,5153987,12015729,-12486481,-5624739,-6213133,648609,-6783221,78521,-509873,6351869,-7334391,-472649,-1061043,5800699,-1631131,5230611,4642217,11503959,-7866097,-1004355,-1592749,5268993,-2162837,4698905,4110511,10972253,-2714007,4147735,3559341,10421083,2989253,9850995,9262601,16124343,-12977909,-6116167,-6704561,157181,-7274649,-412907,-1001301,5860441,-7825819,-964077,-1552471,5309271,-2122559,4739183,4150789,11012531,-8357525,-1495783,-2084177,4777565,-2654265,4207477,3619083,10480825,-3205435,3656307,3067913,9929655,2497825,9359567,8771173,15632915,-8869295,-2007553,-2595947,4265795,-3166035,3695707,3107313,9969055,-3717205,3144537,2556143,9417885,1986055,8847797,8259403,15121145,-4248911,2612831,2024437,8886179,1454349,8316091,7727697,14589439,903179,7764921,7176527,14038269,6606439,13468181,12879787,19741529
+29326912,20124506,20559854,11357448,21056836,11854430,12289778,3087372,21605662,12403256,12838604,3636198,13335586,4133180,4568528,-4633878,22196668,12994262,13429610,4227204,13926592,4724186,5159534,-4042872,14475418,5273012,5708360,-3494046,6205342,-2997064,-2561716,-11764122,22820400,13617994,14053342,4850936,14550324,5347918,5783266,-3419140,15099150,5896744,6332092,-2870314,6829074,-2373332,-1937984,-11140390,15690156,6487750,6923098,-2279308,7420080,-1782326,-1346978,-10549384,7968906,-1233500,-798152,-10000558,-301170,-9503576,-9068228,-18270634,23467714,14265308,14700656,5498250,15197638,5995232,6430580,-2771826,15746464,6544058,6979406,-2223000,7476388,-1726018,-1290670,-10493076,16337470,7135064,7570412,-1631994,8067394,-1135012,-699664,-9902070,8616220,-586186,-150838,-9353244,346144,-8856262,-8420914,-17623320,16961202,7758796,8194144,-1008262,8691126,-511280,-75932,-9278338,9239952,37546,472894,-8729512,969876,-8232530,-7797182,-16999588,9830958,628552,1063900,-8138506,1560882,-7641524,-7206176,-16408582,2109708,-7092698,-6657350,-15859756,-6160368,-15362774,-14927426,-24129832,24129832,14927426,15362774,6160368,15859756,6657350,7092698,-2109708,16408582,7206176,7641524,-1560882,8138506,-1063900,-628552,-9830958,16999588,7797182,8232530,-969876,8729512,-472894,-37546,-9239952,9278338,75932,511280,-8691126,1008262,-8194144,-7758796,-16961202,17623320,8420914,8856262,-346144,9353244,150838,586186,-8616220,9902070,699664,1135012,-8067394,1631994,-7570412,-7135064,-16337470,10493076,1290670,1726018,-7476388,2223000,-6979406,-6544058,-15746464,2771826,-6430580,-5995232,-15197638,-5498250,-14700656,-14265308,-23467714,18270634,9068228,9503576,301170,10000558,798152,1233500,-7968906,10549384,1346978,1782326,-7420080,2279308,-6923098,-6487750,-15690156,11140390,1937984,2373332,-6829074,2870314,-6332092,-5896744,-15099150,3419140,-5783266,-5347918,-14550324,-4850936,-14053342,-13617994,-22820400,11764122,2561716,2997064,-6205342,3494046,-5708360,-5273012,-14475418,4042872,-5159534,-4724186,-13926592,-4227204,-13429610,-12994262,-22196668,4633878,-4568528,-4133180,-13335586,-3636198,-12838604,-12403256,-21605662,-3087372,-12289778,-11854430,-21056836,-11357448,-20559854,-20124506,-29326912
  },
  { // [10]
--39008737,-26876419,-27581233,-15448915,-28275003,-16142685,-16847499,-4715181,-28956609,-16824291,-17529105,-5396787,-18222875,-6090557,-6795371,5336947,-29624983,-17492665,-18197479,-6065161,-18891249,-6758931,-7463745,4668573,-19572855,-7440537,-8145351,3986967,-8839121,3293197,2588383,14720701,-30279121,-18146803,-18851617,-6719299,-19545387,-7413069,-8117883,4014435,-20226993,-8094675,-8799489,3332829,-9493259,2639059,1934245,14066563,-20895367,-8763049,-9467863,2664455,-10161633,1970685,1265871,13398189,-10843239,1289079,584265,12716583,-109505,12022813,11317999,23450317,-30918079,-18785761,-19490575,-7358257,-20184345,-8052027,-8756841,3375477,-20865951,-8733633,-9438447,2693871,-10132217,2000101,1295287,13427605,-21534325,-9402007,-10106821,2025497,-10800591,1331727,626913,12759231,-11482197,650121,-54693,12077625,-748463,11383855,10679041,22811359,-22188463,-10056145,-10760959,1371359,-11454729,677589,-27225,12105093,-12136335,-4017,-708831,11423487,-1402601,10729717,10024903,22157221,-12804709,-672391,-1377205,10755113,-2070975,10061343,9356529,21488847,-2752581,9379737,8674923,20807241,7981153,20113471,19408657,31540975,-31540975,-19408657,-20113471,-7981153,-20807241,-8674923,-9379737,2752581,-21488847,-9356529,-10061343,2070975,-10755113,1377205,672391,12804709,-22157221,-10024903,-10729717,1402601,-11423487,708831,4017,12136335,-12105093,27225,-677589,11454729,-1371359,10760959,10056145,22188463,-22811359,-10679041,-11383855,748463,-12077625,54693,-650121,11482197,-12759231,-626913,-1331727,10800591,-2025497,10106821,9402007,21534325,-13427605,-1295287,-2000101,10132217,-2693871,9438447,8733633,20865951,-3375477,8756841,8052027,20184345,7358257,19490575,18785761,30918079,-23450317,-11317999,-12022813,109505,-12716583,-584265,-1289079,10843239,-13398189,-1265871,-1970685,10161633,-2664455,9467863,8763049,20895367,-14066563,-1934245,-2639059,9493259,-3332829,8799489,8094675,20226993,-4014435,8117883,7413069,19545387,6719299,18851617,18146803,30279121,-14720701,-2588383,-3293197,8839121,-3986967,8145351,7440537,19572855,-4668573,7463745,6758931,18891249,6065161,18197479,17492665,29624983,-5336947,6795371,6090557,18222875,5396787,17529105,16824291,28956609,4715181,16847499,16142685,28275003,15448915,27581233,26876419,39008737
+39365580,30038410,29645580,20318410,29385306,20058136,19665306,10338136,29250422,19923252,19530422,10203252,19270148,9942978,9550148,222978,29233064,19905894,19513064,10185894,19252790,9925620,9532790,205620,19117906,9790736,9397906,70736,9137632,-189538,-582368,-9909538,29324780,19997610,19604780,10277610,19344506,10017336,9624506,297336,19209622,9882452,9489622,162452,9229348,-97822,-490652,-9817822,19192264,9865094,9472264,145094,9211990,-115180,-508010,-9835180,9077106,-250064,-642894,-9970064,-903168,-10230338,-10623168,-19950338,29516628,20189458,19796628,10469458,19536354,10209184,9816354,489184,19401470,10074300,9681470,354300,9421196,94026,-298804,-9625974,19384112,10056942,9664112,336942,9403838,76668,-316162,-9643332,9268954,-58216,-451046,-9778216,-711320,-10038490,-10431320,-19758490,19475828,10148658,9755828,428658,9495554,168384,-224446,-9551616,9360670,33500,-359330,-9686500,-619604,-9946774,-10339604,-19666774,9343312,16142,-376688,-9703858,-636962,-9964132,-10356962,-19684132,-771846,-10099016,-10491846,-19819016,-10752120,-20079290,-20472120,-29799290,29799290,20472120,20079290,10752120,19819016,10491846,10099016,771846,19684132,10356962,9964132,636962,9703858,376688,-16142,-9343312,19666774,10339604,9946774,619604,9686500,359330,-33500,-9360670,9551616,224446,-168384,-9495554,-428658,-9755828,-10148658,-19475828,19758490,10431320,10038490,711320,9778216,451046,58216,-9268954,9643332,316162,-76668,-9403838,-336942,-9664112,-10056942,-19384112,9625974,298804,-94026,-9421196,-354300,-9681470,-10074300,-19401470,-489184,-9816354,-10209184,-19536354,-10469458,-19796628,-20189458,-29516628,19950338,10623168,10230338,903168,9970064,642894,250064,-9077106,9835180,508010,115180,-9211990,-145094,-9472264,-9865094,-19192264,9817822,490652,97822,-9229348,-162452,-9489622,-9882452,-19209622,-297336,-9624506,-10017336,-19344506,-10277610,-19604780,-19997610,-29324780,9909538,582368,189538,-9137632,-70736,-9397906,-9790736,-19117906,-205620,-9532790,-9925620,-19252790,-10185894,-19513064,-19905894,-29233064,-222978,-9550148,-9942978,-19270148,-10203252,-19530422,-19923252,-29250422,-10338136,-19665306,-20058136,-29385306,-20318410,-29645580,-30038410,-39365580
  },
  { // [11]
--61672969,-43655967,-44402793,-26385791,-45149261,-27132259,-27879085,-9862083,-45893901,-27876899,-28623725,-10606723,-29370193,-11353191,-12100017,5916985,-46635277,-28618275,-29365101,-11348099,-30111569,-12094567,-12841393,5175609,-30856209,-12839207,-13586033,4430969,-14332501,3684501,2937675,20954677,-47371985,-29354983,-30101809,-12084807,-30848277,-12831275,-13578101,4438901,-31592917,-13575915,-14322741,3694261,-15069209,2947793,2200967,20217969,-32334293,-14317291,-15064117,2952885,-15810585,2206417,1459591,19476593,-16555225,1461777,714951,18731953,-31517,17985485,17238659,35255661,-48102657,-30085655,-30832481,-12815479,-31578949,-13561947,-14308773,3708229,-32323589,-14306587,-15053413,2963589,-15799881,2217121,1470295,19487297,-33064965,-15047963,-15794789,2222213,-16541257,1475745,728919,18745921,-17285897,731105,-15721,18001281,-762189,17254813,16507987,34524989,-33801673,-15784671,-16531497,1485505,-17277965,739037,-7789,18009213,-18022605,-5603,-752429,17264573,-1498897,16518105,15771279,33788281,-18763981,-746979,-1493805,16523197,-2240273,15776729,15029903,33046905,-2984913,15032089,14285263,32302265,13538795,31555797,30808971,48825973,-48825973,-30808971,-31555797,-13538795,-32302265,-14285263,-15032089,2984913,-33046905,-15029903,-15776729,2240273,-16523197,1493805,746979,18763981,-33788281,-15771279,-16518105,1498897,-17264573,752429,5603,18022605,-18009213,7789,-739037,17277965,-1485505,16531497,15784671,33801673,-34524989,-16507987,-17254813,762189,-18001281,15721,-731105,17285897,-18745921,-728919,-1475745,16541257,-2222213,15794789,15047963,33064965,-19487297,-1470295,-2217121,15799881,-2963589,15053413,14306587,32323589,-3708229,14308773,13561947,31578949,12815479,30832481,30085655,48102657,-35255661,-17238659,-17985485,31517,-18731953,-714951,-1461777,16555225,-19476593,-1459591,-2206417,15810585,-2952885,15064117,14317291,32334293,-20217969,-2200967,-2947793,15069209,-3694261,14322741,13575915,31592917,-4438901,13578101,12831275,30848277,12084807,30101809,29354983,47371985,-20954677,-2937675,-3684501,14332501,-4430969,13586033,12839207,30856209,-5175609,12841393,12094567,30111569,11348099,29365101,28618275,46635277,-5916985,12100017,11353191,29370193,10606723,28623725,27876899,45893901,9862083,27879085,27132259,45149261,26385791,44402793,43655967,61672969
+21458049,20602277,19004695,18148923,17561255,16705483,15107901,14252129,16273411,15417639,13820057,12964285,12376617,11520845,9923263,9067491,15141323,14285551,12687969,11832197,11244529,10388757,8791175,7935403,9956685,9100913,7503331,6647559,6059891,5204119,3606537,2750765,14163889,13308117,11710535,10854763,10267095,9411323,7813741,6957969,8979251,8123479,6525897,5670125,5082457,4226685,2629103,1773331,7847163,6991391,5393809,4538037,3950369,3094597,1497015,641243,2662525,1806753,209171,-646601,-1234269,-2090041,-3687623,-4543395,13338807,12483035,10885453,10029681,9442013,8586241,6988659,6132887,8154169,7298397,5700815,4845043,4257375,3401603,1804021,948249,7022081,6166309,4568727,3712955,3125287,2269515,671933,-183839,1837443,981671,-615911,-1471683,-2059351,-2915123,-4512705,-5368477,6044647,5188875,3591293,2735521,2147853,1292081,-305501,-1161273,860009,4237,-1593345,-2449117,-3036785,-3892557,-5490139,-6345911,-272079,-1127851,-2725433,-3581205,-4168873,-5024645,-6622227,-7477999,-5456717,-6312489,-7910071,-8765843,-9353511,-10209283,-11806865,-12662637,12662637,11806865,10209283,9353511,8765843,7910071,6312489,5456717,7477999,6622227,5024645,4168873,3581205,2725433,1127851,272079,6345911,5490139,3892557,3036785,2449117,1593345,-4237,-860009,1161273,305501,-1292081,-2147853,-2735521,-3591293,-5188875,-6044647,5368477,4512705,2915123,2059351,1471683,615911,-981671,-1837443,183839,-671933,-2269515,-3125287,-3712955,-4568727,-6166309,-7022081,-948249,-1804021,-3401603,-4257375,-4845043,-5700815,-7298397,-8154169,-6132887,-6988659,-8586241,-9442013,-10029681,-10885453,-12483035,-13338807,4543395,3687623,2090041,1234269,646601,-209171,-1806753,-2662525,-641243,-1497015,-3094597,-3950369,-4538037,-5393809,-6991391,-7847163,-1773331,-2629103,-4226685,-5082457,-5670125,-6525897,-8123479,-8979251,-6957969,-7813741,-9411323,-10267095,-10854763,-11710535,-13308117,-14163889,-2750765,-3606537,-5204119,-6059891,-6647559,-7503331,-9100913,-9956685,-7935403,-8791175,-10388757,-11244529,-11832197,-12687969,-14285551,-15141323,-9067491,-9923263,-11520845,-12376617,-12964285,-13820057,-15417639,-16273411,-14252129,-15107901,-16705483,-17561255,-18148923,-19004695,-20602277,-21458049
  },
  { // [12]
--85281588,-61460008,-62154590,-38333010,-62861138,-39039558,-39734140,-15912560,-63578098,-39756518,-40451100,-16629520,-41157648,-17336068,-18030650,5790930,-64303912,-40482332,-41176914,-17355334,-41883462,-18061882,-18756464,5065116,-42600422,-18778842,-19473424,4348156,-20179972,3641608,2947026,26768606,-65037020,-41215440,-41910022,-18088442,-42616570,-18794990,-19489572,4332008,-43333530,-19511950,-20206532,3615048,-20913080,2908500,2213918,26035498,-44059344,-20237764,-20932346,2889234,-21638894,2182686,1488104,25309684,-22355854,1465726,771144,24592724,64596,23886176,23191594,47013174,-65775864,-41954284,-42648866,-18827286,-43355414,-19533834,-20228416,3593164,-44072374,-20250794,-20945376,2876204,-21651924,2169656,1475074,25296654,-44798188,-20976608,-21671190,2150390,-22377738,1443842,749260,24570840,-23094698,726882,32300,23853880,-674248,23147332,22452750,46274330,-45531296,-21709716,-22404298,1417282,-23110846,710734,16152,23837732,-23827806,-6226,-700808,23120772,-1407356,22414224,21719642,45541222,-24553620,-732040,-1426622,22394958,-2133170,21688410,20993828,44815408,-2850130,20971450,20276868,44098448,19570320,43391900,42697318,66518898,-66518898,-42697318,-43391900,-19570320,-44098448,-20276868,-20971450,2850130,-44815408,-20993828,-21688410,2133170,-22394958,1426622,732040,24553620,-45541222,-21719642,-22414224,1407356,-23120772,700808,6226,23827806,-23837732,-16152,-710734,23110846,-1417282,22404298,21709716,45531296,-46274330,-22452750,-23147332,674248,-23853880,-32300,-726882,23094698,-24570840,-749260,-1443842,22377738,-2150390,21671190,20976608,44798188,-25296654,-1475074,-2169656,21651924,-2876204,20945376,20250794,44072374,-3593164,20228416,19533834,43355414,18827286,42648866,41954284,65775864,-47013174,-23191594,-23886176,-64596,-24592724,-771144,-1465726,22355854,-25309684,-1488104,-2182686,21638894,-2889234,20932346,20237764,44059344,-26035498,-2213918,-2908500,20913080,-3615048,20206532,19511950,43333530,-4332008,19489572,18794990,42616570,18088442,41910022,41215440,65037020,-26768606,-2947026,-3641608,20179972,-4348156,19473424,18778842,42600422,-5065116,18756464,18061882,41883462,17355334,41176914,40482332,64303912,-5790930,18030650,17336068,41157648,16629520,40451100,39756518,63578098,15912560,39734140,39039558,62861138,38333010,62154590,61460008,85281588
+-33809485,-16953369,-19570849,-2714733,-22093809,-5237693,-7855173,9000943,-24510329,-7654213,-10271693,6584423,-12794653,4061463,1443983,18300099,-26809673,-9953557,-12571037,4285079,-15093997,1762119,-855361,16000755,-17510517,-654401,-3271881,13584235,-5794841,11061275,8443795,25299911,-28982357,-12126241,-14743721,2112395,-17266681,-410565,-3028045,13828071,-19683201,-2827085,-5444565,11411551,-7967525,8888591,6271111,23127227,-21982545,-5126429,-7743909,9112207,-10266869,6589247,3971767,20827883,-12683389,4172727,1555247,18411363,-967713,15888403,13270923,30127039,-31020195,-14164079,-16781559,74557,-19304519,-2448403,-5065883,11790233,-21721039,-4864923,-7482403,9373713,-10005363,6850753,4233273,21089389,-24020383,-7164267,-9781747,7074369,-12304707,4551409,1933929,18790045,-14721227,2134889,-482591,16373525,-3005551,13850565,11233085,28089201,-26193067,-9336951,-11954431,4901685,-14477391,2378725,-238755,16617361,-16893911,-37795,-2655275,14200841,-5178235,11677881,9060401,25916517,-19193255,-2337139,-4954619,11901497,-7477579,9378537,6761057,23617173,-9894099,6962017,4344537,21200653,1821577,18677693,16060213,32916329,-32916329,-16060213,-18677693,-1821577,-21200653,-4344537,-6962017,9894099,-23617173,-6761057,-9378537,7477579,-11901497,4954619,2337139,19193255,-25916517,-9060401,-11677881,5178235,-14200841,2655275,37795,16893911,-16617361,238755,-2378725,14477391,-4901685,11954431,9336951,26193067,-28089201,-11233085,-13850565,3005551,-16373525,482591,-2134889,14721227,-18790045,-1933929,-4551409,12304707,-7074369,9781747,7164267,24020383,-21089389,-4233273,-6850753,10005363,-9373713,7482403,4864923,21721039,-11790233,5065883,2448403,19304519,-74557,16781559,14164079,31020195,-30127039,-13270923,-15888403,967713,-18411363,-1555247,-4172727,12683389,-20827883,-3971767,-6589247,10266869,-9112207,7743909,5126429,21982545,-23127227,-6271111,-8888591,7967525,-11411551,5444565,2827085,19683201,-13828071,3028045,410565,17266681,-2112395,14743721,12126241,28982357,-25299911,-8443795,-11061275,5794841,-13584235,3271881,654401,17510517,-16000755,855361,-1762119,15093997,-4285079,12571037,9953557,26809673,-18300099,-1443983,-4061463,12794653,-6584423,10271693,7654213,24510329,-9000943,7855173,5237693,22093809,2714733,19570849,16953369,33809485
  },
  { // [13]
--106821005,-78054193,-78599415,-49832603,-79168247,-50401435,-50946657,-22179845,-79759349,-50992537,-51537759,-22770947,-52106591,-23339779,-23885001,4881811,-80371345,-51604533,-52149755,-23382943,-52718587,-23951775,-24496997,4269815,-53309689,-24542877,-25088099,3678713,-25656931,3109881,2564659,31331471,-81002817,-52236005,-52781227,-24014415,-53350059,-24583247,-25128469,3638343,-53941161,-25174349,-25719571,3047241,-26288403,2478409,1933187,30699999,-54553157,-25786345,-26331567,2435245,-26900399,1866413,1321191,30088003,-27491501,1275311,730089,29496901,161257,28928069,28382847,57149659,-81652313,-52885501,-53430723,-24663911,-53999555,-25232743,-25777965,2988847,-54590657,-25823845,-26369067,2397745,-26937899,1828913,1283691,30050503,-55202653,-26435841,-26981063,1785749,-27549895,1216917,671695,29438507,-28140997,625815,80593,28847405,-488239,28278573,27733351,56500163,-55834125,-27067313,-27612535,1154277,-28181367,585445,40223,28807035,-28772469,-5657,-550879,28215933,-1119711,27647101,27101879,55868691,-29384465,-617653,-1162875,27603937,-1731707,27035105,26489883,55256695,-2322809,26444003,25898781,54665593,25329949,54096761,53551539,82318351,-82318351,-53551539,-54096761,-25329949,-54665593,-25898781,-26444003,2322809,-55256695,-26489883,-27035105,1731707,-27603937,1162875,617653,29384465,-55868691,-27101879,-27647101,1119711,-28215933,550879,5657,28772469,-28807035,-40223,-585445,28181367,-1154277,27612535,27067313,55834125,-56500163,-27733351,-28278573,488239,-28847405,-80593,-625815,28140997,-29438507,-671695,-1216917,27549895,-1785749,26981063,26435841,55202653,-30050503,-1283691,-1828913,26937899,-2397745,26369067,25823845,54590657,-2988847,25777965,25232743,53999555,24663911,53430723,52885501,81652313,-57149659,-28382847,-28928069,-161257,-29496901,-730089,-1275311,27491501,-30088003,-1321191,-1866413,26900399,-2435245,26331567,25786345,54553157,-30699999,-1933187,-2478409,26288403,-3047241,25719571,25174349,53941161,-3638343,25128469,24583247,53350059,24014415,52781227,52236005,81002817,-31331471,-2564659,-3109881,25656931,-3678713,25088099,24542877,53309689,-4269815,24496997,23951775,52718587,23382943,52149755,51604533,80371345,-4881811,23885001,23339779,52106591,22770947,51537759,50992537,79759349,22179845,50946657,50401435,79168247,49832603,78599415,78054193,106821005
+-117847040,-78400934,-81232898,-41786792,-84097092,-44650986,-47482950,-8036844,-86975726,-47529620,-50361584,-10915478,-53225778,-13779672,-16611636,22834470,-89851304,-50405198,-53237162,-13791056,-56101356,-16655250,-19487214,19958892,-58979990,-19533884,-22365848,17080258,-25230042,14216064,11384100,50830206,-92706752,-53260646,-56092610,-16646504,-58956804,-19510698,-22342662,17103444,-61835438,-22389332,-25221296,14224810,-28085490,11360616,8528652,47974758,-64711016,-25264910,-28096874,11349232,-30961068,8485038,5653074,45099180,-33839702,5606404,2774440,42220546,-89754,39356352,36524388,75970494,-95525574,-56079468,-58911432,-19465326,-61775626,-22329520,-25161484,14284622,-64654260,-25208154,-28040118,11405988,-30904312,8541794,5709830,45155936,-67529838,-28083732,-30915696,8530410,-33779890,5666216,2834252,42280358,-36658524,2787582,-44382,39401724,-2908576,36537530,33705566,73151672,-70385286,-30939180,-33771144,5674962,-36635338,2810768,-21196,39424910,-39513972,-67866,-2899830,36546276,-5764024,33682082,30850118,70296224,-42389550,-2943444,-5775408,33670698,-8639602,30806504,27974540,67420646,-11518236,27927870,25095906,64542012,22231712,61677818,58845854,98291960,-98291960,-58845854,-61677818,-22231712,-64542012,-25095906,-27927870,11518236,-67420646,-27974540,-30806504,8639602,-33670698,5775408,2943444,42389550,-70296224,-30850118,-33682082,5764024,-36546276,2899830,67866,39513972,-39424910,21196,-2810768,36635338,-5674962,33771144,30939180,70385286,-73151672,-33705566,-36537530,2908576,-39401724,44382,-2787582,36658524,-42280358,-2834252,-5666216,33779890,-8530410,30915696,28083732,67529838,-45155936,-5709830,-8541794,30904312,-11405988,28040118,25208154,64654260,-14284622,25161484,22329520,61775626,19465326,58911432,56079468,95525574,-75970494,-36524388,-39356352,89754,-42220546,-2774440,-5606404,33839702,-45099180,-5653074,-8485038,30961068,-11349232,28096874,25264910,64711016,-47974758,-8528652,-11360616,28085490,-14224810,25221296,22389332,61835438,-17103444,22342662,19510698,58956804,16646504,56092610,53260646,92706752,-50830206,-11384100,-14216064,25230042,-17080258,22365848,19533884,58979990,-19958892,19487214,16655250,56101356,13791056,53237162,50405198,89851304,-22834470,16611636,13779672,53225778,10915478,50361584,47529620,86975726,8036844,47482950,44650986,84097092,41786792,81232898,78400934,117847040
  },
  { // [14]
--123265284,-91129160,-91444028,-59307904,-91791132,-59655008,-59969876,-27833752,-92169630,-60033506,-60348374,-28212250,-60695478,-28559354,-28874222,3261902,-92578602,-60442478,-60757346,-28621222,-61104450,-28968326,-29283194,2852930,-61482948,-29346824,-29661692,2474432,-30008796,2127328,1812460,33948584,-93017060,-60880936,-61195804,-29059680,-61542908,-29406784,-29721652,2414472,-61921406,-29785282,-30100150,2035974,-30447254,1688870,1374002,33510126,-62330378,-30194254,-30509122,1627002,-30856226,1279898,965030,33101154,-31234724,901400,586532,32722656,239428,32375552,32060684,64196808,-93483948,-61347824,-61662692,-29526568,-62009796,-29873672,-30188540,1947584,-62388294,-30252170,-30567038,1569086,-30914142,1221982,907114,33043238,-62797266,-30661142,-30976010,1160114,-31323114,813010,498142,32634266,-31701612,434512,119644,32255768,-227460,31908664,31593796,63729920,-63235724,-31099600,-31414468,721656,-31761572,374552,59684,32195808,-32140070,-3946,-318814,31817310,-665918,31470206,31155338,63291462,-32549042,-412918,-727786,31408338,-1074890,31061234,30746366,62882490,-1453388,30682736,30367868,62503992,30020764,62156888,61842020,93978144,-93978144,-61842020,-62156888,-30020764,-62503992,-30367868,-30682736,1453388,-62882490,-30746366,-31061234,1074890,-31408338,727786,412918,32549042,-63291462,-31155338,-31470206,665918,-31817310,318814,3946,32140070,-32195808,-59684,-374552,31761572,-721656,31414468,31099600,63235724,-63729920,-31593796,-31908664,227460,-32255768,-119644,-434512,31701612,-32634266,-498142,-813010,31323114,-1160114,30976010,30661142,62797266,-33043238,-907114,-1221982,30914142,-1569086,30567038,30252170,62388294,-1947584,30188540,29873672,62009796,29526568,61662692,61347824,93483948,-64196808,-32060684,-32375552,-239428,-32722656,-586532,-901400,31234724,-33101154,-965030,-1279898,30856226,-1627002,30509122,30194254,62330378,-33510126,-1374002,-1688870,30447254,-2035974,30100150,29785282,61921406,-2414472,29721652,29406784,61542908,29059680,61195804,60880936,93017060,-33948584,-1812460,-2127328,30008796,-2474432,29661692,29346824,61482948,-2852930,29283194,28968326,61104450,28621222,60757346,60442478,92578602,-3261902,28874222,28559354,60695478,28212250,60348374,60033506,92169630,27833752,59969876,59655008,91791132,59307904,91444028,91129160,123265284
+-203907463,-145075019,-147024425,-88191981,-149140481,-90308037,-92257443,-33424999,-151408559,-92576115,-94525521,-35693077,-96641577,-37809133,-39758539,19073905,-153813117,-94980673,-96930079,-38097635,-99046135,-40213691,-42163097,16669347,-101314213,-42481769,-44431175,14401269,-46547231,12285213,10335807,69168251,-156337843,-97505399,-99454805,-40622361,-101570861,-42738417,-44687823,14144621,-103838939,-45006495,-46955901,11876543,-49071957,9760487,7811081,66643525,-106243497,-47411053,-49360459,9471985,-51476515,7355929,5406523,64238967,-53744593,5087851,3138445,61970889,1022389,59854833,57905427,116737871,-158965791,-100133347,-102082753,-43250309,-104198809,-45366365,-47315771,11516673,-106466887,-47634443,-49583849,9248595,-51699905,7132539,5183133,64015577,-108871445,-50039001,-51988407,6844037,-54104463,4727981,2778575,61611019,-56372541,2459903,510497,59342941,-1605559,57226885,55277479,114109923,-111396171,-52563727,-54513133,4319311,-56629189,2203255,253849,59086293,-58897267,-64823,-2014229,56818215,-4130285,54702159,52752753,111585197,-61301825,-2469381,-4418787,54413657,-6534843,52297601,50348195,109180639,-8802921,50029523,48080117,106912561,45964061,104796505,102847099,161679543,-161679543,-102847099,-104796505,-45964061,-106912561,-48080117,-50029523,8802921,-109180639,-50348195,-52297601,6534843,-54413657,4418787,2469381,61301825,-111585197,-52752753,-54702159,4130285,-56818215,2014229,64823,58897267,-59086293,-253849,-2203255,56629189,-4319311,54513133,52563727,111396171,-114109923,-55277479,-57226885,1605559,-59342941,-510497,-2459903,56372541,-61611019,-2778575,-4727981,54104463,-6844037,51988407,50039001,108871445,-64015577,-5183133,-7132539,51699905,-9248595,49583849,47634443,106466887,-11516673,47315771,45366365,104198809,43250309,102082753,100133347,158965791,-116737871,-57905427,-59854833,-1022389,-61970889,-3138445,-5087851,53744593,-64238967,-5406523,-7355929,51476515,-9471985,49360459,47411053,106243497,-66643525,-7811081,-9760487,49071957,-11876543,46955901,45006495,103838939,-14144621,44687823,42738417,101570861,40622361,99454805,97505399,156337843,-69168251,-10335807,-12285213,46547231,-14401269,44431175,42481769,101314213,-16669347,42163097,40213691,99046135,38097635,96930079,94980673,153813117,-19073905,39758539,37809133,96641577,35693077,94525521,92576115,151408559,33424999,92257443,90308037,149140481,88191981,147024425,145075019,203907463
  },
  { // [15]
--132169671,-98750359,-98786521,-65367209,-98858755,-65439443,-65475605,-32056293,-98966883,-65547571,-65583733,-32164421,-65655967,-32236655,-32272817,1146495,-99110637,-65691325,-65727487,-32308175,-65799721,-32380409,-32416571,1002741,-65907849,-32488537,-32524699,894613,-32596933,822379,786217,34205529,-99289663,-65870351,-65906513,-32487201,-65978747,-32559435,-32595597,823715,-66086875,-32667563,-32703725,715587,-32775959,643353,607191,34026503,-66230629,-32811317,-32847479,571833,-32919713,499599,463437,33882749,-33027841,391471,355309,33774621,283075,33702387,33666225,67085537,-99503521,-66084209,-66120371,-32701059,-66192605,-32773293,-32809455,609857,-66300733,-32881421,-32917583,501729,-32989817,429495,393333,33812645,-66444487,-33025175,-33061337,357975,-33133571,285741,249579,33668891,-33241699,177613,141451,33560763,69217,33488529,33452367,66871679,-66623513,-33204201,-33240363,178949,-33312597,106715,70553,33489865,-33420725,-1413,-37575,33381737,-109809,33309503,33273341,66692653,-33564479,-145167,-181329,33237983,-253563,33165749,33129587,66548899,-361691,33057621,33021459,66440771,32949225,66368537,66332375,99751687,-99751687,-66332375,-66368537,-32949225,-66440771,-33021459,-33057621,361691,-66548899,-33129587,-33165749,253563,-33237983,181329,145167,33564479,-66692653,-33273341,-33309503,109809,-33381737,37575,1413,33420725,-33489865,-70553,-106715,33312597,-178949,33240363,33204201,66623513,-66871679,-33452367,-33488529,-69217,-33560763,-141451,-177613,33241699,-33668891,-249579,-285741,33133571,-357975,33061337,33025175,66444487,-33812645,-393333,-429495,32989817,-501729,32917583,32881421,66300733,-609857,32809455,32773293,66192605,32701059,66120371,66084209,99503521,-67085537,-33666225,-33702387,-283075,-33774621,-355309,-391471,33027841,-33882749,-463437,-499599,32919713,-571833,32847479,32811317,66230629,-34026503,-607191,-643353,32775959,-715587,32703725,32667563,66086875,-823715,32595597,32559435,65978747,32487201,65906513,65870351,99289663,-34205529,-786217,-822379,32596933,-894613,32524699,32488537,65907849,-1002741,32416571,32380409,65799721,32308175,65727487,65691325,99110637,-1146495,32272817,32236655,65655967,32164421,65583733,65547571,98966883,32056293,65475605,65439443,98858755,65367209,98786521,98750359,132169671
+-258474573,-191403473,-191642119,-124571019,-192117701,-125046601,-125285247,-58214147,-192826801,-125755701,-125994347,-58923247,-126469929,-59398829,-59637475,7433625,-193764345,-126693245,-126931891,-59860791,-127407473,-60336373,-60575019,6496081,-128116573,-61045473,-61284119,5786981,-61759701,5311399,5072753,72143853,-194923633,-127852533,-128091179,-61020079,-128566761,-61495661,-61734307,5336793,-129275861,-62204761,-62443407,4627693,-62918989,4152111,3913465,70984565,-130213405,-63142305,-63380951,3690149,-63856533,3214567,2975921,70047021,-64565633,2505467,2266821,69337921,1791239,68862339,68623693,135694793,-196296413,-129225313,-129463959,-62392859,-129939541,-62868441,-63107087,3964013,-130648641,-63577541,-63816187,3254913,-64291769,2779331,2540685,69611785,-131586185,-64515085,-64753731,2317369,-65229313,1841787,1603141,68674241,-65938413,1132687,894041,67965141,418459,67489559,67250913,134322013,-132745473,-65674373,-65913019,1158081,-66388601,682499,443853,67514953,-67097701,-26601,-265247,66805853,-740829,66330271,66091625,133162725,-68035245,-964145,-1202791,65868309,-1678373,65392727,65154081,132225181,-2387473,64683627,64444981,131516081,63969399,131040499,130801853,197872953,-197872953,-130801853,-131040499,-63969399,-131516081,-64444981,-64683627,2387473,-132225181,-65154081,-65392727,1678373,-65868309,1202791,964145,68035245,-133162725,-66091625,-66330271,740829,-66805853,265247,26601,67097701,-67514953,-443853,-682499,66388601,-1158081,65913019,65674373,132745473,-134322013,-67250913,-67489559,-418459,-67965141,-894041,-1132687,65938413,-68674241,-1603141,-1841787,65229313,-2317369,64753731,64515085,131586185,-69611785,-2540685,-2779331,64291769,-3254913,63816187,63577541,130648641,-3964013,63107087,62868441,129939541,62392859,129463959,129225313,196296413,-135694793,-68623693,-68862339,-1791239,-69337921,-2266821,-2505467,64565633,-70047021,-2975921,-3214567,63856533,-3690149,63380951,63142305,130213405,-70984565,-3913465,-4152111,62918989,-4627693,62443407,62204761,129275861,-5336793,61734307,61495661,128566761,61020079,128091179,127852533,194923633,-72143853,-5072753,-5311399,61759701,-5786981,61284119,61045473,128116573,-6496081,60575019,60336373,127407473,59860791,126931891,126693245,193764345,-7433625,59637475,59398829,126469929,58923247,125994347,125755701,192826801,58214147,125285247,125046601,192117701,124571019,191642119,191403473,258474573
  },
  { // [16]
--132169671,-99751687,-99503521,-67085537,-99289663,-66871679,-66623513,-34205529,-99110637,-66692653,-66444487,-34026503,-66230629,-33812645,-33564479,-1146495,-98966883,-66548899,-66300733,-33882749,-66086875,-33668891,-33420725,-1002741,-65907849,-33489865,-33241699,-823715,-33027841,-609857,-361691,32056293,-98858755,-66440771,-66192605,-33774621,-65978747,-33560763,-33312597,-894613,-65799721,-33381737,-33133571,-715587,-32919713,-501729,-253563,32164421,-65655967,-33237983,-32989817,-571833,-32775959,-357975,-109809,32308175,-32596933,-178949,69217,32487201,283075,32701059,32949225,65367209,-98786521,-66368537,-66120371,-33702387,-65906513,-33488529,-33240363,-822379,-65727487,-33309503,-33061337,-643353,-32847479,-429495,-181329,32236655,-65583733,-33165749,-32917583,-499599,-32703725,-285741,-37575,32380409,-32524699,-106715,141451,32559435,355309,32773293,33021459,65439443,-65475605,-33057621,-32809455,-391471,-32595597,-177613,70553,32488537,-32416571,1413,249579,32667563,463437,32881421,33129587,65547571,-32272817,145167,393333,32811317,607191,33025175,33273341,65691325,786217,33204201,33452367,65870351,33666225,66084209,66332375,98750359,-98750359,-66332375,-66084209,-33666225,-65870351,-33452367,-33204201,-786217,-65691325,-33273341,-33025175,-607191,-32811317,-393333,-145167,32272817,-65547571,-33129587,-32881421,-463437,-32667563,-249579,-1413,32416571,-32488537,-70553,177613,32595597,391471,32809455,33057621,65475605,-65439443,-33021459,-32773293,-355309,-32559435,-141451,106715,32524699,-32380409,37575,285741,32703725,499599,32917583,33165749,65583733,-32236655,181329,429495,32847479,643353,33061337,33309503,65727487,822379,33240363,33488529,65906513,33702387,66120371,66368537,98786521,-65367209,-32949225,-32701059,-283075,-32487201,-69217,178949,32596933,-32308175,109809,357975,32775959,571833,32989817,33237983,65655967,-32164421,253563,501729,32919713,715587,33133571,33381737,65799721,894613,33312597,33560763,65978747,33774621,66192605,66440771,98858755,-32056293,361691,609857,33027841,823715,33241699,33489865,65907849,1002741,33420725,33668891,66086875,33882749,66300733,66548899,98966883,1146495,33564479,33812645,66230629,34026503,66444487,66692653,99110637,34205529,66623513,66871679,99289663,67085537,99503521,99751687,132169671
+-258474573,-197872953,-196296413,-135694793,-194923633,-134322013,-132745473,-72143853,-193764345,-133162725,-131586185,-70984565,-130213405,-69611785,-68035245,-7433625,-192826801,-132225181,-130648641,-70047021,-129275861,-68674241,-67097701,-6496081,-128116573,-67514953,-65938413,-5336793,-64565633,-3964013,-2387473,58214147,-192117701,-131516081,-129939541,-69337921,-128566761,-67965141,-66388601,-5786981,-127407473,-66805853,-65229313,-4627693,-63856533,-3254913,-1678373,58923247,-126469929,-65868309,-64291769,-3690149,-62918989,-2317369,-740829,59860791,-61759701,-1158081,418459,61020079,1791239,62392859,63969399,124571019,-191642119,-131040499,-129463959,-68862339,-128091179,-67489559,-65913019,-5311399,-126931891,-66330271,-64753731,-4152111,-63380951,-2779331,-1202791,59398829,-125994347,-65392727,-63816187,-3214567,-62443407,-1841787,-265247,60336373,-61284119,-682499,894041,61495661,2266821,62868441,64444981,125046601,-125285247,-64683627,-63107087,-2505467,-61734307,-1132687,443853,61045473,-60575019,26601,1603141,62204761,2975921,63577541,65154081,125755701,-59637475,964145,2540685,63142305,3913465,64515085,66091625,126693245,5072753,65674373,67250913,127852533,68623693,129225313,130801853,191403473,-191403473,-130801853,-129225313,-68623693,-127852533,-67250913,-65674373,-5072753,-126693245,-66091625,-64515085,-3913465,-63142305,-2540685,-964145,59637475,-125755701,-65154081,-63577541,-2975921,-62204761,-1603141,-26601,60575019,-61045473,-443853,1132687,61734307,2505467,63107087,64683627,125285247,-125046601,-64444981,-62868441,-2266821,-61495661,-894041,682499,61284119,-60336373,265247,1841787,62443407,3214567,63816187,65392727,125994347,-59398829,1202791,2779331,63380951,4152111,64753731,66330271,126931891,5311399,65913019,67489559,128091179,68862339,129463959,131040499,191642119,-124571019,-63969399,-62392859,-1791239,-61020079,-418459,1158081,61759701,-59860791,740829,2317369,62918989,3690149,64291769,65868309,126469929,-58923247,1678373,3254913,63856533,4627693,65229313,66805853,127407473,5786981,66388601,67965141,128566761,69337921,129939541,131516081,192117701,-58214147,2387473,3964013,64565633,5336793,65938413,67514953,128116573,6496081,67097701,68674241,129275861,70047021,130648641,132225181,192826801,7433625,68035245,69611785,130213405,70984565,131586185,133162725,193764345,72143853,132745473,134322013,194923633,135694793,196296413,197872953,258474573
  },
  { // [17]
--123265284,-93978144,-93483948,-64196808,-93017060,-63729920,-63235724,-33948584,-92578602,-63291462,-62797266,-33510126,-62330378,-33043238,-32549042,-3261902,-92169630,-62882490,-62388294,-33101154,-61921406,-32634266,-32140070,-2852930,-61482948,-32195808,-31701612,-2414472,-31234724,-1947584,-1453388,27833752,-91791132,-62503992,-62009796,-32722656,-61542908,-32255768,-31761572,-2474432,-61104450,-31817310,-31323114,-2035974,-30856226,-1569086,-1074890,28212250,-60695478,-31408338,-30914142,-1627002,-30447254,-1160114,-665918,28621222,-30008796,-721656,-227460,29059680,239428,29526568,30020764,59307904,-91444028,-62156888,-61662692,-32375552,-61195804,-31908664,-31414468,-2127328,-60757346,-31470206,-30976010,-1688870,-30509122,-1221982,-727786,28559354,-60348374,-31061234,-30567038,-1279898,-30100150,-813010,-318814,28968326,-29661692,-374552,119644,29406784,586532,29873672,30367868,59655008,-59969876,-30682736,-30188540,-901400,-29721652,-434512,59684,29346824,-29283194,3946,498142,29785282,965030,30252170,30746366,60033506,-28874222,412918,907114,30194254,1374002,30661142,31155338,60442478,1812460,31099600,31593796,60880936,32060684,61347824,61842020,91129160,-91129160,-61842020,-61347824,-32060684,-60880936,-31593796,-31099600,-1812460,-60442478,-31155338,-30661142,-1374002,-30194254,-907114,-412918,28874222,-60033506,-30746366,-30252170,-965030,-29785282,-498142,-3946,29283194,-29346824,-59684,434512,29721652,901400,30188540,30682736,59969876,-59655008,-30367868,-29873672,-586532,-29406784,-119644,374552,29661692,-28968326,318814,813010,30100150,1279898,30567038,31061234,60348374,-28559354,727786,1221982,30509122,1688870,30976010,31470206,60757346,2127328,31414468,31908664,61195804,32375552,61662692,62156888,91444028,-59307904,-30020764,-29526568,-239428,-29059680,227460,721656,30008796,-28621222,665918,1160114,30447254,1627002,30914142,31408338,60695478,-28212250,1074890,1569086,30856226,2035974,31323114,31817310,61104450,2474432,31761572,32255768,61542908,32722656,62009796,62503992,91791132,-27833752,1453388,1947584,31234724,2414472,31701612,32195808,61482948,2852930,32140070,32634266,61921406,33101154,62388294,62882490,92169630,3261902,32549042,33043238,62330378,33510126,62797266,63291462,92578602,33948584,63235724,63729920,93017060,64196808,93483948,93978144,123265284
+-203907463,-161679543,-158965791,-116737871,-156337843,-114109923,-111396171,-69168251,-153813117,-111585197,-108871445,-66643525,-106243497,-64015577,-61301825,-19073905,-151408559,-109180639,-106466887,-64238967,-103838939,-61611019,-58897267,-16669347,-101314213,-59086293,-56372541,-14144621,-53744593,-11516673,-8802921,33424999,-149140481,-106912561,-104198809,-61970889,-101570861,-59342941,-56629189,-14401269,-99046135,-56818215,-54104463,-11876543,-51476515,-9248595,-6534843,35693077,-96641577,-54413657,-51699905,-9471985,-49071957,-6844037,-4130285,38097635,-46547231,-4319311,-1605559,40622361,1022389,43250309,45964061,88191981,-147024425,-104796505,-102082753,-59854833,-99454805,-57226885,-54513133,-12285213,-96930079,-54702159,-51988407,-9760487,-49360459,-7132539,-4418787,37809133,-94525521,-52297601,-49583849,-7355929,-46955901,-4727981,-2014229,40213691,-44431175,-2203255,510497,42738417,3138445,45366365,48080117,90308037,-92257443,-50029523,-47315771,-5087851,-44687823,-2459903,253849,42481769,-42163097,64823,2778575,45006495,5406523,47634443,50348195,92576115,-39758539,2469381,5183133,47411053,7811081,50039001,52752753,94980673,10335807,52563727,55277479,97505399,57905427,100133347,102847099,145075019,-145075019,-102847099,-100133347,-57905427,-97505399,-55277479,-52563727,-10335807,-94980673,-52752753,-50039001,-7811081,-47411053,-5183133,-2469381,39758539,-92576115,-50348195,-47634443,-5406523,-45006495,-2778575,-64823,42163097,-42481769,-253849,2459903,44687823,5087851,47315771,50029523,92257443,-90308037,-48080117,-45366365,-3138445,-42738417,-510497,2203255,44431175,-40213691,2014229,4727981,46955901,7355929,49583849,52297601,94525521,-37809133,4418787,7132539,49360459,9760487,51988407,54702159,96930079,12285213,54513133,57226885,99454805,59854833,102082753,104796505,147024425,-88191981,-45964061,-43250309,-1022389,-40622361,1605559,4319311,46547231,-38097635,4130285,6844037,49071957,9471985,51699905,54413657,96641577,-35693077,6534843,9248595,51476515,11876543,54104463,56818215,99046135,14401269,56629189,59342941,101570861,61970889,104198809,106912561,149140481,-33424999,8802921,11516673,53744593,14144621,56372541,59086293,101314213,16669347,58897267,61611019,103838939,64238967,106466887,109180639,151408559,19073905,61301825,64015577,106243497,66643525,108871445,111585197,153813117,69168251,111396171,114109923,156337843,116737871,158965791,161679543,203907463
  },
  { // [18]
--106821005,-82318351,-81652313,-57149659,-81002817,-56500163,-55834125,-31331471,-80371345,-55868691,-55202653,-30699999,-54553157,-30050503,-29384465,-4881811,-79759349,-55256695,-54590657,-30088003,-53941161,-29438507,-28772469,-4269815,-53309689,-28807035,-28140997,-3638343,-27491501,-2988847,-2322809,22179845,-79168247,-54665593,-53999555,-29496901,-53350059,-28847405,-28181367,-3678713,-52718587,-28215933,-27549895,-3047241,-26900399,-2397745,-1731707,22770947,-52106591,-27603937,-26937899,-2435245,-26288403,-1785749,-1119711,23382943,-25656931,-1154277,-488239,24014415,161257,24663911,25329949,49832603,-78599415,-54096761,-53430723,-28928069,-52781227,-28278573,-27612535,-3109881,-52149755,-27647101,-26981063,-2478409,-26331567,-1828913,-1162875,23339779,-51537759,-27035105,-26369067,-1866413,-25719571,-1216917,-550879,23951775,-25088099,-585445,80593,24583247,730089,25232743,25898781,50401435,-50946657,-26444003,-25777965,-1275311,-25128469,-625815,40223,24542877,-24496997,5657,671695,25174349,1321191,25823845,26489883,50992537,-23885001,617653,1283691,25786345,1933187,26435841,27101879,51604533,2564659,27067313,27733351,52236005,28382847,52885501,53551539,78054193,-78054193,-53551539,-52885501,-28382847,-52236005,-27733351,-27067313,-2564659,-51604533,-27101879,-26435841,-1933187,-25786345,-1283691,-617653,23885001,-50992537,-26489883,-25823845,-1321191,-25174349,-671695,-5657,24496997,-24542877,-40223,625815,25128469,1275311,25777965,26444003,50946657,-50401435,-25898781,-25232743,-730089,-24583247,-80593,585445,25088099,-23951775,550879,1216917,25719571,1866413,26369067,27035105,51537759,-23339779,1162875,1828913,26331567,2478409,26981063,27647101,52149755,3109881,27612535,28278573,52781227,28928069,53430723,54096761,78599415,-49832603,-25329949,-24663911,-161257,-24014415,488239,1154277,25656931,-23382943,1119711,1785749,26288403,2435245,26937899,27603937,52106591,-22770947,1731707,2397745,26900399,3047241,27549895,28215933,52718587,3678713,28181367,28847405,53350059,29496901,53999555,54665593,79168247,-22179845,2322809,2988847,27491501,3638343,28140997,28807035,53309689,4269815,28772469,29438507,53941161,30088003,54590657,55256695,79759349,4881811,29384465,30050503,54553157,30699999,55202653,55868691,80371345,31331471,55834125,56500163,81002817,57149659,81652313,82318351,106821005
+-117847040,-98291960,-95525574,-75970494,-92706752,-73151672,-70385286,-50830206,-89851304,-70296224,-67529838,-47974758,-64711016,-45155936,-42389550,-22834470,-86975726,-67420646,-64654260,-45099180,-61835438,-42280358,-39513972,-19958892,-58979990,-39424910,-36658524,-17103444,-33839702,-14284622,-11518236,8036844,-84097092,-64542012,-61775626,-42220546,-58956804,-39401724,-36635338,-17080258,-56101356,-36546276,-33779890,-14224810,-30961068,-11405988,-8639602,10915478,-53225778,-33670698,-30904312,-11349232,-28085490,-8530410,-5764024,13791056,-25230042,-5674962,-2908576,16646504,-89754,19465326,22231712,41786792,-81232898,-61677818,-58911432,-39356352,-56092610,-36537530,-33771144,-14216064,-53237162,-33682082,-30915696,-11360616,-28096874,-8541794,-5775408,13779672,-50361584,-30806504,-28040118,-8485038,-25221296,-5666216,-2899830,16655250,-22365848,-2810768,-44382,19510698,2774440,22329520,25095906,44650986,-47482950,-27927870,-25161484,-5606404,-22342662,-2787582,-21196,19533884,-19487214,67866,2834252,22389332,5653074,25208154,27974540,47529620,-16611636,2943444,5709830,25264910,8528652,28083732,30850118,50405198,11384100,30939180,33705566,53260646,36524388,56079468,58845854,78400934,-78400934,-58845854,-56079468,-36524388,-53260646,-33705566,-30939180,-11384100,-50405198,-30850118,-28083732,-8528652,-25264910,-5709830,-2943444,16611636,-47529620,-27974540,-25208154,-5653074,-22389332,-2834252,-67866,19487214,-19533884,21196,2787582,22342662,5606404,25161484,27927870,47482950,-44650986,-25095906,-22329520,-2774440,-19510698,44382,2810768,22365848,-16655250,2899830,5666216,25221296,8485038,28040118,30806504,50361584,-13779672,5775408,8541794,28096874,11360616,30915696,33682082,53237162,14216064,33771144,36537530,56092610,39356352,58911432,61677818,81232898,-41786792,-22231712,-19465326,89754,-16646504,2908576,5674962,25230042,-13791056,5764024,8530410,28085490,11349232,30904312,33670698,53225778,-10915478,8639602,11405988,30961068,14224810,33779890,36546276,56101356,17080258,36635338,39401724,58956804,42220546,61775626,64542012,84097092,-8036844,11518236,14284622,33839702,17103444,36658524,39424910,58979990,19958892,39513972,42280358,61835438,45099180,64654260,67420646,86975726,22834470,42389550,45155936,64711016,47974758,67529838,70296224,89851304,50830206,70385286,73151672,92706752,75970494,95525574,98291960,117847040
  },
  { // [19]
--85281588,-66518898,-65775864,-47013174,-65037020,-46274330,-45531296,-26768606,-64303912,-45541222,-44798188,-26035498,-44059344,-25296654,-24553620,-5790930,-63578098,-44815408,-44072374,-25309684,-43333530,-24570840,-23827806,-5065116,-42600422,-23837732,-23094698,-4332008,-22355854,-3593164,-2850130,15912560,-62861138,-44098448,-43355414,-24592724,-42616570,-23853880,-23110846,-4348156,-41883462,-23120772,-22377738,-3615048,-21638894,-2876204,-2133170,16629520,-41157648,-22394958,-21651924,-2889234,-20913080,-2150390,-1407356,17355334,-20179972,-1417282,-674248,18088442,64596,18827286,19570320,38333010,-62154590,-43391900,-42648866,-23886176,-41910022,-23147332,-22404298,-3641608,-41176914,-22414224,-21671190,-2908500,-20932346,-2169656,-1426622,17336068,-40451100,-21688410,-20945376,-2182686,-20206532,-1443842,-700808,18061882,-19473424,-710734,32300,18794990,771144,19533834,20276868,39039558,-39734140,-20971450,-20228416,-1465726,-19489572,-726882,16152,18778842,-18756464,6226,749260,19511950,1488104,20250794,20993828,39756518,-18030650,732040,1475074,20237764,2213918,20976608,21719642,40482332,2947026,21709716,22452750,41215440,23191594,41954284,42697318,61460008,-61460008,-42697318,-41954284,-23191594,-41215440,-22452750,-21709716,-2947026,-40482332,-21719642,-20976608,-2213918,-20237764,-1475074,-732040,18030650,-39756518,-20993828,-20250794,-1488104,-19511950,-749260,-6226,18756464,-18778842,-16152,726882,19489572,1465726,20228416,20971450,39734140,-39039558,-20276868,-19533834,-771144,-18794990,-32300,710734,19473424,-18061882,700808,1443842,20206532,2182686,20945376,21688410,40451100,-17336068,1426622,2169656,20932346,2908500,21671190,22414224,41176914,3641608,22404298,23147332,41910022,23886176,42648866,43391900,62154590,-38333010,-19570320,-18827286,-64596,-18088442,674248,1417282,20179972,-17355334,1407356,2150390,20913080,2889234,21651924,22394958,41157648,-16629520,2133170,2876204,21638894,3615048,22377738,23120772,41883462,4348156,23110846,23853880,42616570,24592724,43355414,44098448,62861138,-15912560,2850130,3593164,22355854,4332008,23094698,23837732,42600422,5065116,23827806,24570840,43333530,25309684,44072374,44815408,63578098,5790930,24553620,25296654,44059344,26035498,44798188,45541222,64303912,26768606,45531296,46274330,65037020,47013174,65775864,66518898,85281588
+-33809485,-32916329,-31020195,-30127039,-28982357,-28089201,-26193067,-25299911,-26809673,-25916517,-24020383,-23127227,-21982545,-21089389,-19193255,-18300099,-24510329,-23617173,-21721039,-20827883,-19683201,-18790045,-16893911,-16000755,-17510517,-16617361,-14721227,-13828071,-12683389,-11790233,-9894099,-9000943,-22093809,-21200653,-19304519,-18411363,-17266681,-16373525,-14477391,-13584235,-15093997,-14200841,-12304707,-11411551,-10266869,-9373713,-7477579,-6584423,-12794653,-11901497,-10005363,-9112207,-7967525,-7074369,-5178235,-4285079,-5794841,-4901685,-3005551,-2112395,-967713,-74557,1821577,2714733,-19570849,-18677693,-16781559,-15888403,-14743721,-13850565,-11954431,-11061275,-12571037,-11677881,-9781747,-8888591,-7743909,-6850753,-4954619,-4061463,-10271693,-9378537,-7482403,-6589247,-5444565,-4551409,-2655275,-1762119,-3271881,-2378725,-482591,410565,1555247,2448403,4344537,5237693,-7855173,-6962017,-5065883,-4172727,-3028045,-2134889,-238755,654401,-855361,37795,1933929,2827085,3971767,4864923,6761057,7654213,1443983,2337139,4233273,5126429,6271111,7164267,9060401,9953557,8443795,9336951,11233085,12126241,13270923,14164079,16060213,16953369,-16953369,-16060213,-14164079,-13270923,-12126241,-11233085,-9336951,-8443795,-9953557,-9060401,-7164267,-6271111,-5126429,-4233273,-2337139,-1443983,-7654213,-6761057,-4864923,-3971767,-2827085,-1933929,-37795,855361,-654401,238755,2134889,3028045,4172727,5065883,6962017,7855173,-5237693,-4344537,-2448403,-1555247,-410565,482591,2378725,3271881,1762119,2655275,4551409,5444565,6589247,7482403,9378537,10271693,4061463,4954619,6850753,7743909,8888591,9781747,11677881,12571037,11061275,11954431,13850565,14743721,15888403,16781559,18677693,19570849,-2714733,-1821577,74557,967713,2112395,3005551,4901685,5794841,4285079,5178235,7074369,7967525,9112207,10005363,11901497,12794653,6584423,7477579,9373713,10266869,11411551,12304707,14200841,15093997,13584235,14477391,16373525,17266681,18411363,19304519,21200653,22093809,9000943,9894099,11790233,12683389,13828071,14721227,16617361,17510517,16000755,16893911,18790045,19683201,20827883,21721039,23617173,24510329,18300099,19193255,21089389,21982545,23127227,24020383,25916517,26809673,25299911,26193067,28089201,28982357,30127039,31020195,32916329,33809485
  },
  { // [20]
--61672969,-48825973,-48102657,-35255661,-47371985,-34524989,-33801673,-20954677,-46635277,-33788281,-33064965,-20217969,-32334293,-19487297,-18763981,-5916985,-45893901,-33046905,-32323589,-19476593,-31592917,-18745921,-18022605,-5175609,-30856209,-18009213,-17285897,-4438901,-16555225,-3708229,-2984913,9862083,-45149261,-32302265,-31578949,-18731953,-30848277,-18001281,-17277965,-4430969,-30111569,-17264573,-16541257,-3694261,-15810585,-2963589,-2240273,10606723,-29370193,-16523197,-15799881,-2952885,-15069209,-2222213,-1498897,11348099,-14332501,-1485505,-762189,12084807,-31517,12815479,13538795,26385791,-44402793,-31555797,-30832481,-17985485,-30101809,-17254813,-16531497,-3684501,-29365101,-16518105,-15794789,-2947793,-15064117,-2217121,-1493805,11353191,-28623725,-15776729,-15053413,-2206417,-14322741,-1475745,-752429,12094567,-13586033,-739037,-15721,12831275,714951,13561947,14285263,27132259,-27879085,-15032089,-14308773,-1461777,-13578101,-731105,-7789,12839207,-12841393,5603,728919,13575915,1459591,14306587,15029903,27876899,-12100017,746979,1470295,14317291,2200967,15047963,15771279,28618275,2937675,15784671,16507987,29354983,17238659,30085655,30808971,43655967,-43655967,-30808971,-30085655,-17238659,-29354983,-16507987,-15784671,-2937675,-28618275,-15771279,-15047963,-2200967,-14317291,-1470295,-746979,12100017,-27876899,-15029903,-14306587,-1459591,-13575915,-728919,-5603,12841393,-12839207,7789,731105,13578101,1461777,14308773,15032089,27879085,-27132259,-14285263,-13561947,-714951,-12831275,15721,739037,13586033,-12094567,752429,1475745,14322741,2206417,15053413,15776729,28623725,-11353191,1493805,2217121,15064117,2947793,15794789,16518105,29365101,3684501,16531497,17254813,30101809,17985485,30832481,31555797,44402793,-26385791,-13538795,-12815479,31517,-12084807,762189,1485505,14332501,-11348099,1498897,2222213,15069209,2952885,15799881,16523197,29370193,-10606723,2240273,2963589,15810585,3694261,16541257,17264573,30111569,4430969,17277965,18001281,30848277,18731953,31578949,32302265,45149261,-9862083,2984913,3708229,16555225,4438901,17285897,18009213,30856209,5175609,18022605,18745921,31592917,19476593,32323589,33046905,45893901,5916985,18763981,19487297,32334293,20217969,33064965,33788281,46635277,20954677,33801673,34524989,47371985,35255661,48102657,48825973,61672969
+21458049,12662637,13338807,4543395,14163889,5368477,6044647,-2750765,15141323,6345911,7022081,-1773331,7847163,-948249,-272079,-9067491,16273411,7477999,8154169,-641243,8979251,183839,860009,-7935403,9956685,1161273,1837443,-6957969,2662525,-6132887,-5456717,-14252129,17561255,8765843,9442013,646601,10267095,1471683,2147853,-6647559,11244529,2449117,3125287,-5670125,3950369,-4845043,-4168873,-12964285,12376617,3581205,4257375,-4538037,5082457,-3712955,-3036785,-11832197,6059891,-2735521,-2059351,-10854763,-1234269,-10029681,-9353511,-18148923,19004695,10209283,10885453,2090041,11710535,2915123,3591293,-5204119,12687969,3892557,4568727,-4226685,5393809,-3401603,-2725433,-11520845,13820057,5024645,5700815,-3094597,6525897,-2269515,-1593345,-10388757,7503331,-1292081,-615911,-9411323,209171,-8586241,-7910071,-16705483,15107901,6312489,6988659,-1806753,7813741,-981671,-305501,-9100913,8791175,-4237,671933,-8123479,1497015,-7298397,-6622227,-15417639,9923263,1127851,1804021,-6991391,2629103,-6166309,-5490139,-14285551,3606537,-5188875,-4512705,-13308117,-3687623,-12483035,-11806865,-20602277,20602277,11806865,12483035,3687623,13308117,4512705,5188875,-3606537,14285551,5490139,6166309,-2629103,6991391,-1804021,-1127851,-9923263,15417639,6622227,7298397,-1497015,8123479,-671933,4237,-8791175,9100913,305501,981671,-7813741,1806753,-6988659,-6312489,-15107901,16705483,7910071,8586241,-209171,9411323,615911,1292081,-7503331,10388757,1593345,2269515,-6525897,3094597,-5700815,-5024645,-13820057,11520845,2725433,3401603,-5393809,4226685,-4568727,-3892557,-12687969,5204119,-3591293,-2915123,-11710535,-2090041,-10885453,-10209283,-19004695,18148923,9353511,10029681,1234269,10854763,2059351,2735521,-6059891,11832197,3036785,3712955,-5082457,4538037,-4257375,-3581205,-12376617,12964285,4168873,4845043,-3950369,5670125,-3125287,-2449117,-11244529,6647559,-2147853,-1471683,-10267095,-646601,-9442013,-8765843,-17561255,14252129,5456717,6132887,-2662525,6957969,-1837443,-1161273,-9956685,7935403,-860009,-183839,-8979251,641243,-8154169,-7477999,-16273411,9067491,272079,948249,-7847163,1773331,-7022081,-6345911,-15141323,2750765,-6044647,-5368477,-14163889,-4543395,-13338807,-12662637,-21458049
  },
  { // [21]
--39008737,-31540975,-30918079,-23450317,-30279121,-22811359,-22188463,-14720701,-29624983,-22157221,-21534325,-14066563,-20895367,-13427605,-12804709,-5336947,-28956609,-21488847,-20865951,-13398189,-20226993,-12759231,-12136335,-4668573,-19572855,-12105093,-11482197,-4014435,-10843239,-3375477,-2752581,4715181,-28275003,-20807241,-20184345,-12716583,-19545387,-12077625,-11454729,-3986967,-18891249,-11423487,-10800591,-3332829,-10161633,-2693871,-2070975,5396787,-18222875,-10755113,-10132217,-2664455,-9493259,-2025497,-1402601,6065161,-8839121,-1371359,-748463,6719299,-109505,7358257,7981153,15448915,-27581233,-20113471,-19490575,-12022813,-18851617,-11383855,-10760959,-3293197,-18197479,-10729717,-10106821,-2639059,-9467863,-2000101,-1377205,6090557,-17529105,-10061343,-9438447,-1970685,-8799489,-1331727,-708831,6758931,-8145351,-677589,-54693,7413069,584265,8052027,8674923,16142685,-16847499,-9379737,-8756841,-1289079,-8117883,-650121,-27225,7440537,-7463745,4017,626913,8094675,1265871,8733633,9356529,16824291,-6795371,672391,1295287,8763049,1934245,9402007,10024903,17492665,2588383,10056145,10679041,18146803,11317999,18785761,19408657,26876419,-26876419,-19408657,-18785761,-11317999,-18146803,-10679041,-10056145,-2588383,-17492665,-10024903,-9402007,-1934245,-8763049,-1295287,-672391,6795371,-16824291,-9356529,-8733633,-1265871,-8094675,-626913,-4017,7463745,-7440537,27225,650121,8117883,1289079,8756841,9379737,16847499,-16142685,-8674923,-8052027,-584265,-7413069,54693,677589,8145351,-6758931,708831,1331727,8799489,1970685,9438447,10061343,17529105,-6090557,1377205,2000101,9467863,2639059,10106821,10729717,18197479,3293197,10760959,11383855,18851617,12022813,19490575,20113471,27581233,-15448915,-7981153,-7358257,109505,-6719299,748463,1371359,8839121,-6065161,1402601,2025497,9493259,2664455,10132217,10755113,18222875,-5396787,2070975,2693871,10161633,3332829,10800591,11423487,18891249,3986967,11454729,12077625,19545387,12716583,20184345,20807241,28275003,-4715181,2752581,3375477,10843239,4014435,11482197,12105093,19572855,4668573,12136335,12759231,20226993,13398189,20865951,21488847,28956609,5336947,12804709,13427605,20895367,14066563,21534325,22157221,29624983,14720701,22188463,22811359,30279121,23450317,30918079,31540975,39008737
+39365580,29799290,29516628,19950338,29324780,19758490,19475828,9909538,29233064,19666774,19384112,9817822,19192264,9625974,9343312,-222978,29250422,19684132,19401470,9835180,19209622,9643332,9360670,-205620,19117906,9551616,9268954,-297336,9077106,-489184,-771846,-10338136,29385306,19819016,19536354,9970064,19344506,9778216,9495554,-70736,19252790,9686500,9403838,-162452,9211990,-354300,-636962,-10203252,19270148,9703858,9421196,-145094,9229348,-336942,-619604,-10185894,9137632,-428658,-711320,-10277610,-903168,-10469458,-10752120,-20318410,29645580,20079290,19796628,10230338,19604780,10038490,9755828,189538,19513064,9946774,9664112,97822,9472264,-94026,-376688,-9942978,19530422,9964132,9681470,115180,9489622,-76668,-359330,-9925620,9397906,-168384,-451046,-10017336,-642894,-10209184,-10491846,-20058136,19665306,10099016,9816354,250064,9624506,58216,-224446,-9790736,9532790,-33500,-316162,-9882452,-508010,-10074300,-10356962,-19923252,9550148,-16142,-298804,-9865094,-490652,-10056942,-10339604,-19905894,-582368,-10148658,-10431320,-19997610,-10623168,-20189458,-20472120,-30038410,30038410,20472120,20189458,10623168,19997610,10431320,10148658,582368,19905894,10339604,10056942,490652,9865094,298804,16142,-9550148,19923252,10356962,10074300,508010,9882452,316162,33500,-9532790,9790736,224446,-58216,-9624506,-250064,-9816354,-10099016,-19665306,20058136,10491846,10209184,642894,10017336,451046,168384,-9397906,9925620,359330,76668,-9489622,-115180,-9681470,-9964132,-19530422,9942978,376688,94026,-9472264,-97822,-9664112,-9946774,-19513064,-189538,-9755828,-10038490,-19604780,-10230338,-19796628,-20079290,-29645580,20318410,10752120,10469458,903168,10277610,711320,428658,-9137632,10185894,619604,336942,-9229348,145094,-9421196,-9703858,-19270148,10203252,636962,354300,-9211990,162452,-9403838,-9686500,-19252790,70736,-9495554,-9778216,-19344506,-9970064,-19536354,-19819016,-29385306,10338136,771846,489184,-9077106,297336,-9268954,-9551616,-19117906,205620,-9360670,-9643332,-19209622,-9835180,-19401470,-19684132,-29250422,222978,-9343312,-9625974,-19192264,-9817822,-19384112,-19666774,-29233064,-9909538,-19475828,-19758490,-29324780,-19950338,-29516628,-29799290,-39365580
  },
  { // [22]
--19741529,-16595095,-16124343,-12977909,-15632915,-12486481,-12015729,-8869295,-15121145,-11974711,-11503959,-8357525,-11012531,-7866097,-7395345,-4248911,-14589439,-11443005,-10972253,-7825819,-10480825,-7334391,-6863639,-3717205,-9969055,-6822621,-6351869,-3205435,-5860441,-2714007,-2243255,903179,-14038269,-10891835,-10421083,-7274649,-9929655,-6783221,-6312469,-3166035,-9417885,-6271451,-5800699,-2654265,-5309271,-2162837,-1692085,1454349,-8886179,-5739745,-5268993,-2122559,-4777565,-1631131,-1160379,1986055,-4265795,-1119361,-648609,2497825,-157181,2989253,3460005,6606439,-13468181,-10321747,-9850995,-6704561,-9359567,-6213133,-5742381,-2595947,-8847797,-5701363,-5230611,-2084177,-4739183,-1592749,-1121997,2024437,-8316091,-5169657,-4698905,-1552471,-4207477,-1061043,-590291,2556143,-3695707,-549273,-78521,3067913,412907,3559341,4030093,7176527,-7764921,-4618487,-4147735,-1001301,-3656307,-509873,-39121,3107313,-3144537,1897,472649,3619083,964077,4110511,4581263,7727697,-2612831,533603,1004355,4150789,1495783,4642217,5112969,8259403,2007553,5153987,5624739,8771173,6116167,9262601,9733353,12879787,-12879787,-9733353,-9262601,-6116167,-8771173,-5624739,-5153987,-2007553,-8259403,-5112969,-4642217,-1495783,-4150789,-1004355,-533603,2612831,-7727697,-4581263,-4110511,-964077,-3619083,-472649,-1897,3144537,-3107313,39121,509873,3656307,1001301,4147735,4618487,7764921,-7176527,-4030093,-3559341,-412907,-3067913,78521,549273,3695707,-2556143,590291,1061043,4207477,1552471,4698905,5169657,8316091,-2024437,1121997,1592749,4739183,2084177,5230611,5701363,8847797,2595947,5742381,6213133,9359567,6704561,9850995,10321747,13468181,-6606439,-3460005,-2989253,157181,-2497825,648609,1119361,4265795,-1986055,1160379,1631131,4777565,2122559,5268993,5739745,8886179,-1454349,1692085,2162837,5309271,2654265,5800699,6271451,9417885,3166035,6312469,6783221,9929655,7274649,10421083,10891835,14038269,-903179,2243255,2714007,5860441,3205435,6351869,6822621,9969055,3717205,6863639,7334391,10480825,7825819,10972253,11443005,14589439,4248911,7395345,7866097,11012531,8357525,11503959,11974711,15121145,8869295,12015729,12486481,15632915,12977909,16124343,16595095,19741529
+29326912,24129832,23467714,18270634,22820400,17623320,16961202,11764122,22196668,16999588,16337470,11140390,15690156,10493076,9830958,4633878,21605662,16408582,15746464,10549384,15099150,9902070,9239952,4042872,14475418,9278338,8616220,3419140,7968906,2771826,2109708,-3087372,21056836,15859756,15197638,10000558,14550324,9353244,8691126,3494046,13926592,8729512,8067394,2870314,7420080,2223000,1560882,-3636198,13335586,8138506,7476388,2279308,6829074,1631994,969876,-4227204,6205342,1008262,346144,-4850936,-301170,-5498250,-6160368,-11357448,20559854,15362774,14700656,9503576,14053342,8856262,8194144,2997064,13429610,8232530,7570412,2373332,6923098,1726018,1063900,-4133180,12838604,7641524,6979406,1782326,6332092,1135012,472894,-4724186,5708360,511280,-150838,-5347918,-798152,-5995232,-6657350,-11854430,12289778,7092698,6430580,1233500,5783266,586186,-75932,-5273012,5159534,-37546,-699664,-5896744,-1346978,-6544058,-7206176,-12403256,4568528,-628552,-1290670,-6487750,-1937984,-7135064,-7797182,-12994262,-2561716,-7758796,-8420914,-13617994,-9068228,-14265308,-14927426,-20124506,20124506,14927426,14265308,9068228,13617994,8420914,7758796,2561716,12994262,7797182,7135064,1937984,6487750,1290670,628552,-4568528,12403256,7206176,6544058,1346978,5896744,699664,37546,-5159534,5273012,75932,-586186,-5783266,-1233500,-6430580,-7092698,-12289778,11854430,6657350,5995232,798152,5347918,150838,-511280,-5708360,4724186,-472894,-1135012,-6332092,-1782326,-6979406,-7641524,-12838604,4133180,-1063900,-1726018,-6923098,-2373332,-7570412,-8232530,-13429610,-2997064,-8194144,-8856262,-14053342,-9503576,-14700656,-15362774,-20559854,11357448,6160368,5498250,301170,4850936,-346144,-1008262,-6205342,4227204,-969876,-1631994,-6829074,-2279308,-7476388,-8138506,-13335586,3636198,-1560882,-2223000,-7420080,-2870314,-8067394,-8729512,-13926592,-3494046,-8691126,-9353244,-14550324,-10000558,-15197638,-15859756,-21056836,3087372,-2109708,-2771826,-7968906,-3419140,-8616220,-9278338,-14475418,-4042872,-9239952,-9902070,-15099150,-10549384,-15746464,-16408582,-21605662,-4633878,-9830958,-10493076,-15690156,-11140390,-16337470,-16999588,-22196668,-11764122,-16961202,-17623320,-22820400,-18270634,-23467714,-24129832,-29326912
  },
  { // [23]
--5381447,-5238599,-4937313,-4794465,-4615049,-4472201,-4170915,-4028067,-4271625,-4128777,-3827491,-3684643,-3505227,-3362379,-3061093,-2918245,-3906921,-3764073,-3462787,-3319939,-3140523,-2997675,-2696389,-2553541,-2797099,-2654251,-2352965,-2210117,-2030701,-1887853,-1586567,-1443719,-3520873,-3378025,-3076739,-2933891,-2754475,-2611627,-2310341,-2167493,-2411051,-2268203,-1966917,-1824069,-1644653,-1501805,-1200519,-1057671,-2046347,-1903499,-1602213,-1459365,-1279949,-1137101,-835815,-692967,-936525,-793677,-492391,-349543,-170127,-27279,274007,416855,-3113483,-2970635,-2669349,-2526501,-2347085,-2204237,-1902951,-1760103,-2003661,-1860813,-1559527,-1416679,-1237263,-1094415,-793129,-650281,-1638957,-1496109,-1194823,-1051975,-872559,-729711,-428425,-285577,-529135,-386287,-85001,57847,237263,380111,681397,824245,-1252909,-1110061,-808775,-665927,-486511,-343663,-42377,100471,-143087,-239,301047,443895,623311,766159,1067445,1210293,221617,364465,665751,808599,988015,1130863,1432149,1574997,1331439,1474287,1775573,1918421,2097837,2240685,2541971,2684819,-2684819,-2541971,-2240685,-2097837,-1918421,-1775573,-1474287,-1331439,-1574997,-1432149,-1130863,-988015,-808599,-665751,-364465,-221617,-1210293,-1067445,-766159,-623311,-443895,-301047,239,143087,-100471,42377,343663,486511,665927,808775,1110061,1252909,-824245,-681397,-380111,-237263,-57847,85001,386287,529135,285577,428425,729711,872559,1051975,1194823,1496109,1638957,650281,793129,1094415,1237263,1416679,1559527,1860813,2003661,1760103,1902951,2204237,2347085,2526501,2669349,2970635,3113483,-416855,-274007,27279,170127,349543,492391,793677,936525,692967,835815,1137101,1279949,1459365,1602213,1903499,2046347,1057671,1200519,1501805,1644653,1824069,1966917,2268203,2411051,2167493,2310341,2611627,2754475,2933891,3076739,3378025,3520873,1443719,1586567,1887853,2030701,2210117,2352965,2654251,2797099,2553541,2696389,2997675,3140523,3319939,3462787,3764073,3906921,2918245,3061093,3362379,3505227,3684643,3827491,4128777,4271625,4028067,4170915,4472201,4615049,4794465,4937313,5238599,5381447
+9229644,8979792,8451382,8201530,7887542,7637690,7109280,6859428,7292286,7042434,6514024,6264172,5950184,5700332,5171922,4922070,6670312,6420460,5892050,5642198,5328210,5078358,4549948,4300096,4732954,4483102,3954692,3704840,3390852,3141000,2612590,2362738,6027002,5777150,5248740,4998888,4684900,4435048,3906638,3656786,4089644,3839792,3311382,3061530,2747542,2497690,1969280,1719428,3467670,3217818,2689408,2439556,2125568,1875716,1347306,1097454,1530312,1280460,752050,502198,188210,-61642,-590052,-839904,5368392,5118540,4590130,4340278,4026290,3776438,3248028,2998176,3431034,3181182,2652772,2402920,2088932,1839080,1310670,1060818,2809060,2559208,2030798,1780946,1466958,1217106,688696,438844,871702,621850,93440,-156412,-470400,-720252,-1248662,-1498514,2165750,1915898,1387488,1137636,823648,573796,45386,-204466,228392,-21460,-549870,-799722,-1113710,-1363562,-1891972,-2141824,-393582,-643434,-1171844,-1421696,-1735684,-1985536,-2513946,-2763798,-2330940,-2580792,-3109202,-3359054,-3673042,-3922894,-4451304,-4701156,4701156,4451304,3922894,3673042,3359054,3109202,2580792,2330940,2763798,2513946,1985536,1735684,1421696,1171844,643434,393582,2141824,1891972,1363562,1113710,799722,549870,21460,-228392,204466,-45386,-573796,-823648,-1137636,-1387488,-1915898,-2165750,1498514,1248662,720252,470400,156412,-93440,-621850,-871702,-438844,-688696,-1217106,-1466958,-1780946,-2030798,-2559208,-2809060,-1060818,-1310670,-1839080,-2088932,-2402920,-2652772,-3181182,-3431034,-2998176,-3248028,-3776438,-4026290,-4340278,-4590130,-5118540,-5368392,839904,590052,61642,-188210,-502198,-752050,-1280460,-1530312,-1097454,-1347306,-1875716,-2125568,-2439556,-2689408,-3217818,-3467670,-1719428,-1969280,-2497690,-2747542,-3061530,-3311382,-3839792,-4089644,-3656786,-3906638,-4435048,-4684900,-4998888,-5248740,-5777150,-6027002,-2362738,-2612590,-3141000,-3390852,-3704840,-3954692,-4483102,-4732954,-4300096,-4549948,-5078358,-5328210,-5642198,-5892050,-6420460,-6670312,-4922070,-5171922,-5700332,-5950184,-6264172,-6514024,-7042434,-7292286,-6859428,-7109280,-7637690,-7887542,-8201530,-8451382,-8979792,-9229644
  },
  { // [24]
-3644268,2092744,2239000,687476,2402958,851434,997690,-553834,2585184,1033660,1179916,-371608,1343874,-207650,-61394,-1612918,2786196,1234672,1380928,-170596,1544886,-6638,139618,-1411906,1727112,175588,321844,-1229680,485802,-1065722,-919466,-2470990,3006480,1454956,1601212,49688,1765170,213646,359902,-1191622,1947396,395872,542128,-1009396,706086,-845438,-699182,-2250706,2148408,596884,743140,-808384,907098,-644426,-498170,-2049694,1089324,-462200,-315944,-1867468,-151986,-1703510,-1557254,-3108778,3246474,1694950,1841206,289682,2005164,453640,599896,-951628,2187390,635866,782122,-769402,946080,-605444,-459188,-2010712,2388402,836878,983134,-568390,1147092,-404432,-258176,-1809700,1329318,-222206,-75950,-1627474,88008,-1463516,-1317260,-2868784,2608686,1057162,1203418,-348106,1367376,-184148,-37892,-1589416,1549602,-1922,144334,-1407190,308292,-1243232,-1096976,-2648500,1750614,199090,345346,-1206178,509304,-1042220,-895964,-2447488,691530,-859994,-713738,-2265262,-549780,-2101304,-1955048,-3506572,3506572,1955048,2101304,549780,2265262,713738,859994,-691530,2447488,895964,1042220,-509304,1206178,-345346,-199090,-1750614,2648500,1096976,1243232,-308292,1407190,-144334,1922,-1549602,1589416,37892,184148,-1367376,348106,-1203418,-1057162,-2608686,2868784,1317260,1463516,-88008,1627474,75950,222206,-1329318,1809700,258176,404432,-1147092,568390,-983134,-836878,-2388402,2010712,459188,605444,-946080,769402,-782122,-635866,-2187390,951628,-599896,-453640,-2005164,-289682,-1841206,-1694950,-3246474,3108778,1557254,1703510,151986,1867468,315944,462200,-1089324,2049694,498170,644426,-907098,808384,-743140,-596884,-2148408,2250706,699182,845438,-706086,1009396,-542128,-395872,-1947396,1191622,-359902,-213646,-1765170,-49688,-1601212,-1454956,-3006480,2470990,919466,1065722,-485802,1229680,-321844,-175588,-1727112,1411906,-139618,6638,-1544886,170596,-1380928,-1234672,-2786196,1612918,61394,207650,-1343874,371608,-1179916,-1033660,-2585184,553834,-997690,-851434,-2402958,-687476,-2239000,-2092744,-3644268
+-5990526,-3549492,-3729370,-1288336,-3953450,-1512416,-1692294,748740,-4222656,-1781622,-1961500,479534,-2185580,255454,75576,2516610,-4537410,-2096376,-2276254,164780,-2500334,-59300,-239178,2201856,-2769540,-328506,-508384,1932650,-732464,1708570,1528692,3969726,-4897586,-2456552,-2636430,-195396,-2860510,-419476,-599354,1841680,-3129716,-688682,-868560,1572474,-1092640,1348394,1168516,3609550,-3444470,-1003436,-1183314,1257720,-1407394,1033640,853762,3294796,-1676600,764434,584556,3025590,360476,2801510,2621632,5062666,-5302468,-2861434,-3041312,-600278,-3265392,-824358,-1004236,1436798,-3534598,-1093564,-1273442,1167592,-1497522,943512,763634,3204668,-3849352,-1408318,-1588196,852838,-1812276,628758,448880,2889914,-2081482,359552,179674,2620708,-44406,2396628,2216750,4657784,-4209528,-1768494,-1948372,492662,-2172452,268582,88704,2529738,-2441658,-624,-180502,2260532,-404582,2036452,1856574,4297608,-2756412,-315378,-495256,1945778,-719336,1721698,1541820,3982854,-988542,1452492,1272614,3713648,1048534,3489568,3309690,5750724,-5750724,-3309690,-3489568,-1048534,-3713648,-1272614,-1452492,988542,-3982854,-1541820,-1721698,719336,-1945778,495256,315378,2756412,-4297608,-1856574,-2036452,404582,-2260532,180502,624,2441658,-2529738,-88704,-268582,2172452,-492662,1948372,1768494,4209528,-4657784,-2216750,-2396628,44406,-2620708,-179674,-359552,2081482,-2889914,-448880,-628758,1812276,-852838,1588196,1408318,3849352,-3204668,-763634,-943512,1497522,-1167592,1273442,1093564,3534598,-1436798,1004236,824358,3265392,600278,3041312,2861434,5302468,-5062666,-2621632,-2801510,-360476,-3025590,-584556,-764434,1676600,-3294796,-853762,-1033640,1407394,-1257720,1183314,1003436,3444470,-3609550,-1168516,-1348394,1092640,-1572474,868560,688682,3129716,-1841680,599354,419476,2860510,195396,2636430,2456552,4897586,-3969726,-1528692,-1708570,732464,-1932650,508384,328506,2769540,-2201856,239178,59300,2500334,-164780,2276254,2096376,4537410,-2516610,-75576,-255454,2185580,-479534,1961500,1781622,4222656,-748740,1692294,1512416,3953450,1288336,3729370,3549492,5990526
  },
  { // [25]
-7880783,5719667,5747837,3586721,5788285,3627169,3655339,1494223,5841749,3680633,3708803,1547687,3749251,1588135,1616305,-544811,5908959,3747843,3776013,1614897,3816461,1655345,1683515,-477601,3869925,1708809,1736979,-424137,1777427,-383689,-355519,-2516635,5990629,3829513,3857683,1696567,3898131,1737015,1765185,-395931,3951595,1790479,1818649,-342467,1859097,-302019,-273849,-2434965,4018805,1857689,1885859,-275257,1926307,-234809,-206639,-2367755,1979771,-181345,-153175,-2314291,-112727,-2273843,-2245673,-4406789,6087457,3926341,3954511,1793395,3994959,1833843,1862013,-299103,4048423,1887307,1915477,-245639,1955925,-205191,-177021,-2338137,4115633,1954517,1982687,-178429,2023135,-137981,-109811,-2270927,2076599,-84517,-56347,-2217463,-15899,-2177015,-2148845,-4309961,4197303,2036187,2064357,-96759,2104805,-56311,-28141,-2189257,2158269,-2847,25323,-2135793,65771,-2095345,-2067175,-4228291,2225479,64363,92533,-2068583,132981,-2028135,-1999965,-4161081,186445,-1974671,-1946501,-4107617,-1906053,-4067169,-4038999,-6200115,6200115,4038999,4067169,1906053,4107617,1946501,1974671,-186445,4161081,1999965,2028135,-132981,2068583,-92533,-64363,-2225479,4228291,2067175,2095345,-65771,2135793,-25323,2847,-2158269,2189257,28141,56311,-2104805,96759,-2064357,-2036187,-4197303,4309961,2148845,2177015,15899,2217463,56347,84517,-2076599,2270927,109811,137981,-2023135,178429,-1982687,-1954517,-4115633,2338137,177021,205191,-1955925,245639,-1915477,-1887307,-4048423,299103,-1862013,-1833843,-3994959,-1793395,-3954511,-3926341,-6087457,4406789,2245673,2273843,112727,2314291,153175,181345,-1979771,2367755,206639,234809,-1926307,275257,-1885859,-1857689,-4018805,2434965,273849,302019,-1859097,342467,-1818649,-1790479,-3951595,395931,-1765185,-1737015,-3898131,-1696567,-3857683,-3829513,-5990629,2516635,355519,383689,-1777427,424137,-1736979,-1708809,-3869925,477601,-1683515,-1655345,-3816461,-1614897,-3776013,-3747843,-5908959,544811,-1616305,-1588135,-3749251,-1547687,-3708803,-3680633,-5841749,-1494223,-3655339,-3627169,-5788285,-3586721,-5747837,-5719667,-7880783
+-10661820,-8133146,-8037432,-5508758,-7966176,-5437502,-5341788,-2813114,-7922570,-5393896,-5298182,-2769508,-5226926,-2698252,-2602538,-73864,-7909700,-5381026,-5285312,-2756638,-5214056,-2685382,-2589668,-60994,-5170450,-2641776,-2546062,-17388,-2474806,53868,149582,2678256,-7930494,-5401820,-5306106,-2777432,-5234850,-2706176,-2610462,-81788,-5191244,-2662570,-2566856,-38182,-2495600,33074,128788,2657462,-5178374,-2649700,-2553986,-25312,-2482730,45944,141658,2670332,-2439124,89550,185264,2713938,256520,2785194,2880908,5409582,-7987678,-5459004,-5363290,-2834616,-5292034,-2763360,-2667646,-138972,-5248428,-2719754,-2624040,-95366,-2552784,-24110,71604,2600278,-5235558,-2706884,-2611170,-82496,-2539914,-11240,84474,2613148,-2496308,32366,128080,2656754,199336,2728010,2823724,5352398,-5256352,-2727678,-2631964,-103290,-2560708,-32034,63680,2592354,-2517102,11572,107286,2635960,178542,2707216,2802930,5331604,-2504232,24442,120156,2648830,191412,2720086,2815800,5344474,235018,2763692,2859406,5388080,2930662,5459336,5555050,8083724,-8083724,-5555050,-5459336,-2930662,-5388080,-2859406,-2763692,-235018,-5344474,-2815800,-2720086,-191412,-2648830,-120156,-24442,2504232,-5331604,-2802930,-2707216,-178542,-2635960,-107286,-11572,2517102,-2592354,-63680,32034,2560708,103290,2631964,2727678,5256352,-5352398,-2823724,-2728010,-199336,-2656754,-128080,-32366,2496308,-2613148,-84474,11240,2539914,82496,2611170,2706884,5235558,-2600278,-71604,24110,2552784,95366,2624040,2719754,5248428,138972,2667646,2763360,5292034,2834616,5363290,5459004,7987678,-5409582,-2880908,-2785194,-256520,-2713938,-185264,-89550,2439124,-2670332,-141658,-45944,2482730,25312,2553986,2649700,5178374,-2657462,-128788,-33074,2495600,38182,2566856,2662570,5191244,81788,2610462,2706176,5234850,2777432,5306106,5401820,7930494,-2678256,-149582,-53868,2474806,17388,2546062,2641776,5170450,60994,2589668,2685382,5214056,2756638,5285312,5381026,7909700,73864,2602538,2698252,5226926,2769508,5298182,5393896,7922570,2813114,5341788,5437502,7966176,5508758,8037432,8133146,10661820
  },
  { // [26]
-8538097,6504071,6460817,4426791,6423933,4389907,4346653,2312627,6394129,4360103,4316849,2282823,4279965,2245939,2202685,168659,6372129,4338103,4294849,2260823,4257965,2223939,2180685,146659,4228161,2194135,2150881,116855,2113997,79971,36717,-1997309,6358667,4324641,4281387,2247361,4244503,2210477,2167223,133197,4214699,2180673,2137419,103393,2100535,66509,23255,-2010771,4192699,2158673,2115419,81393,2078535,44509,1255,-2032771,2048731,14705,-28549,-2062575,-65433,-2099459,-2142713,-4176739,6354491,4320465,4277211,2243185,4240327,2206301,2163047,129021,4210523,2176497,2133243,99217,2096359,62333,19079,-2014947,4188523,2154497,2111243,77217,2074359,40333,-2921,-2036947,2044555,10529,-32725,-2066751,-69609,-2103635,-2146889,-4180915,4175061,2141035,2097781,63755,2060897,26871,-16383,-2050409,2031093,-2933,-46187,-2080213,-83071,-2117097,-2160351,-4194377,2009093,-24933,-68187,-2102213,-105071,-2139097,-2182351,-4216377,-134875,-2168901,-2212155,-4246181,-2249039,-4283065,-4326319,-6360345,6360345,4326319,4283065,2249039,4246181,2212155,2168901,134875,4216377,2182351,2139097,105071,2102213,68187,24933,-2009093,4194377,2160351,2117097,83071,2080213,46187,2933,-2031093,2050409,16383,-26871,-2060897,-63755,-2097781,-2141035,-4175061,4180915,2146889,2103635,69609,2066751,32725,-10529,-2044555,2036947,2921,-40333,-2074359,-77217,-2111243,-2154497,-4188523,2014947,-19079,-62333,-2096359,-99217,-2133243,-2176497,-4210523,-129021,-2163047,-2206301,-4240327,-2243185,-4277211,-4320465,-6354491,4176739,2142713,2099459,65433,2062575,28549,-14705,-2048731,2032771,-1255,-44509,-2078535,-81393,-2115419,-2158673,-4192699,2010771,-23255,-66509,-2100535,-103393,-2137419,-2180673,-4214699,-133197,-2167223,-2210477,-4244503,-2247361,-4281387,-4324641,-6358667,1997309,-36717,-79971,-2113997,-116855,-2150881,-2194135,-4228161,-146659,-2180685,-2223939,-4257965,-2260823,-4294849,-4338103,-6372129,-168659,-2202685,-2245939,-4279965,-2282823,-4316849,-4360103,-6394129,-2312627,-4346653,-4389907,-6423933,-4426791,-6460817,-6504071,-8538097
+-7452843,-6188827,-6010211,-4746195,-5831941,-4567925,-4389309,-3125293,-5656563,-4392547,-4213931,-2949915,-4035661,-2771645,-2593029,-1329013,-5486819,-4222803,-4044187,-2780171,-3865917,-2601901,-2423285,-1159269,-3690539,-2426523,-2247907,-983891,-2069637,-805621,-627005,637011,-5325611,-4061595,-3882979,-2618963,-3704709,-2440693,-2262077,-998061,-3529331,-2265315,-2086699,-822683,-1908429,-644413,-465797,798219,-3359587,-2095571,-1916955,-652939,-1738685,-474669,-296053,967963,-1563307,-299291,-120675,1143341,57595,1321611,1500227,2764243,-5175987,-3911971,-3733355,-2469339,-3555085,-2291069,-2112453,-848437,-3379707,-2115691,-1937075,-673059,-1758805,-494789,-316173,947843,-3209963,-1945947,-1767331,-503315,-1589061,-325045,-146429,1117587,-1413683,-149667,28949,1292965,207219,1471235,1649851,2913867,-3048755,-1784739,-1606123,-342107,-1427853,-163837,14779,1278795,-1252475,11541,190157,1454173,368427,1632443,1811059,3075075,-1082731,181285,359901,1623917,538171,1802187,1980803,3244819,713549,1977565,2156181,3420197,2334451,3598467,3777083,5041099,-5041099,-3777083,-3598467,-2334451,-3420197,-2156181,-1977565,-713549,-3244819,-1980803,-1802187,-538171,-1623917,-359901,-181285,1082731,-3075075,-1811059,-1632443,-368427,-1454173,-190157,-11541,1252475,-1278795,-14779,163837,1427853,342107,1606123,1784739,3048755,-2913867,-1649851,-1471235,-207219,-1292965,-28949,149667,1413683,-1117587,146429,325045,1589061,503315,1767331,1945947,3209963,-947843,316173,494789,1758805,673059,1937075,2115691,3379707,848437,2112453,2291069,3555085,2469339,3733355,3911971,5175987,-2764243,-1500227,-1321611,-57595,-1143341,120675,299291,1563307,-967963,296053,474669,1738685,652939,1916955,2095571,3359587,-798219,465797,644413,1908429,822683,2086699,2265315,3529331,998061,2262077,2440693,3704709,2618963,3882979,4061595,5325611,-637011,627005,805621,2069637,983891,2247907,2426523,3690539,1159269,2423285,2601901,3865917,2780171,4044187,4222803,5486819,1329013,2593029,2771645,4035661,2949915,4213931,4392547,5656563,3125293,4389309,4567925,5831941,4746195,6010211,6188827,7452843
  },
  { // [27]
-7085303,5547605,5476607,3938909,5407047,3869349,3798351,2260653,5339451,3801753,3730755,2193057,3661195,2123497,2052499,514801,5274375,3736677,3665679,2127981,3596119,2058421,1987423,449725,3528523,1990825,1919827,382129,1850267,312569,241571,-1296127,5212397,3674699,3603701,2066003,3534141,1996443,1925445,387747,3466545,1928847,1857849,320151,1788289,250591,179593,-1358105,3401469,1863771,1792773,255075,1723213,185515,114517,-1423181,1655617,117919,46921,-1490777,-22639,-1560337,-1631335,-3169033,5154131,3616433,3545435,2007737,3475875,1938177,1867179,329481,3408279,1870581,1799583,261885,1730023,192325,121327,-1416371,3343203,1805505,1734507,196809,1664947,127249,56251,-1481447,1597351,59653,-11345,-1549043,-80905,-1618603,-1689601,-3227299,3281225,1743527,1672529,134831,1602969,65271,-5727,-1543425,1535373,-2325,-73323,-1611021,-142883,-1680581,-1751579,-3289277,1470297,-67401,-138399,-1676097,-207959,-1745657,-1816655,-3354353,-275555,-1813253,-1884251,-3421949,-1953811,-3491509,-3562507,-5100205,5100205,3562507,3491509,1953811,3421949,1884251,1813253,275555,3354353,1816655,1745657,207959,1676097,138399,67401,-1470297,3289277,1751579,1680581,142883,1611021,73323,2325,-1535373,1543425,5727,-65271,-1602969,-134831,-1672529,-1743527,-3281225,3227299,1689601,1618603,80905,1549043,11345,-59653,-1597351,1481447,-56251,-127249,-1664947,-196809,-1734507,-1805505,-3343203,1416371,-121327,-192325,-1730023,-261885,-1799583,-1870581,-3408279,-329481,-1867179,-1938177,-3475875,-2007737,-3545435,-3616433,-5154131,3169033,1631335,1560337,22639,1490777,-46921,-117919,-1655617,1423181,-114517,-185515,-1723213,-255075,-1792773,-1863771,-3401469,1358105,-179593,-250591,-1788289,-320151,-1857849,-1928847,-3466545,-387747,-1925445,-1996443,-3534141,-2066003,-3603701,-3674699,-5212397,1296127,-241571,-312569,-1850267,-382129,-1919827,-1990825,-3528523,-449725,-1987423,-2058421,-3596119,-2127981,-3665679,-3736677,-5274375,-514801,-2052499,-2123497,-3661195,-2193057,-3730755,-3801753,-5339451,-2260653,-3798351,-3869349,-5407047,-3938909,-5476607,-5547605,-7085303
+-2152138,-2098160,-1981132,-1927154,-1852400,-1798422,-1681394,-1627416,-1712626,-1658648,-1541620,-1487642,-1412888,-1358910,-1241882,-1187904,-1562712,-1508734,-1391706,-1337728,-1262974,-1208996,-1091968,-1037990,-1123200,-1069222,-952194,-898216,-823462,-769484,-652456,-598478,-1403794,-1349816,-1232788,-1178810,-1104056,-1050078,-933050,-879072,-964282,-910304,-793276,-739298,-664544,-610566,-493538,-439560,-814368,-760390,-643362,-589384,-514630,-460652,-343624,-289646,-374856,-320878,-203850,-149872,-75118,-21140,95888,149866,-1237260,-1183282,-1066254,-1012276,-937522,-883544,-766516,-712538,-797748,-743770,-626742,-572764,-498010,-444032,-327004,-273026,-647834,-593856,-476828,-422850,-348096,-294118,-177090,-123112,-208322,-154344,-37316,16662,91416,145394,262422,316400,-488916,-434938,-317910,-263932,-189178,-135200,-18172,35806,-49404,4574,121602,175580,250334,304312,421340,475318,100510,154488,271516,325494,400248,454226,571254,625232,540022,594000,711028,765006,839760,893738,1010766,1064744,-1064744,-1010766,-893738,-839760,-765006,-711028,-594000,-540022,-625232,-571254,-454226,-400248,-325494,-271516,-154488,-100510,-475318,-421340,-304312,-250334,-175580,-121602,-4574,49404,-35806,18172,135200,189178,263932,317910,434938,488916,-316400,-262422,-145394,-91416,-16662,37316,154344,208322,123112,177090,294118,348096,422850,476828,593856,647834,273026,327004,444032,498010,572764,626742,743770,797748,712538,766516,883544,937522,1012276,1066254,1183282,1237260,-149866,-95888,21140,75118,149872,203850,320878,374856,289646,343624,460652,514630,589384,643362,760390,814368,439560,493538,610566,664544,739298,793276,910304,964282,879072,933050,1050078,1104056,1178810,1232788,1349816,1403794,598478,652456,769484,823462,898216,952194,1069222,1123200,1037990,1091968,1208996,1262974,1337728,1391706,1508734,1562712,1187904,1241882,1358910,1412888,1487642,1541620,1658648,1712626,1627416,1681394,1798422,1852400,1927154,1981132,2098160,2152138
  },
  { // [28]
-4860691,3890185,3822765,2852259,3753739,2783233,2715813,1745307,3683371,2712865,2645445,1674939,2576419,1605913,1538493,567987,3611959,2641453,2574033,1603527,2505007,1534501,1467081,496575,2434639,1464133,1396713,426207,1327687,357181,289761,-680745,3539833,2569327,2501907,1531401,2432881,1462375,1394955,424449,2362513,1392007,1324587,354081,1255561,285055,217635,-752871,2291101,1320595,1253175,282669,1184149,213643,146223,-824283,1113781,143275,75855,-894651,6829,-963677,-1031097,-2001603,3467359,2496853,2429433,1458927,2360407,1389901,1322481,351975,2290039,1319533,1252113,281607,1183087,212581,145161,-825345,2218627,1248121,1180701,210195,1111675,141169,73749,-896757,1041307,70801,3381,-967125,-65645,-1036151,-1103571,-2074077,2146501,1175995,1108575,138069,1039549,69043,1623,-968883,969181,-1325,-68745,-1039251,-137771,-1108277,-1175697,-2146203,897769,-72737,-140157,-1110663,-209183,-1179689,-1247109,-2217615,-279551,-1250057,-1317477,-2287983,-1386503,-2357009,-2424429,-3394935,3394935,2424429,2357009,1386503,2287983,1317477,1250057,279551,2217615,1247109,1179689,209183,1110663,140157,72737,-897769,2146203,1175697,1108277,137771,1039251,68745,1325,-969181,968883,-1623,-69043,-1039549,-138069,-1108575,-1175995,-2146501,2074077,1103571,1036151,65645,967125,-3381,-70801,-1041307,896757,-73749,-141169,-1111675,-210195,-1180701,-1248121,-2218627,825345,-145161,-212581,-1183087,-281607,-1252113,-1319533,-2290039,-351975,-1322481,-1389901,-2360407,-1458927,-2429433,-2496853,-3467359,2001603,1031097,963677,-6829,894651,-75855,-143275,-1113781,824283,-146223,-213643,-1184149,-282669,-1253175,-1320595,-2291101,752871,-217635,-285055,-1255561,-354081,-1324587,-1392007,-2362513,-424449,-1394955,-1462375,-2432881,-1531401,-2501907,-2569327,-3539833,680745,-289761,-357181,-1327687,-426207,-1396713,-1464133,-2434639,-496575,-1467081,-1534501,-2505007,-1603527,-2574033,-2641453,-3611959,-567987,-1538493,-1605913,-2576419,-1674939,-2645445,-2712865,-3683371,-1745307,-2715813,-2783233,-3753739,-2852259,-3822765,-3890185,-4860691
+1161372,712518,735936,287082,769538,320684,344102,-104752,814018,365164,388582,-60272,422184,-26670,-3252,-452106,869964,421110,444528,-4326,478130,29276,52694,-396160,522610,73756,97174,-351680,130776,-318078,-294660,-743514,937836,488982,512400,63546,546002,97148,120566,-328288,590482,141628,165046,-283808,198648,-250206,-226788,-675642,646428,197574,220992,-227862,254594,-194260,-170842,-619696,299074,-149780,-126362,-575216,-92760,-541614,-518196,-967050,1017954,569100,592518,143664,626120,177266,200684,-248170,670600,221746,245164,-203690,278766,-170088,-146670,-595524,726546,277692,301110,-147744,334712,-114142,-90724,-539578,379192,-69662,-46244,-495098,-12642,-461496,-438078,-886932,794418,345564,368982,-79872,402584,-46270,-22852,-471706,447064,-1790,21628,-427226,55230,-393624,-370206,-819060,503010,54156,77574,-371280,111176,-337678,-314260,-763114,155656,-293198,-269780,-718634,-236178,-685032,-661614,-1110468,1110468,661614,685032,236178,718634,269780,293198,-155656,763114,314260,337678,-111176,371280,-77574,-54156,-503010,819060,370206,393624,-55230,427226,-21628,1790,-447064,471706,22852,46270,-402584,79872,-368982,-345564,-794418,886932,438078,461496,12642,495098,46244,69662,-379192,539578,90724,114142,-334712,147744,-301110,-277692,-726546,595524,146670,170088,-278766,203690,-245164,-221746,-670600,248170,-200684,-177266,-626120,-143664,-592518,-569100,-1017954,967050,518196,541614,92760,575216,126362,149780,-299074,619696,170842,194260,-254594,227862,-220992,-197574,-646428,675642,226788,250206,-198648,283808,-165046,-141628,-590482,328288,-120566,-97148,-546002,-63546,-512400,-488982,-937836,743514,294660,318078,-130776,351680,-97174,-73756,-522610,396160,-52694,-29276,-478130,4326,-444528,-421110,-869964,452106,3252,26670,-422184,60272,-388582,-365164,-814018,104752,-344102,-320684,-769538,-287082,-735936,-712518,-1161372
  },
  { // [29]
-2795410,2285518,2236574,1726682,2185058,1675166,1626222,1116330,2130988,1621096,1572152,1062260,1520636,1010744,961800,451908,2074406,1564514,1515570,1005678,1464054,954162,905218,395326,1409984,900092,851148,341256,799632,289740,240796,-269096,2015390,1505498,1456554,946662,1405038,895146,846202,336310,1350968,841076,792132,282240,740616,230724,181780,-328112,1294386,784494,735550,225658,684034,174142,125198,-384694,629964,120072,71128,-438764,19612,-490280,-539224,-1049116,1954038,1444146,1395202,885310,1343686,833794,784850,274958,1289616,779724,730780,220888,679264,169372,120428,-389464,1233034,723142,674198,164306,622682,112790,63846,-446046,568612,58720,9776,-500116,-41740,-551632,-600576,-1110468,1174018,664126,615182,105290,563666,53774,4830,-505062,509596,-296,-49240,-559132,-100756,-610648,-659592,-1169484,453014,-56878,-105822,-615714,-157338,-667230,-716174,-1226066,-211408,-721300,-770244,-1280136,-821760,-1331652,-1380596,-1890488,1890488,1380596,1331652,821760,1280136,770244,721300,211408,1226066,716174,667230,157338,615714,105822,56878,-453014,1169484,659592,610648,100756,559132,49240,296,-509596,505062,-4830,-53774,-563666,-105290,-615182,-664126,-1174018,1110468,600576,551632,41740,500116,-9776,-58720,-568612,446046,-63846,-112790,-622682,-164306,-674198,-723142,-1233034,389464,-120428,-169372,-679264,-220888,-730780,-779724,-1289616,-274958,-784850,-833794,-1343686,-885310,-1395202,-1444146,-1954038,1049116,539224,490280,-19612,438764,-71128,-120072,-629964,384694,-125198,-174142,-684034,-225658,-735550,-784494,-1294386,328112,-181780,-230724,-740616,-282240,-792132,-841076,-1350968,-336310,-846202,-895146,-1405038,-946662,-1456554,-1505498,-2015390,269096,-240796,-289740,-799632,-341256,-851148,-900092,-1409984,-395326,-905218,-954162,-1464054,-1005678,-1515570,-1564514,-2074406,-451908,-961800,-1010744,-1520636,-1062260,-1572152,-1621096,-2130988,-1116330,-1626222,-1675166,-2185058,-1726682,-2236574,-2285518,-2795410
+1745456,1373124,1346388,974056,1322750,950418,923682,551350,1303088,930756,904020,531688,880382,508050,481314,108982,1288312,915980,889244,516912,865606,493274,466538,94206,845944,473612,446876,74544,423238,50906,24170,-348162,1279350,907018,880282,507950,856644,484312,457576,85244,836982,464650,437914,65582,414276,41944,15208,-357124,822206,449874,423138,50806,399500,27168,432,-371900,379838,7506,-19230,-391562,-42868,-415200,-441936,-814268,1277136,904804,878068,505736,854430,482098,455362,83030,834768,462436,435700,63368,412062,39730,12994,-359338,819992,447660,420924,48592,397286,24954,-1782,-374114,377624,5292,-21444,-393776,-45082,-417414,-444150,-816482,811030,438698,411962,39630,388324,15992,-10744,-383076,368662,-3670,-30406,-402738,-54044,-426376,-453112,-825444,353886,-18446,-45182,-417514,-68820,-441152,-467888,-840220,-88482,-460814,-487550,-859882,-511188,-883520,-910256,-1282588,1282588,910256,883520,511188,859882,487550,460814,88482,840220,467888,441152,68820,417514,45182,18446,-353886,825444,453112,426376,54044,402738,30406,3670,-368662,383076,10744,-15992,-388324,-39630,-411962,-438698,-811030,816482,444150,417414,45082,393776,21444,-5292,-377624,374114,1782,-24954,-397286,-48592,-420924,-447660,-819992,359338,-12994,-39730,-412062,-63368,-435700,-462436,-834768,-83030,-455362,-482098,-854430,-505736,-878068,-904804,-1277136,814268,441936,415200,42868,391562,19230,-7506,-379838,371900,-432,-27168,-399500,-50806,-423138,-449874,-822206,357124,-15208,-41944,-414276,-65582,-437914,-464650,-836982,-85244,-457576,-484312,-856644,-507950,-880282,-907018,-1279350,348162,-24170,-50906,-423238,-74544,-446876,-473612,-845944,-94206,-466538,-493274,-865606,-516912,-889244,-915980,-1288312,-108982,-481314,-508050,-880382,-531688,-904020,-930756,-1303088,-551350,-923682,-950418,-1322750,-974056,-1346388,-1373124,-1745456
  },
  { // [30]
-1306358,1101066,1070578,865286,1038170,832878,802390,597098,1003698,798406,767918,562626,735510,530218,499730,294438,967034,761742,731254,525962,698846,493554,463066,257774,664374,459082,428594,223302,396186,190894,160406,-44886,928064,722772,692284,486992,659876,454584,424096,218804,625404,420112,389624,184332,357216,151924,121436,-83856,588740,383448,352960,147668,320552,115260,84772,-120520,286080,80788,50300,-154992,17892,-187400,-217888,-423180,886692,681400,650912,445620,618504,413212,382724,177432,584032,378740,348252,142960,315844,110552,80064,-125228,547368,342076,311588,106296,279180,73888,43400,-161892,244708,39416,8928,-196364,-23480,-228772,-259260,-464552,508398,303106,272618,67326,240210,34918,4430,-200862,205738,446,-30042,-235334,-62450,-267742,-298230,-503522,169074,-36218,-66706,-271998,-99114,-304406,-334894,-540186,-133586,-338878,-369366,-574658,-401774,-607066,-637554,-842846,842846,637554,607066,401774,574658,369366,338878,133586,540186,334894,304406,99114,271998,66706,36218,-169074,503522,298230,267742,62450,235334,30042,-446,-205738,200862,-4430,-34918,-240210,-67326,-272618,-303106,-508398,464552,259260,228772,23480,196364,-8928,-39416,-244708,161892,-43400,-73888,-279180,-106296,-311588,-342076,-547368,125228,-80064,-110552,-315844,-142960,-348252,-378740,-584032,-177432,-382724,-413212,-618504,-445620,-650912,-681400,-886692,423180,217888,187400,-17892,154992,-50300,-80788,-286080,120520,-84772,-115260,-320552,-147668,-352960,-383448,-588740,83856,-121436,-151924,-357216,-184332,-389624,-420112,-625404,-218804,-424096,-454584,-659876,-486992,-692284,-722772,-928064,44886,-160406,-190894,-396186,-223302,-428594,-459082,-664374,-257774,-463066,-493554,-698846,-525962,-731254,-761742,-967034,-294438,-499730,-530218,-735510,-562626,-767918,-798406,-1003698,-597098,-802390,-832878,-1038170,-865286,-1070578,-1101066,-1306358
+946045,811801,785071,650827,756577,622333,595603,461359,726675,592431,565701,431457,537207,402963,376233,241989,695795,561551,534821,400577,506327,372083,345353,211109,476425,342181,315451,181207,286957,152713,125983,-8261,664441,530197,503467,369223,474973,340729,313999,179755,445071,310827,284097,149853,255603,121359,94629,-39615,414191,279947,253217,118973,224723,90479,63749,-70495,194821,60577,33847,-100397,5353,-128891,-155621,-289865,633197,498953,472223,337979,443729,309485,282755,148511,413827,279583,252853,118609,224359,90115,63385,-70859,382947,248703,221973,87729,193479,59235,32505,-101739,163577,29333,2603,-131641,-25891,-160135,-186865,-321109,351593,217349,190619,56375,162125,27881,1151,-133093,132223,-2021,-28751,-162995,-57245,-191489,-218219,-352463,101343,-32901,-59631,-193875,-88125,-222369,-249099,-383343,-118027,-252271,-279001,-413245,-307495,-441739,-468469,-602713,602713,468469,441739,307495,413245,279001,252271,118027,383343,249099,222369,88125,193875,59631,32901,-101343,352463,218219,191489,57245,162995,28751,2021,-132223,133093,-1151,-27881,-162125,-56375,-190619,-217349,-351593,321109,186865,160135,25891,131641,-2603,-29333,-163577,101739,-32505,-59235,-193479,-87729,-221973,-248703,-382947,70859,-63385,-90115,-224359,-118609,-252853,-279583,-413827,-148511,-282755,-309485,-443729,-337979,-472223,-498953,-633197,289865,155621,128891,-5353,100397,-33847,-60577,-194821,70495,-63749,-90479,-224723,-118973,-253217,-279947,-414191,39615,-94629,-121359,-255603,-149853,-284097,-310827,-445071,-179755,-313999,-340729,-474973,-369223,-503467,-530197,-664441,8261,-125983,-152713,-286957,-181207,-315451,-342181,-476425,-211109,-345353,-372083,-506327,-400577,-534821,-561551,-695795,-241989,-376233,-402963,-537207,-431457,-565701,-592431,-726675,-461359,-595603,-622333,-756577,-650827,-785071,-811801,-946045
  },
  { // [31]
-360411,349927,328679,318195,306909,296425,275177,264693,284437,273953,252705,242221,230935,220451,199203,188719,261075,250591,229343,218859,207573,197089,175841,165357,185101,174617,153369,142885,131599,121115,99867,89383,236643,226159,204911,194427,183141,172657,151409,140925,160669,150185,128937,118453,107167,96683,75435,64951,137307,126823,105575,95091,83805,73321,52073,41589,61333,50849,29601,19117,7831,-2653,-23901,-34385,210957,200473,179225,168741,157455,146971,125723,115239,134983,124499,103251,92767,81481,70997,49749,39265,111621,101137,79889,69405,58119,47635,26387,15903,35647,25163,3915,-6569,-17855,-28339,-49587,-60071,87189,76705,55457,44973,33687,23203,1955,-8529,11215,731,-20517,-31001,-42287,-52771,-74019,-84503,-12147,-22631,-43879,-54363,-65649,-76133,-97381,-107865,-88121,-98605,-119853,-130337,-141623,-152107,-173355,-183839,183839,173355,152107,141623,130337,119853,98605,88121,107865,97381,76133,65649,54363,43879,22631,12147,84503,74019,52771,42287,31001,20517,-731,-11215,8529,-1955,-23203,-33687,-44973,-55457,-76705,-87189,60071,49587,28339,17855,6569,-3915,-25163,-35647,-15903,-26387,-47635,-58119,-69405,-79889,-101137,-111621,-39265,-49749,-70997,-81481,-92767,-103251,-124499,-134983,-115239,-125723,-146971,-157455,-168741,-179225,-200473,-210957,34385,23901,2653,-7831,-19117,-29601,-50849,-61333,-41589,-52073,-73321,-83805,-95091,-105575,-126823,-137307,-64951,-75435,-96683,-107167,-118453,-128937,-150185,-160669,-140925,-151409,-172657,-183141,-194427,-204911,-226159,-236643,-89383,-99867,-121115,-131599,-142885,-153369,-174617,-185101,-165357,-175841,-197089,-207573,-218859,-229343,-250591,-261075,-188719,-199203,-220451,-230935,-242221,-252705,-273953,-284437,-264693,-275177,-296425,-306909,-318195,-328679,-349927,-360411
+191923,188665,180571,177313,170247,166989,158895,155637,157569,154311,146217,142959,135893,132635,124541,121283,142453,139195,131101,127843,120777,117519,109425,106167,108099,104841,96747,93489,86423,83165,75071,71813,124859,121601,113507,110249,103183,99925,91831,88573,90505,87247,79153,75895,68829,65571,57477,54219,75389,72131,64037,60779,53713,50455,42361,39103,41035,37777,29683,26425,19359,16101,8007,4749,104807,101549,93455,90197,83131,79873,71779,68521,70453,67195,59101,55843,48777,45519,37425,34167,55337,52079,43985,40727,33661,30403,22309,19051,20983,17725,9631,6373,-693,-3951,-12045,-15303,37743,34485,26391,23133,16067,12809,4715,1457,3389,131,-7963,-11221,-18287,-21545,-29639,-32897,-11727,-14985,-23079,-26337,-33403,-36661,-44755,-48013,-46081,-49339,-57433,-60691,-67757,-71015,-79109,-82367,82367,79109,71015,67757,60691,57433,49339,46081,48013,44755,36661,33403,26337,23079,14985,11727,32897,29639,21545,18287,11221,7963,-131,-3389,-1457,-4715,-12809,-16067,-23133,-26391,-34485,-37743,15303,12045,3951,693,-6373,-9631,-17725,-20983,-19051,-22309,-30403,-33661,-40727,-43985,-52079,-55337,-34167,-37425,-45519,-48777,-55843,-59101,-67195,-70453,-68521,-71779,-79873,-83131,-90197,-93455,-101549,-104807,-4749,-8007,-16101,-19359,-26425,-29683,-37777,-41035,-39103,-42361,-50455,-53713,-60779,-64037,-72131,-75389,-54219,-57477,-65571,-68829,-75895,-79153,-87247,-90505,-88573,-91831,-99925,-103183,-110249,-113507,-121601,-124859,-71813,-75071,-83165,-86423,-93489,-96747,-104841,-108099,-106167,-109425,-117519,-120777,-127843,-131101,-139195,-142453,-121283,-124541,-132635,-135893,-142959,-146217,-154311,-157569,-155637,-158895,-166989,-170247,-177313,-180571,-188665,-191923
  },
 };
+static int const dec2_coeff[PDM_FTL_DEC2_TAPS] = {
+-1599,-3782,1917,9523,1302,-17092,-11042,23274,29417,-22356,-55874,6972,85479,29868,-107975,-91887,108188,176405,-67911,-271833,-31243,356270,205530,-396628,-470427,344350,854412,-109990,-1468098,-609567,3120882,6772122,6772122,3120882,-609567,-1468098,-109990,854412,344350,-470427,-396628,205530,356270,-31243,-271833,-67911,176405,108188,-91887,-107975,29868,85479,6972,-55874,-22356,29417,23274,-11042,-17092,1302,9523,1917,-3782,-1599
+};
@@ -37,9 +37,18 @@ signed int printfn(const char *pFormat, ...){
     result = ap_vsnprintf(outbuf, PRINTF_MAX_STRING_SIZE, pFormat, ap);
     va_end(ap);
 
+    //Queue the text between line breaks in bulk, expanding each line break to CR LF
     char * strptr = outbuf;
     while(*strptr != 0){
-    	PrintChar(*(strptr++));
+    	char * end = strptr;
+    	while(*end != 0 && *end != '\n'){
+    		end++;
+    	}
+    	board_usart_write_block(strptr, end - strptr);
+    	if(*end == '\n'){
+    		PrintChar(*(end++));
+    	}
+    	strptr = end;
     }
 
     return result;
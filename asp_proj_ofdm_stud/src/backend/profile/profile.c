@@ -0,0 +1,133 @@
+#include "profile.h"
+#include <stddef.h>
+#include "../../config.h"
+#include "../printfn/printfn.h"
+#include "../hw/headphone.h"
+#if defined(__arm__)
+#include "../hw/board.h"
+#else
+#include <time.h>
+#endif
+
+/** @brief Linked list of all scopes that have completed at least one measurement */
+static struct profile_scope_s * scope_list = NULL;
+
+/** @brief Per-block measurement, registered as any other scope */
+static PROFILE_SCOPE(block_scope, "audio block");
+
+/** @brief Histogram of the per-block headroom */
+static uint32_t headroom_hist[PROFILE_HIST_BINS];
+
+uint32_t profile_get_ticks(void){
+#if defined(__arm__)
+	return board_get_cycles();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t) (ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+#endif
+}
+
+uint32_t profile_get_block_ticks(void){
+#if defined(__arm__)
+	return board_get_block_cycles();
+#else
+	//The host driver provides audio_get_sample_rate, as the board does on target
+	return (uint32_t) ((1000000000ULL * AUDIO_BLOCKSIZE) / audio_get_sample_rate());
+#endif
+}
+
+/** @brief Adds a measured duration dt to the statistics of scope s */
+static void profile_record(struct profile_scope_s * const s, const uint32_t dt){
+	if(!s->registered){
+		//First measurement for this scope, add it to the list of scopes
+		s->registered = true;
+		s->next = scope_list;
+		scope_list = s;
+	}
+	s->count++;
+	s->total += dt;
+	if(dt < s->min){
+		s->min = dt;
+	}
+	if(dt > s->max){
+		s->max = dt;
+	}
+}
+
+void profile_begin(struct profile_scope_s * const s){
+	s->t_start = profile_get_ticks();
+}
+
+void profile_end(struct profile_scope_s * const s){
+	profile_record(s, profile_get_ticks() - s->t_start);
+}
+
+void profile_block_begin(void){
+	profile_begin(&block_scope);
+}
+
+void profile_block_end(void){
+	const uint32_t dt = profile_get_ticks() - block_scope.t_start;
+	profile_record(&block_scope, dt);
+	const uint32_t block_ticks = profile_get_block_ticks();
+	uint_fast32_t bin;
+	if(dt >= block_ticks){
+		bin = 0;
+	}else{
+		//Headroom in percent of the block time, mapped onto the bins following the overrun bin
+		const uint32_t headroom_pct = (uint32_t) ((100ULL * (block_ticks - dt)) / block_ticks);
+		bin = 1 + (headroom_pct * (PROFILE_HIST_BINS - 1)) / 100;
+		if(bin >= PROFILE_HIST_BINS){
+			bin = PROFILE_HIST_BINS - 1;
+		}
+	}
+	headroom_hist[bin]++;
+}
+
+void profile_reset(void){
+	struct profile_scope_s * s;
+	for(s = scope_list; s != NULL; s = s->next){
+		s->count = 0;
+		s->total = 0;
+		s->min = UINT32_MAX;
+		s->max = 0;
+	}
+	uint_fast32_t i;
+	for(i = 0; i < PROFILE_HIST_BINS; i++){
+		headroom_hist[i] = 0;
+	}
+}
+
+const struct profile_scope_s * profile_first_scope(void){
+	return scope_list;
+}
+
+const uint32_t * profile_get_headroom_hist(void){
+	return headroom_hist;
+}
+
+void profile_print(void){
+	const uint32_t block_ticks = profile_get_block_ticks();
+	printf("Profile (%lu ticks per block);\n", (unsigned long) block_ticks);
+	printf("\t%-20s %10s %10s %10s %10s %8s\n", "scope", "calls", "min", "mean", "max", "max [%]");
+	struct profile_scope_s * s;
+	for(s = scope_list; s != NULL; s = s->next){
+		if(s->count == 0){
+			continue;
+		}
+		const uint32_t mean = (uint32_t) (s->total / s->count);
+		printf("\t%-20s %10lu %10lu %10lu %10lu %8.1f\n", s->name,
+				(unsigned long) s->count, (unsigned long) s->min, (unsigned long) mean, (unsigned long) s->max,
+				(100.0f * s->max) / block_ticks);
+	}
+	printf("Block headroom histogram;\n");
+	printf("\t  overrun: %lu\n", (unsigned long) headroom_hist[0]);
+	uint_fast32_t i;
+	for(i = 1; i < PROFILE_HIST_BINS; i++){
+		printf("\t%3u-%3u %%: %lu\n",
+				(unsigned) (((i - 1) * 100) / (PROFILE_HIST_BINS - 1)),
+				(unsigned) ((i * 100) / (PROFILE_HIST_BINS - 1)),
+				(unsigned long) headroom_hist[i]);
+	}
+}
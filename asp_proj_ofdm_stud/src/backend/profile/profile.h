@@ -0,0 +1,76 @@
+/** @file Lightweight cycle-count profiler.
+ * Code sections are measured by wrapping them in profile_begin/profile_end
+ * calls on a named scope. Each scope keeps the minimum, mean and maximum
+ * number of cycles spent per call. In addition, the time spent per audio block
+ * is measured by profile_block_begin/profile_block_end and accumulated in a
+ * histogram over the remaining headroom, expressed as a percentage of the time
+ * available per AUDIO_BLOCKSIZE samples.
+ * On target the DWT cycle counter is used. On a host build, timestamps are
+ * instead taken from clock_gettime() and expressed in nanoseconds, and the
+ * host driver must provide audio_get_sample_rate() for the block period.
+ * Scopes register themselves on their first completed measurement, so no
+ * explicit initialization is needed. All functions except profile_print are
+ * safe to call from the audio callback. */
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Number of histogram bins for the per-block headroom.
+ * Bin 0 counts blocks that overran their deadline, the remaining bins evenly
+ * split the 0-100 % headroom range. */
+#define PROFILE_HIST_BINS		(11)
+
+/** @brief Memory element for a single named profiling scope */
+struct profile_scope_s {
+	const char * name;				//!<- Name to display when printing results
+	uint32_t t_start;				//!<- Timestamp of the last call to profile_begin
+	uint32_t count;					//!<- Number of completed measurements
+	uint32_t min;					//!<- Shortest measured duration
+	uint32_t max;					//!<- Longest measured duration
+	uint64_t total;					//!<- Sum of all measured durations
+	bool registered;				//!<- True once the scope has been added to the list of scopes
+	struct profile_scope_s * next;	//!<- Next registered scope
+};
+
+/** @brief Initializer of a profiling scope with a given name, for arrays of scopes */
+#define PROFILE_SCOPE_INIT(name_)	{.name = (name_), .min = UINT32_MAX}
+
+/** @brief Declares and initializes a profiling scope with a given name */
+#define PROFILE_SCOPE(var, name_)	struct profile_scope_s var = PROFILE_SCOPE_INIT(name_)
+
+/** @brief Returns the current timestamp in profiler ticks */
+uint32_t profile_get_ticks(void);
+
+/** @brief Returns the number of profiler ticks corresponding to one block of AUDIO_BLOCKSIZE samples */
+uint32_t profile_get_block_ticks(void);
+
+/** @brief Starts a measurement for scope s */
+void profile_begin(struct profile_scope_s * const s);
+
+/** @brief Ends the measurement for scope s started by the last profile_begin call */
+void profile_end(struct profile_scope_s * const s);
+
+/** @brief Marks the start of the processing for one audio block */
+void profile_block_begin(void);
+
+/** @brief Marks the end of the processing for one audio block and updates the headroom histogram */
+void profile_block_end(void);
+
+/** @brief Clears all measurements, keeping registered scopes */
+void profile_reset(void);
+
+/** @brief Returns the first registered scope, or NULL if there is none.
+ * The remaining scopes follow through the next member. */
+const struct profile_scope_s * profile_first_scope(void);
+
+/** @brief Returns the PROFILE_HIST_BINS bins of the block headroom histogram */
+const uint32_t * profile_get_headroom_hist(void);
+
+/** @brief Prints the statistics of all registered scopes and the headroom histogram.
+ * Must only be called from a non-interrupt context. */
+void profile_print(void);
+
+#endif /* PROFILE_H_ */
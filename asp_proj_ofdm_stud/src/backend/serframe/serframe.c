@@ -0,0 +1,39 @@
+#include "serframe.h"
+#include "../hw/board.h"
+
+/** @brief CRC-16/CCITT-FALSE of every value of a nibble, processing four bits per lookup */
+static const uint16_t serframe_crc_table[16] = {
+		0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+		0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF};
+
+uint16_t serframe_crc16(uint16_t crc, const void * data, size_t len){
+	const uint8_t * p = data;
+	while(len--){
+		crc = (crc << 4) ^ serframe_crc_table[(crc >> 12) ^ (*p >> 4)];
+		crc = (crc << 4) ^ serframe_crc_table[(crc >> 12) ^ (*p++ & 0x0F)];
+	}
+	return crc;
+}
+
+/** @brief Queues len bytes of data for transmission */
+static void serframe_put(const uint8_t * data, size_t len){
+	board_usart_write_block(data, len);
+}
+
+void serframe_begin(struct serframe_s * const f, const uint8_t type, const uint16_t len){
+	const uint8_t sync[2] = {SERFRAME_SYNC0, SERFRAME_SYNC1};
+	const uint8_t head[3] = {type, len & 0xFF, len >> 8};
+	serframe_put(sync, sizeof(sync));
+	f->crc = 0xFFFF;
+	serframe_write(f, head, sizeof(head));
+}
+
+void serframe_write(struct serframe_s * const f, const void * data, const size_t len){
+	f->crc = serframe_crc16(f->crc, data, len);
+	serframe_put(data, len);
+}
+
+void serframe_end(struct serframe_s * const f){
+	const uint8_t crc[2] = {f->crc & 0xFF, f->crc >> 8};
+	serframe_put(crc, sizeof(crc));
+}
@@ -0,0 +1,62 @@
+/** @file Binary framing for the debug USART.
+ * Binary data shares the serial link with the printf output, so every frame
+ * starts with two sync bytes that do not occur in text, followed by a type
+ * byte, the payload length and the payload, and ends with a CRC-16 of
+ * everything after the sync bytes. A receiver searches the byte stream for
+ * the sync bytes and keeps a frame only if its checksum matches, so text in
+ * between frames and frames damaged by lost bytes are skipped. All multi-byte
+ * values are little endian.
+ *
+ *	| 0xA5 | 0x5A | type | len (2) | payload (len) | crc (2) |
+ *
+ * The checksum is CRC-16/CCITT-FALSE (polynomial 0x1021, initial value
+ * 0xFFFF, no reflection). A frame is written with serframe_begin, any number
+ * of serframe_write calls adding up to the announced length, and serframe_end.
+ * As the frame is queued in the USART transmit buffer as it is written, it
+ * must be written from a single context; use board_usart_tx_free to check
+ * that a whole frame fits without waiting. */
+
+#ifndef SERFRAME_H_
+#define SERFRAME_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/** @brief Sync bytes starting every frame */
+#define SERFRAME_SYNC0		(0xA5)
+#define SERFRAME_SYNC1		(0x5A)
+
+/** @brief Number of bytes added to the payload of each frame */
+#define SERFRAME_OVERHEAD	(7)
+
+/** @brief Frame types. Host tools decode frames by these values, so existing
+ * values must not be changed. */
+enum serframe_type_e {
+	serframe_type_capture_header = 0x01,	//!<- Start of a capture, see backend/capture/capture.h
+	serframe_type_capture_data = 0x02,		//!<- Samples of a capture
+	serframe_type_telemetry_ofdm_rx = 0x10,	//!<- Result of receiving one OFDM band, see backend/telemetry/telemetry.h
+	serframe_type_telemetry_cvector = 0x11,	//!<- Vector of complex values
+	serframe_type_telemetry_profile = 0x12,	//!<- Statistics of one profiling scope
+	serframe_type_telemetry_headroom = 0x13,//!<- Block headroom histogram
+	serframe_type_log = 0x20,				//!<- Message with deferred formatting, see backend/dlog/dlog.h
+};
+
+/** @brief Memory element for a frame being written */
+struct serframe_s {
+	uint16_t crc;		//!<- Checksum of the frame so far
+};
+
+/** @brief Updates a CRC-16/CCITT-FALSE checksum crc with len bytes of data
+ * @return The updated checksum, start with 0xFFFF */
+uint16_t serframe_crc16(uint16_t crc, const void * data, size_t len);
+
+/** @brief Starts a frame of a given type with len bytes of payload */
+void serframe_begin(struct serframe_s * const f, const uint8_t type, const uint16_t len);
+
+/** @brief Adds len bytes of payload to a frame */
+void serframe_write(struct serframe_s * const f, const void * data, const size_t len);
+
+/** @brief Ends a frame by writing its checksum */
+void serframe_end(struct serframe_s * const f);
+
+#endif /* SERFRAME_H_ */
@@ -0,0 +1,76 @@
+#include "spsc.h"
+#include <stddef.h>
+#include <string.h>
+#include "macro.h"
+
+bool spsc_new(spsc_s * const cb, spsc_elem_t * const pool, const spsc_idx_t elems){
+	if(pool == NULL || cb == NULL || !ISPOW2(elems)){
+		return false;
+	}
+	cb->buf = pool;
+	cb->mask = elems - 1;
+	cb->head = 0;
+	cb->tail = 0;
+	return true;
+}
+
+spsc_idx_t spsc_write_span(spsc_s * const cb, spsc_elem_t ** const span){
+	const spsc_idx_t head = cb->head;
+	const spsc_idx_t free = cb->mask + 1 - (head - cb->tail);
+	const spsc_idx_t to_end = cb->mask + 1 - (head & cb->mask);
+	*span = &cb->buf[head & cb->mask];
+	return MIN(free, to_end);
+}
+
+void spsc_write_commit(spsc_s * const cb, const spsc_idx_t len){
+	SPSC_BARRIER();
+	cb->head += len;
+}
+
+spsc_idx_t spsc_read_span(spsc_s * const cb, const spsc_elem_t ** const span){
+	const spsc_idx_t tail = cb->tail;
+	const spsc_idx_t used = cb->head - tail;
+	const spsc_idx_t to_end = cb->mask + 1 - (tail & cb->mask);
+	*span = &cb->buf[tail & cb->mask];
+	return MIN(used, to_end);
+}
+
+void spsc_read_commit(spsc_s * const cb, const spsc_idx_t len){
+	SPSC_BARRIER();
+	cb->tail += len;
+}
+
+spsc_idx_t spsc_write_block(spsc_s * const cb, const spsc_elem_t * data, spsc_idx_t len){
+	spsc_idx_t written = 0;
+	//At most two spans are needed; one up to the end of the buffer memory and one from its start
+	while(len > 0){
+		spsc_elem_t * span;
+		const spsc_idx_t n = MIN(spsc_write_span(cb, &span), len);
+		if(n == 0){
+			break;
+		}
+		memcpy(span, data, n * sizeof(spsc_elem_t));
+		spsc_write_commit(cb, n);
+		data += n;
+		len -= n;
+		written += n;
+	}
+	return written;
+}
+
+spsc_idx_t spsc_read_block(spsc_s * const cb, spsc_elem_t * data, spsc_idx_t len){
+	spsc_idx_t read = 0;
+	while(len > 0){
+		const spsc_elem_t * span;
+		const spsc_idx_t n = MIN(spsc_read_span(cb, &span), len);
+		if(n == 0){
+			break;
+		}
+		memcpy(data, span, n * sizeof(spsc_elem_t));
+		spsc_read_commit(cb, n);
+		data += n;
+		len -= n;
+		read += n;
+	}
+	return read;
+}
@@ -0,0 +1,119 @@
+/** @file Lock-free single-producer/single-consumer FIFO buffer.
+ * Unlike cbuf, no critical sections are used; the buffer is safe as long as
+ * exactly one context writes to it (for example an interrupt handler) and
+ * exactly one context reads from it. The number of elements must be a power of
+ * two, so that indices can be wrapped with a mask. The head and tail indices
+ * are free-running and only masked when the buffer memory is addressed.
+ * Besides single-element access, the buffer can be accessed in bulk either by
+ * copying blocks of elements or by directly accessing contiguous spans of the
+ * buffer memory, followed by a commit call. */
+
+#ifndef SPSC_H_
+#define SPSC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** @brief Memory storage type for indexing specific elements of the buffer */
+typedef uint32_t spsc_idx_t;
+
+/** @brief Memory storage type for each individual element in a buffer */
+typedef uint16_t spsc_elem_t;
+
+/** @brief Memory storage element for a single SPSC buffer */
+typedef struct {
+	spsc_elem_t *buf;			//!<- Bulk data for buffer contents
+	volatile spsc_idx_t head;	//!<- Total number of elements written, only modified by the producer
+	volatile spsc_idx_t tail;	//!<- Total number of elements read, only modified by the consumer
+	spsc_idx_t mask;			//!<- Total number of elements in buffer minus one
+} spsc_s;
+
+/** @brief Ensures all buffer memory accesses have completed before an index is updated */
+#define SPSC_BARRIER()	__sync_synchronize()
+
+/** @brief Initialize a buffer
+ * @param cb Pointer to the spsc_s structure to initialize
+ * @param pool Pointer to an array of spsc_elem_t elements
+ * @param elems The number of elements in pool, must be a power of two
+ * @return True on success, false if elems is not a power of two */
+bool spsc_new(spsc_s * const cb, spsc_elem_t * const pool, const spsc_idx_t elems);
+
+/** @brief Returns the number of used elements in a buffer cb */
+static inline spsc_idx_t spsc_elems_used(const spsc_s * const cb){
+	return cb->head - cb->tail;
+}
+
+/** @brief Returns the number of free elements in a buffer cb */
+static inline spsc_idx_t spsc_elems_free(const spsc_s * const cb){
+	return cb->mask + 1 - (cb->head - cb->tail);
+}
+
+/** @brief Writes an element data to a buffer cb if space is available.
+ * To be called by the producer only.
+ * @return True on write success, false if the buffer is full */
+static inline bool spsc_write(spsc_s * const cb, const spsc_elem_t data){
+	const spsc_idx_t head = cb->head;
+	if(head - cb->tail > cb->mask){
+		return false;
+	}
+	cb->buf[head & cb->mask] = data;
+	SPSC_BARRIER();
+	cb->head = head + 1;
+	return true;
+}
+
+/** @brief Reads an element from a buffer cb if data is available.
+ * To be called by the consumer only.
+ * @return True on read success, false if the buffer is empty */
+static inline bool spsc_read(spsc_s * const cb, spsc_elem_t * const data){
+	const spsc_idx_t tail = cb->tail;
+	if(cb->head == tail){
+		return false;
+	}
+	*data = cb->buf[tail & cb->mask];
+	SPSC_BARRIER();
+	cb->tail = tail + 1;
+	return true;
+}
+
+/** @brief Reads the element offset places after the oldest unread element of
+ * a buffer cb, without removing anything. To be called by the consumer only.
+ * @return True on success, false if fewer than offset + 1 elements are unread */
+static inline bool spsc_peek(const spsc_s * const cb, const spsc_idx_t offset, spsc_elem_t * const data){
+	const spsc_idx_t tail = cb->tail;
+	if(cb->head - tail <= offset){
+		return false;
+	}
+	*data = cb->buf[(tail + offset) & cb->mask];
+	return true;
+}
+
+/** @brief Copies up to len elements from data to a buffer cb.
+ * To be called by the producer only.
+ * @return The number of elements written */
+spsc_idx_t spsc_write_block(spsc_s * const cb, const spsc_elem_t * data, spsc_idx_t len);
+
+/** @brief Copies up to len elements from a buffer cb to data.
+ * To be called by the consumer only.
+ * @return The number of elements read */
+spsc_idx_t spsc_read_block(spsc_s * const cb, spsc_elem_t * data, spsc_idx_t len);
+
+/** @brief Gets the largest contiguous span of free elements in a buffer cb.
+ * The elements may be written through span and are added to the buffer by
+ * spsc_write_commit. To be called by the producer only.
+ * @return The number of elements in span */
+spsc_idx_t spsc_write_span(spsc_s * const cb, spsc_elem_t ** const span);
+
+/** @brief Adds len elements previously written through spsc_write_span to a buffer cb */
+void spsc_write_commit(spsc_s * const cb, const spsc_idx_t len);
+
+/** @brief Gets the largest contiguous span of unread elements in a buffer cb.
+ * The elements may be read through span and are removed from the buffer by
+ * spsc_read_commit. To be called by the consumer only.
+ * @return The number of elements in span */
+spsc_idx_t spsc_read_span(spsc_s * const cb, const spsc_elem_t ** const span);
+
+/** @brief Removes len elements previously read through spsc_read_span from a buffer cb */
+void spsc_read_commit(spsc_s * const cb, const spsc_idx_t len);
+
+#endif /* SPSC_H_ */
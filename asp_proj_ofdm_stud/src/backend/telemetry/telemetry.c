@@ -0,0 +1,120 @@
+#include "telemetry.h"
+#include <string.h>
+#include <math.h>
+#include "../../macro.h"
+#include "../serframe/serframe.h"
+#include "../systime/systime.h"
+#include "../hw/board.h"
+
+/** @brief Number of bytes of the timestamp starting every record */
+#define TELEMETRY_STAMP_LEN		(4)
+
+static bool telemetry_enabled = false;
+static uint_fast32_t telemetry_drops = 0;
+
+void telemetry_set_enabled(const bool enabled){
+	telemetry_enabled = enabled;
+}
+
+bool telemetry_get_enabled(void){
+	return telemetry_enabled;
+}
+
+uint_fast32_t telemetry_dropped(void){
+	return telemetry_drops;
+}
+
+/** @brief Starts a record of a given type with len bytes following the timestamp
+ * @return True if the whole record fits in the USART transmit buffer, false if it was dropped */
+static bool telemetry_begin(struct serframe_s * const f, const enum serframe_type_e type, const uint_fast32_t len){
+	if(board_usart_tx_free() < SERFRAME_OVERHEAD + TELEMETRY_STAMP_LEN + len){
+		telemetry_drops++;
+		return false;
+	}
+	const uint32_t stamp = systime_get();
+	serframe_begin(f, type, TELEMETRY_STAMP_LEN + len);
+	serframe_write(f, &stamp, sizeof(stamp));
+	return true;
+}
+
+bool telemetry_ofdm_rx(const uint8_t band, const float frequency, const float rmse, const char * tx, const char * rx, const uint8_t len){
+	struct serframe_s f;
+	uint8_t head[10];
+	head[0] = band;
+	memcpy(&head[1], &frequency, sizeof(frequency));
+	memcpy(&head[5], &rmse, sizeof(rmse));
+	head[9] = len;
+	if(!telemetry_begin(&f, serframe_type_telemetry_ofdm_rx, sizeof(head) + 2*len)){
+		return false;
+	}
+	serframe_write(&f, head, sizeof(head));
+	serframe_write(&f, tx, len);
+	serframe_write(&f, rx, len);
+	serframe_end(&f);
+	return true;
+}
+
+bool telemetry_cvector(const enum telemetry_id_e id, const float * data, const uint_fast16_t len){
+	struct serframe_s f;
+	uint_fast32_t i;
+	if(len > TELEMETRY_CVECTOR_MAX){
+		return false;
+	}
+	//Scale the largest part to full scale
+	float peak = 0;
+	for(i = 0; i < 2*len; i++){
+		peak = MAX(peak, fabsf(data[i]));
+	}
+	const float scale = (peak > 0) ? peak / INT16_MAX : 1.0f;
+	uint8_t head[7];
+	head[0] = id;
+	head[1] = len & 0xFF;
+	head[2] = len >> 8;
+	memcpy(&head[3], &scale, sizeof(scale));
+	if(!telemetry_begin(&f, serframe_type_telemetry_cvector, sizeof(head) + 4*len)){
+		return false;
+	}
+	serframe_write(&f, head, sizeof(head));
+	//Convert in pieces to keep the stack small
+	int16_t piece[32];
+	for(i = 0; i < 2*len; i += NUMEL(piece)){
+		const uint_fast32_t n = MIN(NUMEL(piece), 2*len - i);
+		uint_fast32_t j;
+		for(j = 0; j < n; j++){
+			piece[j] = (int16_t) lrintf(data[i + j] / scale);
+		}
+		serframe_write(&f, piece, n * sizeof(piece[0]));
+	}
+	serframe_end(&f);
+	return true;
+}
+
+bool telemetry_profile(void){
+	struct serframe_s f;
+	bool all = true;
+	const uint32_t block_ticks = profile_get_block_ticks();
+	const struct profile_scope_s * s;
+	for(s = profile_first_scope(); s != NULL; s = s->next){
+		if(s->count == 0){
+			continue;
+		}
+		const uint32_t vals[5] = {block_ticks, s->count, s->min, (uint32_t) (s->total / s->count), s->max};
+		const uint8_t name_len = MIN(strlen(s->name), UINT8_MAX);
+		if(!telemetry_begin(&f, serframe_type_telemetry_profile, sizeof(vals) + 1 + name_len)){
+			all = false;
+			continue;
+		}
+		serframe_write(&f, vals, sizeof(vals));
+		serframe_write(&f, &name_len, 1);
+		serframe_write(&f, s->name, name_len);
+		serframe_end(&f);
+	}
+	const uint8_t bins = PROFILE_HIST_BINS;
+	if(!telemetry_begin(&f, serframe_type_telemetry_headroom, 1 + PROFILE_HIST_BINS * sizeof(uint32_t))){
+		return false;
+	}
+	serframe_write(&f, &bins, 1);
+	serframe_write(&f, profile_get_headroom_hist(), PROFILE_HIST_BINS * sizeof(uint32_t));
+	serframe_end(&f);
+	return all;
+}
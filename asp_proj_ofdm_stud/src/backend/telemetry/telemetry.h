@@ -0,0 +1,64 @@
+/** @file Binary telemetry records over the debug USART.
+ * Diagnostics such as decoded messages, constellations, channel estimates and
+ * profiler statistics are sent as typed binary records instead of formatted
+ * text. Every record is one serframe frame (see backend/serframe/serframe.h)
+ * whose payload starts with a timestamp, systime_get() [us] as a 32-bit
+ * value, followed by the fields listed below, all little endian:
+ *
+ *	ofdm_rx:	band (1), frequency [Hz] (f32), RMSE (f32), length (1), transmitted string, received string
+ *	cvector:	id (1), count (2), scale (f32), count pairs of real and imaginary parts (2 each)
+ *	profile:	ticks per block (4), calls (4), min (4), mean (4), max (4), length (1), name
+ *	headroom:	bins (1), bins counts (4 each)
+ *
+ * Complex vectors are sent as 16-bit integers which, multiplied by scale,
+ * give the original values, so a constellation takes a quarter of the bytes
+ * of its values in MATLAB text. Records are only queued if they fit in the
+ * USART transmit buffer as a whole; otherwise they are dropped and counted,
+ * so sending never waits for the serial link. tools/telemetry_decode.py
+ * decodes a log of the serial output. */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../profile/profile.h"
+
+/** @brief Largest number of values in a complex vector record */
+#define TELEMETRY_CVECTOR_MAX	(1024)
+
+/** @brief Identifiers of complex vector records. Host tools name the vectors
+ * by these values, so existing values must not be changed. */
+enum telemetry_id_e {
+	telemetry_id_ofdm_soft_symbols = 0x01,	//!<- Equalized QPSK soft symbols of the message block
+	telemetry_id_ofdm_channel = 0x02,		//!<- Conjugated channel estimate, per subcarrier
+};
+
+/** @brief Selects whether applications send telemetry records instead of printing diagnostics */
+void telemetry_set_enabled(const bool enabled);
+
+/** @brief Returns true if telemetry has been enabled by telemetry_set_enabled */
+bool telemetry_get_enabled(void);
+
+/** @brief Sends the result of receiving one OFDM band
+ * @param band		Index of the band
+ * @param frequency	Center frequency of the band [Hz]
+ * @param rmse		RMSE of the soft symbols
+ * @param tx		The transmitted string, len characters
+ * @param rx		The received string, len characters
+ * @param len		Length of the strings, at most 255
+ * @return True if the record was queued */
+bool telemetry_ofdm_rx(const uint8_t band, const float frequency, const float rmse, const char * tx, const char * rx, const uint8_t len);
+
+/** @brief Sends a vector of len complex values, stored as interleaved real and imaginary parts
+ * @return True if the record was queued */
+bool telemetry_cvector(const enum telemetry_id_e id, const float * data, const uint_fast16_t len);
+
+/** @brief Sends the statistics of all profiling scopes and the block headroom histogram
+ * @return True if all records were queued */
+bool telemetry_profile(void);
+
+/** @brief Returns the number of records dropped since startup */
+uint_fast32_t telemetry_dropped(void);
+
+#endif /* TELEMETRY_H_ */
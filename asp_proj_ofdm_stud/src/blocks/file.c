@@ -0,0 +1,314 @@
+#include "file.h"
+#include <string.h>
+#include "arm_math.h"
+#include "macro.h"
+#include "util.h"
+#include "backend/pcm/pcm.h"
+#ifndef __arm__
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/** @brief WAV format tags */
+#define WAV_FORMAT_PCM			(0x0001)
+#define WAV_FORMAT_FLOAT		(0x0003)
+#define WAV_FORMAT_EXTENSIBLE	(0xFFFE)
+
+/** @brief Samples per channel converted to 16 bits at a time by the sink */
+#define BLOCKS_FILE_CVT_CHUNK	(64)
+
+/** @brief Reads little endian integers from possibly unaligned memory */
+static uint_fast16_t file_get_u16(const uint8_t * p){
+	return p[0] | (p[1] << 8);
+}
+
+static uint_fast32_t file_get_u32(const uint8_t * p){
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint_fast32_t) p[3] << 24);
+}
+
+/** @brief Writes little endian integers to possibly unaligned memory */
+static void file_put_u16(uint8_t * p, const uint_fast16_t x){
+	p[0] = x;
+	p[1] = x >> 8;
+}
+
+static void file_put_u32(uint8_t * p, const uint_fast32_t x){
+	p[0] = x;
+	p[1] = x >> 8;
+	p[2] = x >> 16;
+	p[3] = x >> 24;
+}
+
+/** @brief Returns the size of one sample of a format [bytes] */
+static uint_fast8_t file_sample_size(const enum blocks_file_format_e format){
+	return format == blocks_file_f32 ? sizeof(float) : sizeof(int16_t);
+}
+
+bool blocks_file_open_raw(struct blocks_file_s * const f,
+		const void * const data,
+		const size_t len,
+		const enum blocks_file_format_e format,
+		const uint_fast8_t channels,
+		const uint32_t sample_rate){
+	if(channels == 0){
+		return false;
+	}
+	f->data = data;
+	f->frames = len / (channels * file_sample_size(format));
+	f->channels = channels;
+	f->channel = 0;
+	f->format = format;
+	f->sample_rate = sample_rate;
+	f->pos = 0;
+	f->loop = false;
+#ifndef __arm__
+	f->map = NULL;
+	f->map_len = 0;
+#endif
+	return true;
+}
+
+bool blocks_file_open_wav(struct blocks_file_s * const f, const void * const data, const size_t len){
+	const uint8_t * const p = data;
+	const uint8_t * fmt = NULL;
+	size_t fmt_len = 0;
+	size_t pos = 12;
+	if(len < 12 || memcmp(p, "RIFF", 4) != 0 || memcmp(&p[8], "WAVE", 4) != 0){
+		return false;
+	}
+	//Walk the chunks up to the data chunk, which must follow the format chunk
+	while(pos + 8 <= len){
+		const uint8_t * const chunk = &p[pos];
+		size_t chunk_len = file_get_u32(&chunk[4]);
+		pos += 8;
+		if(memcmp(chunk, "fmt ", 4) == 0 && chunk_len >= 16 && pos + 16 <= len){
+			fmt = &chunk[8];
+			fmt_len = chunk_len;
+		}else if(memcmp(chunk, "data", 4) == 0){
+			if(fmt == NULL){
+				return false;
+			}
+			//Recorders that stop abruptly may leave the length unset or too long
+			if(chunk_len > len - pos){
+				chunk_len = len - pos;
+			}
+			uint_fast16_t tag = file_get_u16(&fmt[0]);
+			if(tag == WAV_FORMAT_EXTENSIBLE && fmt_len >= 40 && fmt + 40 <= p + len){
+				//The sub format GUID starts with the tag of the actual format
+				tag = file_get_u16(&fmt[24]);
+			}
+			const uint_fast16_t bits = file_get_u16(&fmt[14]);
+			enum blocks_file_format_e format;
+			if(tag == WAV_FORMAT_PCM && bits == 16){
+				format = blocks_file_i16;
+			}else if(tag == WAV_FORMAT_FLOAT && bits == 32){
+				format = blocks_file_f32;
+			}else{
+				return false;
+			}
+			return blocks_file_open_raw(f, &p[pos], chunk_len, format, file_get_u16(&fmt[2]), file_get_u32(&fmt[4]));
+		}
+		//Chunks are padded to an even length
+		pos += chunk_len + (chunk_len & 1);
+	}
+	return false;
+}
+
+uint_fast32_t blocks_file_read(struct blocks_file_s * const f, float * dst, const uint_fast32_t len){
+	const uint_fast8_t sample_size = file_sample_size(f->format);
+	const size_t stride = f->channels * sample_size;
+	uint_fast32_t done = 0;
+	while(done < len){
+		if(f->pos >= f->frames){
+			if(!f->loop || f->frames == 0){
+				arm_fill_f32(0.0f, &dst[done], len - done);
+				break;
+			}
+			f->pos = 0;
+		}
+		const uint_fast32_t span = MIN(len - done, f->frames - f->pos);
+		const uint8_t * src = &f->data[f->pos * stride + f->channel * sample_size];
+		uint_fast32_t i;
+		//Copy through memcpy, as the samples of a WAV file need not be aligned
+		if(f->format == blocks_file_f32){
+			for(i = 0; i < span; i++, src += stride){
+				memcpy(&dst[done + i], src, sizeof(float));
+			}
+		}else{
+			for(i = 0; i < span; i++, src += stride){
+				int16_t x;
+				memcpy(&x, src, sizeof(x));
+				dst[done + i] = x * (1.0f/INT16_MAX);
+			}
+		}
+		f->pos += span;
+		done += span;
+	}
+	return done;
+}
+
+#ifndef __arm__
+/** @brief Maps the file at path read-only into memory
+ * @return A pointer to the mapping, or NULL on failure */
+static void * file_map(const char * const path, size_t * const len){
+	const int fd = open(path, O_RDONLY);
+	struct stat st;
+	void * map = NULL;
+	if(fd < 0){
+		return NULL;
+	}
+	if(fstat(fd, &st) == 0 && st.st_size > 0){
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(map == MAP_FAILED){
+			map = NULL;
+		}else{
+			*len = st.st_size;
+		}
+	}
+	//The mapping stays valid after the descriptor is closed
+	close(fd);
+	return map;
+}
+
+bool blocks_file_map_wav(struct blocks_file_s * const f, const char * const path){
+	size_t len;
+	void * const map = file_map(path, &len);
+	if(map == NULL){
+		return false;
+	}
+	if(!blocks_file_open_wav(f, map, len)){
+		munmap(map, len);
+		return false;
+	}
+	f->map = map;
+	f->map_len = len;
+	return true;
+}
+
+bool blocks_file_map_raw(struct blocks_file_s * const f,
+		const char * const path,
+		const enum blocks_file_format_e format,
+		const uint_fast8_t channels,
+		const uint32_t sample_rate){
+	size_t len;
+	void * const map = file_map(path, &len);
+	if(map == NULL){
+		return false;
+	}
+	if(!blocks_file_open_raw(f, map, len, format, channels, sample_rate)){
+		munmap(map, len);
+		return false;
+	}
+	f->map = map;
+	f->map_len = len;
+	return true;
+}
+
+void blocks_file_unmap(struct blocks_file_s * const f){
+	if(f->map != NULL){
+		munmap(f->map, f->map_len);
+	}
+	f->map = NULL;
+	f->map_len = 0;
+	f->data = NULL;
+	f->frames = 0;
+	f->pos = 0;
+}
+#endif
+
+bool blocks_file_sink_init(struct blocks_file_sink_s * const s,
+		void * const buf,
+		const size_t cap,
+		const enum blocks_file_format_e format,
+		const uint_fast8_t channels,
+		const uint32_t sample_rate,
+		const bool wav){
+	if(channels < 1 || channels > 2 || (wav && cap < BLOCKS_FILE_WAV_HEADER_SIZE)){
+		return false;
+	}
+	s->buf = buf;
+	s->cap = cap;
+	s->channels = channels;
+	s->format = format;
+	s->sample_rate = sample_rate;
+	s->wav = wav;
+	s->overflow = false;
+	s->len = wav ? BLOCKS_FILE_WAV_HEADER_SIZE : 0;
+	return true;
+}
+
+void blocks_file_sink_write(struct blocks_file_sink_s * const s, const float * left, const float * right, const uint_fast32_t len){
+	const uint_fast8_t sample_size = file_sample_size(s->format);
+	const size_t stride = s->channels * sample_size;
+	uint_fast32_t frames = (s->cap - s->len) / stride;
+	uint_fast32_t i;
+	uint_fast8_t c;
+	if(frames < len){
+		s->overflow = true;
+	}else{
+		frames = len;
+	}
+	uint8_t * dst = &s->buf[s->len];
+	if(s->format == blocks_file_f32){
+		for(i = 0; i < frames; i++){
+			for(c = 0; c < s->channels; c++, dst += sample_size){
+				const float x = (c == 0) ? left[i] : right[i];
+				memcpy(dst, &x, sizeof(x));
+			}
+		}
+	}else{
+		//Convert like the output path in chunks, then interleave into the possibly unaligned buffer
+		int16_t y[2][BLOCKS_FILE_CVT_CHUNK];
+		uint_fast32_t n, j;
+		for(i = 0; i < frames; i += n){
+			n = MIN(frames - i, BLOCKS_FILE_CVT_CHUNK);
+			pcm_f32_to_i16(&left[i], y[0], n);
+			if(s->channels > 1){
+				pcm_f32_to_i16(&right[i], y[1], n);
+			}
+			for(j = 0; j < n; j++){
+				for(c = 0; c < s->channels; c++, dst += sample_size){
+					memcpy(dst, &y[c][j], sizeof(y[c][j]));
+				}
+			}
+		}
+	}
+	s->len += frames * stride;
+}
+
+size_t blocks_file_sink_finish(struct blocks_file_sink_s * const s){
+	if(!s->wav){
+		return s->len;
+	}
+	uint8_t * const h = s->buf;
+	const uint_fast8_t sample_size = file_sample_size(s->format);
+	memcpy(&h[0], "RIFF", 4);
+	file_put_u32(&h[4], s->len - 8);
+	memcpy(&h[8], "WAVE", 4);
+	memcpy(&h[12], "fmt ", 4);
+	file_put_u32(&h[16], 16);
+	file_put_u16(&h[20], s->format == blocks_file_f32 ? WAV_FORMAT_FLOAT : WAV_FORMAT_PCM);
+	file_put_u16(&h[22], s->channels);
+	file_put_u32(&h[24], s->sample_rate);
+	file_put_u32(&h[28], s->sample_rate * s->channels * sample_size);
+	file_put_u16(&h[32], s->channels * sample_size);
+	file_put_u16(&h[34], 8 * sample_size);
+	memcpy(&h[36], "data", 4);
+	file_put_u32(&h[40], s->len - BLOCKS_FILE_WAV_HEADER_SIZE);
+	return s->len;
+}
+
+#ifndef __arm__
+bool blocks_file_sink_save(struct blocks_file_sink_s * const s, const char * const path){
+	const size_t len = blocks_file_sink_finish(s);
+	FILE * const fp = fopen(path, "wb");
+	if(fp == NULL){
+		return false;
+	}
+	const bool ok = fwrite(s->buf, 1, len, fp) == len;
+	return (fclose(fp) == 0) && ok;
+}
+#endif
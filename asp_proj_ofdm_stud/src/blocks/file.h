@@ -0,0 +1,150 @@
+/** @file File-backed sources and sinks.
+ * Recorded signals can be replayed instead of the microphone, and the outputs
+ * can be captured, so that any SYSMODE runs on the same input every time. A
+ * file is read from memory as a WAV file (16-bit PCM or 32-bit float) or as
+ * raw samples. On target the file is typically a const array in flash. On a
+ * host build files are memory-mapped, and the audio callback can be run in a
+ * loop as fast as it completes:
+ *
+ *	blocks_sources_update();
+ *	main_audio_callback();
+ *	blocks_sinks_update();
+ *
+ * A sink writes WAV or raw samples to a caller-provided memory buffer, which
+ * a host build can save to disk once finished. tools/ofdm_replay.c runs the
+ * OFDM lab on a recording this way. */
+
+#ifndef BLOCKS_FILE_H_
+#define BLOCKS_FILE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/** @brief Size of the header written by a WAV sink [bytes] */
+#define BLOCKS_FILE_WAV_HEADER_SIZE	(44)
+
+/** @brief Sample formats of files */
+enum blocks_file_format_e {
+	blocks_file_i16,		//!<- Signed 16-bit integers, little endian, full scale INT16_MAX
+	blocks_file_f32,		//!<- 32-bit floats, little endian, full scale 1
+};
+
+/** @brief A file to read samples from */
+struct blocks_file_s {
+	const uint8_t * data;				//!<- First sample of the file
+	uint_fast32_t frames;				//!<- Number of frames, a frame holding one sample per channel
+	uint_fast8_t channels;				//!<- Number of interleaved channels
+	uint_fast8_t channel;				//!<- Channel returned by blocks_file_read, defaults to 0
+	enum blocks_file_format_e format;	//!<- Sample format
+	uint32_t sample_rate;				//!<- Sample rate [Hz], 0 if not known
+	uint_fast32_t pos;					//!<- Next frame to read
+	bool loop;							//!<- True to restart from the first frame at the end of the file
+#ifndef __arm__
+	void * map;							//!<- Memory mapping of the file, NULL if not mapped
+	size_t map_len;						//!<- Length of the mapping [bytes]
+#endif
+};
+
+/** @brief Opens a WAV file held in memory. The memory must remain valid while the file is used.
+ * @param f		The file to initialize
+ * @param data	The complete WAV file
+ * @param len	The length of data [bytes]
+ * @return True on success, false if data is not a WAV file with 16-bit PCM or 32-bit float samples */
+bool blocks_file_open_wav(struct blocks_file_s * const f, const void * const data, const size_t len);
+
+/** @brief Opens raw interleaved samples held in memory.
+ * The memory must remain valid while the file is used.
+ * @param f				The file to initialize
+ * @param data			The samples
+ * @param len			The length of data [bytes]. A trailing partial frame is ignored.
+ * @param format		The sample format
+ * @param channels		The number of interleaved channels
+ * @param sample_rate	The sample rate [Hz], or 0 if not known
+ * @return True on success, false if channels is zero */
+bool blocks_file_open_raw(struct blocks_file_s * const f,
+		const void * const data,
+		const size_t len,
+		const enum blocks_file_format_e format,
+		const uint_fast8_t channels,
+		const uint32_t sample_rate);
+
+/** @brief Reads the next len samples of the selected channel of a file to dst, scaled to the range [-1, 1].
+ * Past the end of a file that does not loop, dst is filled with zeros.
+ * @return The number of samples taken from the file */
+uint_fast32_t blocks_file_read(struct blocks_file_s * const f, float * dst, const uint_fast32_t len);
+
+/** @brief Returns true if all samples of a file that does not loop have been read */
+static inline bool blocks_file_eof(const struct blocks_file_s * const f){
+	return !f->loop && f->pos >= f->frames;
+}
+
+/** @brief Restarts reading a file from its first frame */
+static inline void blocks_file_rewind(struct blocks_file_s * const f){
+	f->pos = 0;
+}
+
+#ifndef __arm__
+/** @brief Memory-maps and opens a WAV file, see blocks_file_open_wav.
+ * @return True on success, false if the file cannot be mapped or is not a supported WAV file */
+bool blocks_file_map_wav(struct blocks_file_s * const f, const char * const path);
+
+/** @brief Memory-maps and opens a file of raw samples, see blocks_file_open_raw.
+ * @return True on success, false if the file cannot be mapped */
+bool blocks_file_map_raw(struct blocks_file_s * const f,
+		const char * const path,
+		const enum blocks_file_format_e format,
+		const uint_fast8_t channels,
+		const uint32_t sample_rate);
+
+/** @brief Unmaps a file opened with blocks_file_map_wav or blocks_file_map_raw */
+void blocks_file_unmap(struct blocks_file_s * const f);
+#endif
+
+/** @brief A memory buffer to write samples to */
+struct blocks_file_sink_s {
+	uint8_t * buf;						//!<- Buffer holding the file
+	size_t cap;							//!<- Capacity of buf [bytes]
+	size_t len;							//!<- Bytes written to buf, including any header
+	uint_fast8_t channels;				//!<- Number of interleaved channels, 1 or 2
+	enum blocks_file_format_e format;	//!<- Sample format
+	uint32_t sample_rate;				//!<- Sample rate written to the header [Hz]
+	bool wav;							//!<- True to write a WAV header
+	bool overflow;						//!<- True if samples were dropped because buf is full
+};
+
+/** @brief Initializes a sink
+ * @param s				The sink to initialize
+ * @param buf			Buffer to write the file to
+ * @param cap			The capacity of buf [bytes], at least BLOCKS_FILE_WAV_HEADER_SIZE for a WAV file
+ * @param format		The sample format
+ * @param channels		The number of channels, 1 or 2
+ * @param sample_rate	The sample rate [Hz]
+ * @param wav			True to write a WAV file, false to write raw samples
+ * @return True on success, false if channels or cap is invalid */
+bool blocks_file_sink_init(struct blocks_file_sink_s * const s,
+		void * const buf,
+		const size_t cap,
+		const enum blocks_file_format_e format,
+		const uint_fast8_t channels,
+		const uint32_t sample_rate,
+		const bool wav);
+
+/** @brief Appends len samples per channel to a sink. Samples are saturated to the range [-1, 1]
+ * for 16-bit files. Samples not fitting in the buffer are dropped and the overflow flag set.
+ * @param left	The samples of the first channel
+ * @param right	The samples of the second channel, ignored for a single channel */
+void blocks_file_sink_write(struct blocks_file_sink_s * const s, const float * left, const float * right, const uint_fast32_t len);
+
+/** @brief Completes the header of a WAV sink so the buffer holds a valid file.
+ * Writing may continue afterwards, with a new call once done.
+ * @return The length of the file [bytes] */
+size_t blocks_file_sink_finish(struct blocks_file_sink_s * const s);
+
+#ifndef __arm__
+/** @brief Completes a sink and saves it to a file
+ * @return True on success */
+bool blocks_file_sink_save(struct blocks_file_sink_s * const s, const char * const path);
+#endif
+
+#endif /* BLOCKS_FILE_H_ */
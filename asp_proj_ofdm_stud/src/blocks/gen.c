@@ -1,9 +1,10 @@
 #include "gen.h"
 #include "arm_math.h"
 #include "config.h"
+#include "backend/hw/headphone.h"
 
 void blocks_gen_sin(float frequency, float phase, float * dest, int_fast32_t len){
-	const float delta_ang = M_TWOPI * frequency / AUDIO_SAMPLE_RATE;
+	const float delta_ang = M_TWOPI * frequency / audio_get_sample_rate();
 	float ang = phase;
 	while(len--){
 		*(dest++) = arm_sin_f32(ang);
@@ -15,7 +16,7 @@ void blocks_gen_sin(float frequency, float phase, float * dest, int_fast32_t len
 }
 
 void blocks_gen_cos(float frequency, float phase, float * dest, int_fast32_t len){
-	const float delta_ang = M_TWOPI * frequency / AUDIO_SAMPLE_RATE;
+	const float delta_ang = M_TWOPI * frequency / audio_get_sample_rate();
 	float ang = phase;
 	while(len--){
 		*(dest++) = arm_cos_f32(ang);
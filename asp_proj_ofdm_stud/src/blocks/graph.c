@@ -0,0 +1,201 @@
+#include "graph.h"
+#include "config.h"
+#include "sources.h"
+#include "sinks.h"
+
+void graph_init(struct graph_s * const g, float * const pool, const int_fast32_t pool_len){
+	g->n_nodes = 0;
+	g->pool = pool;
+	g->pool_len = pool_len;
+	g->pool_used = 0;
+	g->compiled = false;
+}
+
+int_fast8_t graph_add_node(struct graph_s * const g,
+		const graph_fn_t fn,
+		void * const ctx,
+		const uint_fast8_t n_in,
+		const uint_fast8_t n_out,
+		const uint_fast16_t rate_num,
+		const uint_fast16_t rate_den){
+	if(g->n_nodes >= GRAPH_MAX_NODES || n_in > GRAPH_MAX_PORTS || n_out > GRAPH_MAX_PORTS || rate_num == 0 || rate_den == 0){
+		return -1;
+	}
+	struct graph_node_s * const node = &g->nodes[g->n_nodes];
+	node->fn = fn;
+	node->ctx = ctx;
+	node->n_in = n_in;
+	node->n_out = n_out;
+	node->rate_num = rate_num;
+	node->rate_den = rate_den;
+	uint_fast8_t port;
+	for(port = 0; port < GRAPH_MAX_PORTS; port++){
+		node->src_node[port] = -1;
+		node->src_port[port] = 0;
+	}
+	g->compiled = false;
+	return g->n_nodes++;
+}
+
+bool graph_connect(struct graph_s * const g,
+		const int_fast8_t src_node,
+		const uint_fast8_t src_port,
+		const int_fast8_t dst_node,
+		const uint_fast8_t dst_port){
+	if(src_node < 0 || src_node >= g->n_nodes || dst_node < 0 || dst_node >= g->n_nodes){
+		return false;
+	}
+	if(src_port >= g->nodes[src_node].n_out || dst_port >= g->nodes[dst_node].n_in){
+		return false;
+	}
+	g->nodes[dst_node].src_node[dst_port] = src_node;
+	g->nodes[dst_node].src_port[dst_port] = src_port;
+	g->compiled = false;
+	return true;
+}
+
+bool graph_compile(struct graph_s * const g){
+	int_fast8_t n, m, pos;
+	uint_fast8_t port;
+	g->compiled = false;
+
+	/* Order the nodes with Kahn's algorithm, counting the unscheduled inputs
+	 * of each node. Among the ready nodes the earliest added runs first, so
+	 * the order is predictable. */
+	int_fast8_t pending[GRAPH_MAX_NODES];
+	int_fast8_t sched_pos[GRAPH_MAX_NODES];
+	for(n = 0; n < g->n_nodes; n++){
+		for(port = 0; port < g->nodes[n].n_in; port++){
+			if(g->nodes[n].src_node[port] < 0){
+				return false;
+			}
+		}
+		pending[n] = g->nodes[n].n_in;
+		sched_pos[n] = -1;
+	}
+	for(pos = 0; pos < g->n_nodes; pos++){
+		for(n = 0; n < g->n_nodes; n++){
+			if(sched_pos[n] < 0 && pending[n] == 0){
+				break;
+			}
+		}
+		if(n == g->n_nodes){
+			//No node is ready, so the remaining nodes form a cycle
+			return false;
+		}
+		sched_pos[n] = pos;
+		g->order[pos] = n;
+		for(m = 0; m < g->n_nodes; m++){
+			for(port = 0; port < g->nodes[m].n_in; port++){
+				if(g->nodes[m].src_node[port] == n){
+					pending[m]--;
+				}
+			}
+		}
+	}
+
+	/* Propagate the buffer lengths along the schedule and find the last
+	 * position reading the outputs of each node */
+	for(pos = 0; pos < g->n_nodes; pos++){
+		struct graph_node_s * const node = &g->nodes[g->order[pos]];
+		if(node->n_in == 0){
+			node->in_len = AUDIO_BLOCKSIZE;
+		}else{
+			node->in_len = g->nodes[node->src_node[0]].out_len;
+		}
+		for(port = 0; port < node->n_in; port++){
+			struct graph_node_s * const src = &g->nodes[node->src_node[port]];
+			if(src->out_len != node->in_len){
+				return false;
+			}
+			src->last_use = pos;
+		}
+		if((node->in_len * node->rate_num) % node->rate_den != 0){
+			return false;
+		}
+		node->out_len = node->in_len * node->rate_num / node->rate_den;
+		node->last_use = pos;
+	}
+
+	/* Place the output buffers in the pool in schedule order. A buffer is live
+	 * from the position of its node up to and including its last use, and is
+	 * placed at the lowest offset not overlapping any live buffer. */
+	g->pool_used = 0;
+	for(pos = 0; pos < g->n_nodes; pos++){
+		struct graph_node_s * const node = &g->nodes[g->order[pos]];
+		for(port = 0; port < node->n_out; port++){
+			int_fast32_t offset = 0;
+			bool overlap;
+			do{
+				overlap = false;
+				for(m = 0; m < g->n_nodes; m++){
+					const struct graph_node_s * const other = &g->nodes[m];
+					if(sched_pos[m] > pos || other->last_use < pos){
+						continue;
+					}
+					const uint_fast8_t n_placed = (other == node) ? port : other->n_out;
+					uint_fast8_t other_port;
+					for(other_port = 0; other_port < n_placed; other_port++){
+						const int_fast32_t start = other->out_offset[other_port];
+						const int_fast32_t end = start + other->out_len;
+						if(offset < end && start < offset + node->out_len){
+							//Retry just past the overlapping buffer
+							offset = end;
+							overlap = true;
+						}
+					}
+				}
+			}while(overlap);
+			node->out_offset[port] = offset;
+			if(offset + node->out_len > g->pool_used){
+				g->pool_used = offset + node->out_len;
+			}
+		}
+	}
+	if(g->pool_used > g->pool_len){
+		return false;
+	}
+
+	//Resolve all buffer pointers once, so running the graph is a plain loop
+	for(n = 0; n < g->n_nodes; n++){
+		struct graph_node_s * const node = &g->nodes[n];
+		for(port = 0; port < node->n_out; port++){
+			node->out[port] = &g->pool[node->out_offset[port]];
+		}
+	}
+	for(n = 0; n < g->n_nodes; n++){
+		struct graph_node_s * const node = &g->nodes[n];
+		for(port = 0; port < node->n_in; port++){
+			node->inp[port] = g->nodes[node->src_node[port]].out[node->src_port[port]];
+		}
+	}
+	g->compiled = true;
+	return true;
+}
+
+void graph_run(const struct graph_s * const g){
+	if(!g->compiled){
+		return;
+	}
+	int_fast8_t pos;
+	for(pos = 0; pos < g->n_nodes; pos++){
+		const struct graph_node_s * const node = &g->nodes[g->order[pos]];
+		node->fn(node->ctx, node->inp, node->out, node->n_in ? node->in_len : node->out_len);
+	}
+}
+
+void graph_fn_microphone(void * ctx, const float * const * inp, float * const * out, int_fast32_t len){
+	blocks_sources_microphone(out[0]);
+}
+
+void graph_fn_waveform(void * ctx, const float * const * inp, float * const * out, int_fast32_t len){
+	blocks_sources_waveform(out[0]);
+}
+
+void graph_fn_leftout(void * ctx, const float * const * inp, float * const * out, int_fast32_t len){
+	blocks_sinks_leftout((float *) inp[0]);
+}
+
+void graph_fn_rightout(void * ctx, const float * const * inp, float * const * out, int_fast32_t len){
+	blocks_sinks_rightout((float *) inp[0]);
+}
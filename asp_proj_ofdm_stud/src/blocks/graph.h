@@ -0,0 +1,123 @@
+/** @file Static block graph scheduler.
+ * Instead of hand-wiring sources, processing and sinks with stack arrays in
+ * every audio callback, the blocks of a pipeline can be added as nodes of a
+ * graph and their ports connected. Compiling the graph orders the nodes
+ * topologically and places every output buffer in a shared memory pool. A
+ * buffer only occupies the pool from the node writing it until the last node
+ * reading it, so buffers whose lifetimes do not overlap share memory. Running
+ * the graph then calls each node once per audio block, in order.
+ *
+ * Every node has a rate ratio rate_num/rate_den, the number of output samples
+ * per input sample. Buffer lengths follow from the ratios along the graph,
+ * starting from AUDIO_BLOCKSIZE samples per source output, so a multi-rate
+ * section (for example upsampled by 8 and then decimated by 8) simply runs on
+ * longer buffers within the same callback. */
+
+#ifndef GRAPH_H_
+#define GRAPH_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @brief Maximum number of nodes in a graph */
+#define GRAPH_MAX_NODES		(16)
+
+/** @brief Maximum number of input or output ports of a single node */
+#define GRAPH_MAX_PORTS		(4)
+
+/** @brief Processing function of a node
+ * @param ctx	The context pointer given when the node was added
+ * @param inp	Pointers to the input buffers, one per input port
+ * @param out	Pointers to the output buffers, one per output port. Output
+ * 				buffers never overlap the input buffers of the same node.
+ * @param len	Length of each input buffer, or of each output buffer for
+ * 				nodes without inputs [samples] */
+typedef void (*graph_fn_t)(void * ctx, const float * const * inp, float * const * out, int_fast32_t len);
+
+/** @brief A single node of a graph */
+struct graph_node_s {
+	graph_fn_t fn;								//!<- Processing function
+	void * ctx;									//!<- Context pointer passed to fn
+	uint_fast8_t n_in;							//!<- Number of input ports
+	uint_fast8_t n_out;							//!<- Number of output ports
+	uint_fast16_t rate_num;						//!<- Output samples per rate_den input samples
+	uint_fast16_t rate_den;						//!<- Input samples per rate_num output samples
+	int_fast8_t src_node[GRAPH_MAX_PORTS];		//!<- Node connected to each input port, negative if unconnected
+	int_fast8_t src_port[GRAPH_MAX_PORTS];		//!<- Output port of src_node connected to each input port
+	int_fast32_t in_len;						//!<- Length of each input buffer [samples]
+	int_fast32_t out_len;						//!<- Length of each output buffer [samples]
+	int_fast32_t out_offset[GRAPH_MAX_PORTS];	//!<- Offset of each output buffer in the pool [samples]
+	const float * inp[GRAPH_MAX_PORTS];			//!<- Input buffers, valid once compiled
+	float * out[GRAPH_MAX_PORTS];				//!<- Output buffers, valid once compiled
+	int_fast8_t last_use;						//!<- Last position in the schedule reading any output of this node
+};
+
+/** @brief Memory element for a block graph */
+struct graph_s {
+	struct graph_node_s nodes[GRAPH_MAX_NODES];	//!<- All nodes, in the order they were added
+	int_fast8_t order[GRAPH_MAX_NODES];			//!<- Node indices in execution order, valid once compiled
+	int_fast8_t n_nodes;						//!<- Number of nodes added
+	float * pool;								//!<- Memory pool for all buffers
+	int_fast32_t pool_len;						//!<- Length of pool [samples]
+	int_fast32_t pool_used;						//!<- Pool length required by the compiled graph [samples]
+	bool compiled;								//!<- True if the graph has been compiled successfully
+};
+
+/** @brief Initializes an empty graph
+ * @param g			The graph to initialize
+ * @param pool		Memory pool to place all buffers in
+ * @param pool_len	The length of pool [samples] */
+void graph_init(struct graph_s * const g, float * const pool, const int_fast32_t pool_len);
+
+/** @brief Adds a node to a graph
+ * @param g			The graph to add the node to
+ * @param fn		The processing function of the node
+ * @param ctx		Context pointer passed to fn on every call
+ * @param n_in		Number of input ports, at most GRAPH_MAX_PORTS
+ * @param n_out		Number of output ports, at most GRAPH_MAX_PORTS
+ * @param rate_num	Numerator of the rate ratio, for example R for an upsampler by R
+ * @param rate_den	Denominator of the rate ratio, for example R for a decimator by R
+ * @return The index of the new node, or a negative value on error */
+int_fast8_t graph_add_node(struct graph_s * const g,
+		const graph_fn_t fn,
+		void * const ctx,
+		const uint_fast8_t n_in,
+		const uint_fast8_t n_out,
+		const uint_fast16_t rate_num,
+		const uint_fast16_t rate_den);
+
+/** @brief Connects an output port of one node to an input port of another.
+ * An output port may be connected to any number of input ports, while each
+ * input port is connected to exactly one output port.
+ * @return True on success, false if any node or port index is invalid */
+bool graph_connect(struct graph_s * const g,
+		const int_fast8_t src_node,
+		const uint_fast8_t src_port,
+		const int_fast8_t dst_node,
+		const uint_fast8_t dst_port);
+
+/** @brief Orders the nodes of a graph and places all buffers in the pool.
+ * The required pool length is stored in pool_used even if the pool is too small.
+ * @return True on success, false if an input is unconnected, the graph has a
+ * cycle, the inputs of a node differ in length, a rate ratio does not give an
+ * integer buffer length, or the pool is too small */
+bool graph_compile(struct graph_s * const g);
+
+/** @brief Runs every node of a compiled graph once, in order */
+void graph_run(const struct graph_s * const g);
+
+/** @brief Node function writing the microphone input to its single output.
+ * The node must run at the audio sample rate, as must the other node
+ * functions below. */
+void graph_fn_microphone(void * ctx, const float * const * inp, float * const * out, int_fast32_t len);
+
+/** @brief Node function writing the stored waveform to its single output */
+void graph_fn_waveform(void * ctx, const float * const * inp, float * const * out, int_fast32_t len);
+
+/** @brief Node function sending its single input to the left output */
+void graph_fn_leftout(void * ctx, const float * const * inp, float * const * out, int_fast32_t len);
+
+/** @brief Node function sending its single input to the right output */
+void graph_fn_rightout(void * ctx, const float * const * inp, float * const * out, int_fast32_t len);
+
+#endif /* GRAPH_H_ */
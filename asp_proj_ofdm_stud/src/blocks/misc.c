@@ -2,6 +2,7 @@
 #include <math.h>
 #include "config.h"
 #include "arm_math.h"
+#include "backend/hw/headphone.h"
 
 void misc_envelope_init(struct misc_envelope_s * const s,
 		const float amb_fc,
@@ -24,7 +25,8 @@ void misc_envelope_init(struct misc_envelope_s * const s,
 		net_offset = -(tot_siglen-1);
 	}
 
-	s->filt_k = M_TWOPI * (amb_fc / (1.0f * AUDIO_SAMPLE_RATE)) / (M_TWOPI * (amb_fc / (1.0f * AUDIO_SAMPLE_RATE)) + 1);
+	const float fs = audio_get_sample_rate();
+	s->filt_k = M_TWOPI * (amb_fc / fs) / (M_TWOPI * (amb_fc / fs) + 1);
 	s->tot_siglen = tot_siglen;
 	s->sig_offset = net_offset;
 	s->trigd = false;
@@ -44,7 +46,7 @@ void misc_envelope_init(struct misc_envelope_s * const s,
 	arm_fill_f32(fillval, outdata, tot_siglen);
 }
 
-void misc_envelope_process(struct misc_envelope_s * const s, float * const inp, bool trig_enbl){
+void misc_envelope_process(struct misc_envelope_s * const s, const float * const inp, bool trig_enbl){
 	int_fast32_t i;
 	const float filt_k = s->filt_k;
 	for(i = 0; i < AUDIO_BLOCKSIZE; i++){
@@ -120,3 +122,58 @@ void misc_queuedbuf_process(struct misc_queuedbuf_s * const s, float * out, cons
 		arm_fill_f32(padval, &out[queued_elems_left], pad_elems);
 	}
 }
+
+void misc_delayline_init(struct misc_delayline_s * const s,
+		float * const buf,
+		const uint_fast32_t len,
+		const float delay,
+		const float depth,
+		const float lfo_freq,
+		const float dry,
+		const float wet){
+	//The interpolation reads one sample past the integer delay, so the delay must not exceed len-2
+	const float max_delay = len - 2;
+	s->delay = MIN(MAX(delay, 0.0f), max_delay);
+	s->depth = MIN(MAX(depth, 0.0f), MIN(s->delay, max_delay - s->delay));
+	s->buf = buf;
+	s->len = len;
+	s->wr_idx = 0;
+	s->lfo_freq = lfo_freq;
+	s->lfo_phase = 0.0f;
+	s->dry = dry;
+	s->wet = wet;
+
+	arm_fill_f32(0.0f, buf, len);
+}
+
+void misc_delayline_process(struct misc_delayline_s * const s, const float * const inp, float * const out){
+	const uint_fast32_t mask = s->len - 1;
+	float * const buf = s->buf;
+	uint_fast32_t wr_idx = s->wr_idx;
+
+	/* Evaluate the LFO at the block edges only and sweep the delay linearly
+	 * in between, which is indistinguishable from a per-sample evaluation at
+	 * LFO frequencies of a few Hz */
+	const float delay_start = s->delay + s->depth * arm_sin_f32(M_TWOPI * s->lfo_phase);
+	s->lfo_phase += s->lfo_freq * AUDIO_BLOCKSIZE / audio_get_sample_rate();
+	s->lfo_phase -= floorf(s->lfo_phase);
+	const float delay_end = s->delay + s->depth * arm_sin_f32(M_TWOPI * s->lfo_phase);
+	const float delay_step = (delay_end - delay_start) / AUDIO_BLOCKSIZE;
+
+	int_fast32_t i;
+	float d = delay_start;
+	for(i = 0; i < AUDIO_BLOCKSIZE; i++){
+		buf[wr_idx] = inp[i];
+		/* The delayed sample x[n-d] lies between x[n-k] and x[n-k-1] for
+		 * k = floor(d). The unsigned index arithmetic wraps around modulo the
+		 * (power of two) buffer length */
+		const uint_fast32_t k = (uint_fast32_t) d;
+		const float frac = d - k;
+		const float a = buf[(wr_idx - k) & mask];
+		const float b = buf[(wr_idx - k - 1) & mask];
+		out[i] = s->dry * inp[i] + s->wet * (a + frac * (b - a));
+		wr_idx = (wr_idx + 1) & mask;
+		d += delay_step;
+	}
+	s->wr_idx = wr_idx;
+}
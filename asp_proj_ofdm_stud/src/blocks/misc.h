@@ -61,7 +61,7 @@ void misc_envelope_init(struct misc_envelope_s * const s,
  * @param s			The envelope detector to use
  * @param inp 		Pointer to AUDIO_BLOCKSIZE samples of data
  * @param trig_enbl	Set true to allow detection of a signal, false to only update the ambient noise filter */
-void misc_envelope_process(struct misc_envelope_s * const s, float * const inp, bool trig_enbl);
+void misc_envelope_process(struct misc_envelope_s * const s, const float * const inp, bool trig_enbl);
 
 /** @brief Returns true if an envelope structure s has detected and sampled a signal */
 bool misc_envelope_query_complete(struct misc_envelope_s * const s);
@@ -94,4 +94,47 @@ void misc_queuedbuf_init(struct misc_queuedbuf_s * const s, float * const buf, c
  */
 void misc_queuedbuf_process(struct misc_queuedbuf_s * const s, float * out, const int_fast32_t outlen, const float padval);
 
+/** @brief Memory element for a modulated delay line.
+ * The delay line mixes the input with a delayed copy of itself, where the
+ * delay is swept sinusoidally by a low frequency oscillator (LFO). Fractional
+ * delays are linearly interpolated, so the cost is a few operations per
+ * sample regardless of the delay. Short delays give a flanger, longer delays
+ * with a small depth give a chorus. */
+struct misc_delayline_s {
+	float * buf;					//!<- Pointer to circular buffer of past input samples
+	uint_fast32_t len;				//!<- Length of buf, a power of two
+	uint_fast32_t wr_idx;			//!<- Index in buf to write the next input sample to
+	float delay;					//!<- Center delay [samples]
+	float depth;					//!<- Peak deviation of the delay from the center delay [samples]
+	float lfo_freq;					//!<- LFO frequency [Hz]
+	float lfo_phase;				//!<- LFO phase, in range [0, 1)
+	float dry;						//!<- Gain of the input signal
+	float wet;						//!<- Gain of the delayed signal
+};
+
+/** @brief Initializes/resets a given delay line
+ * @param s			The delay line to initialize
+ * @param buf		Pointer to buffer to store past samples in, cleared on initialization
+ * @param len		The length of buf. NOTE; Must be a power of two!
+ * @param delay		The center delay [samples]. Limited to the range [0, len-2]
+ * @param depth		The peak deviation of the delay from the center delay [samples]. Limited
+ * 					so that the delay stays in the range [0, len-2]
+ * @param lfo_freq	The frequency at which the delay is swept [Hz]
+ * @param dry		Gain of the input signal in the output
+ * @param wet		Gain of the delayed signal in the output */
+void misc_delayline_init(struct misc_delayline_s * const s,
+		float * const buf,
+		const uint_fast32_t len,
+		const float delay,
+		const float depth,
+		const float lfo_freq,
+		const float dry,
+		const float wet);
+
+/** @brief Processes a block of data through a delay line
+ * @param s		The delay line to use
+ * @param inp	Pointer to AUDIO_BLOCKSIZE samples of input data
+ * @param out	Pointer to AUDIO_BLOCKSIZE samples of output data, may not overlap inp */
+void misc_delayline_process(struct misc_delayline_s * const s, const float * const inp, float * const out);
+
 #endif /* MISC_H_ */
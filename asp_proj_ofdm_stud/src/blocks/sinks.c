@@ -5,6 +5,9 @@
 float left_buf[AUDIO_BLOCKSIZE];
 float right_buf[AUDIO_BLOCKSIZE];
 
+/** @brief The sink capturing the outputs, if any */
+static struct blocks_file_sink_s * volatile capture_sink = NULL;
+
 /** @brief Copy AUDIO_BLOCKSIZE samples to the left output buffer */
 void blocks_sinks_leftout(float * data){
 	arm_copy_f32(data, left_buf, AUDIO_BLOCKSIZE);
@@ -15,6 +18,17 @@ void blocks_sinks_rightout(float * data){
 	arm_copy_f32(data, right_buf, AUDIO_BLOCKSIZE);
 }
 
+void blocks_sinks_file_attach(struct blocks_file_sink_s * sink){
+	capture_sink = sink;
+}
+
+void blocks_sinks_update(void){
+	struct blocks_file_sink_s * const sink = capture_sink;
+	if(sink){
+		blocks_file_sink_write(sink, left_buf, right_buf, AUDIO_BLOCKSIZE);
+	}
+}
+
 float * blocks_sinks_leftout_ptr(void){
 	return left_buf;
 }
@@ -3,12 +3,24 @@
 #ifndef SINKS_H_
 #define SINKS_H_
 
+#include "file.h"
+
 /** @brief Copy AUDIO_BLOCKSIZE samples of data to the left output buffer */
 void blocks_sinks_leftout(float * data);
 
 /** @brief Copy AUDIO_BLOCKSIZE samples of data to the right output buffer */
 void blocks_sinks_rightout(float * data);
 
+/** @brief Captures the outputs to a file.
+ * Every audio block, the left output (and the right output for a sink with
+ * two channels) is appended to sink, see blocks/file.h.
+ * @param sink	The sink to write to, or NULL to stop capturing */
+void blocks_sinks_file_attach(struct blocks_file_sink_s * sink);
+
+/** @brief Appends the outputs of the current audio block to the attached sink, if any.
+ * To be called by the backend subsystem only, after main_audio_callback. */
+void blocks_sinks_update(void);
+
 /** @brief Returns a pointer to the buffer for the left output. */
 float * blocks_sinks_leftout_ptr(void);
 /** @brief Returns a pointer to the buffer for the right output */
@@ -5,6 +5,7 @@
 #include "util.h"
 #include "waveform.h"
 #include "arm_math.h"
+#include "file.h"
 
 /** @brief One period of the secret "mystery" disturbance signal */
 #if AUDIO_SAMPLE_RATE == 48000
@@ -28,6 +29,12 @@ float cos_ang = 0;
 /** @brief The current frequency to use for sine/cosine outputs, default to 1kHz */
 float trig_freq = 1e3;
 
+/** @brief The file replayed in place of the microphone, if any, and its samples for the current block */
+static struct blocks_file_s * volatile replay_file = NULL;
+static struct blocks_file_s * replay_active = NULL;
+static float replay_block[AUDIO_BLOCKSIZE];
+static bool replay_done = false;
+
 void blocks_sources_zeros(float * sample_block){
 	arm_fill_f32(0.0f, sample_block, AUDIO_BLOCKSIZE);
 }
@@ -45,7 +52,7 @@ void blocks_sources_sin(float * sample_block){
 	float ang = sin_ang;
 	volatile float freq;	//Declare volatile to ensure the math operations are not re-ordered into the atomic block
 	ATOMIC(freq = trig_freq);
-	const float delta_ang = M_TWOPI * freq / AUDIO_SAMPLE_RATE;
+	const float delta_ang = M_TWOPI * freq / audio_get_sample_rate();
 	for(i = 0; i < AUDIO_BLOCKSIZE; i++){
 		sample_block[i] = arm_sin_f32(ang);
 		ang += delta_ang;
@@ -60,7 +67,7 @@ void blocks_sources_cos(float * sample_block){
 	float ang = sin_ang;
 	volatile float freq;	//Declare volatile to ensure the math operations are not re-ordered into the atomic block
 	ATOMIC(freq = trig_freq);
-	const float delta_ang = M_TWOPI * freq / AUDIO_SAMPLE_RATE;
+	const float delta_ang = M_TWOPI * freq / audio_get_sample_rate();
 	for(i = 0; i < AUDIO_BLOCKSIZE; i++){
 		sample_block[i] = arm_cos_f32(ang);
 		ang += delta_ang;
@@ -91,14 +98,33 @@ void blocks_sources_disturbance(float * sample_block){
 }
 
 void blocks_sources_microphone(float * sample_block){
-	arm_copy_f32(processed_micdata, sample_block, AUDIO_BLOCKSIZE);
+	arm_copy_f32((float *) blocks_sources_microphone_ptr(), sample_block, AUDIO_BLOCKSIZE);
+}
+
+const float * blocks_sources_microphone_ptr(void){
+	return replay_active ? replay_block : processed_micdata;
+}
+
+void blocks_sources_file_attach(struct blocks_file_s * file){
+	replay_file = file;
+}
+
+bool blocks_sources_file_done(void){
+	return replay_done;
 }
 
 void blocks_sources_update(void){
 	//Compute the relative change in angle between each sample for the requested frequency
 	volatile float freq;	//Declare volatile to ensure the math operations are not re-ordered into the atomic block
 	ATOMIC(freq = trig_freq);
-	const float delta_ang = M_TWOPI * freq / AUDIO_SAMPLE_RATE;
+	const float delta_ang = M_TWOPI * freq / audio_get_sample_rate();
 	sin_ang += delta_ang * AUDIO_BLOCKSIZE;
 	cos_ang += delta_ang * AUDIO_BLOCKSIZE;
+
+	//Read the replayed samples for this block once, however many times the microphone is read
+	replay_active = replay_file;
+	replay_done = false;
+	if(replay_active){
+		replay_done = blocks_file_read(replay_active, replay_block, AUDIO_BLOCKSIZE) == 0;
+	}
 }
@@ -3,6 +3,8 @@
 #ifndef SOURCES_H_
 #define SOURCES_H_
 
+#include "file.h"
+
 /** @brief Peak magnitude of amplitude of mystery signal */
 #define DIST_MAXAMP 0.1f
 
@@ -20,10 +22,28 @@ void blocks_sources_update(void);
 void blocks_sources_disturbance(float * sample_block);
 
 /** @brief Gets the AUDIO_BLOCKSIZE oldest unread microphone samples
- * @return Pointer to the AUDIO_BLOCKSIZE oldest unread microphone samples,
- * scaled to the range [-1, 1]. */
+ * @param sample_block Pointer to array of AUDIO_BLOCKSIZE floats to write the
+ * oldest unread microphone samples to, scaled to the range [-1, 1]. */
 void blocks_sources_microphone(float * sample_block);
 
+/** @brief Gets a read-only view of the AUDIO_BLOCKSIZE oldest unread microphone
+ * samples, avoiding the copy made by blocks_sources_microphone.
+ * @return Pointer to the AUDIO_BLOCKSIZE oldest unread microphone samples,
+ * scaled to the range [-1, 1]. The data is only valid until main_audio_callback
+ * returns. */
+const float * blocks_sources_microphone_ptr(void);
+
+/** @brief Replays a file in place of the microphone.
+ * From the next audio block on, blocks_sources_microphone and
+ * blocks_sources_microphone_ptr return the next AUDIO_BLOCKSIZE samples of
+ * file instead of the microphone input, see blocks/file.h.
+ * @param file	The file to replay, or NULL to return to the microphone */
+void blocks_sources_file_attach(struct blocks_file_s * file);
+
+/** @brief Returns true if a replayed file has no samples left for the current audio block.
+ * Returns false while no file is attached or for a looping file. */
+bool blocks_sources_file_done(void);
+
 /** @brief Gets the AUDIO_BLOCKSIZE next samples from the stored waveform */
 void blocks_sources_waveform(float * sample_block);
 
@@ -11,3 +11,10 @@ void windows_blackman(float * coeffs, uint_fast32_t len){
 		*(coeffs + i) = a0 - a1 * cos(2.0f * M_PI * i / (len - 1)) + a2 * cos(4.0f * M_PI * i / (len - 1));
 	}
 }
+
+void windows_hann_periodic(float * coeffs, uint_fast32_t len){
+	uint_fast32_t i;
+	for(i = 0; i < len; i++){
+		*(coeffs + i) = 0.5f - 0.5f * cos(2.0f * M_PI * i / len);
+	}
+}
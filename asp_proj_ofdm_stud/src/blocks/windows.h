@@ -14,4 +14,13 @@
  * @param len		The length of the window */
 void windows_blackman(float * coeffs, uint_fast32_t len);
 
+/** @brief Generates the coefficients for a periodic hann window
+ * Writes the coefficients corresponding to a window of the form
+ * w(n) = 1/2 - 1/2*cos(2*pi*n/N)
+ * where N is the length of the window. Windows shifted by N/2 samples sum to
+ * one, which makes the window suitable for overlap-add processing.
+ * @param coeffs	Array of len floats
+ * @param len		The length of the window */
+void windows_hann_periodic(float * coeffs, uint_fast32_t len);
+
 #endif /* SRC_WINDOWS_H_ */
@@ -58,6 +58,9 @@
  * Due to hardware limitations, the sample-rate must be evenly divisible by
  * 48kHz and no less than 16kHz. This gives a total of three valid sample-rates;
  * 48kHz, 24kHz, and 16kHz.
+ * This is the sample rate the system starts at. It can be changed at run time
+ * with audio_set_sample_rate, so code that depends on the sample rate should
+ * use audio_get_sample_rate rather than this constant.
  * Note that higher sample rates will reduce the computational capacity
  * available as follows;
  * 	48kHz approx. 60% CPU time available for application-level code
@@ -85,6 +88,9 @@
 #error Invalid system mode selected
 #endif
 
+/** @brief Evaluates to true if fs is one of the valid sample rates [Hz] */
+#define AUDIO_SAMPLE_RATE_IS_VALID(fs)	((fs) == 16000 || (fs) == 24000 || (fs) == 48000)
+
 /** @brief Block size for each speaker callback function.
  * Speaker callbacks will expect this many samples to be present on each call.
  * Larger values will increase the net audio path latency, but result in lower
@@ -137,6 +143,11 @@
  * Valid range is integers 0 - 100 */
 #define MIC_VOLUME					(100)
 
+/** @brief Set to 1 to convert the microphone signal with ST's closed
+ * PDM_Filter_64_LSB from lib_ext instead of the pdm_fir decimator, to compare
+ * the "pdm decimate" profile scope and the microphone levels of both. */
+#define MIC_PDM_LIBPDMFILTER		(0)
+
 /** @brief Set to 1 or -1 to control the net sign through the speakers and microphone */
 #define SYS_SIGN					(-1)
 
@@ -163,6 +174,32 @@
 /** @brief Number of elements for debug USART recieve buffer */
 #define DEBUG_USART_RX_BUF_LEN		(16)
 
+/** @brief Number of 16-bit samples in the ring for binary captures, see
+ * backend/capture/capture.h. Must be a power of two and hold the longest
+ * capture, or zero to drop all captures without allocating a ring. Only the
+ * OFDM lab captures signals, so the ring is only allocated in SYSMODE_OFDM,
+ * where it holds one envelope frame or LAB_OFDM_CAPTURE_MIC_BLOCKS
+ * microphone blocks. */
+#ifndef CAPTURE_RING_SAMPLES
+#if SYSMODE == SYSMODE_OFDM
+#define CAPTURE_RING_SAMPLES		(16384)
+#else
+#define CAPTURE_RING_SAMPLES		(0)
+#endif
+#endif
+
+/** @brief Set to 1 to format DLOG messages on the PC instead of with printf,
+ * see backend/dlog/dlog.h. The output must then be read with
+ * tools/dlog_decode.py rather than a terminal program. May also be set with
+ * -DDLOG_DEFERRED=1 in the build_flags of platformio.ini. */
+#ifndef DLOG_DEFERRED
+#define DLOG_DEFERRED				(0)
+#endif
+
+/** @brief Number of 16-bit elements in the ring of deferred messages. Must be
+ * a power of two; a message takes 4 elements plus 2 per numeric argument. */
+#define DLOG_RING_LEN				(2048)
+
 /** @brief Message to print at startup */
 #define DEBUG_STARTUPMSG 			"\n\nCompiled on " __DATE__ " at " __TIME__" with;"	\
 "\n\tBackend version "xstr(BACKEND_VERSION)												\
@@ -200,10 +237,19 @@
 /** @brief LED to use for system-alive indiation */
 #define IDLE_LED					(board_led_green)
 
-/** @brief The time duration each block corresponds to */
+/** @brief The time duration each block corresponds to at the startup sample rate */
 #define AUDIO_BLOCKTIME_s 			((AUDIO_BLOCKSIZE*1.0f)/(AUDIO_SAMPLE_RATE*1.0f))
 
 /** @brief Number of samples (left and right) for each output DMA buffer */
 #define OUTRAW_BUFFER_SAMPLES 		(AUDIO_BLOCKSIZE*2)
 
+/** @brief Number of AUDIO_BLOCKSIZE output blocks in the circular output DMA buffer.
+ * Must be even, as half of the blocks are released at a time. Processing of a
+ * single block may take up to AUDIO_OUT_BUFFERS/2 block periods, less the time
+ * of the other blocks filled in the same half of the ring, as long as the
+ * average processing time per block is below one block period, at the cost of
+ * an input to output latency of about AUDIO_OUT_BUFFERS blocks. Set to 2 for
+ * the lowest latency. */
+#define AUDIO_OUT_BUFFERS			(4)
+
 #endif /* SRC_CONFIG_H_ */
@@ -6,30 +6,42 @@
 #include "blocks/sinks.h"
 #include "blocks/gen.h"
 #include "blocks/windows.h"
+#include "blocks/misc.h"
+#include "blocks/graph.h"
 #include "util.h"
 #include "config.h"
 #include "backend/systime/systime.h"
+#include "backend/hw/headphone.h"
 #include "backend/printfn/printfn.h"
 #include "arm_const_structs.h"
 
 
 #if SYSMODE == SYSMODE_TEST1
 
+/** @brief Block graph routing the waveform to the left output and the microphone to the right output */
+struct graph_s test1_graph;
+/** @brief Buffer memory for test1_graph */
+float test1_pool[2*AUDIO_BLOCKSIZE];
+
 void example_test1_init(void){
-	//No setup needed
+	//Declare the blocks and how they are connected
+	graph_init(&test1_graph, test1_pool, NUMEL(test1_pool));
+	const int_fast8_t mic = graph_add_node(&test1_graph, graph_fn_microphone, NULL, 0, 1, 1, 1);
+	const int_fast8_t wave = graph_add_node(&test1_graph, graph_fn_waveform, NULL, 0, 1, 1, 1);
+	const int_fast8_t left = graph_add_node(&test1_graph, graph_fn_leftout, NULL, 1, 0, 1, 1);
+	const int_fast8_t right = graph_add_node(&test1_graph, graph_fn_rightout, NULL, 1, 0, 1, 1);
+	graph_connect(&test1_graph, wave, 0, left, 0);
+	graph_connect(&test1_graph, mic, 0, right, 0);
+
+	//Order the blocks and place their buffers
+	if(!graph_compile(&test1_graph)){
+		halt_error("Invalid block graph\n");
+	}
 }
 
 void example_test1(void){
-	//Allocate space for the microphone and waveform samples.
-	float micdata[AUDIO_BLOCKSIZE];
-	float wavedata[AUDIO_BLOCKSIZE];
-	//Write AUDIO_BLOCKSIZE samples to the microphone and waveform buffer
-	blocks_sources_microphone(micdata);
-	blocks_sources_waveform(wavedata);
-
-	//Send the waveform data to the left output and the microphone data to the right output without any processing
-	blocks_sinks_leftout(wavedata);
-	blocks_sinks_rightout(micdata);
+	//Run the microphone and waveform sources, then the left and right output sinks
+	graph_run(&test1_graph);
 }
 #endif
 
@@ -55,20 +67,15 @@ bool audio_src_mic = true;
 /** @breif State-keeping variable for the current bit-crusher depth */
 int_fast8_t bitcrush_depth = BITCRUSH_MAXDEPTH;
 
-/* Implement a flanger using a time-varying FIR filter.
- * This is very inefficient as the coefficients are almost only zero, but as we
- * have plenty of procssing power this is a simple way to implement this. */
-
-//Set up the flanger filter
-#define FLANGER_TAPS		(256)	//The maximum time delay in the flanger will be AUDIO_SAMPLERATE / FLANGER_TAPS
-/* Note that the fir filter function assumes coefficients are stored in
- * time-reversed order, so we want the last element to be constantly one and
- * the other nonzero coeffient to ramp linearly across the entire vector */
-float flanger_coeffs[FLANGER_TAPS] = {[0 ... (FLANGER_TAPS - 2)] = 0.0f, [FLANGER_TAPS - 1] = 0.5f};
-float flanger_state[FLANGER_TAPS + AUDIO_BLOCKSIZE - 1];
-arm_fir_instance_f32 flanger_s;
-int_fast16_t flanger_delay_idx = FLANGER_TAPS - 2;	//State-keeping variable for the nonzero delay coefficient in flanger_coeffs
-bool flanger_neg = true;							//The flanging direction (negative -> nonzero coefficient moves from end of flanger_coeffs to start)
+/* Implement a flanger using a delay line, mixing the input with a copy of
+ * itself delayed by a slowly swept amount */
+
+//Set up the flanger delay line
+#define FLANGER_MAX_DELAY	(255.0f)	//Maximum time delay in the flanger [samples]
+#define FLANGER_LFO_FREQ	(0.125f)	//Frequency at which the delay is swept between zero and FLANGER_MAX_DELAY [Hz]
+#define FLANGER_BUFLEN		(512)		//Delay line length, a power of two exceeding FLANGER_MAX_DELAY + 1
+float flanger_buf[FLANGER_BUFLEN];
+struct misc_delayline_s flanger_s;
 
 /** @brief Center carrier frequency for ring modulator */
 #define RING_MOD_CARRIER_CENTER		(750.0f)
@@ -93,7 +100,8 @@ void example_test2_btnpress(void){
 }
 
 void example_test2_init(void){
-	arm_fir_init_f32(&flanger_s, FLANGER_TAPS, flanger_coeffs, flanger_state, AUDIO_BLOCKSIZE);
+	BUILD_BUG_ON(!ISPOW2(FLANGER_BUFLEN) || FLANGER_BUFLEN < FLANGER_MAX_DELAY + 2);
+	misc_delayline_init(&flanger_s, flanger_buf, FLANGER_BUFLEN, FLANGER_MAX_DELAY/2, FLANGER_MAX_DELAY/2, FLANGER_LFO_FREQ, 0.5f, 0.5f);
 	blocks_sources_trig_setfreq(ring_mod_carrier);
 	printf("Usage guide;\n"
 			"Press the user button to switch between audio sources.\n"
@@ -161,23 +169,7 @@ void example_test2(void){
 		arm_copy_f32(inpdata, output, AUDIO_BLOCKSIZE);
 		break;
 	case test2_effect_flanger:
-		arm_fir_f32(&flanger_s, inpdata, output, AUDIO_BLOCKSIZE);
-		flanger_coeffs[flanger_delay_idx] = 0.0f;
-
-		//Update the flanger index
-		if(flanger_neg){
-			//For the smoothest flanger modulation only move the flanger delay by one index per call
-			if(--flanger_delay_idx <= 0){
-				flanger_neg = false;
-			}
-		}else{
-			if(++flanger_delay_idx >= FLANGER_TAPS-2){
-				flanger_neg = true;
-			}
-		}
-
-		//Update the flanger filter
-		flanger_coeffs[flanger_delay_idx] = 0.5f;
+		misc_delayline_process(&flanger_s, inpdata, output);
 		break;
 	case test2_effect_ringmod:
 	{
@@ -241,100 +233,89 @@ float test3_lp_filt_state[TEST3_LP_TAPS + AUDIO_BLOCKSIZE - 1];
 arm_fir_instance_f32 test3_lp_filt;
 
 //Frequency shift FFT setup
-//Note; only lengths of 16, 32, 64, ... , 4096 samples are supported by cfft
+//Note; only the real FFT lengths generated in backend/fft_tables are available
 #define TEST3_FFT_LEN AUDIO_BLOCKSIZE	//For simplicity, force the FFT length to be equal to the audio block size
+#define TEST3_HOP (TEST3_FFT_LEN/2)		//Frames overlap by half their length, over which the hann window sums to one
+#define TEST3_OVERLAP (TEST3_FFT_LEN - TEST3_HOP)
 
 #define TEST3_FREQSHIFT_BINS 5	//Number of bins to shift DFT result up
 
-#if TEST3_FFT_LEN == 16
-const arm_cfft_instance_f32 *cfft_instance_hndl = &arm_cfft_sR_f32_len16;
-#elif TEST3_FFT_LEN == 32
-const arm_cfft_instance_f32 *cfft_instance_hndl = &arm_cfft_sR_f32_len32;
-#elif TEST3_FFT_LEN == 64
-const arm_cfft_instance_f32 *cfft_instance_hndl = &arm_cfft_sR_f32_len64;
-#elif TEST3_FFT_LEN == 128
-const arm_cfft_instance_f32 *cfft_instance_hndl = &arm_cfft_sR_f32_len128;
-#elif TEST3_FFT_LEN == 256
-const arm_cfft_instance_f32 *cfft_instance_hndl = &arm_cfft_sR_f32_len256;
-#elif TEST3_FFT_LEN == 512
-const arm_cfft_instance_f32 *cfft_instance_hndl = &arm_cfft_sR_f32_len512;
-#elif TEST3_FFT_LEN == 1024
-const arm_cfft_instance_f32 *cfft_instance_hndl = &arm_cfft_sR_f32_len1024;
-#elif TEST3_FFT_LEN == 2048
-const arm_cfft_instance_f32 *cfft_instance_hndl = &arm_cfft_sR_f32_len2048;
-#elif TEST3_FFT_LEN == 4096
-const arm_cfft_instance_f32 *cfft_instance_hndl = &arm_cfft_sR_f32_len4096;
-#else
-#error invalid FFT length requested!
-#endif
+arm_rfft_fast_instance_f32 test3_rfft;
 
 //Allocate space for window coefficients
 float window[TEST3_FFT_LEN];
 
+//The last TEST3_OVERLAP input samples followed by the current block
+float test3_inbuf[TEST3_OVERLAP + AUDIO_BLOCKSIZE];
+//Overlap-add accumulator, the first AUDIO_BLOCKSIZE samples are output each block
+float test3_outbuf[TEST3_OVERLAP + AUDIO_BLOCKSIZE];
+//Sign of the current frame, see example_test3
+float test3_frame_sign;
+
+//Spectrum of the most recent frame, used to print the peak frequency
+float fftdata[TEST3_FFT_LEN];
+
 systime_t print_delay;
 
 void example_test3_init(void){
 	arm_fir_init_f32(&test3_lp_filt, TEST3_LP_TAPS, test3_lp_filt_coeffs, test3_lp_filt_state, AUDIO_BLOCKSIZE);
-	windows_blackman(window, NUMEL(window));
+	if(arm_rfft_fast_init_f32(&test3_rfft, TEST3_FFT_LEN) != ARM_MATH_SUCCESS){
+		printf("Real FFT length %d not available\n", TEST3_FFT_LEN);
+	}
+	windows_hann_periodic(window, NUMEL(window));
+	arm_fill_f32(0.0f, test3_inbuf, NUMEL(test3_inbuf));
+	arm_fill_f32(0.0f, test3_outbuf, NUMEL(test3_outbuf));
+	test3_frame_sign = 1.0f;
 	print_delay = systime_get_delay(0);
 }
 
 void example_test3(void){
 	BUILD_BUG_ON(TEST3_FREQSHIFT_BINS < 0);	//Require shift to be up in frequency
 	BUILD_BUG_ON(TEST3_LP_RELCUTOFF > (1.0f - (1.0f*TEST3_FREQSHIFT_BINS)/TEST3_FFT_LEN));	//Require shift to be less than the range of the anti-aliasing filter
+	BUILD_BUG_ON(AUDIO_BLOCKSIZE % TEST3_HOP != 0);
 	//Get the microphone data and apply a simple low-pass antialias filter
 	float inpdata[AUDIO_BLOCKSIZE];
 	blocks_sources_microphone(inpdata);
-	float lpdata[AUDIO_BLOCKSIZE];
-	arm_fir_f32(&test3_lp_filt, inpdata, lpdata, AUDIO_BLOCKSIZE);
-
-	//Prepare the data for the DFT
-	//Apply the window function
-	float final_td_data[AUDIO_BLOCKSIZE];
-	arm_mult_f32(lpdata, window, final_td_data, AUDIO_BLOCKSIZE);
-
-
-	//For generality, use the cfft function rather than rfft
-	float fftdata[TEST3_FFT_LEN*2];
-	int_fast32_t i;
-
-	//Set up the complex input to the DFT with a purely real input
-	for(i = 0; i < NUMEL(fftdata); i++){
-		//For each value pair in fftdata, write the real-valued input and a zero imaginary input
-		if(i%2 == 0){
-			fftdata[i] = final_td_data[i/2];
-		}else{
-			fftdata[i] = 0.0f;
+	arm_fir_f32(&test3_lp_filt, inpdata, &test3_inbuf[TEST3_OVERLAP], AUDIO_BLOCKSIZE);
+
+	int_fast32_t offset;
+	for(offset = 0; offset < AUDIO_BLOCKSIZE; offset += TEST3_HOP){
+		//Window the frame, the real FFT uses its input as scratch space so work on a copy
+		float tddata[TEST3_FFT_LEN];
+		arm_mult_f32(&test3_inbuf[offset], window, tddata, TEST3_FFT_LEN);
+
+		//The spectrum of a real signal is hermitian, so only bins [0, fs/2] are computed.
+		//Bin 0 holds the real DC value in fftdata[0] and the real fs/2 value in fftdata[1]
+		arm_rfft_fast_f32(&test3_rfft, tddata, fftdata, 0);
+
+		//Generate the frequency shift by moving bins up, the mirrored bins in [fs/2, fs] follow implicitly.
+		//Bins shifted past fs/2 are dropped, which the anti-aliasing filter makes harmless.
+		float shift_fftdata[TEST3_FFT_LEN];
+		arm_fill_f32(0.0f, shift_fftdata, 2*TEST3_FREQSHIFT_BINS);
+		//A shift of k bins in a frame starting at sample m*TEST3_HOP must also be rotated by
+		//exp(2j*pi*k*m*TEST3_HOP/TEST3_FFT_LEN) to stay in phase with the neighbouring frames.
+		//With half-length hops this is a sign flip on every other frame for odd k
+		arm_scale_f32(fftdata, test3_frame_sign, &shift_fftdata[2*TEST3_FREQSHIFT_BINS], TEST3_FFT_LEN - 2*TEST3_FREQSHIFT_BINS);
+		if(TEST3_FREQSHIFT_BINS > 0){
+			//The former DC bin has no imaginary part, the fs/2 value is dropped
+			shift_fftdata[2*TEST3_FREQSHIFT_BINS + 1] = 0.0f;
 		}
-	}
-
-	//Apply the FFT
-	arm_cfft_f32(cfft_instance_hndl, fftdata, 0, 1);
-
-	float shift_fftdata[TEST3_FFT_LEN*2];
-
-	//Generate the frequency shift, first shift bins corresponding to frequencies in the range [0, fs/2]
-	for(i = 0; i < NUMEL(fftdata)/2; i++){
-		if(i <= TEST3_FREQSHIFT_BINS*2){
-			shift_fftdata[i] = 0.0f;
-		}else{
-			shift_fftdata[i] = fftdata[i - TEST3_FREQSHIFT_BINS*2];
+		if(TEST3_FREQSHIFT_BINS % 2 == 1){
+			test3_frame_sign = -test3_frame_sign;
 		}
-	}
 
-	//Now generate the contents corresponding to [fs/2, fs]
-	for(i = 0; i < NUMEL(shift_fftdata)/2; i++){
-		shift_fftdata[NUMEL(shift_fftdata) - 1 - i] = shift_fftdata[i];
+		//Apply the IFFT and add the frame to the output
+		arm_rfft_fast_f32(&test3_rfft, shift_fftdata, tddata, 1);
+		arm_add_f32(&test3_outbuf[offset], tddata, &test3_outbuf[offset], TEST3_FFT_LEN);
 	}
 
-	//Apply the IFFT
-	arm_cfft_f32(cfft_instance_hndl, shift_fftdata, 1, 1);
-
-	//Finally, take the real component of the IDFT results
 	float output[AUDIO_BLOCKSIZE];
-	for(i = 0; i < NUMEL(output); i++){
-		output[i] = shift_fftdata[2*i];
-	}
+	arm_copy_f32(test3_outbuf, output, AUDIO_BLOCKSIZE);
+
+	//Keep the tail of the input and output for the next block
+	memmove(test3_inbuf, &test3_inbuf[AUDIO_BLOCKSIZE], TEST3_OVERLAP * sizeof(float));
+	memmove(test3_outbuf, &test3_outbuf[AUDIO_BLOCKSIZE], TEST3_OVERLAP * sizeof(float));
+	arm_fill_f32(0.0f, &test3_outbuf[TEST3_OVERLAP], AUDIO_BLOCKSIZE);
 
 	blocks_sinks_leftout(inpdata);
 
@@ -344,16 +325,17 @@ void example_test3(void){
 	if(systime_get_delay_passed(print_delay)){
 		print_delay = systime_get_delay(MS2US(DEBUG_PRINT_PERIOD_ms));
 		//Determine the bin with the maximum amplitude
-		float mag[TEST3_FFT_LEN];
-		arm_cmplx_mag_squared_f32(fftdata, mag, TEST3_FFT_LEN);
+		float mag[TEST3_FFT_LEN/2];
+		arm_cmplx_mag_squared_f32(fftdata, mag, TEST3_FFT_LEN/2);
 		float max_mag;
 		uint32_t idx;
 
-		//Scan through all bins, except the first and last, save the one with the highest magnitude
-		arm_max_f32(mag, TEST3_FFT_LEN, &max_mag, &idx);
+		//Scan through bins [1, fs/2), bin 0 holds the packed DC and fs/2 values
+		arm_max_f32(&mag[1], TEST3_FFT_LEN/2 - 1, &max_mag, &idx);
+		idx++;
 
 		//Print the frequency corresponding to the bin with the maximum amplitude
-		printf("Peak frequency at %f Hz with amplitude %f\n", (1.0f * idx * AUDIO_SAMPLE_RATE) / (TEST3_FFT_LEN), sqrt(max_mag));
+		printf("Peak frequency at %f Hz with amplitude %f\n", (1.0f * idx * audio_get_sample_rate()) / (TEST3_FFT_LEN), sqrt(max_mag));
 	}
 }
 #endif
@@ -375,6 +357,21 @@ bool qpsk_newmsg_g = false;
 float cos_ref[AUDIO_BLOCKSIZE];
 float sin_ref[AUDIO_BLOCKSIZE];
 
+/** @brief Weight of the newest block in the averaged symbol timing metric */
+#define QPSK_TIMING_ALPHA	(0.25f)
+
+/** @brief Number of microphone blocks kept by the receiver */
+#define QPSK_RX_BLOCKS		(4)
+
+/** @brief The last QPSK_RX_BLOCKS microphone blocks, oldest first */
+float qpsk_rx_buf[QPSK_RX_BLOCKS*AUDIO_BLOCKSIZE];
+/** @brief Averaged correlation power for each symbol timing offset modulo the block length */
+float qpsk_timing_metric[AUDIO_BLOCKSIZE];
+/** @brief Start of the current symbol window in qpsk_rx_buf [samples] */
+int_fast32_t qpsk_rx_tau;
+/** @brief If true, the next decision repeats the previous symbol and is skipped */
+bool qpsk_rx_repeat;
+
 systime_t receiver_timer;
 
 /** @brief Enumerated type for indicating a QPSK symbol */
@@ -421,6 +418,9 @@ void example_test4(void){
 		curr_symbol = 0;
 		receiver_timer = systime_get_delay(S2US(QPSK_RX_ENABLETIME_s));
 		enable_receiver = true;
+		arm_fill_f32(0.0f, qpsk_timing_metric, AUDIO_BLOCKSIZE);
+		qpsk_rx_tau = (QPSK_RX_BLOCKS - 1) * AUDIO_BLOCKSIZE / 2;
+		qpsk_rx_repeat = false;
 		printf("Receiver enabled\n");
 	}
 
@@ -484,75 +484,99 @@ void example_test4(void){
 	}
 
 
-	if(enable_receiver && !systime_get_delay_passed(receiver_timer)){
+	if(enable_receiver){
 		if(systime_get_delay_passed(receiver_timer)){
 			enable_receiver = false;
-			printf("Receiver disabled");
+			printf("Receiver disabled\n");
 		}else{
-			/* Monitor the microphone input if the receiver is enabled and try to
-			 * decode the current block as a single symbol.
+			/* Monitor the microphone input if the receiver is enabled and decode
+			 * one symbol per block with a correlator receiver.
 			 *
-			 * Note that this is incredibly crude as we have no guarantee that the
-			 * microphone's data block isn't delayed wrt. the output data block, so we
-			 * may well be processing two halves of symbols. Also, we neglect all forms
-			 * of carrier recovery and phase jitter. */
-
-			float micinp[AUDIO_BLOCKSIZE];
-			blocks_sources_microphone(micinp);
-
-			//Compare the received block with all possible symbols and choose the most likely one
-			float max_pwr = -INFINITY;
-			enum qpsk_sym_e best_sym = QPSK_SYM_NUM;
-			enum qpsk_sym_e sym;
-			for(sym = qpsk_sym_0; sym < QPSK_SYM_NUM; sym++){
-				float candidate_i[AUDIO_BLOCKSIZE];
-				float candidate_q[AUDIO_BLOCKSIZE];
-				float candidate_sig[AUDIO_BLOCKSIZE];
-				/* Again, use the same I/Q encoding map as before
-				 *        Q
-				 *        ^
-				 *        |
-				 *   11   |   01
-				 *        |
-				 * --------------->  I
-				 *        |
-				 *   10   |   00
-				 *        |
-				 */
-				switch(sym){
-				case qpsk_sym_0:
-					arm_scale_f32(cos_ref, M_SQRT1_2, candidate_i, AUDIO_BLOCKSIZE);
-					arm_scale_f32(sin_ref, -M_SQRT1_2, candidate_q, AUDIO_BLOCKSIZE);
-					break;
-				case qpsk_sym_1:
-					arm_scale_f32(cos_ref, M_SQRT1_2, candidate_i, AUDIO_BLOCKSIZE);
-					arm_scale_f32(sin_ref, M_SQRT1_2, candidate_q, AUDIO_BLOCKSIZE);
-					break;
-				case qpsk_sym_2:
-					arm_scale_f32(cos_ref, -M_SQRT1_2, candidate_i, AUDIO_BLOCKSIZE);
-					arm_scale_f32(sin_ref, -M_SQRT1_2, candidate_q, AUDIO_BLOCKSIZE);
-					break;
-				case qpsk_sym_3:
-					arm_scale_f32(cos_ref, -M_SQRT1_2, candidate_i, AUDIO_BLOCKSIZE);
-					arm_scale_f32(sin_ref, M_SQRT1_2, candidate_q, AUDIO_BLOCKSIZE);
-					break;
-				default:
-					//Should never occur
-					break;
-				}
-				//Generate the candidate output signal
-				arm_add_f32(candidate_i, candidate_q, candidate_sig, AUDIO_BLOCKSIZE);
-
-				//Now, compare the recieved input with each of the generated signals and store the best matching result
-				float sig_pwr[AUDIO_BLOCKSIZE];
-				arm_add_f32(candidate_sig, micinp, sig_pwr, AUDIO_BLOCKSIZE);
-				float sig_pwr_abs[AUDIO_BLOCKSIZE];
-				arm_abs_f32(sig_pwr, sig_pwr_abs, AUDIO_BLOCKSIZE);
-				float candidate_pwr = vector_mean(sig_pwr_abs, AUDIO_BLOCKSIZE);
-				if(candidate_pwr > max_pwr){
-					max_pwr = candidate_pwr;
-					best_sym = sym;
+			 * The microphone blocks are not aligned with the transmitted symbols,
+			 * so a window of one symbol is slid across the last few blocks. For
+			 * each window start tau, the window is projected onto the carrier,
+			 *   C(tau) = sum_n x[tau+n] * (cos(w*(tau+n)) - j*sin(w*(tau+n))),
+			 * which for a window covering a single symbol is proportional to I - jQ.
+			 * As each block holds an integer number of carrier periods the
+			 * reference is periodic in the block length, so sliding the window one
+			 * sample only updates C with the sample leaving and the sample entering
+			 * the window. The window start where no symbol change is straddled gives
+			 * the largest correlation power, averaged over blocks.
+			 *
+			 * One block length of window starts centered on the previous estimate
+			 * is searched, which covers every timing offset once. The estimate is
+			 * kept within the middle QPSK_RX_BLOCKS-2 blocks, and is moved by one
+			 * block, losing or repeating a symbol, only if the timing drifts that far. */
+			BUILD_BUG_ON(QPSK_RX_BLOCKS < 4);
+			arm_copy_f32(&qpsk_rx_buf[AUDIO_BLOCKSIZE], qpsk_rx_buf, (QPSK_RX_BLOCKS - 1) * AUDIO_BLOCKSIZE);
+			blocks_sources_microphone(&qpsk_rx_buf[(QPSK_RX_BLOCKS - 1) * AUDIO_BLOCKSIZE]);
+
+			//Correlate the first window, splitting the reference where it wraps around
+			const int_fast32_t tau_first = qpsk_rx_tau - AUDIO_BLOCKSIZE/2;
+			const int_fast32_t ref_first = tau_first % AUDIO_BLOCKSIZE;
+			const int_fast32_t ref_len = AUDIO_BLOCKSIZE - ref_first;
+			float c_re, c_im, c_wrap;
+			arm_dot_prod_f32(&qpsk_rx_buf[tau_first], &cos_ref[ref_first], ref_len, &c_re);
+			arm_dot_prod_f32(&qpsk_rx_buf[tau_first + ref_len], cos_ref, ref_first, &c_wrap);
+			c_re += c_wrap;
+			arm_dot_prod_f32(&qpsk_rx_buf[tau_first], &sin_ref[ref_first], ref_len, &c_im);
+			arm_dot_prod_f32(&qpsk_rx_buf[tau_first + ref_len], sin_ref, ref_first, &c_wrap);
+			c_im = -(c_im + c_wrap);
+
+			int_fast32_t tau, best_tau = tau_first;
+			float best_metric = -INFINITY, best_re = 0.0f, best_im = 0.0f;
+			for(tau = tau_first; tau < tau_first + AUDIO_BLOCKSIZE; tau++){
+				const int_fast32_t ref_idx = tau % AUDIO_BLOCKSIZE;
+				float * const metric = &qpsk_timing_metric[ref_idx];
+				*metric = (1.0f - QPSK_TIMING_ALPHA) * *metric + QPSK_TIMING_ALPHA * (c_re * c_re + c_im * c_im);
+				if(*metric > best_metric){
+					best_metric = *metric;
+					best_tau = tau;
+					best_re = c_re;
+					best_im = c_im;
 				}
+				//Slide the window one sample
+				const float d = qpsk_rx_buf[tau + AUDIO_BLOCKSIZE] - qpsk_rx_buf[tau];
+				c_re += d * cos_ref[ref_idx];
+				c_im -= d * sin_ref[ref_idx];
+			}
+
+			/* A symbol starting at tau has been delayed by tau samples modulo the
+			 * block length, which rotates it by -w*tau. Undo the rotation, which
+			 * also removes most of the carrier phase offset, and decide by
+			 * quadrant using the same I/Q encoding map as before
+			 *        Q
+			 *        ^
+			 *        |
+			 *   11   |   01
+			 *        |
+			 * --------------->  I
+			 *        |
+			 *   10   |   00
+			 *        |
+			 */
+			const int_fast32_t ref_idx = best_tau % AUDIO_BLOCKSIZE;
+			const float inphase = best_re * cos_ref[ref_idx] - best_im * sin_ref[ref_idx];
+			const float quadphase = -(best_re * sin_ref[ref_idx] + best_im * cos_ref[ref_idx]);
+			enum qpsk_sym_e best_sym;
+			if(inphase >= 0.0f){
+				best_sym = quadphase >= 0.0f ? qpsk_sym_1 : qpsk_sym_0;
+			}else{
+				best_sym = quadphase >= 0.0f ? qpsk_sym_3 : qpsk_sym_2;
+			}
+
+			//Track the timing, moving the estimate back by a block repeats the current symbol next time
+			const bool repeat = qpsk_rx_repeat;
+			qpsk_rx_tau = best_tau;
+			qpsk_rx_repeat = false;
+			if(qpsk_rx_tau < AUDIO_BLOCKSIZE/2){
+				qpsk_rx_tau += AUDIO_BLOCKSIZE;
+			}else if(qpsk_rx_tau >= (QPSK_RX_BLOCKS - 1) * AUDIO_BLOCKSIZE - AUDIO_BLOCKSIZE/2){
+				qpsk_rx_tau -= AUDIO_BLOCKSIZE;
+				qpsk_rx_repeat = true;
+			}
+			if(repeat){
+				best_sym = QPSK_SYM_NUM;
 			}
 
 			switch(best_sym){
@@ -568,6 +592,9 @@ void example_test4(void){
 			case qpsk_sym_3:
 				printf("Rx; 3\n");
 				break;
+			case QPSK_SYM_NUM:
+				//The symbol was decoded in the previous block
+				break;
 			default:
 				//Should never occur
 				printf("Rx; ERR\n");
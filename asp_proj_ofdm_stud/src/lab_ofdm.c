@@ -10,13 +10,18 @@
 #include "arm_math.h"
 #include "backend/printfn/printfn.h"
 #include "backend/systime/systime.h"
+#include "backend/hw/board.h"
+#include "backend/hw/headphone.h"
+#include "backend/profile/profile.h"
+#include "backend/capture/capture.h"
+#include "backend/telemetry/telemetry.h"
 
 #if SYSMODE == SYSMODE_OFDM
 
 extern float volume; // declaration (it is defined elsewhere)
 
 systime_t tx_timer = 0;
-float tx_data[LAB_OFDM_TX_FRAME_SIZE];	//data to send
+float tx_data[LAB_OFDM_TX_FRAME_SIZE];	//data to send, sized for the largest frame
 float envelope_data[10000];	//Stored data from envelope detection
 struct misc_envelope_s env_s;
 struct misc_queuedbuf_s queue_s;
@@ -25,6 +30,23 @@ systime_t block_timer = 0;
 bool trig_enbl = true;
 int sig_offset = 0;
 
+/** @brief Number of microphone blocks captured by the 'm' key */
+#define LAB_OFDM_CAPTURE_MIC_BLOCKS	(10)
+static bool lab_ofdm_capture_frames = false;	//Capture every detected frame, toggled by the 'c' key
+static bool lab_ofdm_print_profile = false;	//Print the profile from lab_ofdm_idle, set by the 'p' key
+
+/** @brief Combinations of sample rate and OFDM numerology selectable at run time, see LAB_OFDM_MODES */
+#define LAB_OFDM_MODE_ENTRY(fs, rate, fc)	{(fs), (rate), (fc)},
+static const struct lab_ofdm_mode_s {
+	uint32_t sample_rate;	//Audio sample rate [Hz]
+	int upsample_rate;		//Up/downsample rate between the baseband and the audio signal
+	float center_frequency;	//OFDM center frequency [Hz]
+} lab_ofdm_modes[] = {
+		LAB_OFDM_MODES(LAB_OFDM_MODE_ENTRY)
+};
+static int lab_ofdm_mode_idx = 0;
+static bool lab_ofdm_dual_band = false;
+
 static void lab_ofdm_trigstart_fun(void){
 	board_set_led(board_led_blue, true);
 	printf("Signal envelope detected!\n");
@@ -40,11 +62,24 @@ void lab_ofdm_init(void){
 	lab_ofdm_process_init();
 }
 
+void lab_ofdm_idle(void){
+	if(lab_ofdm_print_profile){
+		lab_ofdm_print_profile = false;
+		if(telemetry_get_enabled()){
+			telemetry_profile();
+		}else{
+			profile_print();
+			lab_ofdm_process_print_scratch();
+		}
+		profile_reset();
+	}
+}
+
 void lab_ofdm(void){
-	float inp[AUDIO_BLOCKSIZE];
-	blocks_sources_microphone(inp);
+	const float * inp = blocks_sources_microphone_ptr();
 
-	if(systime_get_delay_passed(block_timer) && trig_enbl == false){
+	//Do not re-arm the detector while envelope_data is still being processed
+	if(systime_get_delay_passed(block_timer) && trig_enbl == false && !lab_ofdm_process_rx_busy()){
 		trig_enbl = true;
 //		printf("Envelope detection blanking period elapsed.\n");
 	}
@@ -53,9 +88,12 @@ void lab_ofdm(void){
 
 	if(misc_envelope_query_complete(&env_s)){ // True if a buffer is ready to process
 		misc_envelope_ack_complete(&env_s);
-		block_timer = systime_get_delay(1.5 * S2US(1.0f * NUMEL(envelope_data) / AUDIO_SAMPLE_RATE ));
+		block_timer = systime_get_delay(1.5 * S2US(1.0f * NUMEL(envelope_data) / audio_get_sample_rate() ));
 		trig_enbl = false;
-		lab_ofdm_process_rx(envelope_data); // Process data
+		if(lab_ofdm_capture_frames){
+			capture_frame(envelope_data, NUMEL(envelope_data));
+		}
+		lab_ofdm_process_rx_start(envelope_data); // Process data over the following callbacks
 	}
 
 	char key;
@@ -82,19 +120,74 @@ void lab_ofdm(void){
 			printf("Sample offset adjusted to earlier  %d \n",env_s.sig_offset-10);
 			lab_ofdm_init();
 			break;
+		case 'c':
+			lab_ofdm_capture_frames = !lab_ofdm_capture_frames;
+			printf("Capture of received frames %s, %lu captures dropped so far\n", lab_ofdm_capture_frames ? "enabled" : "disabled", (unsigned long) capture_dropped());
+			break;
+		case 'm':
+			if(capture_microphone_start(LAB_OFDM_CAPTURE_MIC_BLOCKS)){
+				printf("Capturing %d microphone blocks\n", LAB_OFDM_CAPTURE_MIC_BLOCKS);
+			}else{
+				printf("Capture busy, try again later\n");
+			}
+			break;
+		case 'p':
+			//Printing takes many blocks worth of time, so it is left to lab_ofdm_idle
+			lab_ofdm_print_profile = true;
+			break;
+		case 't':
+			printf("Binary telemetry %s, %lu records dropped so far\n", telemetry_get_enabled() ? "disabled" : "enabled", (unsigned long) telemetry_dropped());
+			telemetry_set_enabled(!telemetry_get_enabled());
+			break;
+		case 'r':
+		{
+			lab_ofdm_mode_idx = (lab_ofdm_mode_idx + 1) % NUMEL(lab_ofdm_modes);
+			const struct lab_ofdm_mode_s * mode = &lab_ofdm_modes[lab_ofdm_mode_idx];
+			audio_set_sample_rate(mode->sample_rate);
+			if(!lab_ofdm_process_set_numerology(mode->center_frequency, mode->upsample_rate, lab_ofdm_dual_band)){
+				//Not every mode has room for two bands
+				lab_ofdm_dual_band = false;
+				lab_ofdm_process_set_numerology(mode->center_frequency, mode->upsample_rate, lab_ofdm_dual_band);
+				printf("Dual-band mode not supported in this mode, disabled\n");
+			}
+			lab_ofdm_init();
+			printf("Switching to %lu Hz sample rate, upsample rate %d, center frequency %f Hz\n", (unsigned long) mode->sample_rate, mode->upsample_rate, mode->center_frequency);
+			break;
+		}
+		case 'd':
+		{
+			const struct lab_ofdm_mode_s * mode = &lab_ofdm_modes[lab_ofdm_mode_idx];
+			if(lab_ofdm_process_set_numerology(mode->center_frequency, mode->upsample_rate, !lab_ofdm_dual_band)){
+				lab_ofdm_dual_band = !lab_ofdm_dual_band;
+				lab_ofdm_init();
+				printf("Dual-band mode %s\n", lab_ofdm_dual_band ? "enabled" : "disabled");
+			} else {
+				printf("Dual-band mode not supported at %lu Hz sample rate\n", (unsigned long) mode->sample_rate);
+			}
+			break;
+		}
 		}
 	}
 
-	if(systime_get_delay_passed(tx_timer)){
+	//The receiver shares scratch buffers with the transmitter, so postpone transmission until it is done
+	if(systime_get_delay_passed(tx_timer) && !lab_ofdm_process_rx_busy()){
 		tx_timer = systime_get_delay(S2US(2));
 		//is now time to generate data, write to tx_data
 		lab_ofdm_process_tx(tx_data); // Create OFDM frame to send
-		misc_queuedbuf_init(&queue_s, tx_data, NUMEL(tx_data)); // Add to queue
+		misc_queuedbuf_init(&queue_s, tx_data, lab_ofdm_process_get_tx_frame_size()); // Add to queue
 	}
 	float out[AUDIO_BLOCKSIZE];
 	misc_queuedbuf_process(&queue_s, out, NUMEL(out), 0.0f);
 	blocks_sinks_leftout(out);
 	blocks_sinks_rightout(out);
+
+	//Spend what is left of the receiver's share of this block on the pending frame
+	if(lab_ofdm_process_rx_busy()){
+		const uint32_t budget = (uint32_t) (board_get_block_cycles() * (LAB_OFDM_RX_BUDGET_PERCENT / 100.0f));
+		//The deadline is set by the start of the block, which includes the microphone conversion
+		const uint32_t elapsed = board_get_cycles() - audio_get_block_start_cycles();
+		lab_ofdm_process_rx_step(elapsed < budget ? budget - elapsed : 0);
+	}
 }
 
 #endif
@@ -11,4 +11,8 @@
 void lab_ofdm_init(void);
 void lab_ofdm(void);
 
+/** @brief Prints what the audio callback has requested. Called from main_idle,
+ * in between audio blocks, so that printing does not eat into the time of a block. */
+void lab_ofdm_idle(void);
+
 #endif /* LAB_LMS_H_ */
@@ -7,6 +7,7 @@
  *      Author: mckelvey
  */
 #include <stdlib.h>
+#include <string.h>
 #include "lab_ofdm_process.h"
 #include "backend/arm_math.h"
 #include "blocks/sources.h"
@@ -16,26 +17,21 @@
 #include "config.h"
 #include "backend/systime/systime.h"
 #include "backend/printfn/printfn.h"
+#include "backend/hw/board.h"
+#include "backend/hw/headphone.h"
+#include "backend/profile/profile.h"
+#include "backend/arena.h"
+#include "backend/fixed/fixed.h"
+#include "backend/telemetry/telemetry.h"
+#include "backend/dlog/dlog.h"
 #include "arm_math.h"
 #include "arm_const_structs.h"
 
 #if SYSMODE == SYSMODE_OFDM
 
 char message[LAB_OFDM_CHAR_MESSAGE_SIZE] = "Hello World!AAA";
+char message_band2[LAB_OFDM_CHAR_MESSAGE_SIZE] = "Second band!BBB";
 char pilot_message[LAB_OFDM_CHAR_MESSAGE_SIZE] = "Pilot Signal!";
-float ofdm_buffer[2*LAB_OFDM_BLOCKSIZE];
-float ofdm_pilot_message[2*LAB_OFDM_BLOCKSIZE];
-float bb_transmit_buffer_pilot[2*(LAB_OFDM_BLOCK_W_CP_SIZE)];
-float bb_transmit_buffer_message[2*(LAB_OFDM_BLOCK_W_CP_SIZE)];
-float bb_transmit_buffer[2*(LAB_OFDM_BB_FRAME_SIZE)];
-float bb_receive_buffer[2*(LAB_OFDM_BB_FRAME_SIZE)];
-float bb_receive_buffer_message[2*(LAB_OFDM_BLOCK_W_CP_SIZE)];
-float bb_receive_buffer_pilot[2*(LAB_OFDM_BLOCK_W_CP_SIZE)];
-float ofdm_rx_message[2*LAB_OFDM_BLOCKSIZE];
-float ofdm_rx_pilot[2*LAB_OFDM_BLOCKSIZE];
-float ofdm_received_message[2*LAB_OFDM_BLOCKSIZE];
-float hhat_conj[2*LAB_OFDM_BLOCKSIZE];
-float soft_symb[2*LAB_OFDM_BLOCKSIZE];
 char rec_message[LAB_OFDM_CHAR_MESSAGE_SIZE];
 
 // LP filter with cutoff frequency = fs/LAB_OFDM_UPSAMPLE_RATE/2
@@ -109,26 +105,201 @@ float lp_filter[LAB_OFDM_FILTER_LENGTH] = { // LP filter with cutoff 1/(2*R)
   -2.496956319982458e-03f,
    };
 
+/* The upsample rate and center frequency can be changed at run time, see
+ * lab_ofdm_process_set_numerology. All buffers are sized for the largest
+ * rate, LAB_OFDM_UPSAMPLE_RATE, for which lp_filter is used. For other rates a
+ * windowed-sinc filter is designed into lp_filter_rt.
+ * In dual-band mode, a frame is sent in each of two bands, centered at half
+ * and one and a half times the center frequency, each carrying its own
+ * message. The bands are summed by the transmitter and separated again by the
+ * receiver, which runs the downconversion and polyphase decimator once per band. */
+static int ofdm_upsample_rate = LAB_OFDM_UPSAMPLE_RATE;
+static int ofdm_num_bands = 1;
+static float ofdm_band_frequency[LAB_OFDM_MAX_BANDS] = {LAB_OFDM_CENTER_FREQUENCY};
+static char * const ofdm_band_message[LAB_OFDM_MAX_BANDS] = {message, message_band2};
+static float lp_filter_rt[LAB_OFDM_FILTER_LENGTH];
+static float * lp_coeffs = lp_filter;
+
 /* Data structures for OFDM processing */
-arm_fir_decimate_instance_f32 S_decim;
-float pState_decim[LAB_OFDM_TX_FRAME_SIZE+(LAB_OFDM_FILTER_LENGTH)-1];
+#if LAB_OFDM_FIXED_POINT
+/* In the fixed-point variant, the stages running at the audio and base band
+ * sample rates (interpolation, modulation, decimation and the FFTs) work on
+ * q15 mantissas with one block exponent per buffer, see backend/fixed/fixed.h.
+ * The receiver demodulates with ofdm_demodulate and interleaves the decimated
+ * frame with cnvt_re_im_2_cmplx in float, so the exercise functions above are
+ * used by both variants. Each OFDM block is converted to q15 for its FFT and
+ * back to float afterwards. */
+typedef q15_t lab_ofdm_sample_t;
+static q15_t lp_coeffs_q15[LAB_OFDM_FILTER_LENGTH];
+static int_fast8_t lp_coeffs_exp;
+static struct fixed_fir_decimate_s S_decim_re, S_decim_im;
+static q15_t pState_decim_re[LAB_OFDM_RX_CHUNK_SIZE+(LAB_OFDM_FILTER_LENGTH)-1];
+static q15_t pState_decim_im[LAB_OFDM_RX_CHUNK_SIZE+(LAB_OFDM_FILTER_LENGTH)-1];
+static struct fixed_fir_interpolate_s S_intp;
+static q15_t pState_intp[(LAB_OFDM_BB_FRAME_SIZE)+(LAB_OFDM_FILTER_LENGTH)-1];	//Sized for an upsample rate of one
+static struct fixed_cfft_s S_cfft;
+#define LAB_OFDM_BLOCKSIZE_LOG2 (6)
+#else
+typedef float lab_ofdm_sample_t;
+arm_fir_decimate_instance_f32 S_decim_re, S_decim_im;
+float pState_decim_re[LAB_OFDM_RX_CHUNK_SIZE+(LAB_OFDM_FILTER_LENGTH)-1];
+float pState_decim_im[LAB_OFDM_RX_CHUNK_SIZE+(LAB_OFDM_FILTER_LENGTH)-1];
 arm_fir_interpolate_instance_f32 S_intp;
-float pState_intp[(LAB_OFDM_BB_FRAME_SIZE)+(LAB_OFDM_FILTER_LENGTH/LAB_OFDM_UPSAMPLE_RATE)-1];
+float pState_intp[(LAB_OFDM_BB_FRAME_SIZE)+(LAB_OFDM_FILTER_LENGTH)-1];	//Sized for an upsample rate of one
+#endif
 
-/* Scratch buffers for temporary storage*/
-float br_tx[LAB_OFDM_TX_FRAME_SIZE], bi_tx[LAB_OFDM_TX_FRAME_SIZE];
-float br_bb[LAB_OFDM_BB_FRAME_SIZE], bi_bb[LAB_OFDM_BB_FRAME_SIZE];
-float pTmp[2*LAB_OFDM_BLOCKSIZE];
+/* Scratch memory for temporary storage. The transmitter is never run while
+ * the receiver is busy, so the working buffers of both are allocated from the
+ * same arena and overlay each other. Within the receiver, the passband buffers
+ * are released once decimated, which makes room for the baseband stages.
+ * Sizes are in floats at the deepest point of each chain, for the largest
+ * upsample rate. In the fixed-point variant two samples fit in each float, the
+ * transmitter also needs the message symbols in float, and the receiver needs
+ * a chunk of demodulated samples in float. */
+#define LAB_OFDM_SAMPLE_FLOATS(n) (((n)*sizeof(lab_ofdm_sample_t) + sizeof(float) - 1) / sizeof(float))
+#define LAB_OFDM_TX_SCRATCH_SIZE (LAB_OFDM_SAMPLE_FLOATS(2*LAB_OFDM_TX_FRAME_SIZE + 2*2*LAB_OFDM_BB_FRAME_SIZE) + LAB_OFDM_FIXED_POINT*2*LAB_OFDM_BLOCKSIZE)
+#define LAB_OFDM_RX_SCRATCH_SIZE (LAB_OFDM_SAMPLE_FLOATS(2*LAB_OFDM_TX_FRAME_SIZE) + 2*LAB_OFDM_BB_FRAME_SIZE + LAB_OFDM_FIXED_POINT*2*LAB_OFDM_RX_CHUNK_SIZE)
+#define LAB_OFDM_SCRATCH_SIZE (LAB_OFDM_TX_SCRATCH_SIZE > LAB_OFDM_RX_SCRATCH_SIZE ? LAB_OFDM_TX_SCRATCH_SIZE : LAB_OFDM_RX_SCRATCH_SIZE)
+static float scratch_pool[LAB_OFDM_SCRATCH_SIZE];
+static arena_s scratch;
+
+/* The pilot is the same in every frame, so its symbols and its time domain
+ * block, including the cyclic prefix, are computed once and reused by the
+ * transmitter and the receiver. lab_ofdm_process_set_pilot marks them dirty,
+ * and they are recomputed before the next frame is sent or received. */
+static float pilot_symbols[2*LAB_OFDM_BLOCKSIZE];
+static lab_ofdm_sample_t pilot_block[2*LAB_OFDM_BLOCK_W_CP_SIZE];
+#if LAB_OFDM_FIXED_POINT
+static int_fast8_t pilot_block_exp;
+#endif
+static bool pilot_dirty = true;
+static void lab_ofdm_process_update_pilot(void);
 
 // volume for transmitted signal
 float volume = 4;
 
+/* The receiver is run as a resumable state machine so that a frame can be
+ * processed over several audio callbacks without exceeding the time available
+ * per block. Each stage is split into work units; a unit is only started if
+ * the worst-case cost observed for it so far fits in the remaining budget. */
+enum lab_ofdm_rx_stage_e {rx_stage_idle = 0, rx_stage_demodulate, rx_stage_decimate, rx_stage_split, rx_stage_fft_pilot, rx_stage_fft_message, rx_stage_decode, rx_stage_report, RX_STAGE_NUM};
+
+static enum lab_ofdm_rx_stage_e rx_stage = rx_stage_idle;	//Next stage to execute
+static float * rx_src;										//Frame currently being received
+static int_fast32_t rx_chunk_idx;							//Next chunk to process in the chunked stages
+static int rx_band;											//Band currently being received
+static lab_ofdm_sample_t * rx_re, * rx_im;					//Demodulated frame, released after decimation
+static float * rx_bb_re, * rx_bb_im;						//Decimated frame
+static arena_mark_t rx_mark_bb;								//Arena mark above the decimated frame
+static float * rx_frame;									//Complex base band frame
+static float * rx_pilot, * rx_message;						//Pilot and message blocks, views of rx_frame
+static float * rx_soft_symb;								//Soft message symbols
+#if LAB_OFDM_FIXED_POINT
+static int_fast8_t rx_exp;									//Exponent of the frame currently being received
+#endif
+static uint32_t rx_stage_cost[RX_STAGE_NUM];				//Largest observed cost of one work unit [cycles]
+
+/* Profiling scopes for the transmitter and each receiver stage */
+static PROFILE_SCOPE(tx_prof, "tx");
+static struct profile_scope_s rx_stage_prof[RX_STAGE_NUM] = {
+	[rx_stage_demodulate] = PROFILE_SCOPE_INIT("rx demodulate"),
+	[rx_stage_decimate] = PROFILE_SCOPE_INIT("rx decimate"),
+	[rx_stage_split] = PROFILE_SCOPE_INIT("rx split"),
+	[rx_stage_fft_pilot] = PROFILE_SCOPE_INIT("rx fft pilot"),
+	[rx_stage_fft_message] = PROFILE_SCOPE_INIT("rx fft message"),
+	[rx_stage_decode] = PROFILE_SCOPE_INIT("rx decode"),
+	[rx_stage_report] = PROFILE_SCOPE_INIT("rx report"),
+};
+
 void lab_ofdm_process_init(void){
-	arm_fir_decimate_init_f32 (&S_decim, LAB_OFDM_FILTER_LENGTH, LAB_OFDM_UPSAMPLE_RATE, lp_filter, pState_decim, LAB_OFDM_TX_FRAME_SIZE);
-	arm_fir_interpolate_init_f32 (&S_intp, LAB_OFDM_UPSAMPLE_RATE, LAB_OFDM_FILTER_LENGTH, lp_filter, pState_intp, LAB_OFDM_BB_FRAME_SIZE);
+	arena_new(&scratch, scratch_pool, NUMEL(scratch_pool));
+#if LAB_OFDM_FIXED_POINT
+	fixed_cfft_init(&S_cfft, LAB_OFDM_BLOCKSIZE);
+	pilot_dirty = true;
+#endif
+	lab_ofdm_process_update_pilot();
+#if LAB_OFDM_FIXED_POINT
+	lp_coeffs_exp = fixed_from_f32_auto(lp_coeffs, lp_coeffs_q15, LAB_OFDM_FILTER_LENGTH);
+	fixed_fir_decimate_init(&S_decim_re, ofdm_upsample_rate, LAB_OFDM_FILTER_LENGTH, lp_coeffs_q15, lp_coeffs_exp, pState_decim_re);
+	fixed_fir_decimate_init(&S_decim_im, ofdm_upsample_rate, LAB_OFDM_FILTER_LENGTH, lp_coeffs_q15, lp_coeffs_exp, pState_decim_im);
+	rx_stage = rx_stage_idle;
+	fixed_fir_interpolate_init(&S_intp, ofdm_upsample_rate, LAB_OFDM_FILTER_LENGTH, lp_coeffs_q15, lp_coeffs_exp, pState_intp);
+#else
+	arm_fir_decimate_init_f32 (&S_decim_re, LAB_OFDM_FILTER_LENGTH, ofdm_upsample_rate, lp_coeffs, pState_decim_re, LAB_OFDM_RX_CHUNK_SIZE);
+	arm_fir_decimate_init_f32 (&S_decim_im, LAB_OFDM_FILTER_LENGTH, ofdm_upsample_rate, lp_coeffs, pState_decim_im, LAB_OFDM_RX_CHUNK_SIZE);
+	rx_stage = rx_stage_idle;
+	arm_fir_interpolate_init_f32 (&S_intp, ofdm_upsample_rate, LAB_OFDM_FILTER_LENGTH, lp_coeffs, pState_intp, LAB_OFDM_BB_FRAME_SIZE);
+#endif
   printf("OFDM initialized!\n");
 }
 
+static bool lab_ofdm_process_band_valid(float f, int upsample_rate, float fs){
+  /*
+  * Check that a band centered at f fits between DC and the Nyquist frequency,
+  * and that each receiver chunk holds an integer number of its carrier periods
+  */
+	return IS_INTEGER(LAB_OFDM_RX_CHUNK_SIZE * f / fs) &&
+			f - fs / (2 * upsample_rate) > 0 &&
+			f + fs / (2 * upsample_rate) < fs / 2;
+}
+
+bool lab_ofdm_process_set_numerology(float center_frequency, int upsample_rate, bool dual_band){
+  /*
+  * Change the center frequency and up/downsample rate, for example to use the
+  * larger bandwidth available at a higher sample rate, and select between a
+  * single band at the center frequency or two bands at half and one and a
+  * half times the center frequency. Must be called after any change of the
+  * sample rate. Returns false, leaving the numerology unchanged, if the
+  * combination is not supported at the current sample rate.
+  */
+	const float fs = audio_get_sample_rate();
+	const int frame_size = LAB_OFDM_BB_FRAME_SIZE * upsample_rate;
+	const float band_frequency[LAB_OFDM_MAX_BANDS] = {
+			dual_band ? center_frequency / 2 : center_frequency,
+			center_frequency * 3 / 2};
+	const int num_bands = dual_band ? 2 : 1;
+	int b;
+	if(upsample_rate < 1 || upsample_rate > LAB_OFDM_UPSAMPLE_RATE ||
+			LAB_OFDM_FILTER_LENGTH % upsample_rate != 0 ||
+			LAB_OFDM_RX_CHUNK_SIZE % upsample_rate != 0 ||
+			frame_size % LAB_OFDM_RX_CHUNK_SIZE != 0){
+		return false;
+	}
+	for(b = 0; b < num_bands; b++){
+		if(!lab_ofdm_process_band_valid(band_frequency[b], upsample_rate, fs)){
+			return false;
+		}
+	}
+	ofdm_upsample_rate = upsample_rate;
+	ofdm_num_bands = num_bands;
+	for(b = 0; b < num_bands; b++){
+		ofdm_band_frequency[b] = band_frequency[b];
+	}
+	if(upsample_rate == LAB_OFDM_UPSAMPLE_RATE){
+		lp_coeffs = lp_filter;
+	}else{
+		// Hamming-windowed sinc with the same relative passband and transition band as lp_filter
+		int i;
+		const float fcut = 1.3f / (2 * upsample_rate);
+		float sum = 0;
+		for(i = 0; i < LAB_OFDM_FILTER_LENGTH; i++){
+			const float t = i - (LAB_OFDM_FILTER_LENGTH - 1) / 2.0f;
+			const float w = 0.54f - 0.46f * arm_cos_f32(M_TWOPI * i / (LAB_OFDM_FILTER_LENGTH - 1));
+			lp_filter_rt[i] = w * arm_sin_f32(M_PI * 2 * fcut * t) / (M_PI * t);
+			sum += lp_filter_rt[i];
+		}
+		// Normalize to unity DC gain, like lp_filter
+		arm_scale_f32(lp_filter_rt, 1.0f / sum, lp_filter_rt, LAB_OFDM_FILTER_LENGTH);
+		lp_coeffs = lp_filter_rt;
+	}
+	lab_ofdm_process_init();
+	return true;
+}
+
+int lab_ofdm_process_get_tx_frame_size(void){
+	return LAB_OFDM_BB_FRAME_SIZE * ofdm_upsample_rate;
+}
+
 void lab_ofdm_process_qpsk_encode(char * pMessage, float * pDst, int Mlen){
   /*
    * Encode the character string in pMessage[] of length Mlen
@@ -205,11 +376,15 @@ void ofdm_modulate(float * pRe, float * pIm, float* pDst, float f , int length){
    * and saves the real part of the signal in vector pDst
    */
 	int i;
-	float inc,omega=0;
-	inc = 2*f*M_PI;
+	float omega, phase=0;
 	for(i=0; i< length; i++ ){
+		omega = 2*M_PI*phase;
 		pDst[i] = pRe[i] * arm_cos_f32(omega) - pIm[i] * arm_sin_f32(omega);
-		omega += inc;
+		// Accumulate the phase in cycles and wrap it, a growing angle would lose precision
+		phase += f;
+		if(phase >= 1){
+			phase -= 1;
+		}
 	}
 }
 void ofdm_demodulate(float * pSrc, float * pRe, float * pIm,  float f, int length ){
@@ -308,88 +483,464 @@ void ofdm_soft_symb(float * prxMes, float * hhat_conj, float * soft_symb, int le
   * Note that s_k / H_k = s_k * conj(H_k) / abs(H_k)
   */
   int i;
-  float pTmp[LAB_OFDM_BLOCKSIZE];
+  const arena_mark_t mark = arena_push(&scratch);
+  float * pTmp = arena_alloc(&scratch, length);
 	arm_cmplx_mult_cmplx_f32( hhat_conj, prxMes, soft_symb, length);
 	arm_cmplx_mag_squared_f32(hhat_conj, pTmp, length);
 	for (i=0; i<length; i++){
 		soft_symb[2*i]  = soft_symb[2*i]/pTmp[i];
 		soft_symb[2*i+1]  = soft_symb[2*i+1]/pTmp[i];
 	}
+  arena_pop(&scratch, mark);
 }
 
-void lab_ofdm_process_tx(float * real_tx){
-  /* Create one frame including an ofdm pilot and ofdm message message block
+static lab_ofdm_sample_t * lab_ofdm_process_alloc_samples(int_fast32_t len){
+  /* Allocate a buffer of len samples from the scratch arena
   */
-	/* Encode pilot string to qpsk symbols */
-	lab_ofdm_process_qpsk_encode( pilot_message , ofdm_buffer, LAB_OFDM_CHAR_MESSAGE_SIZE);
-	/* perform IFFT on ofdm_buffer */
-	BUILD_BUG_ON(LAB_OFDM_BLOCKSIZE != 64);
-	arm_cfft_f32(&arm_cfft_sR_f32_len64, ofdm_buffer, LAB_OFDM_IFFT_FLAG, LAB_OFDM_DO_BITREVERSE);
+	return (lab_ofdm_sample_t *) arena_alloc(&scratch, LAB_OFDM_SAMPLE_FLOATS(len));
+}
+
+static int lab_ofdm_process_block_offset(int block){
+  /* Return the index of the data part of OFDM block number block in a complex
+   * base band frame, following the cyclic prefix of the block
+  */
+	return 2*(block*LAB_OFDM_BLOCK_W_CP_SIZE + LAB_OFDM_CYCLIC_PREFIX_SIZE);
+}
+
+static lab_ofdm_sample_t * lab_ofdm_process_block(lab_ofdm_sample_t * frame, int block){
+  /* Return a view of the data part of OFDM block number block in the complex
+   * base band frame[]
+  */
+	return &frame[lab_ofdm_process_block_offset(block)];
+}
+
+#if LAB_OFDM_FIXED_POINT
+static int_fast8_t lab_ofdm_process_tx_block(q15_t * frame, int block, float * symbols){
+  /* Create OFDM block number block of the base band frame[] in place from the
+   * QPSK symbols in symbols[], and return the exponent of the block. As for
+   * arm_cfft_f32, the IFFT is scaled by 1/LAB_OFDM_BLOCKSIZE.
+  */
+	q15_t * data = lab_ofdm_process_block(frame, block);
+	int_fast8_t exp = fixed_from_f32_auto(symbols, data, 2*LAB_OFDM_BLOCKSIZE);
+	/* perform IFFT on the block */
+	BUILD_BUG_ON((1 << LAB_OFDM_BLOCKSIZE_LOG2) != LAB_OFDM_BLOCKSIZE);
+	exp += fixed_cfft_q15(&S_cfft, data, true) - LAB_OFDM_BLOCKSIZE_LOG2;
 	// Add cyclic prefix
-	add_cyclic_prefix(ofdm_buffer, bb_transmit_buffer_pilot, LAB_OFDM_BLOCKSIZE, LAB_OFDM_CYCLIC_PREFIX_SIZE);
-	/* Encode message string to qpsk sybols */
-	lab_ofdm_process_qpsk_encode( message , ofdm_buffer, LAB_OFDM_CHAR_MESSAGE_SIZE);
-	/* perform IFFT on ofdm_buffer */
+	memcpy(&data[-2*LAB_OFDM_CYCLIC_PREFIX_SIZE], &data[2*(LAB_OFDM_BLOCKSIZE - LAB_OFDM_CYCLIC_PREFIX_SIZE)], 2*LAB_OFDM_CYCLIC_PREFIX_SIZE*sizeof(q15_t));
+	return exp;
+}
+#else
+static void lab_ofdm_process_tx_block(float * frame, int block, char * block_message){
+  /* Create OFDM block number block of the base band frame[] in place. The
+   * symbols are encoded and transformed at their final position, after which
+   * the cyclic prefix is filled in from the tail of the block.
+  */
+	float * data = lab_ofdm_process_block(frame, block);
+	/* Encode string to qpsk symbols */
+	lab_ofdm_process_qpsk_encode( block_message , data, LAB_OFDM_CHAR_MESSAGE_SIZE);
+	/* perform IFFT on the block */
 	BUILD_BUG_ON(LAB_OFDM_BLOCKSIZE != 64);
-	arm_cfft_f32(&arm_cfft_sR_f32_len64, ofdm_buffer, LAB_OFDM_IFFT_FLAG, LAB_OFDM_DO_BITREVERSE);
+	arm_cfft_f32(&arm_cfft_sR_f32_len64, data, LAB_OFDM_IFFT_FLAG, LAB_OFDM_DO_BITREVERSE);
 	// Add cyclic prefix
-	add_cyclic_prefix(ofdm_buffer, bb_transmit_buffer_message, LAB_OFDM_BLOCKSIZE, LAB_OFDM_CYCLIC_PREFIX_SIZE);
-	// Add Pilot + Message to create a full base band frame
-	concat(bb_transmit_buffer_pilot, bb_transmit_buffer_message, bb_transmit_buffer, 2*LAB_OFDM_BLOCK_W_CP_SIZE);
+	arm_copy_f32(&data[2*(LAB_OFDM_BLOCKSIZE - LAB_OFDM_CYCLIC_PREFIX_SIZE)], &data[-2*LAB_OFDM_CYCLIC_PREFIX_SIZE], 2*LAB_OFDM_CYCLIC_PREFIX_SIZE);
+}
+#endif
+
+static void lab_ofdm_process_update_pilot(void){
+  /* Recompute the cached pilot symbols and time domain block if the pilot changed
+  */
+	if(!pilot_dirty){
+		return;
+	}
+	lab_ofdm_process_qpsk_encode( pilot_message , pilot_symbols, LAB_OFDM_CHAR_MESSAGE_SIZE);
+#if LAB_OFDM_FIXED_POINT
+	pilot_block_exp = lab_ofdm_process_tx_block(pilot_block, 0, pilot_symbols);
+#else
+	lab_ofdm_process_tx_block(pilot_block, 0, pilot_message);
+#endif
+	pilot_dirty = false;
+}
+
+void lab_ofdm_process_set_pilot(const char * pilot){
+  /* Change the pilot string sent in the first block of every frame, truncating
+   * it to LAB_OFDM_CHAR_MESSAGE_SIZE characters. Both ends of a link must use
+   * the same pilot. The pilot is a block of characters rather than a C string,
+   * so it is zero-filled after a shorter string and not terminated after a
+   * string of full length.
+  */
+	memset(pilot_message, 0, LAB_OFDM_CHAR_MESSAGE_SIZE);
+	memcpy(pilot_message, pilot, strnlen(pilot, LAB_OFDM_CHAR_MESSAGE_SIZE));
+	pilot_dirty = true;
+}
+
+#if LAB_OFDM_FIXED_POINT
+static int_fast8_t lab_ofdm_process_tx_band(q15_t * br_tx, q15_t * bi_tx, char * band_message, float f){
+  /* Create one frame including an ofdm pilot and ofdm message message block,
+   * modulated onto the carrier frequency f. The modulated frame replaces the
+   * interpolated real part in br_tx[], and its exponent is returned.
+  */
+	int i;
+	const arena_mark_t mark = arena_push(&scratch);
+	q15_t * bb_transmit_buffer = lab_ofdm_process_alloc_samples(2*LAB_OFDM_BB_FRAME_SIZE);
+	q15_t * br_bb = lab_ofdm_process_alloc_samples(LAB_OFDM_BB_FRAME_SIZE);
+	q15_t * bi_bb = lab_ofdm_process_alloc_samples(LAB_OFDM_BB_FRAME_SIZE);
+	float * symbols = arena_alloc(&scratch, 2*LAB_OFDM_BLOCKSIZE);
+	// Copy the cached pilot block and create the message block directly in the full base band frame
+	BUILD_BUG_ON(LAB_OFDM_NUM_FRAMES != 2);
+	memcpy(bb_transmit_buffer, pilot_block, sizeof(pilot_block));
+	lab_ofdm_process_qpsk_encode( band_message , symbols, LAB_OFDM_CHAR_MESSAGE_SIZE);
+	int_fast8_t exp = lab_ofdm_process_tx_block(bb_transmit_buffer, 1, symbols);
+	// Bring both blocks to the larger of their exponents
+	if(exp > pilot_block_exp){
+		fixed_shift_right(bb_transmit_buffer, exp - pilot_block_exp, 2*LAB_OFDM_BLOCK_W_CP_SIZE);
+	}else{
+		fixed_shift_right(&bb_transmit_buffer[2*LAB_OFDM_BLOCK_W_CP_SIZE], pilot_block_exp - exp, 2*LAB_OFDM_BLOCK_W_CP_SIZE);
+		exp = pilot_block_exp;
+	}
+  // Split complex signal into real and imaginary parts
+	for(i = 0; i < LAB_OFDM_BB_FRAME_SIZE; i++){
+		br_bb[i] = bb_transmit_buffer[2*i];
+		bi_bb[i] = bb_transmit_buffer[2*i+1];
+	}
+  // Interpolate to the audio sampling frequency, restarting the interpolator
+  // so that no samples from the previous part, band or frame leak into this one
+	fixed_fir_interpolate_init(&S_intp, ofdm_upsample_rate, LAB_OFDM_FILTER_LENGTH, lp_coeffs_q15, lp_coeffs_exp, pState_intp);
+	fixed_fir_interpolate_q15(&S_intp, br_bb, br_tx, LAB_OFDM_BB_FRAME_SIZE);
+	fixed_fir_interpolate_init(&S_intp, ofdm_upsample_rate, LAB_OFDM_FILTER_LENGTH, lp_coeffs_q15, lp_coeffs_exp, pState_intp);
+	fixed_fir_interpolate_q15(&S_intp, bi_bb, bi_tx, LAB_OFDM_BB_FRAME_SIZE);
+	exp += S_intp.exp_delta;
+	arena_pop(&scratch, mark);
+	 // Modulate
+	struct fixed_nco_s nco;
+	fixed_nco_init(&nco, f/audio_get_sample_rate());
+	fixed_modulate_q15(&nco, br_tx, bi_tx, br_tx, lab_ofdm_process_get_tx_frame_size());
+	return exp + 1;
+}
+
+void lab_ofdm_process_tx(float * real_tx){
+  /* Create one frame in each band and sum them
+  */
+	int b;
+	profile_begin(&tx_prof);
+	lab_ofdm_process_update_pilot();
+	const arena_mark_t mark = arena_push(&scratch);
+	q15_t * br_tx = lab_ofdm_process_alloc_samples(LAB_OFDM_TX_FRAME_SIZE);
+	q15_t * bi_tx = lab_ofdm_process_alloc_samples(LAB_OFDM_TX_FRAME_SIZE);
+	for(b = 0; b < ofdm_num_bands; b++){
+		const int_fast8_t exp = lab_ofdm_process_tx_band(br_tx, bi_tx, ofdm_band_message[b], ofdm_band_frequency[b]);
+		if(b == 0){
+			fixed_to_f32(br_tx, exp, real_tx, lab_ofdm_process_get_tx_frame_size());
+		}else{
+			fixed_to_f32_add(br_tx, exp, real_tx, lab_ofdm_process_get_tx_frame_size());
+		}
+	}
+	arena_pop(&scratch, mark);
+  // Change volume on tranmitted signal
+	arm_scale_f32(real_tx, volume, real_tx, lab_ofdm_process_get_tx_frame_size());
+	 // buffer real_tx now ready for transmission
+	profile_end(&tx_prof);
+}
+#else
+static void lab_ofdm_process_tx_band(float * real_tx, float * br_tx, float * bi_tx, char * band_message, float f){
+  /* Create one frame including an ofdm pilot and ofdm message message block,
+   * modulated onto the carrier frequency f. br_tx[] and bi_tx[] hold the
+   * interpolated frame and may be the same buffer as real_tx[].
+  */
+	const arena_mark_t mark = arena_push(&scratch);
+	float * bb_transmit_buffer = arena_alloc(&scratch, 2*LAB_OFDM_BB_FRAME_SIZE);
+	float * br_bb = arena_alloc(&scratch, LAB_OFDM_BB_FRAME_SIZE);
+	float * bi_bb = arena_alloc(&scratch, LAB_OFDM_BB_FRAME_SIZE);
+	// Copy the cached pilot block and create the message block directly in the full base band frame
+	BUILD_BUG_ON(LAB_OFDM_NUM_FRAMES != 2);
+	arm_copy_f32(pilot_block, bb_transmit_buffer, 2*LAB_OFDM_BLOCK_W_CP_SIZE);
+	lab_ofdm_process_tx_block(bb_transmit_buffer, 1, band_message);
   // Split complex signal into real and imaginary parts
   cnvt_cmplx_2_re_im(bb_transmit_buffer, br_bb, bi_bb, LAB_OFDM_BB_FRAME_SIZE);
-  // Interpolate to the audio sampling frequency
+  // Interpolate to the audio sampling frequency, restarting the interpolator
+  // so that no samples from the previous part, band or frame leak into this one
+  arm_fir_interpolate_init_f32 (&S_intp, ofdm_upsample_rate, LAB_OFDM_FILTER_LENGTH, lp_coeffs, pState_intp, LAB_OFDM_BB_FRAME_SIZE);
   arm_fir_interpolate_f32 (&S_intp, br_bb , br_tx, LAB_OFDM_BB_FRAME_SIZE);
+  arm_fir_interpolate_init_f32 (&S_intp, ofdm_upsample_rate, LAB_OFDM_FILTER_LENGTH, lp_coeffs, pState_intp, LAB_OFDM_BB_FRAME_SIZE);
   arm_fir_interpolate_f32 (&S_intp, bi_bb , bi_tx, LAB_OFDM_BB_FRAME_SIZE);
+	arena_pop(&scratch, mark);
 	 // Modulate
-	ofdm_modulate(br_tx, bi_tx, real_tx, LAB_OFDM_CENTER_FREQUENCY/AUDIO_SAMPLE_RATE, LAB_OFDM_TX_FRAME_SIZE);
+	ofdm_modulate(br_tx, bi_tx, real_tx, f/audio_get_sample_rate(), lab_ofdm_process_get_tx_frame_size());
+}
+
+void lab_ofdm_process_tx(float * real_tx){
+  /* Create one frame in each band and sum them
+  */
+	int b;
+	profile_begin(&tx_prof);
+	lab_ofdm_process_update_pilot();
+	const arena_mark_t mark = arena_push(&scratch);
+	float * br_tx = arena_alloc(&scratch, LAB_OFDM_TX_FRAME_SIZE);
+	float * bi_tx = arena_alloc(&scratch, LAB_OFDM_TX_FRAME_SIZE);
+	lab_ofdm_process_tx_band(real_tx, br_tx, bi_tx, ofdm_band_message[0], ofdm_band_frequency[0]);
+	for(b = 1; b < ofdm_num_bands; b++){
+		// The modulator works sample by sample, so the band can be modulated in place before adding it
+		lab_ofdm_process_tx_band(br_tx, br_tx, bi_tx, ofdm_band_message[b], ofdm_band_frequency[b]);
+		arm_add_f32(real_tx, br_tx, real_tx, lab_ofdm_process_get_tx_frame_size());
+	}
+	arena_pop(&scratch, mark);
   // Change volume on tranmitted signal
-	arm_scale_f32(real_tx, volume, real_tx, LAB_OFDM_TX_FRAME_SIZE);
+	arm_scale_f32(real_tx, volume, real_tx, lab_ofdm_process_get_tx_frame_size());
 	 // buffer real_tx now ready for transmission
+	profile_end(&tx_prof);
 }
+#endif
 
-void lab_ofdm_process_rx(float * real_rx_buffer){
-	int i;
-  ofdm_demodulate(real_rx_buffer, br_tx, bi_tx, LAB_OFDM_CENTER_FREQUENCY/AUDIO_SAMPLE_RATE, LAB_OFDM_TX_FRAME_SIZE);
-  // Decimate using arm_fir_decimate_f32() function
-  arm_fir_decimate_f32 (&S_decim, br_tx , br_bb, LAB_OFDM_TX_FRAME_SIZE);
-  arm_fir_decimate_f32 (&S_decim, bi_tx , bi_bb, LAB_OFDM_TX_FRAME_SIZE);
-
-  // Convert from real and imaginary vectors to a complex vector
-  cnvt_re_im_2_cmplx(br_bb, bi_bb, bb_receive_buffer, LAB_OFDM_BB_FRAME_SIZE);
-
-  // Split and Remove Cyclic prefix
-	split(bb_receive_buffer,bb_receive_buffer_pilot, bb_receive_buffer_message, 2*LAB_OFDM_BLOCK_W_CP_SIZE);
-	remove_cyclic_prefix(bb_receive_buffer_pilot, ofdm_rx_pilot, LAB_OFDM_BLOCKSIZE, LAB_OFDM_CYCLIC_PREFIX_SIZE);
-	remove_cyclic_prefix(bb_receive_buffer_message, ofdm_rx_message, LAB_OFDM_BLOCKSIZE, LAB_OFDM_CYCLIC_PREFIX_SIZE);
-
-	//  Perform FFT
-	arm_cfft_f32(&arm_cfft_sR_f32_len64, ofdm_rx_pilot, LAB_OFDM_FFT_FLAG, LAB_OFDM_DO_BITREVERSE);
-	arm_cfft_f32(&arm_cfft_sR_f32_len64, ofdm_rx_message, LAB_OFDM_FFT_FLAG, LAB_OFDM_DO_BITREVERSE);
-
-	lab_ofdm_process_qpsk_encode( pilot_message , ofdm_pilot_message, LAB_OFDM_CHAR_MESSAGE_SIZE);
-	ofdm_conj_equalize(ofdm_rx_message, ofdm_rx_pilot, ofdm_pilot_message, ofdm_received_message, hhat_conj, LAB_OFDM_BLOCKSIZE);
-
-	/* Decode qpsk */
-	lab_ofdm_process_qpsk_decode(ofdm_received_message,  rec_message,  LAB_OFDM_CHAR_MESSAGE_SIZE);
-	/* Determine SNR here by also calculating the "soft symbols", i.e. by dividing
-   * with the channel estimate. */
-	ofdm_soft_symb(ofdm_rx_message, hhat_conj, soft_symb, LAB_OFDM_BLOCKSIZE);
-  // Here we calulate the "correct" symbols in the message
-  lab_ofdm_process_qpsk_encode( message , ofdm_buffer, LAB_OFDM_CHAR_MESSAGE_SIZE);
-  // Determine RMSE for the symbols
-	float tmp[2*LAB_OFDM_BLOCKSIZE];
-	float err_norm=0;
-	arm_sub_f32( soft_symb, ofdm_buffer, tmp, 2*LAB_OFDM_BLOCKSIZE);
-	arm_cmplx_mag_squared_f32(tmp, tmp, LAB_OFDM_BLOCKSIZE );
-	for ( i=0; i< LAB_OFDM_BLOCKSIZE; i++){
-		err_norm += tmp[i];
+static void lab_ofdm_process_rx_restart(void){
+  /*
+  * Restart the chunked stages and the decimators, so that no samples from the
+  * previous frame or band leak into this one, and allocate the frame buffers
+  */
+	rx_chunk_idx = 0;
+	arena_reset(&scratch);
+	rx_bb_re = arena_alloc(&scratch, LAB_OFDM_BB_FRAME_SIZE);
+	rx_bb_im = arena_alloc(&scratch, LAB_OFDM_BB_FRAME_SIZE);
+	rx_mark_bb = arena_push(&scratch);
+	rx_re = lab_ofdm_process_alloc_samples(LAB_OFDM_TX_FRAME_SIZE);
+	rx_im = lab_ofdm_process_alloc_samples(LAB_OFDM_TX_FRAME_SIZE);
+#if LAB_OFDM_FIXED_POINT
+	fixed_fir_decimate_init(&S_decim_re, ofdm_upsample_rate, LAB_OFDM_FILTER_LENGTH, lp_coeffs_q15, lp_coeffs_exp, pState_decim_re);
+	fixed_fir_decimate_init(&S_decim_im, ofdm_upsample_rate, LAB_OFDM_FILTER_LENGTH, lp_coeffs_q15, lp_coeffs_exp, pState_decim_im);
+#else
+	arm_fir_decimate_init_f32 (&S_decim_re, LAB_OFDM_FILTER_LENGTH, ofdm_upsample_rate, lp_coeffs, pState_decim_re, LAB_OFDM_RX_CHUNK_SIZE);
+	arm_fir_decimate_init_f32 (&S_decim_im, LAB_OFDM_FILTER_LENGTH, ofdm_upsample_rate, lp_coeffs, pState_decim_im, LAB_OFDM_RX_CHUNK_SIZE);
+#endif
+}
+
+static enum lab_ofdm_rx_stage_e lab_ofdm_process_rx_unit(enum lab_ofdm_rx_stage_e stage){
+  /*
+  * Perform one work unit of the given receiver stage and return the stage to
+  * continue with.
+  */
+	// Check the default numerology and every mode selectable at run time, as lab_ofdm_process_set_numerology
+	// does for other combinations. The demodulator restarts its phase on every call, so each chunk must hold
+	// an integer number of carrier periods.
+#define LAB_OFDM_CHECK_MODE(fs, rate, fc) \
+	BUILD_BUG_ON((LAB_OFDM_BB_FRAME_SIZE * (rate)) % LAB_OFDM_RX_CHUNK_SIZE != 0); \
+	BUILD_BUG_ON(LAB_OFDM_RX_CHUNK_SIZE % (rate) != 0); \
+	BUILD_BUG_ON(LAB_OFDM_FILTER_LENGTH % (rate) != 0); \
+	BUILD_BUG_ON(!IS_INTEGER(LAB_OFDM_RX_CHUNK_SIZE * (fc) / (fs))); \
+	BUILD_BUG_ON((fc) - (fs) / (2.0f * (rate)) <= 0 || (fc) + (fs) / (2.0f * (rate)) >= (fs) / 2.0f);
+	LAB_OFDM_CHECK_MODE(AUDIO_SAMPLE_RATE, LAB_OFDM_UPSAMPLE_RATE, LAB_OFDM_CENTER_FREQUENCY)
+	LAB_OFDM_MODES(LAB_OFDM_CHECK_MODE)
+#undef LAB_OFDM_CHECK_MODE
+	const int_fast32_t chunks = lab_ofdm_process_get_tx_frame_size() / LAB_OFDM_RX_CHUNK_SIZE;
+	const int_fast32_t offset = rx_chunk_idx * LAB_OFDM_RX_CHUNK_SIZE;
+	switch(stage){
+	case rx_stage_demodulate:
+#if LAB_OFDM_FIXED_POINT
+	{
+		// Demodulate in float and store the result with the exponent of the frame, plus one for the factor of two
+		const arena_mark_t mark = arena_push(&scratch);
+		float * re = arena_alloc(&scratch, LAB_OFDM_RX_CHUNK_SIZE);
+		float * im = arena_alloc(&scratch, LAB_OFDM_RX_CHUNK_SIZE);
+		ofdm_demodulate(&rx_src[offset], re, im, ofdm_band_frequency[rx_band]/audio_get_sample_rate(), LAB_OFDM_RX_CHUNK_SIZE);
+		fixed_from_f32(re, rx_exp + 1, &rx_re[offset], LAB_OFDM_RX_CHUNK_SIZE);
+		fixed_from_f32(im, rx_exp + 1, &rx_im[offset], LAB_OFDM_RX_CHUNK_SIZE);
+		arena_pop(&scratch, mark);
 	}
-	err_norm = sqrtf(err_norm/LAB_OFDM_BLOCKSIZE);
-	printf("Transmitted String: %s\n", message);
-	printf("Received String: %s\n", rec_message);
-	printf("QPSK symbol RMSE  %f \n\n", err_norm);
+#else
+		ofdm_demodulate(&rx_src[offset], &rx_re[offset], &rx_im[offset], ofdm_band_frequency[rx_band]/audio_get_sample_rate(), LAB_OFDM_RX_CHUNK_SIZE);
+#endif
+		if(++rx_chunk_idx < chunks){
+			return rx_stage_demodulate;
+		}
+		rx_chunk_idx = 0;
+		return rx_stage_decimate;
+	case rx_stage_decimate:
+#if LAB_OFDM_FIXED_POINT
+	{
+		// Decimate in q15 and convert the decimated chunk to float
+		const arena_mark_t mark = arena_push(&scratch);
+		const int_fast32_t len = LAB_OFDM_RX_CHUNK_SIZE/ofdm_upsample_rate;
+		const int_fast8_t exp = rx_exp + 1 + S_decim_re.exp_delta;
+		q15_t * bb = lab_ofdm_process_alloc_samples(len);
+		fixed_fir_decimate_q15(&S_decim_re, &rx_re[offset], bb, LAB_OFDM_RX_CHUNK_SIZE);
+		fixed_to_f32(bb, exp, &rx_bb_re[offset/ofdm_upsample_rate], len);
+		fixed_fir_decimate_q15(&S_decim_im, &rx_im[offset], bb, LAB_OFDM_RX_CHUNK_SIZE);
+		fixed_to_f32(bb, exp, &rx_bb_im[offset/ofdm_upsample_rate], len);
+		arena_pop(&scratch, mark);
+	}
+#else
+		// Decimate using arm_fir_decimate_f32() function
+		arm_fir_decimate_f32 (&S_decim_re, &rx_re[offset], &rx_bb_re[offset/ofdm_upsample_rate], LAB_OFDM_RX_CHUNK_SIZE);
+		arm_fir_decimate_f32 (&S_decim_im, &rx_im[offset], &rx_bb_im[offset/ofdm_upsample_rate], LAB_OFDM_RX_CHUNK_SIZE);
+#endif
+		if(++rx_chunk_idx < chunks){
+			return rx_stage_decimate;
+		}
+		rx_chunk_idx = 0;
+		// The demodulated frame is no longer needed
+		arena_pop(&scratch, rx_mark_bb);
+		return rx_stage_split;
+	case rx_stage_split:
+		rx_frame = arena_alloc(&scratch, 2*LAB_OFDM_BB_FRAME_SIZE);
+		rx_soft_symb = arena_alloc(&scratch, 2*LAB_OFDM_BLOCKSIZE);
+		// Convert from real and imaginary vectors to a complex vector
+		cnvt_re_im_2_cmplx(rx_bb_re, rx_bb_im, rx_frame, LAB_OFDM_BB_FRAME_SIZE);
+		// Split and Remove Cyclic prefix, by skipping it in place
+		rx_pilot = &rx_frame[lab_ofdm_process_block_offset(0)];
+		rx_message = &rx_frame[lab_ofdm_process_block_offset(1)];
+		return rx_stage_fft_pilot;
+#if LAB_OFDM_FIXED_POINT
+	case rx_stage_fft_pilot:
+	case rx_stage_fft_message:
+	{
+		// Transform the block in q15 with its own exponent and convert the spectrum back in place
+		const arena_mark_t mark = arena_push(&scratch);
+		const bool pilot = (stage == rx_stage_fft_pilot);
+		float * block = pilot ? rx_pilot : rx_message;
+		q15_t * data = lab_ofdm_process_alloc_samples(2*LAB_OFDM_BLOCKSIZE);
+		int_fast8_t exp = fixed_from_f32_auto(block, data, 2*LAB_OFDM_BLOCKSIZE);
+		exp += fixed_cfft_q15(&S_cfft, data, false);
+		fixed_to_f32(data, exp, block, 2*LAB_OFDM_BLOCKSIZE);
+		arena_pop(&scratch, mark);
+		return pilot ? rx_stage_fft_message : rx_stage_decode;
+	}
+#else
+	case rx_stage_fft_pilot:
+		//  Perform FFT
+		arm_cfft_f32(&arm_cfft_sR_f32_len64, rx_pilot, LAB_OFDM_FFT_FLAG, LAB_OFDM_DO_BITREVERSE);
+		return rx_stage_fft_message;
+	case rx_stage_fft_message:
+		arm_cfft_f32(&arm_cfft_sR_f32_len64, rx_message, LAB_OFDM_FFT_FLAG, LAB_OFDM_DO_BITREVERSE);
+		return rx_stage_decode;
+#endif
+	case rx_stage_decode:
+	{
+		const arena_mark_t mark = arena_push(&scratch);
+		float * ofdm_received_message = arena_alloc(&scratch, 2*LAB_OFDM_BLOCKSIZE);
+		float * hhat_conj = arena_alloc(&scratch, 2*LAB_OFDM_BLOCKSIZE);
+		ofdm_conj_equalize(rx_message, rx_pilot, pilot_symbols, ofdm_received_message, hhat_conj, LAB_OFDM_BLOCKSIZE);
+		if(telemetry_get_enabled()){
+			telemetry_cvector(telemetry_id_ofdm_channel, hhat_conj, LAB_OFDM_BLOCKSIZE);
+		}
 
+		/* Decode qpsk */
+		lab_ofdm_process_qpsk_decode(ofdm_received_message,  rec_message,  LAB_OFDM_CHAR_MESSAGE_SIZE);
+		/* Determine SNR here by also calculating the "soft symbols", i.e. by dividing
+		 * with the channel estimate. */
+		ofdm_soft_symb(rx_message, hhat_conj, rx_soft_symb, LAB_OFDM_BLOCKSIZE);
+		arena_pop(&scratch, mark);
+		return rx_stage_report;
+	}
+	case rx_stage_report:
+	{
+		int i;
+		const arena_mark_t mark = arena_push(&scratch);
+		float * ofdm_buffer = arena_alloc(&scratch, 2*LAB_OFDM_BLOCKSIZE);
+		float * tmp = arena_alloc(&scratch, 2*LAB_OFDM_BLOCKSIZE);
+		// Here we calulate the "correct" symbols in the message
+		lab_ofdm_process_qpsk_encode( ofdm_band_message[rx_band] , ofdm_buffer, LAB_OFDM_CHAR_MESSAGE_SIZE);
+		// Determine RMSE for the symbols
+		float err_norm=0;
+		arm_sub_f32( rx_soft_symb, ofdm_buffer, tmp, 2*LAB_OFDM_BLOCKSIZE);
+		arm_cmplx_mag_squared_f32(tmp, tmp, LAB_OFDM_BLOCKSIZE );
+		for ( i=0; i< LAB_OFDM_BLOCKSIZE; i++){
+			err_norm += tmp[i];
+		}
+		err_norm = sqrtf(err_norm/LAB_OFDM_BLOCKSIZE);
+		arena_pop(&scratch, mark);
+		if(telemetry_get_enabled()){
+			// Send the results as binary records instead, see backend/telemetry/telemetry.h
+			telemetry_ofdm_rx(rx_band, ofdm_band_frequency[rx_band], err_norm, ofdm_band_message[rx_band], rec_message, LAB_OFDM_CHAR_MESSAGE_SIZE);
+			telemetry_cvector(telemetry_id_ofdm_soft_symbols, rx_soft_symb, LAB_OFDM_BLOCKSIZE);
+		}else{
+			if(ofdm_num_bands > 1){
+				DLOG("Band %d at %f Hz\n", rx_band + 1, ofdm_band_frequency[rx_band]);
+			}
+			DLOG("Transmitted String: %s\n", ofdm_band_message[rx_band]);
+			DLOG("Received String: %s\n", rec_message);
+			DLOG("QPSK symbol RMSE  %f \n\n", err_norm);
+		}
+		if(++rx_band < ofdm_num_bands){
+			// Receive the next band from the same frame
+			lab_ofdm_process_rx_restart();
+			return rx_stage_demodulate;
+		}
+		// Hand the scratch memory back to the transmitter
+		arena_reset(&scratch);
+		return rx_stage_idle;
+	}
+	default:
+		return rx_stage_idle;
+	}
+}
+
+void lab_ofdm_process_rx_start(float * real_rx_buffer){
+  /*
+  * Start receiving the frame in real_rx_buffer[]. The buffer must be left
+  * untouched until lab_ofdm_process_rx_busy() returns false.
+  */
+	lab_ofdm_process_update_pilot();
+	rx_src = real_rx_buffer;
+#if LAB_OFDM_FIXED_POINT
+	rx_exp = fixed_exponent_f32(real_rx_buffer, lab_ofdm_process_get_tx_frame_size());
+#endif
+	rx_band = 0;
+	lab_ofdm_process_rx_restart();
+	rx_stage = rx_stage_demodulate;
+}
+
+bool lab_ofdm_process_rx_step(uint32_t budget_cycles){
+  /*
+  * Continue processing the current frame for at most budget_cycles CPU cycles.
+  * A work unit is only started if the largest cost observed for it so far fits
+  * in what is left of the budget, so nothing is done once the budget is spent.
+  * A unit costing more than a whole budget would never fit, so after a call
+  * that had a budget but could not start anything, the next call with a
+  * budget starts one unit regardless. Returns true when the frame is
+  * completely processed.
+  */
+	static bool starved = false;
+	const uint32_t t_start = board_get_cycles();
+	bool ran = false;
+	while(rx_stage != rx_stage_idle){
+		const uint32_t elapsed = board_get_cycles() - t_start;
+		const bool force = starved && !ran && budget_cycles > 0;
+		if(!force && (elapsed >= budget_cycles || rx_stage_cost[rx_stage] > budget_cycles - elapsed)){
+			break;
+		}
+		const enum lab_ofdm_rx_stage_e stage = rx_stage;
+		const uint32_t t_unit = board_get_cycles();
+		profile_begin(&rx_stage_prof[stage]);
+		rx_stage = lab_ofdm_process_rx_unit(stage);
+		profile_end(&rx_stage_prof[stage]);
+		const uint32_t cost = board_get_cycles() - t_unit;
+		if(cost > rx_stage_cost[stage]){
+			rx_stage_cost[stage] = cost;
+		}
+		ran = true;
+	}
+	if(budget_cycles > 0){
+		starved = !ran && rx_stage != rx_stage_idle;
+	}
+	return rx_stage == rx_stage_idle;
+}
+
+bool lab_ofdm_process_rx_busy(void){
+	return rx_stage != rx_stage_idle;
+}
+
+void lab_ofdm_process_print_scratch(void){
+  /*
+  * Print the most scratch memory used so far against the size of the arena
+  */
+	printf("Scratch memory high-water mark: %lu of %lu floats (tx %lu, rx %lu)\n",
+			(unsigned long) arena_high_water(&scratch), (unsigned long) NUMEL(scratch_pool),
+			(unsigned long) LAB_OFDM_TX_SCRATCH_SIZE, (unsigned long) LAB_OFDM_RX_SCRATCH_SIZE);
+}
+
+void lab_ofdm_process_rx(float * real_rx_buffer){
+  /*
+  * Process a complete frame in one go, regardless of the time this takes
+  */
+	lab_ofdm_process_rx_start(real_rx_buffer);
+	while(!lab_ofdm_process_rx_step(UINT32_MAX)){};
 }
 
 #endif
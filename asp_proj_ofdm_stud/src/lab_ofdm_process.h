@@ -1,24 +1,43 @@
 #ifndef LAB_OFDM_PROCESS_H_
 #define LAB_OFDM_PROCESS_H_
 
+#include <stdint.h>
+#include <stdbool.h>
+
 extern char message[];
+extern char message_band2[];
 extern char rec_message[];
 extern char stat_message[];
 
 /* #define LAB_BLOCKSIZE  (4096) */
 #define LAB_OFDM_CYCLIC_PREFIX_SIZE (32) /* Complex */
 #define LAB_OFDM_BLOCKSIZE (64) /* Complex Note must be aligned with FFT size*/
-#define LAB_OFDM_UPSAMPLE_RATE (8) // Also used as downsample rate
+#define LAB_OFDM_UPSAMPLE_RATE (8) // Also used as downsample rate. Default and largest rate, see lab_ofdm_process_set_numerology
 #define LAB_OFDM_NUM_FRAMES (2)
 #define LAB_OFDM_CHAR_MESSAGE_SIZE (LAB_OFDM_BLOCKSIZE / 4)
 #define LAB_OFDM_BLOCK_W_CP_SIZE   (LAB_OFDM_CYCLIC_PREFIX_SIZE + LAB_OFDM_BLOCKSIZE) /* Complex */
 #define LAB_OFDM_BB_FRAME_SIZE   (LAB_OFDM_NUM_FRAMES * LAB_OFDM_BLOCK_W_CP_SIZE) /* Complex */
-#define LAB_OFDM_TX_FRAME_SIZE   ((LAB_OFDM_BB_FRAME_SIZE)*(LAB_OFDM_UPSAMPLE_RATE)) /* Complex */
+#define LAB_OFDM_TX_FRAME_SIZE   ((LAB_OFDM_BB_FRAME_SIZE)*(LAB_OFDM_UPSAMPLE_RATE)) /* Complex. Largest frame size, see lab_ofdm_process_get_tx_frame_size */
 #define LAB_OFDM_FFT_FLAG (0)
 #define LAB_OFDM_IFFT_FLAG (1)
 #define LAB_OFDM_DO_BITREVERSE (1)
 #define LAB_OFDM_FILTER_LENGTH (64)
-#define LAB_OFDM_CENTER_FREQUENCY (4000.0f)
+#define LAB_OFDM_CENTER_FREQUENCY (4000.0f) /* Default center frequency */
+#define LAB_OFDM_MAX_BANDS (2) /* Number of frequency bands used in dual-band mode */
+#define LAB_OFDM_RX_CHUNK_SIZE (256) /* Real samples demodulated/decimated per receiver work unit */
+#define LAB_OFDM_RX_BUDGET_PERCENT (50) /* Share of each audio block the receiver may spend processing */
+/* Combinations of sample rate [Hz], up/downsample rate and center frequency [Hz]
+ * selectable at run time, as X(sample_rate, upsample_rate, center_frequency).
+ * The center frequency is kept at a quarter of the sample rate, which gives an
+ * integer number of carrier periods per receiver work unit. Every mode is
+ * checked at compile time in lab_ofdm_process.c. */
+#define LAB_OFDM_MODES(X) \
+	X(16000, 8, 4000.0f) \
+	X(24000, 8, 6000.0f) \
+	X(48000, 4, 12000.0f)
+#ifndef LAB_OFDM_FIXED_POINT
+#define LAB_OFDM_FIXED_POINT (0) /* Set to 1 to run the sample rate stages in q15 fixed point, see lab_ofdm_process.c */
+#endif
 
 // /** @brief Storage element for generic complex vector */
 // struct Cplx_Signal {
@@ -31,6 +50,13 @@ void lab_ofdm_process_qpsk_encode(char * pMessage, float * pDst, int Mlen);
 void lab_ofdm_process_qpsk_decode(float * pSrc, char * pMessage,  int Mlen);
 void lab_ofdm_process_tx(float * tx_data);
 void lab_ofdm_process_rx(float * rx_data);
+void lab_ofdm_process_rx_start(float * rx_data);
+bool lab_ofdm_process_rx_step(uint32_t budget_cycles);
+bool lab_ofdm_process_rx_busy(void);
+void lab_ofdm_process_print_scratch(void);
 void lab_ofdm_process_init(void);
+void lab_ofdm_process_set_pilot(const char * pilot);
+bool lab_ofdm_process_set_numerology(float center_frequency, int upsample_rate, bool dual_band);
+int lab_ofdm_process_get_tx_frame_size(void);
 
 #endif /* LAB_OFDM_PROCESS_H_ */
@@ -31,12 +31,17 @@
   } while(0)
 
 /** @brief Generic atomic section macro */
+#if defined(__arm__)
 #define ATOMIC(x) 	do{						\
 						CpuCriticalVar();	\
 						CpuEnterCritical();	\
 						x;					\
 						CpuExitCritical();	\
 					}while(0)
+#else
+//Host builds (see tools/) run the audio callback from a single thread without interrupts
+#define ATOMIC(x)	do{ x; }while(0)
+#endif
 
 /** @brief Textboot stringification macro. Allows for the conversion of a preprocessor statement to a string. */
 #define xstr(s) str(s)
@@ -10,6 +10,8 @@
 #include "backend/arm_math.h"
 #include "util.h"
 #include "backend/printfn/printfn.h"
+#include "backend/capture/capture.h"
+#include "backend/dlog/dlog.h"
 #include "example.h"
 #if SYSMODE == SYSMODE_LMS
 #include "lab_lms.h"
@@ -63,9 +65,24 @@
  * 		- No parity bit
  * 		- No flow control (neither hardware nor software)
  *
+ * 	- Messages printed from the audio callback can use DLOG from
+ * 	backend/dlog/dlog.h instead of printf. With DLOG_DEFERRED set in
+ * 	config.h, only the raw arguments are sent and the text is formatted on
+ * 	the PC by tools/dlog_decode.py, which costs far less time per block.
+ *
+ * 	- Received signals can be captured in a binary format with the
+ * 	capture_xx functions in backend/capture/capture.h, and turned into WAV
+ * 	files on the PC with tools/capture2wav.py.
+ *
  * 	- Configurable timers can be added using the systime_xx functions. See
  * 	main_idle for a use-example.
  *
+ * 	- The execution time of any code section can be measured with the
+ * 	profile_xx functions in backend/profile/profile.h. The backend already
+ * 	measures the time spent per block; call profile_print() (bound to the 'p'
+ * 	key in the OFDM lab) to display the results. It prints for long, so call
+ * 	it from main_idle rather than the audio callback.
+ *
  * 	- windows.h contains functions for generating various window functions
  *
  * 	- blocks/gen.h contains functions for generating data vectors
@@ -94,8 +111,9 @@
  * up the hardware to;
  * 	- Use an SPI peripheral to sample the PDM microphone. An interrupt is
  * 	triggered every 16 bits, which is fed into a FIFO buffer.
- * 	- Use the DMA peripheral to write the output DAC, reading from a buffer with
- * 	AUDIO_BLOCKSIZE samples for each output (IE. left and right).
+ * 	- Use the DMA peripheral to write the output DAC, reading circularly from a
+ * 	buffer of AUDIO_OUT_BUFFERS blocks with AUDIO_BLOCKSIZE samples for each
+ * 	output (IE. left and right).
  * 	- Use an USART peripheral to write data stored in a FIFO buffer to the
  * 	serial output, which is used for status/debug messages.
  * 	- While not in an interrupt context, the application will idle in the
@@ -111,13 +129,16 @@ systime_t idle_led_timer;
 
 int main(void){
 	//Generate a compiler error on invalid #define statements
-	BUILD_BUG_ON(AUDIO_SAMPLE_RATE != 16000 && AUDIO_SAMPLE_RATE != 24000 && AUDIO_SAMPLE_RATE != 48000);
+	BUILD_BUG_ON(!AUDIO_SAMPLE_RATE_IS_VALID(AUDIO_SAMPLE_RATE));
 	BUILD_BUG_ON(AUDIO_VOLUME > 85 || AUDIO_VOLUME < 0);
 	BUILD_BUG_ON(MIC_VOLUME > 100 || MIC_VOLUME < 0);
 	BUILD_BUG_ON(!ISPOW2(OUTRAW_BUFFER_SAMPLES));
+	BUILD_BUG_ON(AUDIO_OUT_BUFFERS < 2 || AUDIO_OUT_BUFFERS % 2 != 0);
 	BUILD_BUG_ON(!(SYS_SIGN == 1 || SYS_SIGN == -1));
 	SystemInit();
 	board_init();
+	capture_init();
+	dlog_init();
 
 	printf(DEBUG_STARTUPMSG);
 
@@ -159,6 +180,12 @@ void main_idle(void){
 		idle_led_timer = systime_add_delay(MS2US(IDLE_LED_BLINK_PER_ms/2), idle_led_timer);
 		board_toggle_led(IDLE_LED);
 	}
+	//Stream out pending log messages and captures as room in the USART transmit buffer permits
+	dlog_poll();
+	capture_poll();
+#if SYSMODE == SYSMODE_OFDM
+	lab_ofdm_idle();
+#endif
 }
 
 void main_audio_callback(void){
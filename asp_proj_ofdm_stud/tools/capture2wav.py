@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Reconstructs WAV files from the binary captures in a log of the serial output.
+
+The board sends captures (see src/backend/capture/capture.h) as frames
+(see src/backend/serframe/serframe.h) in between the printed text. Log the
+serial output to a file with any terminal program that saves raw bytes, or
+read the port directly (requires pyserial):
+
+    python3 capture2wav.py log.bin
+    python3 capture2wav.py --port /dev/ttyACM0 --seconds 10
+
+Every complete capture is written to <prefix>_<seq>_<kind>.wav as 16-bit mono
+PCM at the sample rate in use when it was taken. Incomplete captures are
+reported and written with the missing samples set to zero. With --text, the
+text in between frames is printed as well.
+"""
+
+import argparse
+import struct
+import sys
+import wave
+
+SYNC = b'\xa5\x5a'
+TYPE_CAPTURE_HEADER = 0x01
+TYPE_CAPTURE_DATA = 0x02
+KINDS = {0: 'frame', 1: 'mic'}
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE, as computed by serframe_crc16."""
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def frames(data):
+    """Yields (type, payload) for every valid frame and (None, text) for the bytes in between."""
+    pos = 0
+    text_start = 0
+    while True:
+        pos = data.find(SYNC, pos)
+        if pos < 0 or pos + 7 > len(data):
+            break
+        ftype, length = struct.unpack_from('<BH', data, pos + 2)
+        end = pos + 5 + length + 2
+        if end <= len(data):
+            body = data[pos + 2:pos + 5 + length]
+            (crc,) = struct.unpack_from('<H', data, pos + 5 + length)
+            if crc16(body) == crc:
+                if pos > text_start:
+                    yield None, data[text_start:pos]
+                yield ftype, body[3:]
+                pos = text_start = end
+                continue
+        # Not a frame, or a damaged one; resynchronize on the next sync bytes
+        pos += 1
+    if text_start < len(data):
+        yield None, data[text_start:]
+
+
+class Capture:
+    def __init__(self, seq, kind, sample_rate, length):
+        self.seq = seq
+        self.kind = kind
+        self.sample_rate = sample_rate
+        self.samples = bytearray(2 * length)
+        self.received = 0
+
+    def add(self, offset, samples):
+        self.samples[2 * offset:2 * offset + len(samples)] = samples
+        self.received += len(samples) // 2
+
+    def complete(self):
+        return self.received * 2 == len(self.samples)
+
+
+def write_wav(cap, prefix):
+    name = '%s_%05d_%s.wav' % (prefix, cap.seq, KINDS.get(cap.kind, 'kind%d' % cap.kind))
+    with wave.open(name, 'wb') as w:
+        w.setnchannels(1)
+        w.setsampwidth(2)
+        w.setframerate(cap.sample_rate)
+        w.writeframes(bytes(cap.samples))
+    status = 'complete' if cap.complete() else 'INCOMPLETE, %d of %d samples' % (cap.received, len(cap.samples) // 2)
+    print('%s: %d samples at %d Hz, %s' % (name, len(cap.samples) // 2, cap.sample_rate, status), file=sys.stderr)
+
+
+def convert(data, prefix, show_text):
+    cap = None
+    count = 0
+    for ftype, payload in frames(data):
+        if ftype is None:
+            if show_text:
+                sys.stdout.write(payload.decode('latin-1'))
+        elif ftype == TYPE_CAPTURE_HEADER and len(payload) == 12:
+            if cap is not None:
+                write_wav(cap, prefix)
+                count += 1
+            seq, kind, _, sample_rate, length = struct.unpack('<HBBII', payload)
+            cap = Capture(seq, kind, sample_rate, length)
+        elif ftype == TYPE_CAPTURE_DATA and len(payload) >= 6:
+            seq, offset = struct.unpack_from('<HI', payload)
+            samples = payload[6:]
+            if cap is None or seq != cap.seq or 2 * offset + len(samples) > len(cap.samples):
+                print('Dropping data of capture %d without its header' % seq, file=sys.stderr)
+                continue
+            cap.add(offset, samples)
+    if cap is not None:
+        write_wav(cap, prefix)
+        count += 1
+    return count
+
+
+def read_port(port, baudrate, seconds):
+    import serial
+    import time
+    data = bytearray()
+    with serial.Serial(port, baudrate, timeout=0.1) as s:
+        t_end = time.monotonic() + seconds
+        while time.monotonic() < t_end:
+            data += s.read(65536)
+    return bytes(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('log', nargs='?', help='file with the raw serial output')
+    parser.add_argument('--port', help='read from this serial port instead of a file')
+    parser.add_argument('--baudrate', type=int, default=921600, help='see DEBUG_USART_BAUDRATE (default %(default)s)')
+    parser.add_argument('--seconds', type=float, default=10, help='time to read from the port (default %(default)s)')
+    parser.add_argument('--prefix', default='capture', help='prefix of the WAV files (default %(default)s)')
+    parser.add_argument('--text', action='store_true', help='print the text in between frames')
+    args = parser.parse_args()
+    if args.port:
+        data = read_port(args.port, args.baudrate, args.seconds)
+    elif args.log:
+        with open(args.log, 'rb') as f:
+            data = f.read()
+    else:
+        parser.error('either a log file or --port is required')
+    if convert(data, args.prefix, args.text) == 0:
+        print('No captures found', file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
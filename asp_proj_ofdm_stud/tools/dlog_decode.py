@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""Formats the deferred log messages in a log of the serial output.
+
+With DLOG_DEFERRED set in src/config.h, DLOG messages are sent as the
+identifier of their format string and the raw argument values (see
+src/backend/dlog/dlog.h). The format strings are read from the dlog_fmt
+section of the firmware ELF file, which must be the one running on the board;
+PlatformIO leaves it at .pioenvs/<env>/firmware.elf. Log the serial output to
+a file with any terminal program that saves raw bytes, or read the port
+directly (requires pyserial):
+
+    python3 dlog_decode.py firmware.elf log.bin
+    python3 dlog_decode.py firmware.elf --port /dev/ttyACM0 --seconds 30
+
+The messages are printed in between the text written with printf, as it
+would have appeared on a terminal. With --time, every message is preceded by
+its timestamp.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+from capture2wav import frames, read_port
+
+TYPE_LOG = 0x20
+SECTION = 'dlog_fmt'
+
+# A printf conversion; flags, width, precision, length modifier and conversion
+CONVERSION = re.compile(r'%([-+ #0]*)(\d*)(\.\d*)?(hh|h|ll|l|z|j|t|L)?([diouxXeEfFgGcsp%])')
+
+
+def elf_section(path, name):
+    """Returns the contents of a section of an ELF file, or None if there is no such section."""
+    with open(path, 'rb') as f:
+        elf = f.read()
+    if elf[:4] != b'\x7fELF' or elf[5] != 1:
+        raise ValueError('%s is not a little endian ELF file' % path)
+    if elf[4] == 1:
+        (shoff,) = struct.unpack_from('<I', elf, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', elf, 0x2E)
+        header = '<IIIIII'
+    else:
+        (shoff,) = struct.unpack_from('<Q', elf, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', elf, 0x3A)
+        header = '<IIQQQQ'
+    sections = [struct.unpack_from(header, elf, shoff + i * shentsize) for i in range(shnum)]
+    strtab = sections[shstrndx][4]
+    for sh_name, _, _, _, offset, size in sections:
+        end = elf.index(b'\0', strtab + sh_name)
+        if elf[strtab + sh_name:end].decode('latin-1') == name:
+            return elf[offset:offset + size]
+    return None
+
+
+def expand(fmt, args):
+    """Formats a message with printf format fmt and the raw argument bytes args."""
+    out = []
+    pos = 0
+    argpos = 0
+    for m in CONVERSION.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, precision, _, conv = m.groups()
+        if conv == '%':
+            out.append('%')
+            continue
+        spec = '%' + flags + width + (precision or '')
+        if conv == 's':
+            (n,) = struct.unpack_from('<H', args, argpos)
+            value = args[argpos + 2:argpos + 2 + n].decode('latin-1')
+            argpos += 2 + n + (n & 1)
+        else:
+            word = args[argpos:argpos + 4]
+            argpos += 4
+            if conv in 'eEfFgG':
+                (value,) = struct.unpack('<f', word)
+            elif conv in 'di':
+                (value,) = struct.unpack('<i', word)
+            else:
+                (value,) = struct.unpack('<I', word)
+            if conv == 'p':
+                spec, conv = '0x%08', 'x'
+            elif conv == 'c':
+                value = chr(value & 0xFF)
+        out.append((spec + conv) % value)
+    out.append(fmt[pos:])
+    if argpos != len(args):
+        raise struct.error('arguments do not match the format string')
+    return ''.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('elf', help='the firmware ELF file')
+    parser.add_argument('log', nargs='?', help='file with the raw serial output')
+    parser.add_argument('--port', help='read from this serial port instead of a file')
+    parser.add_argument('--baudrate', type=int, default=921600, help='see DEBUG_USART_BAUDRATE (default %(default)s)')
+    parser.add_argument('--seconds', type=float, default=10, help='time to read from the port (default %(default)s)')
+    parser.add_argument('--time', action='store_true', help='precede every message by its timestamp')
+    args = parser.parse_args()
+    strings = elf_section(args.elf, SECTION)
+    if strings is None:
+        print('%s has no %s section; was it built with DLOG_DEFERRED set?' % (args.elf, SECTION), file=sys.stderr)
+        return 1
+    if args.port:
+        data = read_port(args.port, args.baudrate, args.seconds)
+    elif args.log:
+        with open(args.log, 'rb') as f:
+            data = f.read()
+    else:
+        parser.error('either a log file or --port is required')
+    for ftype, payload in frames(data):
+        if ftype is None:
+            sys.stdout.write(payload.decode('latin-1'))
+            continue
+        if ftype != TYPE_LOG or len(payload) < 6:
+            continue
+        stamp, fid = struct.unpack_from('<IH', payload)
+        if args.time:
+            sys.stdout.write('[%10.3f s] ' % (stamp * 1e-6))
+        if fid >= len(strings):
+            sys.stdout.write('[unknown format %d, is the ELF file the one running?]\n' % fid)
+            continue
+        fmt = strings[fid:strings.index(b'\0', fid)].decode('latin-1')
+        try:
+            sys.stdout.write(expand(fmt, payload[6:]))
+        except (struct.error, TypeError, ValueError):
+            sys.stdout.write('[malformed message for format %r]\n' % fmt)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""Writes the golden vectors of the OFDM stages without MATLAB.
+
+A line-by-line transcription of export_golden_vectors.m in the repository
+root, in plain Python 3 without third-party modules, so that the vectors can
+be regenerated on any machine. The committed vectors in golden/ were written
+by it:
+
+    python3 tools/export_golden_vectors.py ../golden
+
+They have not been compared with the output of the MATLAB script, so they are
+only as good as this transcription. Running export_golden_vectors in MATLAB
+and comparing the two sets of files would verify them.
+
+The only difference from the MATLAB script is the interpolation filter B.
+firpm is not available, so its coefficients are read from lp_filter in
+src/lab_ofdm_process.c, where they were printed by the same firpm call to
+16 significant digits. The filter stage of ofdm_sweep --golden therefore
+only confirms that lp_filter is unchanged.
+"""
+
+import argparse
+import cmath
+import math
+import os
+import re
+import sys
+
+N = 64
+N_CP = 32
+R = 8
+F0 = 4000.0
+
+SOURCE = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src', 'lab_ofdm_process.c')
+
+
+def lp_filter():
+    """Returns the coefficients of lp_filter in src/lab_ofdm_process.c."""
+    with open(SOURCE) as f:
+        src = f.read()
+    table = src.split('lp_filter[LAB_OFDM_FILTER_LENGTH] =', 1)[1].split('};', 1)[0]
+    return [float(v) for v in re.findall(r'([-+]?\d\.\d+e[-+]\d+)f', table)]
+
+
+def char_block(s):
+    """Pads the string s with zero characters to the N/4 characters of a block."""
+    return [ord(c) for c in s] + [0] * (N // 4 - len(s))
+
+
+def char2bits(s):
+    """Bits of the characters in s, least significant bit first."""
+    return [(c >> k) & 1 for c in s for k in range(8)]
+
+
+def bits2char(bits):
+    return [sum(bits[8 * i + k] << k for k in range(8)) for i in range(len(bits) // 8)]
+
+
+def bits2sym(bits):
+    """bits2sym.m scaled by sqrt(2), as in the C code."""
+    return [complex(2 * bits[i] - 1, 2 * bits[i + 1] - 1) for i in range(0, len(bits), 2)]
+
+
+def sym2bits(symbols):
+    return [int(b) for v in symbols for b in (v.real > 0, v.imag > 0)]
+
+
+def dft(x, inverse=False):
+    """fft and ifft, as direct transforms, which are fast enough for N = 64."""
+    n = len(x)
+    s = 1 if inverse else -1
+    y = [sum(x[k] * cmath.exp(s * 2j * math.pi * k * m / n) for k in range(n)) for m in range(n)]
+    return [v / n for v in y] if inverse else y
+
+
+def ofdm_gen(symbol):
+    """OFDM_gen.m"""
+    z = dft(symbol, True)
+    return z[-N_CP:] + z
+
+
+def conv(x, h, n):
+    """The first n samples of conv(x, h)."""
+    return [sum(h[k] * x[i - k] for k in range(len(h)) if 0 <= i - k < len(x)) for i in range(n)]
+
+
+def export(dirname, fs, fcm):
+    message = char_block('Hello World!AAA')
+    pilot = char_block('Pilot Signal!')
+
+    # Encode
+    symbol = bits2sym(char2bits(message))
+    pilot_symbol = bits2sym(char2bits(pilot))
+
+    # Generate OFDM frame
+    z = ofdm_gen(pilot_symbol) + ofdm_gen(symbol)
+
+    # Interpolate
+    zu = [0j] * (len(z) * R)
+    zu[::R] = z
+    b = lp_filter()
+    zi = conv(zu, b, len(zu))
+
+    # Modulate
+    zmr = [(zi[n] * cmath.exp(2j * math.pi * fcm / fs * n)).real for n in range(len(zi))]
+
+    # Channel, filter(b_chan, a_chan, zmr/max(abs(zmr)))
+    peak = max(abs(v) for v in zmr)
+    a1 = -2 * 0.9 * math.cos(2 * math.pi * F0 / fs)
+    a2 = 0.81
+    x1 = x2 = y1 = y2 = 0.0
+    yrec = []
+    for v in zmr:
+        v /= peak
+        y = v - x2 - a1 * y1 - a2 * y2
+        x2, x1, y2, y1 = x1, v, y1, y
+        yrec.append(y)
+
+    # Demodulate
+    yib = [2 * yrec[n] * cmath.exp(-2j * math.pi * fcm / fs * n) for n in range(len(yrec))]
+
+    # Decimate
+    y = conv(yib, b, len(yib))[::R]
+
+    # FFT, equalize and decode
+    pilot_fft = dft(y[N_CP:N_CP + N])
+    message_fft = dft(y[2 * N_CP + N:2 * N_CP + 2 * N])
+    h_hat = [pilot_fft[k] / pilot_symbol[k] for k in range(N)]
+    equalized = [h_hat[k].conjugate() * message_fft[k] for k in range(N)]
+    soft_symbol = [equalized[k] / abs(h_hat[k]) ** 2 for k in range(N)]
+    decoded = bits2char(sym2bits(equalized))
+    if decoded != message:
+        print('The reference chain did not decode the message', file=sys.stderr)
+
+    # Export
+    os.makedirs(dirname, exist_ok=True)
+    vectors = [
+        ('params', [fs, fcm, R, N, N_CP]),
+        ('message', message),
+        ('pilot', pilot),
+        ('symbols', symbol),
+        ('pilot_symbols', pilot_symbol),
+        ('frame', z),
+        ('filter', b),
+        ('interpolated', zi),
+        ('tx', zmr),
+        ('rx', yrec),
+        ('demodulated', yib),
+        ('baseband', y),
+        ('pilot_fft', pilot_fft),
+        ('message_fft', message_fft),
+        ('hhat_conj', [v.conjugate() for v in h_hat]),
+        ('equalized', equalized),
+        ('soft_symbols', soft_symbol),
+        ('decoded', decoded),
+    ]
+    for name, x in vectors:
+        with open(os.path.join(dirname, name + '.csv'), 'w') as f:
+            for v in x:
+                if isinstance(v, complex):
+                    f.write('%.9g,%.9g\n' % (v.real, v.imag))
+                else:
+                    f.write('%.9g\n' % v)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('dirname', nargs='?', default='golden', help='output directory (default %(default)s)')
+    parser.add_argument('--fs', type=float, default=16000, help='audio sample rate [Hz] (default %(default)s)')
+    parser.add_argument('--fc', type=float, default=4000, help='center frequency [Hz] (default %(default)s)')
+    args = parser.parse_args()
+    export(args.dirname, args.fs, args.fc)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,366 @@
+/** @file Unit test of the block graph scheduler on the PC.
+ * Checks src/blocks/graph.c for the argument checks of graph_add_node and
+ * graph_connect, the topological order of nodes added in any order, the
+ * rejection of cycles, unconnected inputs, mismatched input lengths,
+ * non-integer rate ratios and too small pools, the buffer lengths of a
+ * multi-rate section, and the placement of buffers in the pool: buffers
+ * whose lifetimes overlap must not share memory, while a chain of nodes must
+ * reuse the memory of buffers no longer read. Finally runs a graph with two
+ * sources, a fan-out and a two-input node and checks the samples arriving at
+ * the sinks. The microphone, waveform and output blocks graph.c refers to are
+ * replaced by stubs. The exit status is nonzero if any check fails.
+ *
+ * Build and run from the asp_proj_ofdm_stud directory:
+ *
+ *	gcc -O2 -std=gnu11 -o graph_test tools/graph_test.c src/blocks/graph.c -Isrc
+ *	./graph_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "macro.h"
+#include "blocks/graph.h"
+#include "blocks/sources.h"
+#include "blocks/sinks.h"
+
+/** @brief Pool length of the tests [samples], room for all buffers of any test graph */
+#define GRAPH_TEST_POOL		(32*AUDIO_BLOCKSIZE)
+
+static int graph_test_checks, graph_test_failures;
+
+/** @brief Counts a check, printing it if it fails */
+#define CHECK(cond)	do{																\
+		graph_test_checks++;														\
+		if(!(cond)){																\
+			graph_test_failures++;													\
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);			\
+		}																			\
+	}while(0)
+
+static float graph_test_pool[GRAPH_TEST_POOL];
+
+/* Stubs of the blocks used by the node functions of graph.c */
+void blocks_sources_microphone(float * sample_block){}
+void blocks_sources_waveform(float * sample_block){}
+void blocks_sinks_leftout(float * sample_block){}
+void blocks_sinks_rightout(float * sample_block){}
+
+/** @brief Node function doing nothing, for tests that only compile a graph */
+static void graph_test_fn_nop(void * ctx, const float * const * inp, float * const * out, int_fast32_t len){}
+
+/** @brief Node function writing the ramp start, start+1, ... to its single output, start given by ctx */
+static void graph_test_fn_ramp(void * ctx, const float * const * inp, float * const * out, int_fast32_t len){
+	const float start = *(const float *) ctx;
+	int_fast32_t i;
+	for(i = 0; i < len; i++){
+		out[0][i] = start + i;
+	}
+}
+
+/** @brief Node function scaling its single input by the factor given by ctx */
+static void graph_test_fn_gain(void * ctx, const float * const * inp, float * const * out, int_fast32_t len){
+	const float gain = *(const float *) ctx;
+	int_fast32_t i;
+	for(i = 0; i < len; i++){
+		out[0][i] = gain * inp[0][i];
+	}
+}
+
+/** @brief Node function adding its two inputs */
+static void graph_test_fn_add(void * ctx, const float * const * inp, float * const * out, int_fast32_t len){
+	int_fast32_t i;
+	for(i = 0; i < len; i++){
+		out[0][i] = inp[0][i] + inp[1][i];
+	}
+}
+
+/** @brief Node function copying its single input to the buffer given by ctx */
+static void graph_test_fn_sink(void * ctx, const float * const * inp, float * const * out, int_fast32_t len){
+	float * const dst = ctx;
+	int_fast32_t i;
+	for(i = 0; i < len; i++){
+		dst[i] = inp[0][i];
+	}
+}
+
+/** @brief Returns the position of node n in the schedule of a compiled graph, or -1 */
+static int graph_test_pos(const struct graph_s * const g, const int_fast8_t n){
+	int pos;
+	for(pos = 0; pos < g->n_nodes; pos++){
+		if(g->order[pos] == n){
+			return pos;
+		}
+	}
+	return -1;
+}
+
+/** @brief Checks that a compiled graph schedules every node once and after the nodes feeding it */
+static void graph_test_check_order(const struct graph_s * const g){
+	int_fast8_t n;
+	uint_fast8_t port;
+	for(n = 0; n < g->n_nodes; n++){
+		const int pos = graph_test_pos(g, n);
+		CHECK(pos >= 0);
+		for(port = 0; port < g->nodes[n].n_in; port++){
+			CHECK(graph_test_pos(g, g->nodes[n].src_node[port]) < pos);
+		}
+	}
+}
+
+/** @brief Checks that the output buffers of a compiled graph lie in the pool and
+ * that no two buffers overlap while both are live */
+static void graph_test_check_placement(const struct graph_s * const g){
+	int_fast8_t n, m;
+	uint_fast8_t port, other_port;
+	for(n = 0; n < g->n_nodes; n++){
+		const struct graph_node_s * const a = &g->nodes[n];
+		const int a_pos = graph_test_pos(g, n);
+		for(port = 0; port < a->n_out; port++){
+			CHECK(a->out_offset[port] >= 0 && a->out_offset[port] + a->out_len <= g->pool_used);
+			CHECK(a->out[port] == &g->pool[a->out_offset[port]]);
+			for(m = 0; m < g->n_nodes; m++){
+				const struct graph_node_s * const b = &g->nodes[m];
+				const int b_pos = graph_test_pos(g, m);
+				if(a_pos > b->last_use || b_pos > a->last_use){
+					continue;
+				}
+				for(other_port = 0; other_port < b->n_out; other_port++){
+					if(m == n && other_port == port){
+						continue;
+					}
+					CHECK(a->out_offset[port] + a->out_len <= b->out_offset[other_port]
+							|| b->out_offset[other_port] + b->out_len <= a->out_offset[port]);
+				}
+			}
+		}
+	}
+}
+
+static void graph_test_args(void){
+	struct graph_s g;
+	graph_init(&g, graph_test_pool, NUMEL(graph_test_pool));
+	CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, GRAPH_MAX_PORTS + 1, 1, 1, 1) < 0);
+	CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, 1, GRAPH_MAX_PORTS + 1, 1, 1) < 0);
+	CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 0, 1) < 0);
+	CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 1, 0) < 0);
+	const int_fast8_t src = graph_add_node(&g, graph_test_fn_nop, NULL, 0, 1, 1, 1);
+	const int_fast8_t dst = graph_add_node(&g, graph_test_fn_nop, NULL, 1, 0, 1, 1);
+	CHECK(src == 0 && dst == 1);
+	CHECK(!graph_connect(&g, src, 1, dst, 0));
+	CHECK(!graph_connect(&g, src, 0, dst, 1));
+	CHECK(!graph_connect(&g, -1, 0, dst, 0));
+	CHECK(!graph_connect(&g, src, 0, 2, 0));
+
+	//An input left unconnected by the failed calls above
+	CHECK(!graph_compile(&g));
+	CHECK(graph_connect(&g, src, 0, dst, 0));
+	CHECK(graph_compile(&g));
+
+	//Adding a node invalidates the compiled graph
+	CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, 0, 1, 1, 1) == 2);
+	CHECK(!g.compiled);
+	while(g.n_nodes < GRAPH_MAX_NODES){
+		CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, 0, 1, 1, 1) >= 0);
+	}
+	CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, 0, 1, 1, 1) < 0);
+}
+
+static void graph_test_order(void){
+	/* A diamond added backwards, sink first:
+	 * src -> a -> add <- b <- src, add -> sink */
+	struct graph_s g;
+	graph_init(&g, graph_test_pool, NUMEL(graph_test_pool));
+	const int_fast8_t sink = graph_add_node(&g, graph_test_fn_nop, NULL, 1, 0, 1, 1);
+	const int_fast8_t add = graph_add_node(&g, graph_test_fn_nop, NULL, 2, 1, 1, 1);
+	const int_fast8_t b = graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 1, 1);
+	const int_fast8_t a = graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 1, 1);
+	const int_fast8_t src = graph_add_node(&g, graph_test_fn_nop, NULL, 0, 1, 1, 1);
+	CHECK(graph_connect(&g, add, 0, sink, 0));
+	CHECK(graph_connect(&g, a, 0, add, 0));
+	CHECK(graph_connect(&g, b, 0, add, 1));
+	CHECK(graph_connect(&g, src, 0, a, 0));
+	CHECK(graph_connect(&g, src, 0, b, 0));
+	CHECK(graph_compile(&g));
+	graph_test_check_order(&g);
+
+	//Among the ready nodes the earliest added runs first
+	CHECK(g.order[0] == src && g.order[1] == b && g.order[2] == a && g.order[3] == add && g.order[4] == sink);
+	graph_test_check_placement(&g);
+}
+
+static void graph_test_cycle(void){
+	/* src -> a -> b -> a, b -> sink; a and b wait on each other */
+	struct graph_s g;
+	graph_init(&g, graph_test_pool, NUMEL(graph_test_pool));
+	const int_fast8_t src = graph_add_node(&g, graph_test_fn_nop, NULL, 0, 1, 1, 1);
+	const int_fast8_t a = graph_add_node(&g, graph_test_fn_add, NULL, 2, 1, 1, 1);
+	const int_fast8_t b = graph_add_node(&g, graph_test_fn_gain, NULL, 1, 1, 1, 1);
+	const int_fast8_t sink = graph_add_node(&g, graph_test_fn_nop, NULL, 1, 0, 1, 1);
+	CHECK(graph_connect(&g, src, 0, a, 0));
+	CHECK(graph_connect(&g, b, 0, a, 1));
+	CHECK(graph_connect(&g, a, 0, b, 0));
+	CHECK(graph_connect(&g, b, 0, sink, 0));
+	CHECK(!graph_compile(&g));
+	CHECK(!g.compiled);
+
+	//Running a graph that failed to compile does nothing, the functions above would crash on NULL contexts
+	graph_run(&g);
+
+	//A node feeding itself
+	graph_init(&g, graph_test_pool, NUMEL(graph_test_pool));
+	const int_fast8_t self = graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 1, 1);
+	CHECK(graph_connect(&g, self, 0, self, 0));
+	CHECK(!graph_compile(&g));
+
+	//Breaking the cycle makes the graph valid
+	graph_init(&g, graph_test_pool, NUMEL(graph_test_pool));
+	CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, 0, 1, 1, 1) == src);
+	CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, 2, 1, 1, 1) == a);
+	CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 1, 1) == b);
+	CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, 1, 0, 1, 1) == sink);
+	CHECK(graph_connect(&g, src, 0, a, 0));
+	CHECK(graph_connect(&g, src, 0, a, 1));
+	CHECK(graph_connect(&g, a, 0, b, 0));
+	CHECK(graph_connect(&g, b, 0, sink, 0));
+	CHECK(graph_compile(&g));
+	graph_test_check_order(&g);
+}
+
+static void graph_test_rates(void){
+	/* src -> up by 8 -> down by 8 -> sink, plus the mismatched and
+	 * non-integer cases */
+	struct graph_s g;
+	graph_init(&g, graph_test_pool, NUMEL(graph_test_pool));
+	const int_fast8_t src = graph_add_node(&g, graph_test_fn_nop, NULL, 0, 1, 1, 1);
+	const int_fast8_t up = graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 8, 1);
+	const int_fast8_t down = graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 1, 8);
+	const int_fast8_t sink = graph_add_node(&g, graph_test_fn_nop, NULL, 1, 0, 1, 1);
+	CHECK(graph_connect(&g, src, 0, up, 0));
+	CHECK(graph_connect(&g, up, 0, down, 0));
+	CHECK(graph_connect(&g, down, 0, sink, 0));
+	CHECK(graph_compile(&g));
+	CHECK(g.nodes[src].out_len == AUDIO_BLOCKSIZE);
+	CHECK(g.nodes[up].in_len == AUDIO_BLOCKSIZE && g.nodes[up].out_len == 8*AUDIO_BLOCKSIZE);
+	CHECK(g.nodes[down].in_len == 8*AUDIO_BLOCKSIZE && g.nodes[down].out_len == AUDIO_BLOCKSIZE);
+	CHECK(g.nodes[sink].in_len == AUDIO_BLOCKSIZE);
+	graph_test_check_placement(&g);
+
+	//The decimated buffer reuses the source buffer, which is only read by the upsampler
+	CHECK(g.pool_used == 9*AUDIO_BLOCKSIZE);
+	CHECK(g.nodes[down].out[0] == g.nodes[src].out[0]);
+
+	//A pool one sample too short is rejected, but still reports the length required
+	graph_init(&g, graph_test_pool, 9*AUDIO_BLOCKSIZE - 1);
+	graph_add_node(&g, graph_test_fn_nop, NULL, 0, 1, 1, 1);
+	graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 8, 1);
+	graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 1, 8);
+	graph_add_node(&g, graph_test_fn_nop, NULL, 1, 0, 1, 1);
+	CHECK(graph_connect(&g, src, 0, up, 0));
+	CHECK(graph_connect(&g, up, 0, down, 0));
+	CHECK(graph_connect(&g, down, 0, sink, 0));
+	CHECK(!graph_compile(&g));
+	CHECK(g.pool_used == 9*AUDIO_BLOCKSIZE);
+
+	//Inputs of different lengths
+	graph_init(&g, graph_test_pool, NUMEL(graph_test_pool));
+	graph_add_node(&g, graph_test_fn_nop, NULL, 0, 1, 1, 1);
+	graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 2, 1);
+	const int_fast8_t add = graph_add_node(&g, graph_test_fn_nop, NULL, 2, 1, 1, 1);
+	CHECK(graph_connect(&g, 0, 0, 1, 0));
+	CHECK(graph_connect(&g, 0, 0, add, 0));
+	CHECK(graph_connect(&g, 1, 0, add, 1));
+	CHECK(!graph_compile(&g));
+
+	//A ratio not giving an integer length, AUDIO_BLOCKSIZE is a power of two
+	graph_init(&g, graph_test_pool, NUMEL(graph_test_pool));
+	graph_add_node(&g, graph_test_fn_nop, NULL, 0, 1, 1, 1);
+	graph_add_node(&g, graph_test_fn_nop, NULL, 1, 1, 1, 3);
+	CHECK(graph_connect(&g, 0, 0, 1, 0));
+	CHECK(!graph_compile(&g));
+}
+
+static void graph_test_reuse(void){
+	/* A chain of eight 1:1 nodes. Each buffer is only live from its writer
+	 * to the next node, so two buffers suffice for the whole chain. */
+	struct graph_s g;
+	graph_init(&g, graph_test_pool, NUMEL(graph_test_pool));
+	int_fast8_t n;
+	for(n = 0; n < 8; n++){
+		CHECK(graph_add_node(&g, graph_test_fn_nop, NULL, n ? 1 : 0, 1, 1, 1) == n);
+		if(n){
+			CHECK(graph_connect(&g, n - 1, 0, n, 0));
+		}
+	}
+	CHECK(graph_compile(&g));
+	graph_test_check_placement(&g);
+	CHECK(g.pool_used == 2*AUDIO_BLOCKSIZE);
+	for(n = 2; n < 8; n++){
+		CHECK(g.nodes[n].out[0] == g.nodes[n - 2].out[0]);
+	}
+
+	//A buffer read at the end of the chain stays live, so the others need a second slot around it
+	const int_fast8_t add = graph_add_node(&g, graph_test_fn_nop, NULL, 2, 1, 1, 1);
+	CHECK(graph_connect(&g, 0, 0, add, 0));
+	CHECK(graph_connect(&g, 7, 0, add, 1));
+	CHECK(graph_compile(&g));
+	graph_test_check_placement(&g);
+	CHECK(g.pool_used == 3*AUDIO_BLOCKSIZE);
+	for(n = 1; n < 8; n++){
+		CHECK(g.nodes[n].out[0] != g.nodes[0].out[0]);
+	}
+}
+
+static void graph_test_run(void){
+	/* ramp0 -> gain -> add -> sink0
+	 * ramp1 ---------> add
+	 * ramp1 -> sink1
+	 * Checks the samples at the sinks, so a misplaced buffer overwriting one
+	 * still to be read shows up as wrong values. */
+	static float out0[AUDIO_BLOCKSIZE], out1[AUDIO_BLOCKSIZE];
+	float start0 = 1000, start1 = -5, gain = 3;
+	struct graph_s g;
+	graph_init(&g, graph_test_pool, NUMEL(graph_test_pool));
+	const int_fast8_t sink0 = graph_add_node(&g, graph_test_fn_sink, out0, 1, 0, 1, 1);
+	const int_fast8_t ramp0 = graph_add_node(&g, graph_test_fn_ramp, &start0, 0, 1, 1, 1);
+	const int_fast8_t amp = graph_add_node(&g, graph_test_fn_gain, &gain, 1, 1, 1, 1);
+	const int_fast8_t add = graph_add_node(&g, graph_test_fn_add, NULL, 2, 1, 1, 1);
+	const int_fast8_t ramp1 = graph_add_node(&g, graph_test_fn_ramp, &start1, 0, 1, 1, 1);
+	const int_fast8_t sink1 = graph_add_node(&g, graph_test_fn_sink, out1, 1, 0, 1, 1);
+	CHECK(graph_connect(&g, ramp0, 0, amp, 0));
+	CHECK(graph_connect(&g, amp, 0, add, 0));
+	CHECK(graph_connect(&g, ramp1, 0, add, 1));
+	CHECK(graph_connect(&g, add, 0, sink0, 0));
+	CHECK(graph_connect(&g, ramp1, 0, sink1, 0));
+	CHECK(graph_compile(&g));
+	graph_test_check_order(&g);
+	graph_test_check_placement(&g);
+	CHECK(g.pool_used < 4*AUDIO_BLOCKSIZE);
+
+	//Twice, as the callback would, with the pool left dirty by the first run
+	int run, i, wrong;
+	for(run = 0; run < 2; run++){
+		graph_run(&g);
+		wrong = 0;
+		for(i = 0; i < AUDIO_BLOCKSIZE; i++){
+			wrong += out0[i] != gain * (start0 + i) + (start1 + i);
+			wrong += out1[i] != start1 + i;
+		}
+		CHECK(wrong == 0);
+		start0 += 1;
+		start1 -= 1;
+	}
+}
+
+int main(void){
+	graph_test_args();
+	graph_test_order();
+	graph_test_cycle();
+	graph_test_rates();
+	graph_test_reuse();
+	graph_test_run();
+	printf("%d of %d checks failed\n", graph_test_failures, graph_test_checks);
+	return graph_test_failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,329 @@
+/** @file Replays a recording through the OFDM lab on the PC.
+ * Runs src/lab_ofdm.c as main_audio_callback does on the board, with the
+ * microphone replaced by a WAV file through blocks_sources_file_attach and
+ * the outputs captured to a WAV file through blocks_sinks_file_attach, see
+ * src/blocks/file.h. Every audio block runs the same sequence as
+ * WavePlayBack:
+ *
+ *	blocks_sources_update();
+ *	main_audio_callback();
+ *	blocks_sinks_update();
+ *
+ * as fast as it completes, with the system time advanced by one block each
+ * time. The recording is typically a capture of the board converted by
+ * tools/capture2wav.py, at one of the sample rates of the modes selectable
+ * with the 'r' key; the numerology of that mode is selected before
+ * lab_ofdm_init is called. Silence is replayed for --lead seconds before
+ * the recording, for the envelope detector to settle as it does after
+ * startup, and for --tail seconds after it, so that a frame detected near its
+ * end is still completed and received. The receiver is given all the time it asks for in every
+ * block, so the output does not depend on the speed of the PC. Its messages
+ * are printed to stdout, and the outputs, both channels, are written to the
+ * output file as 16-bit PCM.
+ *
+ * Build from the asp_proj_ofdm_stud directory, with SYSMODE set to
+ * SYSMODE_OFDM in src/config.h:
+ *
+ *	gcc -O2 -std=gnu11 -funsigned-char -o ofdm_replay tools/ofdm_replay.c \
+ *		src/lab_ofdm.c src/lab_ofdm_process.c src/blocks/sources.c src/blocks/sinks.c \
+ *		src/blocks/file.c src/blocks/misc.c src/backend/pcm/pcm.c src/backend/systime/systime.c \
+ *		src/backend/arena.c src/backend/profile/profile.c \
+ *		$(ls src/backend/CMSIS/Source/[A-Z]*Functions/arm_{cfft,cfft_radix8,fir_interpolate,fir_interpolate_init,fir_decimate,fir_decimate_init,cmplx_mult_cmplx,cmplx_mag_squared,cmplx_conj,add,sub,scale,copy,fill,sin,cos}_f32.c) \
+ *		src/backend/CMSIS/Source/TransformFunctions/arm_bitreversal.c \
+ *		src/backend/CMSIS/Source/CommonTables/arm_common_tables.c \
+ *		src/backend/CMSIS/Source/CommonTables/arm_const_structs.c \
+ *		-Isrc -Isrc/backend -Isrc/backend/CMSIS/Include -DARM_MATH_CM4 -D__FPU_PRESENT=1 \
+ *		-Dprintf=printfn "-DM_TWOPI=(2*M_PI)" -lm
+ *
+ * Example, receiving a frame captured with the 'c' key:
+ *
+ *	python3 tools/capture2wav.py log.bin
+ *	./ofdm_replay capture_00000_frame.wav out.wav */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+#include <getopt.h>
+#include "config.h"
+#include "macro.h"
+#include "main.h"
+#include "lab_ofdm.h"
+#include "lab_ofdm_process.h"
+#include "blocks/sources.h"
+#include "blocks/sinks.h"
+#include "blocks/file.h"
+#include "blocks/waveform.h"
+#include "backend/systime/systime.h"
+#include "backend/hw/board.h"
+#include "backend/capture/capture.h"
+#include "backend/telemetry/telemetry.h"
+
+//printf is mapped to printfn for the lab code, which prints to stdout below
+#undef printf
+int printf(const char * fmt, ...);
+
+/** @brief Numerologies selected by the sample rate of the recording, as in lab_ofdm.c */
+static const struct replay_mode_s {
+	uint32_t sample_rate;	//!<- Audio sample rate [Hz]
+	int upsample_rate;		//!<- Up/downsample rate between the baseband and the audio signal
+	float center_frequency;	//!<- OFDM center frequency [Hz]
+} replay_modes[] = {
+#define REPLAY_MODE(fs, rate, fc)	{(fs), (rate), (fc)},
+		LAB_OFDM_MODES(REPLAY_MODE)
+};
+
+/** @brief Sample rate returned to the lab code, that of the recording */
+static uint32_t replay_sample_rate = AUDIO_SAMPLE_RATE;
+
+/* Replacements for the board backend used by lab_ofdm.c and the blocks */
+
+/** @brief The microphone input, silent before the recording is attached */
+float processed_micdata[AUDIO_BLOCKSIZE];
+
+/** @brief The stored waveform, unused by the OFDM lab */
+const int16_t waveform[NUMEL(waveform)];
+
+int printfn(const char * fmt, ...){
+	va_list ap;
+	int ret;
+	va_start(ap, fmt);
+	ret = vprintf(fmt, ap);
+	va_end(ap);
+	return ret;
+}
+
+void halt_error(char * errmsg){
+	fprintf(stderr, "%s\n", errmsg);
+	exit(EXIT_FAILURE);
+}
+
+uint32_t audio_get_sample_rate(void){
+	return replay_sample_rate;
+}
+
+bool audio_set_sample_rate(uint32_t fs){
+	replay_sample_rate = fs;
+	return true;
+}
+
+uint32_t board_get_cycles(void){
+	return 0;
+}
+
+uint32_t board_get_block_cycles(void){
+	return UINT32_MAX;
+}
+
+uint32_t audio_get_block_start_cycles(void){
+	return 0;
+}
+
+void board_set_led(enum board_led_e led, bool state){
+	(void) led;
+	(void) state;
+}
+
+bool board_get_usart_char(char * data){
+	(void) data;
+	return false;
+}
+
+/** @brief C version of the assembly in arm_bitreversal2.S, as in ofdm_sweep.c */
+void arm_bitreversal_32(uint32_t * pSrc, const uint16_t bitRevLen, const uint16_t * pBitRevTab){
+	int i;
+	for(i = 0; i < bitRevLen; i += 2){
+		const uint32_t a = pBitRevTab[i] >> 2;
+		const uint32_t b = pBitRevTab[i + 1] >> 2;
+		uint32_t t = pSrc[a];
+		pSrc[a] = pSrc[b];
+		pSrc[b] = t;
+		t = pSrc[a + 1];
+		pSrc[a + 1] = pSrc[b + 1];
+		pSrc[b + 1] = t;
+	}
+}
+
+/* Captures and telemetry are sent over the serial port on the board, and are
+ * disabled here; the receiver prints its results instead */
+
+bool capture_frame(const float * data, const uint_fast32_t len){
+	(void) data;
+	(void) len;
+	return false;
+}
+
+bool capture_microphone_start(const uint_fast32_t blocks){
+	(void) blocks;
+	return false;
+}
+
+uint_fast32_t capture_dropped(void){
+	return 0;
+}
+
+void telemetry_set_enabled(const bool enabled){
+	(void) enabled;
+}
+
+bool telemetry_get_enabled(void){
+	return false;
+}
+
+bool telemetry_ofdm_rx(const uint8_t band, const float frequency, const float rmse, const char * tx, const char * rx, const uint8_t len){
+	(void) band;
+	(void) frequency;
+	(void) rmse;
+	(void) tx;
+	(void) rx;
+	(void) len;
+	return false;
+}
+
+bool telemetry_cvector(const enum telemetry_id_e id, const float * data, const uint_fast16_t len){
+	(void) id;
+	(void) data;
+	(void) len;
+	return false;
+}
+
+bool telemetry_profile(void){
+	return false;
+}
+
+uint_fast32_t telemetry_dropped(void){
+	return 0;
+}
+
+void main_audio_callback(void){
+	lab_ofdm();
+}
+
+/** @brief Runs the rest of an audio block after blocks_sources_update, as
+ * WavePlayBack does, and advances the system time by its duration */
+static void replay_block(void){
+	static uint64_t us = 0;
+	main_audio_callback();
+	blocks_sinks_update();
+	us += (1000000ULL * AUDIO_BLOCKSIZE) / replay_sample_rate;
+	while(us >= SYSTIME_PERIOD_us){
+		systime_update();
+		us -= SYSTIME_PERIOD_us;
+	}
+}
+
+static void replay_usage(const char * name){
+	fprintf(stderr,
+			"usage: %s [options] <in.wav> <out.wav>\n"
+			"  --channel N   channel of the recording to replay (default 0)\n"
+			"  --dual        receive and transmit in two bands\n"
+			"  --lead S      seconds of silence replayed before the recording (default 2)\n"
+			"  --tail S      seconds of silence replayed after the recording (default 1)\n",
+			name);
+}
+
+int main(int argc, char ** argv){
+	static const struct option options[] = {
+			{"channel", required_argument, NULL, 'c'},
+			{"dual", no_argument, NULL, 'd'},
+			{"lead", required_argument, NULL, 'l'},
+			{"tail", required_argument, NULL, 't'},
+			{"help", no_argument, NULL, 'h'},
+			{NULL, 0, NULL, 0}};
+	int channel = 0;
+	bool dual = false;
+	double lead = 2.0, tail = 1.0;
+	int opt;
+	while((opt = getopt_long(argc, argv, "h", options, NULL)) != -1){
+		switch(opt){
+		case 'c': channel = atoi(optarg); break;
+		case 'd': dual = true; break;
+		case 'l': lead = atof(optarg); break;
+		case 't': tail = atof(optarg); break;
+		default:
+			replay_usage(argv[0]);
+			return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+	if(argc - optind != 2 || lead < 0 || tail < 0){
+		replay_usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	const char * const in_path = argv[optind];
+	const char * const out_path = argv[optind + 1];
+
+	struct blocks_file_s in;
+	if(!blocks_file_map_wav(&in, in_path)){
+		fprintf(stderr, "%s: not a 16-bit PCM or 32-bit float WAV file\n", in_path);
+		return EXIT_FAILURE;
+	}
+	if(channel < 0 || channel >= in.channels){
+		fprintf(stderr, "%s: no channel %d\n", in_path, channel);
+		return EXIT_FAILURE;
+	}
+	in.channel = channel;
+
+	//Select the mode of the recording, as the 'r' key does
+	const struct replay_mode_s * mode = NULL;
+	uint_fast32_t i;
+	for(i = 0; i < NUMEL(replay_modes); i++){
+		if(replay_modes[i].sample_rate == in.sample_rate){
+			mode = &replay_modes[i];
+		}
+	}
+	if(mode == NULL){
+		fprintf(stderr, "%s: sample rate %lu Hz is not one of the OFDM modes\n", in_path, (unsigned long) in.sample_rate);
+		return EXIT_FAILURE;
+	}
+	audio_set_sample_rate(mode->sample_rate);
+	if(!lab_ofdm_process_set_numerology(mode->center_frequency, mode->upsample_rate, dual)){
+		fprintf(stderr, "Dual-band mode not supported at %lu Hz sample rate\n", (unsigned long) mode->sample_rate);
+		return EXIT_FAILURE;
+	}
+	lab_ofdm_init();
+
+	//Room for every block of the lead, the recording and the tail, in both channels
+	const uint_fast32_t lead_blocks = (uint_fast32_t) (lead * mode->sample_rate / AUDIO_BLOCKSIZE + 0.5);
+	const uint_fast32_t tail_blocks = (uint_fast32_t) (tail * mode->sample_rate / AUDIO_BLOCKSIZE + 0.5);
+	const uint_fast32_t blocks = lead_blocks + (in.frames + AUDIO_BLOCKSIZE - 1) / AUDIO_BLOCKSIZE + tail_blocks;
+	const size_t cap = BLOCKS_FILE_WAV_HEADER_SIZE + (size_t) blocks * AUDIO_BLOCKSIZE * 2 * sizeof(int16_t);
+	void * const buf = malloc(cap);
+	struct blocks_file_sink_s out;
+	if(buf == NULL || !blocks_file_sink_init(&out, buf, cap, blocks_file_i16, 2, mode->sample_rate, true)){
+		fprintf(stderr, "Cannot allocate %lu bytes for the output\n", (unsigned long) cap);
+		return EXIT_FAILURE;
+	}
+
+	blocks_sinks_file_attach(&out);
+	//The envelope detector starts from a full scale ambient level, which takes
+	//over a second of quiet to decay, as after startup on the board
+	uint_fast32_t n, silent = 0;
+	for(n = 0; n < lead_blocks; n++){
+		blocks_sources_update();
+		replay_block();
+	}
+	blocks_sources_file_attach(&in);
+	while(true){
+		blocks_sources_update();
+		//The file reads as zeros past its end
+		if(blocks_sources_file_done() && silent++ == tail_blocks){
+			break;
+		}
+		replay_block();
+		n++;
+	}
+	blocks_sources_file_attach(NULL);
+	blocks_sinks_file_attach(NULL);
+
+	if(!blocks_file_sink_save(&out, out_path)){
+		fprintf(stderr, "%s: cannot write\n", out_path);
+		return EXIT_FAILURE;
+	}
+	fprintf(stderr, "Replayed %lu samples at %lu Hz in %lu blocks to %s%s\n", (unsigned long) in.frames,
+			(unsigned long) mode->sample_rate, (unsigned long) n, out_path, out.overflow ? ", output truncated" : "");
+	blocks_file_unmap(&in);
+	free(buf);
+	return out.overflow ? EXIT_FAILURE : EXIT_SUCCESS;
+}
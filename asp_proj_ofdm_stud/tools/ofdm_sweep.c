@@ -0,0 +1,989 @@
+/** @file Monte-Carlo sweep of the OFDM link on the PC.
+ * Runs the C transmitter and receiver of src/lab_ofdm_process.c over a
+ * simulated channel for every combination of a grid of SNRs, carrier
+ * frequency offsets, timing offsets and numerologies, and writes the bit and
+ * frame error rates, goodput and processing time per point as CSV or JSON.
+ * Every trial sends random messages in all bands and is seeded from the
+ * base seed and its position in the grid only, so results do not depend on
+ * the number of workers. The receiver keeps its state in file-scope
+ * variables, as on the board, so trials are spread over worker processes
+ * rather than threads; the workers take batches of trials from a counter in
+ * shared memory and leave their results next to it.
+ *
+ * Build from the asp_proj_ofdm_stud directory, with SYSMODE set to
+ * SYSMODE_OFDM in src/config.h (add src/backend/fixed/fixed.c and
+ * -DLAB_OFDM_FIXED_POINT=1 for the fixed-point variant):
+ *
+ *	gcc -O2 -std=gnu11 -funsigned-char -o ofdm_sweep tools/ofdm_sweep.c \
+ *		src/lab_ofdm_process.c src/backend/arena.c src/backend/profile/profile.c \
+ *		$(ls src/backend/CMSIS/Source/[A-Z]*Functions/arm_{cfft,cfft_radix8,fir_interpolate,fir_interpolate_init,fir_decimate,fir_decimate_init,cmplx_mult_cmplx,cmplx_mag_squared,cmplx_conj,add,sub,scale,copy,sin,cos}_f32.c) \
+ *		src/backend/CMSIS/Source/TransformFunctions/arm_bitreversal.c \
+ *		src/backend/CMSIS/Source/CommonTables/arm_common_tables.c \
+ *		src/backend/CMSIS/Source/CommonTables/arm_const_structs.c \
+ *		-Isrc -Isrc/backend -Isrc/backend/CMSIS/Include -DARM_MATH_CM4 -D__FPU_PRESENT=1 \
+ *		-Dprintf=printfn "-DM_TWOPI=(2*M_PI)" -lm
+ *
+ * Example, a waterfall curve over the audio channel model in all modes:
+ *
+ *	./ofdm_sweep --snr 0:2:30 --mode 0,1,2 --channel audio --trials 1000 > ber.csv
+ *
+ * The receiver only works once the lab exercises in lab_ofdm_process.c
+ * (ofdm_demodulate, cnvt_re_im_2_cmplx and ofdm_conj_equalize) are solved. As
+ * shipped, every frame fails at any SNR with a BER of about 0.5, so the
+ * sweep measures a solution rather than the tree itself.
+ *
+ * Channel model, in order:
+ *	- The frame is scaled to a peak of one, as in simulate_audio_channel.m.
+ *	- With --channel audio, it is filtered by the resonant audio channel of
+ *	simulate_audio_channel.m, with its pole pair at 4 kHz.
+ *	- A carrier frequency offset shifts the spectrum by cfo Hz, through the
+ *	analytic signal of a Hilbert transformer.
+ *	- A timing offset starts the receive window delay samples before the
+ *	frame, or after it for negative values, as a misaligned envelope detector.
+ *	- White Gaussian noise is added, at a variance that gives the requested
+ *	ratio to the mean power of the received frame [dB].
+ *
+ * With --golden, the stages of the transmitter and receiver are instead
+ * checked one by one against the golden vectors written by
+ * export_golden_vectors.m in the repository root, which runs the MATLAB
+ * reference chain of project1B.m. Every stage is fed the golden input of that
+ * stage and its output is compared with the golden output, so that a failure
+ * points at the stage that introduced it. The exit status is nonzero if any
+ * stage differs. Without a directory, the vectors committed in golden/ in the
+ * repository root are used, which assumes the tool is run from the
+ * asp_proj_ofdm_stud directory. Those were written by the Python
+ * transcription tools/export_golden_vectors.py, not by MATLAB, and have not
+ * been verified against the MATLAB script, see golden/README:
+ *
+ *	./ofdm_sweep --golden
+ *	./ofdm_sweep --golden=other/golden
+ *
+ * Regenerate golden/ with export_golden_vectors in MATLAB from the repository
+ * root, or with its transcription tools/export_golden_vectors.py.
+ *
+ * Output columns, one row per grid point:
+ *	fs, upsample, fc, bands, snr_db, cfo_hz, delay: the grid point
+ *	frames, frame_errors, fer: received band frames and those with any bit error
+ *	bits, bit_errors, ber: message bits and bit errors
+ *	rmse: mean RMSE of the soft symbols, as reported by the receiver
+ *	goodput_bps: bits of error-free frames per second of air time
+ *	ns_per_frame: mean time to transmit and receive one frame, excluding the channel model */
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <getopt.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "lab_ofdm_process.h"
+#include "backend/telemetry/telemetry.h"
+#include "macro.h"
+#include "arm_math.h"
+#include "arm_const_structs.h"
+#if LAB_OFDM_FIXED_POINT
+#include "backend/fixed/fixed.h"
+#endif
+
+//printf is mapped to printfn for the OFDM code, which is silenced below
+#undef printf
+int printf(const char * fmt, ...);
+
+/** @brief Largest number of values per grid dimension */
+#define SWEEP_MAX_VALUES	(256)
+
+/** @brief Trials per job taken by a worker */
+#define SWEEP_BATCH			(16)
+
+/** @brief Number of taps of the Hilbert transformer, odd */
+#define SWEEP_HILBERT_TAPS	(63)
+
+/** @brief Zero samples around the frame, covering the largest timing offset and the filter transients */
+#define SWEEP_PAD			(1024)
+
+/** @brief Center frequency of the resonance of the audio channel model [Hz] */
+#define SWEEP_AUDIO_F0		(4000.0)
+
+/** @brief Numerologies selectable by --mode, as in lab_ofdm.c */
+static const struct sweep_mode_s {
+	uint32_t sample_rate;	//!<- Audio sample rate [Hz]
+	int upsample_rate;		//!<- Up/downsample rate between the baseband and the audio signal
+	float center_frequency;	//!<- OFDM center frequency [Hz]
+} sweep_modes[] = {
+#define SWEEP_MODE(fs, rate, fc)	{(fs), (rate), (fc)},
+		LAB_OFDM_MODES(SWEEP_MODE)
+};
+
+enum sweep_channel_e {
+	sweep_channel_awgn,		//!<- Noise only
+	sweep_channel_audio,	//!<- The audio channel of simulate_audio_channel.m
+};
+
+/** @brief A list of values of one grid dimension */
+struct sweep_values_s {
+	double v[SWEEP_MAX_VALUES];
+	int n;
+};
+
+/** @brief One point of the grid */
+struct sweep_point_s {
+	int mode;
+	bool dual;
+	double snr_db;
+	double cfo_hz;
+	int delay;
+};
+
+/** @brief Results of a batch of trials, written by a worker to shared memory */
+struct sweep_result_s {
+	uint64_t frames, frame_errors;
+	uint64_t bits, bit_errors;
+	double rmse_sum;
+	uint64_t ns;
+	uint32_t trials;
+	bool unsupported;		//!<- True if the numerology is not supported
+};
+
+/** @brief Memory shared between the workers */
+struct sweep_shared_s {
+	volatile uint32_t next_job;		//!<- Next job to take, incremented atomically
+	struct sweep_result_s results[];
+};
+
+/** @brief Settings of a sweep */
+static struct sweep_point_s * sweep_points;
+static int sweep_num_points;
+static int sweep_trials = 100;
+static uint64_t sweep_seed = 1;
+static enum sweep_channel_e sweep_channel = sweep_channel_awgn;
+
+/** @brief Sample rate returned to the OFDM code, set per grid point */
+static uint32_t sweep_sample_rate = 16000;
+
+/** @brief Results of the bands of the frame currently being received, filled in through telemetry_ofdm_rx */
+static struct sweep_result_s * sweep_trial;
+
+/* Replacements for the board backend used by lab_ofdm_process.c */
+
+int printfn(const char * fmt, ...){
+	//The receiver reports every frame, which is not wanted here
+	(void) fmt;
+	return 0;
+}
+
+void halt_error(char * errmsg){
+	fprintf(stderr, "%s\n", errmsg);
+	exit(EXIT_FAILURE);
+}
+
+uint32_t audio_get_sample_rate(void){
+	return sweep_sample_rate;
+}
+
+uint32_t board_get_cycles(void){
+	return 0;
+}
+
+uint32_t board_get_block_cycles(void){
+	return UINT32_MAX;
+}
+
+/** @brief C version of the assembly in arm_bitreversal2.S */
+void arm_bitreversal_32(uint32_t * pSrc, const uint16_t bitRevLen, const uint16_t * pBitRevTab){
+	int i;
+	for(i = 0; i < bitRevLen; i += 2){
+		const uint32_t a = pBitRevTab[i] >> 2;
+		const uint32_t b = pBitRevTab[i + 1] >> 2;
+		uint32_t t = pSrc[a];
+		pSrc[a] = pSrc[b];
+		pSrc[b] = t;
+		t = pSrc[a + 1];
+		pSrc[a + 1] = pSrc[b + 1];
+		pSrc[b + 1] = t;
+	}
+}
+
+/* The receiver hands its results to the telemetry functions when telemetry is enabled */
+
+bool telemetry_get_enabled(void){
+	return true;
+}
+
+bool telemetry_cvector(const enum telemetry_id_e id, const float * data, const uint_fast16_t len){
+	(void) id;
+	(void) data;
+	(void) len;
+	return true;
+}
+
+bool telemetry_ofdm_rx(const uint8_t band, const float frequency, const float rmse, const char * tx, const char * rx, const uint8_t len){
+	int i;
+	uint64_t errors = 0;
+	(void) band;
+	(void) frequency;
+	for(i = 0; i < len; i++){
+		errors += __builtin_popcount((uint8_t) (tx[i] ^ rx[i]));
+	}
+	sweep_trial->frames++;
+	sweep_trial->frame_errors += (errors > 0);
+	sweep_trial->bits += 8 * len;
+	sweep_trial->bit_errors += errors;
+	sweep_trial->rmse_sum += rmse;
+	return true;
+}
+
+/* Random numbers */
+
+/** @brief SplitMix64, see https://prng.di.unimi.it/splitmix64.c */
+static uint64_t sweep_rand(uint64_t * const state){
+	uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+/** @brief Returns a uniformly distributed value in (0, 1) */
+static double sweep_rand_uniform(uint64_t * const state){
+	return ((sweep_rand(state) >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+/** @brief Fills x with len normally distributed values of standard deviation sigma */
+static void sweep_rand_normal(uint64_t * const state, double * x, const int len, const double sigma){
+	int i;
+	for(i = 0; i < len; i += 2){
+		//Box-Muller
+		const double r = sigma * sqrt(-2 * log(sweep_rand_uniform(state)));
+		const double phi = 2 * M_PI * sweep_rand_uniform(state);
+		x[i] = r * cos(phi);
+		if(i + 1 < len){
+			x[i + 1] = r * sin(phi);
+		}
+	}
+}
+
+/* Channel model */
+
+/** @brief Filters x in place with the audio channel of simulate_audio_channel.m */
+static void sweep_audio_channel(double * x, const int len, const double fs){
+	//Zeros at DC and Nyquist, a pole pair at radius 0.9 and SWEEP_AUDIO_F0
+	const double a1 = -2 * 0.9 * cos(2 * M_PI * SWEEP_AUDIO_F0 / fs);
+	const double a2 = 0.81;
+	double x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+	int i;
+	for(i = 0; i < len; i++){
+		const double y = x[i] - x2 - a1 * y1 - a2 * y2;
+		x2 = x1;
+		x1 = x[i];
+		y2 = y1;
+		y1 = y;
+		x[i] = y;
+	}
+}
+
+/** @brief Shifts the spectrum of x by cfo cycles per sample into y, delayed by SWEEP_HILBERT_TAPS/2 samples */
+static void sweep_frequency_shift(const double * x, double * y, const int len, const double cfo){
+	static double h[SWEEP_HILBERT_TAPS];
+	const int d = SWEEP_HILBERT_TAPS / 2;
+	int i, k;
+	if(h[d + 1] == 0){
+		//Hamming-windowed ideal Hilbert transformer
+		for(k = 1; k <= d; k += 2){
+			const double w = 0.54 + 0.46 * cos(M_PI * k / d);
+			h[d + k] = 2 / (M_PI * k) * w;
+			h[d - k] = -h[d + k];
+		}
+	}
+	for(i = 0; i < len; i++){
+		double im = 0;
+		for(k = 0; k < SWEEP_HILBERT_TAPS && k <= i; k++){
+			im += h[k] * x[i - k];
+		}
+		const double re = (i >= d) ? x[i - d] : 0;
+		const double phi = 2 * M_PI * fmod(cfo * i, 1.0);
+		y[i] = re * cos(phi) - im * sin(phi);
+	}
+}
+
+/** @brief Returns the time since an arbitrary point [ns] */
+static uint64_t sweep_ns(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/** @brief Selects the numerology of a grid point
+ * @return False if it is not supported */
+static bool sweep_set_mode(const struct sweep_point_s * const p){
+	static int mode = -1;
+	static bool dual = false;
+	static bool ok = false;
+	if(p->mode != mode || p->dual != dual){
+		mode = p->mode;
+		dual = p->dual;
+		sweep_sample_rate = sweep_modes[mode].sample_rate;
+		ok = lab_ofdm_process_set_numerology(sweep_modes[mode].center_frequency, sweep_modes[mode].upsample_rate, dual);
+	}
+	return ok;
+}
+
+/** @brief Runs trial number trial of grid point p, adding its results to r */
+static void sweep_run_trial(const struct sweep_point_s * const p, const int point, const int trial, struct sweep_result_s * const r){
+	static float tx[LAB_OFDM_TX_FRAME_SIZE];
+	static float rx[LAB_OFDM_TX_FRAME_SIZE];
+	static double sig[LAB_OFDM_TX_FRAME_SIZE + 2*SWEEP_PAD];
+	static double shifted[LAB_OFDM_TX_FRAME_SIZE + 2*SWEEP_PAD];
+	static double noise[LAB_OFDM_TX_FRAME_SIZE];
+	const int len = lab_ofdm_process_get_tx_frame_size();
+	const int sig_len = len + 2*SWEEP_PAD;
+	uint64_t state = sweep_seed ^ ((uint64_t) point << 32) ^ (uint64_t) trial;
+	int i;
+	sweep_rand(&state);
+	for(i = 0; i < LAB_OFDM_CHAR_MESSAGE_SIZE; i++){
+		message[i] = sweep_rand(&state);
+		message_band2[i] = sweep_rand(&state);
+	}
+	uint64_t t = sweep_ns();
+	lab_ofdm_process_tx(tx);
+	t = sweep_ns() - t;
+
+	float peak = 0;
+	for(i = 0; i < len; i++){
+		peak = fmaxf(peak, fabsf(tx[i]));
+	}
+	memset(sig, 0, sizeof(sig[0]) * sig_len);
+	for(i = 0; i < len; i++){
+		sig[SWEEP_PAD + i] = tx[i] / peak;
+	}
+	if(sweep_channel == sweep_channel_audio){
+		sweep_audio_channel(sig, sig_len, sweep_sample_rate);
+	}
+	const double * y = sig;
+	int frame_start = SWEEP_PAD;
+	if(p->cfo_hz != 0){
+		sweep_frequency_shift(sig, shifted, sig_len, p->cfo_hz / sweep_sample_rate);
+		y = shifted;
+		frame_start += SWEEP_HILBERT_TAPS / 2;
+	}
+	double power = 0;
+	for(i = 0; i < len; i++){
+		power += y[frame_start + i] * y[frame_start + i];
+	}
+	sweep_rand_normal(&state, noise, len, sqrt(power / len * pow(10, -p->snr_db / 10)));
+	// The receive window starts delay samples before the frame
+	for(i = 0; i < len; i++){
+		rx[i] = y[frame_start - p->delay + i] + noise[i];
+	}
+
+	sweep_trial = r;
+	const uint64_t t_rx = sweep_ns();
+	lab_ofdm_process_rx(rx);
+	r->ns += t + sweep_ns() - t_rx;
+	r->trials++;
+}
+
+/** @brief Takes jobs until none are left */
+static void sweep_worker(struct sweep_shared_s * const shared, const int jobs_per_point){
+	const int jobs = sweep_num_points * jobs_per_point;
+	int job;
+	while((job = __sync_fetch_and_add(&shared->next_job, 1)) < jobs){
+		const int point = job / jobs_per_point;
+		const int first = (job % jobs_per_point) * SWEEP_BATCH;
+		const int last = MIN(first + SWEEP_BATCH, sweep_trials);
+		const struct sweep_point_s * const p = &sweep_points[point];
+		struct sweep_result_s * const r = &shared->results[job];
+		int trial;
+		if(!sweep_set_mode(p)){
+			r->unsupported = true;
+			continue;
+		}
+		for(trial = first; trial < last; trial++){
+			sweep_run_trial(p, point, trial, r);
+		}
+	}
+}
+
+/* Golden vectors of export_golden_vectors.m */
+
+/** @brief Stages of lab_ofdm_process.c that are not declared in its header */
+void add_cyclic_prefix(float * pSrc, float * pDst, int length, int cp_length);
+void remove_cyclic_prefix(float * pSrc, float * pDst, int slen, int cp_size);
+void ofdm_modulate(float * pRe, float * pIm, float * pDst, float f, int length);
+void ofdm_demodulate(float * pSrc, float * pRe, float * pIm, float f, int length);
+void cnvt_re_im_2_cmplx(float * pRe, float * pIm, float * pCmplx, int length);
+void ofdm_conj_equalize(float * prxMes, float * prxPilot, float * ptxPilot, float * pEqualized, float * hhat_conj, int length);
+void ofdm_soft_symb(float * prxMes, float * hhat_conj, float * soft_symb, int length);
+extern float lp_filter[];
+extern float volume;
+
+/** @brief Largest RMS error of a stage relative to the RMS of its golden output.
+ * The floating point stages stay below 2e-7 on the PC. */
+#define SWEEP_GOLDEN_TOL	(1e-5)
+
+/** @brief Tolerance of the stages at the audio and base band sample rates,
+ * which the fixed-point variant runs in q15, reaching up to 4e-4 */
+#if LAB_OFDM_FIXED_POINT
+#define SWEEP_GOLDEN_TOL_RATE	(1e-3)
+#else
+#define SWEEP_GOLDEN_TOL_RATE	SWEEP_GOLDEN_TOL
+#endif
+
+/** @brief Tolerance of the demodulator, an exercise. A solution accumulating
+ * the oscillator angle in single precision over a chunk, rather than wrapping
+ * it as ofdm_modulate does, reaches about 2.3e-4. */
+#define SWEEP_GOLDEN_TOL_DEMOD	(1e-3)
+
+/** @brief Directory of the committed golden vectors, relative to asp_proj_ofdm_stud */
+#define SWEEP_GOLDEN_DIR	"../golden"
+
+/** @brief Directory holding the golden vectors */
+static const char * sweep_golden_dir;
+
+/** @brief Number of stages compared and of those that failed */
+static int sweep_golden_stages, sweep_golden_failures;
+
+/** @brief Reads len values from the golden vector name into x, interleaving the
+ * real and imaginary parts of complex vectors. A missing imaginary part reads as zero.
+ * @return False if the file cannot be read or does not hold len values */
+static bool sweep_golden_read(const char * name, float * x, const int len, const bool complex){
+	char path[1024], line[256];
+	int n = 0;
+	snprintf(path, sizeof(path), "%s/%s.csv", sweep_golden_dir, name);
+	FILE * const f = fopen(path, "r");
+	if(f == NULL){
+		perror(path);
+		return false;
+	}
+	while(fgets(line, sizeof(line), f) != NULL && n < len){
+		double re, im = 0;
+		const int cols = sscanf(line, "%lf,%lf", &re, &im);
+		if(cols < 1){
+			continue;
+		}
+		if(complex){
+			x[2*n] = re;
+			x[2*n + 1] = im;
+		}else{
+			x[n] = re;
+		}
+		n++;
+	}
+	fclose(f);
+	if(n != len){
+		fprintf(stderr, "%s holds %d values instead of %d\n", path, n, len);
+		return false;
+	}
+	return true;
+}
+
+/** @brief Reads a golden vector of characters into s */
+static bool sweep_golden_read_chars(const char * name, char * s, const int len){
+	float x[LAB_OFDM_CHAR_MESSAGE_SIZE];
+	int i;
+	if(len > LAB_OFDM_CHAR_MESSAGE_SIZE || !sweep_golden_read(name, x, len, false)){
+		return false;
+	}
+	for(i = 0; i < len; i++){
+		s[i] = (char) x[i];
+	}
+	return true;
+}
+
+/** @brief Prints the relative RMS error of the len values in x against the golden values in ref, counting a failure if it exceeds tol */
+static void sweep_golden_compare(const char * stage, const float * x, const float * ref, const int len, const double tol){
+	double err = 0, norm = 0;
+	int i;
+	for(i = 0; i < len; i++){
+		err += ((double) x[i] - ref[i]) * ((double) x[i] - ref[i]);
+		norm += (double) ref[i] * ref[i];
+	}
+	const double rel = norm > 0 ? sqrt(err / norm) : sqrt(err);
+	//Also fails on NaN
+	const bool ok = (rel <= tol);
+	printf("%-14s %12.3g %12.3g  %s\n", stage, rel, tol, ok ? "ok" : "FAIL");
+	sweep_golden_stages++;
+	sweep_golden_failures += !ok;
+}
+
+/** @brief Prints the number of bit errors of the len characters in s against the golden characters in ref, counting a failure if there are any */
+static void sweep_golden_compare_chars(const char * stage, const char * s, const char * ref, const int len){
+	int i, errors = 0;
+	for(i = 0; i < len; i++){
+		errors += __builtin_popcount((uint8_t) (s[i] ^ ref[i]));
+	}
+	printf("%-14s %8d bit errors  %s\n", stage, errors, errors == 0 ? "ok" : "FAIL");
+	sweep_golden_stages++;
+	sweep_golden_failures += (errors != 0);
+}
+
+/** @brief Splits len interleaved complex values in x into re and im */
+static void sweep_split(const float * x, float * re, float * im, const int len){
+	int i;
+	for(i = 0; i < len; i++){
+		re[i] = x[2*i];
+		im[i] = x[2*i + 1];
+	}
+}
+
+/** @brief Interleaves len values of re and im into x */
+static void sweep_interleave(const float * re, const float * im, float * x, const int len){
+	int i;
+	for(i = 0; i < len; i++){
+		x[2*i] = re[i];
+		x[2*i + 1] = im[i];
+	}
+}
+
+/** @brief Fills x with len NaNs, so that outputs a stage leaves unwritten fail the comparison */
+static void sweep_fill_nan(float * x, const int len){
+	int i;
+	for(i = 0; i < len; i++){
+		x[i] = NAN;
+	}
+}
+
+#if LAB_OFDM_FIXED_POINT
+/** @brief Converts len values of re and im to q15 mantissas with a shared exponent
+ * @return The exponent */
+static int_fast8_t sweep_to_q15(const float * re, const float * im, q15_t * qre, q15_t * qim, const int len){
+	const int_fast8_t exp = MAX(fixed_exponent_f32(re, len), fixed_exponent_f32(im, len));
+	fixed_from_f32(re, exp, qre, len);
+	fixed_from_f32(im, exp, qim, len);
+	return exp;
+}
+#endif
+
+/** @brief Checks every stage of the transmitter and receiver against the golden vectors in sweep_golden_dir.
+ * Each stage is fed the golden input of that stage, so that a failure points
+ * at the stage that introduced the error. The fixed-point variant checks its
+ * q15 kernels in place of the floating point stages they replace.
+ * @return True if all stages match */
+static bool sweep_golden(void){
+	enum {
+		N = LAB_OFDM_BLOCKSIZE,
+		CP = LAB_OFDM_CYCLIC_PREFIX_SIZE,
+		BB = LAB_OFDM_BB_FRAME_SIZE,
+		TX = LAB_OFDM_TX_FRAME_SIZE,
+		R = LAB_OFDM_UPSAMPLE_RATE,
+		CHARS = LAB_OFDM_CHAR_MESSAGE_SIZE,
+	};
+	static char message_chars[CHARS], pilot_chars[CHARS], decoded_chars[CHARS], out_chars[CHARS];
+	static float params[5], filter[LAB_OFDM_FILTER_LENGTH];
+	static float symbols[2*N], pilot_symbols[2*N], frame[2*BB], interpolated[2*TX], tx[TX], rx[TX];
+	static float demodulated[2*TX], baseband[2*BB], pilot_fft[2*N], message_fft[2*N];
+	static float hhat_conj[2*N], equalized[2*N], soft_symbols[2*N];
+	static float out[2*TX], out2[2*N], re[TX], im[TX], re_out[TX], im_out[TX];
+	int i, b;
+
+	if(!sweep_golden_read("params", params, NUMEL(params), false) ||
+			!sweep_golden_read_chars("message", message_chars, CHARS) ||
+			!sweep_golden_read_chars("pilot", pilot_chars, CHARS) ||
+			!sweep_golden_read_chars("decoded", decoded_chars, CHARS) ||
+			!sweep_golden_read("filter", filter, NUMEL(filter), false) ||
+			!sweep_golden_read("symbols", symbols, N, true) ||
+			!sweep_golden_read("pilot_symbols", pilot_symbols, N, true) ||
+			!sweep_golden_read("frame", frame, BB, true) ||
+			!sweep_golden_read("interpolated", interpolated, TX, true) ||
+			!sweep_golden_read("tx", tx, TX, false) ||
+			!sweep_golden_read("rx", rx, TX, false) ||
+			!sweep_golden_read("demodulated", demodulated, TX, true) ||
+			!sweep_golden_read("baseband", baseband, BB, true) ||
+			!sweep_golden_read("pilot_fft", pilot_fft, N, true) ||
+			!sweep_golden_read("message_fft", message_fft, N, true) ||
+			!sweep_golden_read("hhat_conj", hhat_conj, N, true) ||
+			!sweep_golden_read("equalized", equalized, N, true) ||
+			!sweep_golden_read("soft_symbols", soft_symbols, N, true)){
+		return false;
+	}
+	const float fs = params[0], fc = params[1];
+	if(params[2] != R || params[3] != N || params[4] != CP){
+		fprintf(stderr, "The golden vectors use R = %g, N = %g and N_cp = %g, instead of %d, %d and %d\n",
+				params[2], params[3], params[4], R, N, CP);
+		return false;
+	}
+	sweep_sample_rate = fs;
+	if(!lab_ofdm_process_set_numerology(fc, R, false)){
+		fprintf(stderr, "The golden vectors use an unsupported numerology, fs %g Hz and fc %g Hz\n", fs, fc);
+		return false;
+	}
+	memcpy(message, message_chars, CHARS);
+	lab_ofdm_process_set_pilot(pilot_chars);
+	printf("Checking against the golden vectors for fs %g Hz, fc %g Hz\n", fs, fc);
+	printf("%-14s %12s %12s\n", "stage", "rel. error", "tolerance");
+
+#if LAB_OFDM_FIXED_POINT
+	static q15_t q[2*TX], q2[TX], q3[TX], coeffs_q15[LAB_OFDM_FILTER_LENGTH];
+	static q15_t state[TX + LAB_OFDM_FILTER_LENGTH - 1], state2[TX + LAB_OFDM_FILTER_LENGTH - 1];
+	static struct fixed_cfft_s cfft;
+	struct fixed_fir_interpolate_s intp;
+	struct fixed_fir_decimate_s decim_re, decim_im;
+	struct fixed_nco_s nco;
+	int_fast8_t exp;
+	const int_fast8_t coeffs_exp = fixed_from_f32_auto(lp_filter, coeffs_q15, LAB_OFDM_FILTER_LENGTH);
+	fixed_cfft_init(&cfft, N);
+#else
+	static float state[TX + LAB_OFDM_FILTER_LENGTH - 1], state2[TX + LAB_OFDM_FILTER_LENGTH - 1];
+	arm_fir_interpolate_instance_f32 intp;
+	arm_fir_decimate_instance_f32 decim_re, decim_im;
+#endif
+
+	//The stages below filter with lp_filter. The exported filter is read from lp_filter itself, so this only
+	//confirms that lp_filter has not changed since the vectors were written.
+	sweep_golden_compare("filter", lp_filter, filter, LAB_OFDM_FILTER_LENGTH, 0);
+
+	lab_ofdm_process_qpsk_encode(message_chars, out, CHARS);
+	sweep_golden_compare("encode", out, symbols, 2*N, 0);
+
+	//IFFT and cyclic prefix of the pilot and message blocks
+	for(b = 0; b < LAB_OFDM_NUM_FRAMES; b++){
+		memcpy(out2, b == 0 ? pilot_symbols : symbols, sizeof(out2));
+#if LAB_OFDM_FIXED_POINT
+		exp = fixed_from_f32_auto(out2, q, 2*N);
+		exp += fixed_cfft_q15(&cfft, q, true) - __builtin_ctz(N);
+		fixed_to_f32(q, exp, out2, 2*N);
+#else
+		arm_cfft_f32(&arm_cfft_sR_f32_len64, out2, LAB_OFDM_IFFT_FLAG, LAB_OFDM_DO_BITREVERSE);
+#endif
+		add_cyclic_prefix(out2, &out[2*b*LAB_OFDM_BLOCK_W_CP_SIZE], N, CP);
+	}
+	sweep_golden_compare("ifft", out, frame, 2*BB, SWEEP_GOLDEN_TOL_RATE);
+
+	sweep_split(frame, re, im, BB);
+#if LAB_OFDM_FIXED_POINT
+	exp = sweep_to_q15(re, im, q2, q3, BB);
+	fixed_fir_interpolate_init(&intp, R, LAB_OFDM_FILTER_LENGTH, coeffs_q15, coeffs_exp, state);
+	fixed_fir_interpolate_q15(&intp, q2, q, BB);
+	fixed_to_f32(q, exp + intp.exp_delta, re_out, TX);
+	fixed_fir_interpolate_init(&intp, R, LAB_OFDM_FILTER_LENGTH, coeffs_q15, coeffs_exp, state);
+	fixed_fir_interpolate_q15(&intp, q3, q, BB);
+	fixed_to_f32(q, exp + intp.exp_delta, im_out, TX);
+#else
+	arm_fir_interpolate_init_f32(&intp, R, LAB_OFDM_FILTER_LENGTH, lp_filter, state, BB);
+	arm_fir_interpolate_f32(&intp, re, re_out, BB);
+	arm_fir_interpolate_init_f32(&intp, R, LAB_OFDM_FILTER_LENGTH, lp_filter, state, BB);
+	arm_fir_interpolate_f32(&intp, im, im_out, BB);
+#endif
+	sweep_interleave(re_out, im_out, out, TX);
+	sweep_golden_compare("interpolate", out, interpolated, 2*TX, SWEEP_GOLDEN_TOL_RATE);
+
+	sweep_split(interpolated, re, im, TX);
+#if LAB_OFDM_FIXED_POINT
+	exp = sweep_to_q15(re, im, q2, q3, TX);
+	fixed_nco_init(&nco, fc / fs);
+	fixed_modulate_q15(&nco, q2, q3, q, TX);
+	fixed_to_f32(q, exp + 1, out, TX);
+#else
+	ofdm_modulate(re, im, out, fc / fs, TX);
+#endif
+	sweep_golden_compare("modulate", out, tx, TX, SWEEP_GOLDEN_TOL_RATE);
+
+	//The whole transmitter, without the volume
+	lab_ofdm_process_init();
+	lab_ofdm_process_tx(out);
+	arm_scale_f32(out, 1 / volume, out, TX);
+	sweep_golden_compare("transmit", out, tx, TX, SWEEP_GOLDEN_TOL_RATE);
+
+	//Demodulation and decimation run in chunks, as in the receiver
+	sweep_fill_nan(re_out, TX);
+	sweep_fill_nan(im_out, TX);
+	for(i = 0; i < TX; i += LAB_OFDM_RX_CHUNK_SIZE){
+		ofdm_demodulate(&rx[i], &re_out[i], &im_out[i], fc / fs, LAB_OFDM_RX_CHUNK_SIZE);
+	}
+#if LAB_OFDM_FIXED_POINT
+	//The fixed-point receiver stores the demodulated frame in q15 with the exponent of the frame plus one
+	exp = fixed_exponent_f32(rx, TX) + 1;
+	fixed_from_f32(re_out, exp, q2, TX);
+	fixed_to_f32(q2, exp, re_out, TX);
+	fixed_from_f32(im_out, exp, q3, TX);
+	fixed_to_f32(q3, exp, im_out, TX);
+#endif
+	sweep_interleave(re_out, im_out, out, TX);
+	sweep_golden_compare("demodulate", out, demodulated, 2*TX, SWEEP_GOLDEN_TOL_DEMOD);
+
+	sweep_split(demodulated, re, im, TX);
+#if LAB_OFDM_FIXED_POINT
+	exp = sweep_to_q15(re, im, q2, q3, TX);
+	fixed_fir_decimate_init(&decim_re, R, LAB_OFDM_FILTER_LENGTH, coeffs_q15, coeffs_exp, state);
+	fixed_fir_decimate_init(&decim_im, R, LAB_OFDM_FILTER_LENGTH, coeffs_q15, coeffs_exp, state2);
+	for(i = 0; i < TX; i += LAB_OFDM_RX_CHUNK_SIZE){
+		fixed_fir_decimate_q15(&decim_re, &q2[i], &q[i / R], LAB_OFDM_RX_CHUNK_SIZE);
+		fixed_fir_decimate_q15(&decim_im, &q3[i], &q[BB + i / R], LAB_OFDM_RX_CHUNK_SIZE);
+	}
+	fixed_to_f32(q, exp + decim_re.exp_delta, re_out, BB);
+	fixed_to_f32(&q[BB], exp + decim_im.exp_delta, im_out, BB);
+#else
+	arm_fir_decimate_init_f32(&decim_re, LAB_OFDM_FILTER_LENGTH, R, lp_filter, state, LAB_OFDM_RX_CHUNK_SIZE);
+	arm_fir_decimate_init_f32(&decim_im, LAB_OFDM_FILTER_LENGTH, R, lp_filter, state2, LAB_OFDM_RX_CHUNK_SIZE);
+	for(i = 0; i < TX; i += LAB_OFDM_RX_CHUNK_SIZE){
+		arm_fir_decimate_f32(&decim_re, &re[i], &re_out[i / R], LAB_OFDM_RX_CHUNK_SIZE);
+		arm_fir_decimate_f32(&decim_im, &im[i], &im_out[i / R], LAB_OFDM_RX_CHUNK_SIZE);
+	}
+#endif
+	sweep_interleave(re_out, im_out, out, BB);
+	sweep_golden_compare("decimate", out, baseband, 2*BB, SWEEP_GOLDEN_TOL_RATE);
+
+	sweep_split(baseband, re, im, BB);
+	sweep_fill_nan(out, 2*BB);
+	cnvt_re_im_2_cmplx(re, im, out, BB);
+	sweep_golden_compare("split", out, baseband, 2*BB, 0);
+
+	//FFT of the pilot and message blocks, skipping their cyclic prefixes
+	for(b = 0; b < LAB_OFDM_NUM_FRAMES; b++){
+		remove_cyclic_prefix(&baseband[2*b*LAB_OFDM_BLOCK_W_CP_SIZE], &out[2*b*N], N, CP);
+#if LAB_OFDM_FIXED_POINT
+		exp = fixed_from_f32_auto(&out[2*b*N], q, 2*N);
+		exp += fixed_cfft_q15(&cfft, q, false);
+		fixed_to_f32(q, exp, &out[2*b*N], 2*N);
+#else
+		arm_cfft_f32(&arm_cfft_sR_f32_len64, &out[2*b*N], LAB_OFDM_FFT_FLAG, LAB_OFDM_DO_BITREVERSE);
+#endif
+	}
+	sweep_golden_compare("fft pilot", out, pilot_fft, 2*N, SWEEP_GOLDEN_TOL_RATE);
+	sweep_golden_compare("fft message", &out[2*N], message_fft, 2*N, SWEEP_GOLDEN_TOL_RATE);
+
+	sweep_fill_nan(out, 2*N);
+	sweep_fill_nan(out2, 2*N);
+	ofdm_conj_equalize(message_fft, pilot_fft, pilot_symbols, out, out2, N);
+	sweep_golden_compare("equalize", out, equalized, 2*N, SWEEP_GOLDEN_TOL);
+	sweep_golden_compare("channel", out2, hhat_conj, 2*N, SWEEP_GOLDEN_TOL);
+
+	ofdm_soft_symb(message_fft, hhat_conj, out, N);
+	sweep_golden_compare("soft symbols", out, soft_symbols, 2*N, SWEEP_GOLDEN_TOL);
+
+	lab_ofdm_process_qpsk_decode(equalized, out_chars, CHARS);
+	sweep_golden_compare_chars("decode", out_chars, decoded_chars, CHARS);
+
+	//The whole receiver
+	struct sweep_result_s r = {0};
+	sweep_trial = &r;
+	lab_ofdm_process_rx(rx);
+	sweep_golden_compare_chars("receive", rec_message, decoded_chars, CHARS);
+
+	if(sweep_golden_failures > 0){
+		printf("%d of %d stages differ from the golden vectors\n", sweep_golden_failures, sweep_golden_stages);
+	}else{
+		printf("All %d stages match the golden vectors\n", sweep_golden_stages);
+	}
+	return sweep_golden_failures == 0;
+}
+
+/** @brief Parses a list of values, as a single value, values separated by commas or start:step:stop
+ * @return False on a syntax error or too many values */
+static bool sweep_parse_values(const char * s, struct sweep_values_s * const vals){
+	double start, step, stop;
+	char end;
+	vals->n = 0;
+	if(sscanf(s, "%lf:%lf:%lf%c", &start, &step, &stop, &end) == 3){
+		if(step == 0 || (stop - start) / step < 0){
+			return false;
+		}
+		const int n = (int) floor((stop - start) / step + 1e-9) + 1;
+		if(n > SWEEP_MAX_VALUES){
+			return false;
+		}
+		for(vals->n = 0; vals->n < n; vals->n++){
+			vals->v[vals->n] = start + vals->n * step;
+		}
+		return true;
+	}
+	while(*s != '\0'){
+		char * next;
+		if(vals->n == SWEEP_MAX_VALUES){
+			return false;
+		}
+		vals->v[vals->n++] = strtod(s, &next);
+		if(next == s || (*next != ',' && *next != '\0')){
+			return false;
+		}
+		s = (*next == ',') ? next + 1 : next;
+	}
+	return vals->n > 0;
+}
+
+static void sweep_usage(const char * name){
+	fprintf(stderr,
+			"Usage: %s [options]\n"
+			"Grid dimensions take a value, a list a,b,c or a range start:step:stop.\n"
+			"  --snr DB           signal to noise ratios [dB] (default 20)\n"
+			"  --cfo HZ           carrier frequency offsets [Hz] (default 0)\n"
+			"  --delay SAMPLES    timing offsets of the receive window [samples] (default 0)\n"
+			"  --mode N           numerologies: 0 = 16 kHz, 1 = 24 kHz, 2 = 48 kHz (default 0)\n"
+			"  --bands N          bands: 1, 2 or 1,2 (default 1)\n"
+			"  --channel NAME     awgn or audio (default awgn)\n"
+			"  --trials N         trials per grid point (default %d)\n"
+			"  --seed N           base seed (default %llu)\n"
+			"  --workers N        worker processes (default: number of cores)\n"
+			"  --json             write JSON instead of CSV\n"
+			"  --golden[=DIR]     check the stages against the golden vectors in DIR instead\n"
+			"                     (default " SWEEP_GOLDEN_DIR ")\n",
+			name, sweep_trials, (unsigned long long) sweep_seed);
+}
+
+int main(int argc, char ** argv){
+	static const struct option options[] = {
+			{"snr", required_argument, NULL, 's'},
+			{"cfo", required_argument, NULL, 'c'},
+			{"delay", required_argument, NULL, 'd'},
+			{"mode", required_argument, NULL, 'm'},
+			{"bands", required_argument, NULL, 'b'},
+			{"channel", required_argument, NULL, 'C'},
+			{"trials", required_argument, NULL, 't'},
+			{"seed", required_argument, NULL, 'S'},
+			{"workers", required_argument, NULL, 'w'},
+			{"json", no_argument, NULL, 'j'},
+			{"golden", optional_argument, NULL, 'g'},
+			{"help", no_argument, NULL, 'h'},
+			{NULL, 0, NULL, 0}};
+	struct sweep_values_s snr = {{20}, 1}, cfo = {{0}, 1}, delay = {{0}, 1}, mode = {{0}, 1}, bands = {{1}, 1};
+	int workers = sysconf(_SC_NPROCESSORS_ONLN);
+	bool json = false;
+	int opt;
+	while((opt = getopt_long(argc, argv, "h", options, NULL)) != -1){
+		bool ok = true;
+		switch(opt){
+		case 's': ok = sweep_parse_values(optarg, &snr); break;
+		case 'c': ok = sweep_parse_values(optarg, &cfo); break;
+		case 'd': ok = sweep_parse_values(optarg, &delay); break;
+		case 'm': ok = sweep_parse_values(optarg, &mode); break;
+		case 'b': ok = sweep_parse_values(optarg, &bands); break;
+		case 'C':
+			if(strcmp(optarg, "awgn") == 0){
+				sweep_channel = sweep_channel_awgn;
+			}else if(strcmp(optarg, "audio") == 0){
+				sweep_channel = sweep_channel_audio;
+			}else{
+				ok = false;
+			}
+			break;
+		case 't': sweep_trials = atoi(optarg); ok = sweep_trials > 0; break;
+		case 'S': sweep_seed = strtoull(optarg, NULL, 0); break;
+		case 'w': workers = atoi(optarg); ok = workers > 0; break;
+		case 'j': json = true; break;
+		case 'g': sweep_golden_dir = (optarg != NULL) ? optarg : SWEEP_GOLDEN_DIR; break;
+		default:
+			sweep_usage(argv[0]);
+			return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+		if(!ok){
+			fprintf(stderr, "Invalid value '%s'\n", optarg);
+			sweep_usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	if(sweep_golden_dir != NULL){
+		lab_ofdm_process_init();
+		return sweep_golden() ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	//Expand the grid, numerologies outermost so that workers rarely switch between them
+	int i, j, k, l, m;
+	sweep_points = calloc(mode.n * bands.n * snr.n * cfo.n * delay.n, sizeof(*sweep_points));
+	for(i = 0; i < mode.n; i++){
+		for(j = 0; j < bands.n; j++){
+			for(k = 0; k < snr.n; k++){
+				for(l = 0; l < cfo.n; l++){
+					for(m = 0; m < delay.n; m++){
+						struct sweep_point_s * const p = &sweep_points[sweep_num_points];
+						p->mode = (int) mode.v[i];
+						p->dual = (bands.v[j] == 2);
+						p->snr_db = snr.v[k];
+						p->cfo_hz = cfo.v[l];
+						p->delay = (int) delay.v[m];
+						if(p->mode < 0 || p->mode >= (int) (NUMEL(sweep_modes)) || (bands.v[j] != 1 && bands.v[j] != 2) ||
+								abs(p->delay) > SWEEP_PAD - SWEEP_HILBERT_TAPS){
+							fprintf(stderr, "Invalid mode, number of bands or delay\n");
+							return EXIT_FAILURE;
+						}
+						sweep_num_points++;
+					}
+				}
+			}
+		}
+	}
+
+	const int jobs_per_point = (sweep_trials + SWEEP_BATCH - 1) / SWEEP_BATCH;
+	const size_t shared_size = sizeof(struct sweep_shared_s) + (size_t) sweep_num_points * jobs_per_point * sizeof(struct sweep_result_s);
+	struct sweep_shared_s * const shared = mmap(NULL, shared_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if(shared == MAP_FAILED){
+		perror("mmap");
+		return EXIT_FAILURE;
+	}
+	lab_ofdm_process_init();
+	fflush(NULL);
+	for(i = 0; i < workers; i++){
+		const pid_t pid = fork();
+		if(pid == 0){
+			sweep_worker(shared, jobs_per_point);
+			_exit(EXIT_SUCCESS);
+		}else if(pid < 0){
+			perror("fork");
+			break;
+		}
+	}
+	int status;
+	bool failed = false;
+	while(wait(&status) > 0){
+		failed |= !WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS;
+	}
+	if(failed || i == 0){
+		fprintf(stderr, "A worker failed\n");
+		return EXIT_FAILURE;
+	}
+
+	if(json){
+		printf("{\"trials\": %d, \"seed\": %llu, \"channel\": \"%s\", \"points\": [\n", sweep_trials,
+				(unsigned long long) sweep_seed, sweep_channel == sweep_channel_audio ? "audio" : "awgn");
+	}else{
+		printf("fs,upsample,fc,bands,snr_db,cfo_hz,delay,frames,frame_errors,fer,bits,bit_errors,ber,rmse,goodput_bps,ns_per_frame\n");
+	}
+	bool first = true;
+	for(i = 0; i < sweep_num_points; i++){
+		const struct sweep_point_s * const p = &sweep_points[i];
+		const struct sweep_mode_s * const md = &sweep_modes[p->mode];
+		struct sweep_result_s r = {0};
+		for(j = 0; j < jobs_per_point; j++){
+			const struct sweep_result_s * const b = &shared->results[i * jobs_per_point + j];
+			r.frames += b->frames;
+			r.frame_errors += b->frame_errors;
+			r.bits += b->bits;
+			r.bit_errors += b->bit_errors;
+			r.rmse_sum += b->rmse_sum;
+			r.ns += b->ns;
+			r.trials += b->trials;
+			r.unsupported |= b->unsupported;
+		}
+		if(r.unsupported || r.frames == 0){
+			fprintf(stderr, "Skipping mode %d with %d bands, which is not supported\n", p->mode, p->dual ? 2 : 1);
+			continue;
+		}
+		const double airtime = (double) r.trials * LAB_OFDM_BB_FRAME_SIZE * md->upsample_rate / md->sample_rate;
+		const double fer = (double) r.frame_errors / r.frames;
+		const double ber = (double) r.bit_errors / r.bits;
+		const double goodput = (r.frames - r.frame_errors) * 8.0 * LAB_OFDM_CHAR_MESSAGE_SIZE / airtime;
+		if(json){
+			printf("%s  {\"fs\": %lu, \"upsample\": %d, \"fc\": %g, \"bands\": %d, \"snr_db\": %g, \"cfo_hz\": %g, \"delay\": %d, "
+					"\"frames\": %llu, \"frame_errors\": %llu, \"fer\": %g, \"bits\": %llu, \"bit_errors\": %llu, \"ber\": %g, "
+					"\"rmse\": %g, \"goodput_bps\": %g, \"ns_per_frame\": %.0f}",
+					first ? "" : ",\n", (unsigned long) md->sample_rate, md->upsample_rate, md->center_frequency, p->dual ? 2 : 1,
+					p->snr_db, p->cfo_hz, p->delay, (unsigned long long) r.frames, (unsigned long long) r.frame_errors, fer,
+					(unsigned long long) r.bits, (unsigned long long) r.bit_errors, ber, r.rmse_sum / r.frames, goodput,
+					(double) r.ns / r.trials);
+		}else{
+			printf("%lu,%d,%g,%d,%g,%g,%d,%llu,%llu,%g,%llu,%llu,%g,%g,%g,%.0f\n",
+					(unsigned long) md->sample_rate, md->upsample_rate, md->center_frequency, p->dual ? 2 : 1,
+					p->snr_db, p->cfo_hz, p->delay, (unsigned long long) r.frames, (unsigned long long) r.frame_errors, fer,
+					(unsigned long long) r.bits, (unsigned long long) r.bit_errors, ber, r.rmse_sum / r.frames, goodput,
+					(double) r.ns / r.trials);
+		}
+		first = false;
+	}
+	if(json){
+		printf("\n]}\n");
+	}
+	return EXIT_SUCCESS;
+}
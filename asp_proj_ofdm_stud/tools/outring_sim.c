@@ -0,0 +1,223 @@
+/** @file Simulation of the output ring accounting of headphone.c on the PC.
+ * Runs the functions of src/backend/hw/outring.h as WavePlayBack and
+ * WavePlayerReleaseHalf call them, against a simulated clock: the DMA starts
+ * a block every block period and releases half of the ring at every half
+ * transfer and transfer complete event, while the main loop fills one block
+ * after the other, each taking the time given by a fill schedule. Interrupts
+ * preempt a fill, and a fill writes its block when it ends, as the output
+ * conversion is the last step of fill_buffer. As on the board, the main loop
+ * halts when it sees the underflow flag.
+ *
+ * Independently of the accounting, the simulation records which block each
+ * slot of the ring holds and when it was written, and counts a glitch when
+ * the DMA starts a block that has not been written in time, or when a block
+ * is overwritten before it has been played. For AUDIO_OUT_BUFFERS of 2, 4 and
+ * 8 and every schedule it checks that no glitch goes unflagged, that the flag
+ * is raised no later than the first glitch, and that a steady load below one
+ * block period never raises it. The flag may be raised without a glitch: the
+ * accounting only runs at the half events, so it flags a half that is not
+ * completely filled when the DMA starts it, even if its last blocks would
+ * still be filled in time. It also prints the longest single fill that passes
+ * without an underflow. The exit status is nonzero if a check fails.
+ *
+ * Build and run from the asp_proj_ofdm_stud directory:
+ *
+ *	gcc -O2 -std=gnu11 -o outring_sim tools/outring_sim.c -Isrc/backend/hw
+ *	./outring_sim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include "outring.h"
+
+/** @brief Simulation ticks per block period */
+#define SIM_PERIOD		(1000)
+
+/** @brief Number of blocks filled by the main loop in each run */
+#define SIM_FILLS		(10000)
+
+/** @brief Largest ring simulated */
+#define SIM_MAX_BLOCKS	(8)
+
+/** @brief Returns the duration of fill number k [ticks] */
+typedef int64_t (*sim_schedule_t)(uint32_t k, int64_t arg);
+
+struct sim_result_s {
+	bool flagged;				//!< Whether the underflow flag was raised
+	int64_t flag_time;			//!< When the flag was raised
+	uint32_t fills;				//!< Blocks filled by the main loop before it halted or finished
+	uint32_t glitches;			//!< Blocks played before they were written, or overwritten before they were played
+	int64_t glitch_time;		//!< When the first glitch happened
+};
+
+/** @brief State of a simulated ring */
+struct sim_s {
+	uint32_t blocks;
+	uint32_t filled, played;
+	bool underflow;
+	int64_t next_release;			//!< Time of the next DMA half event
+	uint32_t next_play;				//!< Block the DMA starts next
+	uint32_t slot_block[SIM_MAX_BLOCKS];	//!< Block held by each slot of the ring
+	int64_t slot_time[SIM_MAX_BLOCKS];		//!< When each slot was written
+	struct sim_result_s res;
+};
+
+static void sim_glitch(struct sim_s * const s, const int64_t t){
+	if(s->res.glitches++ == 0){
+		s->res.glitch_time = t;
+	}
+}
+
+/** @brief Runs the DMA up to and including time t: checks the blocks it starts
+ * and releases halves of the ring as WavePlayerReleaseHalf does */
+static void sim_dma(struct sim_s * const s, const int64_t t){
+	while((int64_t) s->next_play * SIM_PERIOD <= t){
+		const int64_t start = (int64_t) s->next_play * SIM_PERIOD;
+		const uint32_t slot = s->next_play % s->blocks;
+		if(s->slot_block[slot] != s->next_play || s->slot_time[slot] > start){
+			sim_glitch(s, start);
+		}
+		s->next_play++;
+	}
+	while(s->next_release <= t){
+		s->played = outring_release_half(s->played, s->blocks);
+		if(outring_underflow(s->filled, s->played, s->blocks) && !s->underflow){
+			s->underflow = true;
+			s->res.flagged = true;
+			s->res.flag_time = s->next_release;
+		}
+		s->next_release += (int64_t) SIM_PERIOD * s->blocks / 2;
+	}
+}
+
+/** @brief Runs the main loop of WavePlayBack for SIM_FILLS blocks, or until it halts */
+static struct sim_result_s sim_run(const uint32_t blocks, const sim_schedule_t schedule, const int64_t arg){
+	struct sim_s s = {0};
+	int64_t now = 0;
+	uint32_t i;
+	s.blocks = blocks;
+	//The ring is started full of silence
+	s.filled = outring_start_filled(blocks);
+	for(i = 0; i < blocks; i++){
+		s.slot_block[i] = i;
+	}
+	s.next_release = (int64_t) SIM_PERIOD * blocks / 2;
+	while(s.res.fills < SIM_FILLS){
+		if(!outring_can_fill(s.filled, s.played, blocks)){
+			//Idle until the next half is released
+			now = s.next_release;
+			sim_dma(&s, now);
+			continue;
+		}
+		if(s.underflow){
+			break;
+		}
+		//Interrupts during the fill, which ends with writing the block
+		const int64_t end = now + schedule(s.res.fills, arg);
+		sim_dma(&s, end - 1);
+		const uint32_t slot = outring_fill_index(s.filled, blocks);
+		if(s.slot_block[slot] + blocks != s.filled || (int64_t) (s.slot_block[slot] + 1) * SIM_PERIOD > end){
+			//The block in this slot has not been played completely
+			sim_glitch(&s, end);
+		}
+		s.slot_block[slot] = s.filled;
+		s.slot_time[slot] = end;
+		s.filled++;
+		s.res.fills++;
+		now = end;
+		sim_dma(&s, now);
+	}
+	return s.res;
+}
+
+/** @brief Every fill takes arg ticks */
+static int64_t sim_steady(uint32_t k, int64_t arg){
+	(void) k;
+	return arg;
+}
+
+/** @brief Fill 100 takes arg ticks, the others a quarter period */
+static int64_t sim_burst(uint32_t k, int64_t arg){
+	return (k == 100) ? arg : SIM_PERIOD / 4;
+}
+
+/** @brief Fills alternate between arg ticks and a quarter period */
+static int64_t sim_alternate(uint32_t k, int64_t arg){
+	return (k % 2) ? arg : SIM_PERIOD / 4;
+}
+
+/** @brief Pseudo-random fills between a quarter period and arg ticks */
+static int64_t sim_random(uint32_t k, int64_t arg){
+	uint32_t x = k * 2654435761u;
+	x ^= x >> 15;
+	return SIM_PERIOD / 4 + (int64_t) (x % 1024) * (arg - SIM_PERIOD / 4) / 1023;
+}
+
+static int sim_failures;
+
+/** @brief Runs one simulation, checks the flag against the glitches and prints the result
+ * @param expect	1 if an underflow is expected, 0 if not, -1 if either is accepted */
+static struct sim_result_s sim_check(const uint32_t blocks, const char * name, const sim_schedule_t schedule, const int64_t arg, const int expect){
+	const struct sim_result_s res = sim_run(blocks, schedule, arg);
+	bool ok = true;
+	if(res.glitches > 0 && (!res.flagged || res.flag_time > res.glitch_time)){
+		printf("  glitch at %.2f periods was not flagged in time\n", (double) res.glitch_time / SIM_PERIOD);
+		ok = false;
+	}
+	if(expect >= 0 && res.flagged != (expect != 0)){
+		printf("  underflow %s\n", expect ? "not detected" : "detected unexpectedly");
+		ok = false;
+	}
+	sim_failures += !ok;
+	printf("%u blocks, %-9s %5.2f periods: %5u fills, %s", blocks, name, (double) arg / SIM_PERIOD,
+			res.fills, ok ? "ok" : "FAIL");
+	if(res.flagged){
+		printf(", underflow at %.2f periods", (double) res.flag_time / SIM_PERIOD);
+	}
+	if(res.glitches > 0){
+		printf(", %u glitches from %.2f periods", res.glitches, (double) res.glitch_time / SIM_PERIOD);
+	}
+	printf("\n");
+	return res;
+}
+
+/** @brief Returns the longest fill of a schedule that does not underflow [ticks] */
+static int64_t sim_longest(const uint32_t blocks, const sim_schedule_t schedule){
+	int64_t lo = 0, hi = (int64_t) SIM_PERIOD * (blocks + 1);
+	while(hi - lo > 1){
+		const int64_t mid = (lo + hi) / 2;
+		if(sim_run(blocks, schedule, mid).flagged){
+			hi = mid;
+		}else{
+			lo = mid;
+		}
+	}
+	return lo;
+}
+
+int main(void){
+	const uint32_t sizes[] = {2, 4, 8};
+	uint32_t i;
+	for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++){
+		const uint32_t b = sizes[i];
+		sim_check(b, "steady", sim_steady, SIM_PERIOD * 9 / 10, 0);
+		sim_check(b, "steady", sim_steady, SIM_PERIOD, 0);
+		sim_check(b, "steady", sim_steady, SIM_PERIOD * 11 / 10, 1);
+		sim_check(b, "random", sim_random, SIM_PERIOD * 3 / 2, -1);
+		sim_check(b, "random", sim_random, SIM_PERIOD * 2, 1);
+		//A single fill may take half the ring less the other fills of its half
+		sim_check(b, "burst", sim_burst, SIM_PERIOD * b / 2 - (b / 2 - 1) * SIM_PERIOD / 4, 0);
+		sim_check(b, "burst", sim_burst, SIM_PERIOD * b / 2 + SIM_PERIOD / 100, 1);
+		sim_check(b, "alternate", sim_alternate, SIM_PERIOD * 7 / 4, -1);
+		//The DMA overtakes the main loop
+		sim_check(b, "burst", sim_burst, SIM_PERIOD * (b + 1), 1);
+		sim_check(b, "burst", sim_burst, SIM_PERIOD * 100, 1);
+		printf("%u blocks: longest single fill %.3f periods, longest alternate fill %.3f periods\n\n", b,
+				(double) sim_longest(b, sim_burst) / SIM_PERIOD, (double) sim_longest(b, sim_alternate) / SIM_PERIOD);
+	}
+	printf("%d checks failed\n", sim_failures);
+	return sim_failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,267 @@
+/** @file Unit test of the PCM conversion kernels on the PC.
+ * Compiles src/backend/pcm/pcm.c three times: for the Cortex-M4 DSP path,
+ * with SSAT and PKHBT emulated in C and the portable clamping conversion
+ * standing in for VCVT, for the SSE2 path and for the plain C path. Each
+ * variant of pcm_f32_to_i16_stereo and pcm_f32_to_i16 is checked against an
+ * exact reference for every float, or every step'th float, in both channels,
+ * with the special values (+-1, out-of-range values, infinities, NaN and
+ * denormals) checked separately. pcm_i16_to_f32 is checked for every 16-bit sample. Odd block
+ * lengths are checked for the SSE2 and plain C paths, the DSP path requires
+ * even lengths. The host time per sample of each variant is printed; it says
+ * nothing about the cycle counts on target, which the "output convert" and
+ * "mic convert" profile scopes measure. The exit status is nonzero if any
+ * output differs.
+ *
+ * Build and run from the asp_proj_ofdm_stud directory:
+ *
+ *	gcc -O2 -std=gnu11 -msse2 -o pcm_test tools/pcm_test.c -Isrc/backend/CMSIS/Include -lm
+ *	./pcm_test [step]
+ *
+ * Checking every float takes a few minutes, a step of 4099 about a second.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+/** @brief Number of samples per channel converted per call */
+#define PCM_TEST_BLOCK		(4096)
+
+/* The Cortex-M4 DSP path. The include guard of arm_math.h is defined so that
+ * the header is skipped, and the intrinsics are provided here. */
+
+static inline int32_t pcm_test_ssat(const int32_t x, const unsigned bits){
+	const int32_t hi = (1 << (bits - 1)) - 1;
+	return (x > hi) ? hi : ((x < -hi - 1) ? -hi - 1 : x);
+}
+
+#define _ARM_MATH_H
+#define __ARM_FEATURE_DSP		1
+#define __SSAT(x, bits)			pcm_test_ssat((x), (bits))
+#define __PKHBT(a, b, shift)	((((uint32_t) (a)) & 0x0000FFFFUL) | ((((uint32_t) (b)) << (shift)) & 0xFFFF0000UL))
+#define pcm_f32_to_i16_stereo	pcm_dsp_f32_to_i16_stereo
+#define pcm_f32_to_i16			pcm_dsp_f32_to_i16
+#define pcm_i16_to_f32			pcm_dsp_i16_to_f32
+#define pcm_sample				pcm_dsp_sample
+#include "../src/backend/pcm/pcm.c"
+#undef __ARM_FEATURE_DSP
+#undef pcm_f32_to_i16_stereo
+#undef pcm_f32_to_i16
+#undef pcm_i16_to_f32
+#undef pcm_sample
+
+/* The SSE2 path */
+
+#define pcm_f32_to_i16_stereo	pcm_sse2_f32_to_i16_stereo
+#define pcm_f32_to_i16			pcm_sse2_f32_to_i16
+#define pcm_i16_to_f32			pcm_sse2_i16_to_f32
+#define pcm_sample				pcm_sse2_sample
+#include "../src/backend/pcm/pcm.c"
+#undef pcm_f32_to_i16_stereo
+#undef pcm_f32_to_i16
+#undef pcm_i16_to_f32
+#undef pcm_sample
+
+/* The plain C path */
+
+#undef __SSE2__
+#define pcm_f32_to_i16_stereo	pcm_c_f32_to_i16_stereo
+#define pcm_f32_to_i16			pcm_c_f32_to_i16
+#define pcm_i16_to_f32			pcm_c_i16_to_f32
+#define pcm_sample				pcm_c_sample
+#include "../src/backend/pcm/pcm.c"
+#undef pcm_f32_to_i16_stereo
+#undef pcm_f32_to_i16
+#undef pcm_i16_to_f32
+#undef pcm_sample
+
+struct pcm_test_variant_s {
+	const char * name;
+	void (*f32_to_i16_stereo)(const float *, const float *, int16_t *, uint_fast32_t);
+	void (*f32_to_i16)(const float *, int16_t *, uint_fast32_t);
+	void (*i16_to_f32)(const int16_t *, float *, uint_fast32_t, float);
+	bool odd;					//!< Whether odd lengths are allowed in f32_to_i16_stereo
+	double seconds;				//!< Time spent in f32_to_i16_stereo
+	unsigned long samples;		//!< Samples converted by f32_to_i16_stereo
+};
+
+static struct pcm_test_variant_s variants[] = {
+	{"dsp", pcm_dsp_f32_to_i16_stereo, pcm_dsp_f32_to_i16, pcm_dsp_i16_to_f32, false, 0, 0},
+	{"sse2", pcm_sse2_f32_to_i16_stereo, pcm_sse2_f32_to_i16, pcm_sse2_i16_to_f32, true, 0, 0},
+	{"c", pcm_c_f32_to_i16_stereo, pcm_c_f32_to_i16, pcm_c_i16_to_f32, true, 0, 0},
+};
+
+static unsigned long pcm_test_failures;
+
+static double pcm_test_seconds(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/** @brief The exact conversion of pcm_f32_to_i16_stereo: NaN is 0, other values
+ * are saturated to [-1, 1], multiplied by INT16_MAX with the product rounded
+ * to float, as FtoI16 does, and rounded towards zero */
+static int16_t pcm_test_reference(const float x){
+	if(isnan(x)){
+		return 0;
+	}
+	const double sat = fmin(fmax(x, -1.0), 1.0);
+	//The product of a float and a 16-bit integer is exact in double
+	return (int16_t) truncf((float) (sat * INT16_MAX));
+}
+
+static float pcm_test_float(const uint32_t bits){
+	float x;
+	memcpy(&x, &bits, sizeof(x));
+	return x;
+}
+
+/** @brief Converts len samples with every variant and compares them with the reference */
+static void pcm_test_block(const float * left, const float * right, const uint_fast32_t len){
+	static int16_t out[2 * PCM_TEST_BLOCK + 2] __attribute__((aligned(16)));
+	uint_fast32_t i, v;
+	for(v = 0; v < NUMEL(variants); v++){
+		if((len % 2 != 0) && !variants[v].odd){
+			continue;
+		}
+		//Mark the sample after the block, which must not be written
+		out[2 * len] = out[2 * len + 1] = 0x5A5A;
+		const double t = pcm_test_seconds();
+		variants[v].f32_to_i16_stereo(left, right, out, len);
+		variants[v].seconds += pcm_test_seconds() - t;
+		variants[v].samples += len;
+		for(i = 0; i < len; i++){
+			const int16_t l = pcm_test_reference(left[i]), r = pcm_test_reference(right[i]);
+			if(out[2 * i] != l || out[2 * i + 1] != r){
+				if(pcm_test_failures++ < 10){
+					printf("%s: sample %u of %u: (%.9g, %.9g) gave (%d, %d), expected (%d, %d)\n",
+							variants[v].name, (unsigned) i, (unsigned) len, left[i], right[i],
+							out[2 * i], out[2 * i + 1], l, r);
+				}
+			}
+		}
+		if(out[2 * len] != 0x5A5A || out[2 * len + 1] != 0x5A5A){
+			pcm_test_failures++;
+			printf("%s: wrote past the block of %u samples\n", variants[v].name, (unsigned) len);
+		}
+	}
+	//The mono kernel takes any length and an output aligned to 16 bits only
+	for(v = 0; v < NUMEL(variants); v++){
+		out[len + 1] = 0x5A5A;
+		variants[v].f32_to_i16(right, &out[1], len);
+		for(i = 0; i < len; i++){
+			const int16_t r = pcm_test_reference(right[i]);
+			if(out[i + 1] != r){
+				if(pcm_test_failures++ < 10){
+					printf("%s mono: sample %u of %u: %.9g gave %d, expected %d\n",
+							variants[v].name, (unsigned) i, (unsigned) len, right[i], out[i + 1], r);
+				}
+			}
+		}
+		if(out[len + 1] != 0x5A5A){
+			pcm_test_failures++;
+			printf("%s mono: wrote past the block of %u samples\n", variants[v].name, (unsigned) len);
+		}
+	}
+}
+
+/** @brief Checks the special values in every position and with every block length up to 16 */
+static void pcm_test_special(void){
+	const float special[] = {
+		0.0f, -0.0f, 1.0f, -1.0f, nextafterf(1.0f, 0), nextafterf(-1.0f, 0),
+		nextafterf(1.0f, 2.0f), nextafterf(-1.0f, -2.0f), 1.0f / INT16_MAX, -1.0f / INT16_MAX,
+		nextafterf(1.0f / INT16_MAX, 0), nextafterf(-1.0f / INT16_MAX, 0),
+		0.5f, -0.5f, 2.0f, -2.0f, 65536.0f, -65536.0f, 1e10f, -1e10f, 3e38f, -3e38f,
+		INFINITY, -INFINITY, NAN, -NAN, pcm_test_float(0x7F800001), pcm_test_float(0xFFC00001),
+		1e-40f, -1e-40f, pcm_test_float(1), pcm_test_float(0x80000001),
+	};
+	float left[16], right[16];
+	uint_fast32_t i, j, len;
+	for(i = 0; i < NUMEL(special); i++){
+		for(j = 0; j < NUMEL(special); j++){
+			for(len = 1; len <= NUMEL(left); len++){
+				uint_fast32_t k;
+				for(k = 0; k < len; k++){
+					left[k] = special[(i + k) % NUMEL(special)];
+					right[k] = special[(j + 3 * k) % NUMEL(special)];
+				}
+				pcm_test_block(left, right, len);
+			}
+		}
+	}
+}
+
+/** @brief Checks every step'th float in blocks of PCM_TEST_BLOCK samples,
+ * with the right channel running through the floats in the opposite order */
+static void pcm_test_all_floats(const uint32_t step){
+	static float left[PCM_TEST_BLOCK], right[PCM_TEST_BLOCK];
+	uint64_t bits = 0;
+	while(bits <= UINT32_MAX){
+		uint_fast32_t len;
+		for(len = 0; len < PCM_TEST_BLOCK && bits <= UINT32_MAX; len++, bits += step){
+			left[len] = pcm_test_float((uint32_t) bits);
+			right[len] = pcm_test_float(~(uint32_t) bits);
+		}
+		pcm_test_block(left, right, len);
+	}
+}
+
+/** @brief Checks pcm_i16_to_f32 for every sample, with odd lengths and a few scales */
+static void pcm_test_i16_to_f32(void){
+	static int16_t in[UINT16_MAX + 1];
+	static float out[UINT16_MAX + 2];
+	const float scales[] = {1.0f / INT16_MAX, 1.0f, -3.0f};
+	const uint_fast32_t lens[] = {UINT16_MAX + 1, UINT16_MAX, 7, 1};
+	uint_fast32_t i, s, n, v;
+	for(i = 0; i < NUMEL(in); i++){
+		in[i] = (int16_t) (i + INT16_MIN);
+	}
+	for(v = 0; v < NUMEL(variants); v++){
+		for(s = 0; s < NUMEL(scales); s++){
+			for(n = 0; n < NUMEL(lens); n++){
+				const uint_fast32_t len = lens[n];
+				out[len] = -42.0f;
+				variants[v].i16_to_f32(in, out, len, scales[s]);
+				for(i = 0; i < len; i++){
+					//The conversion to float is exact, so only the product is rounded
+					if(out[i] != (float) ((double) in[i] * scales[s])){
+						if(pcm_test_failures++ < 10){
+							printf("%s: %d * %.9g gave %.9g\n", variants[v].name, in[i], scales[s], out[i]);
+						}
+					}
+				}
+				if(out[len] != -42.0f){
+					pcm_test_failures++;
+					printf("%s: wrote past the block of %u samples\n", variants[v].name, (unsigned) len);
+				}
+			}
+		}
+	}
+}
+
+int main(int argc, char ** argv){
+	const uint32_t step = (argc > 1) ? strtoul(argv[1], NULL, 0) : 1;
+	uint_fast32_t v;
+	if(step == 0){
+		fprintf(stderr, "usage: %s [step]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+	pcm_test_special();
+	pcm_test_i16_to_f32();
+	for(v = 0; v < NUMEL(variants); v++){
+		variants[v].seconds = 0;
+		variants[v].samples = 0;
+	}
+	pcm_test_all_floats(step);
+	for(v = 0; v < NUMEL(variants); v++){
+		printf("%s: %lu stereo samples, %.2f ns per sample on this host\n", variants[v].name,
+				variants[v].samples, variants[v].seconds / variants[v].samples * 1e9);
+	}
+	printf("%lu samples differ\n", pcm_test_failures);
+	return pcm_test_failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
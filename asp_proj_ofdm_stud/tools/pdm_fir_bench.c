@@ -0,0 +1,232 @@
+/** @file Bit-identity check and benchmark of the PDM decimation filters on the PC.
+ * pdm_fir_flt_decimate is checked against putting the words one at a time
+ * with pdm_fir_flt_put and reading every output with pdm_fir_flt_get, which
+ * is how the filter was evaluated before it worked on blocks. The check uses
+ * random PDM words, several decimation factors and output widths, and call
+ * lengths below, at and above PDM_FTL_BLOCK_WORDS. pdm_fir_dec2_decimate is
+ * checked against a direct form FIR filter without the tap symmetry, on
+ * random values near the 16-bit range and for several call lengths. Then the
+ * throughput of each is printed, in the block size microphone.c uses and in
+ * output samples at the final rate, 64 PDM bits per sample. The exit status
+ * is nonzero if any output differs.
+ *
+ * Build and run from the asp_proj_ofdm_stud directory:
+ *
+ *	gcc -O2 -std=gnu11 -o pdm_fir_bench tools/pdm_fir_bench.c src/backend/pdm_fir/pdm_fir.c \
+ *		-Isrc/backend/pdm_fir
+ *	./pdm_fir_bench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "pdm_fir.h"
+
+/** @brief Number of PDM words in the identity check and in each benchmark */
+#define BENCH_WORDS			(1 << 16)
+#define BENCH_REPEAT		(64)
+
+/** @brief PDM words per output sample of both stages, and per block of microphone.c */
+#define BENCH_DEC_WORDS		(4)
+#define BENCH_BLOCK_WORDS	(64)
+
+#define NUMEL(x)	(sizeof(x) / sizeof((x)[0]))
+
+/* The tables of both stages, for the reference implementations */
+#include "pdm_fir_.h"
+
+static uint16_t words[BENCH_WORDS];
+static int out[BENCH_WORDS], ref[BENCH_WORDS];
+static unsigned long bench_failures;
+
+static double bench_seconds(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static uint32_t bench_rand(void){
+	static uint32_t x = 12345;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return x;
+}
+
+static void bench_print(const char * name, double samples, double dt){
+	printf("%-30s %6.2f Msamples/s\n", name, samples / dt * 1e-6);
+}
+
+static void bench_compare(const char * name, const int * a, const int * b, int n, int n_ref){
+	int i;
+	if(n != n_ref){
+		bench_failures++;
+		printf("%s: %d outputs, expected %d\n", name, n, n_ref);
+		return;
+	}
+	for(i = 0; i < n; i++){
+		if(a[i] != b[i]){
+			bench_failures++;
+			printf("%s: output %d is %d, expected %d\n", name, i, a[i], b[i]);
+			return;
+		}
+	}
+}
+
+/** @brief Checks pdm_fir_flt_decimate against pdm_fir_flt_put and pdm_fir_flt_get */
+static void bench_check_flt(int dec_words, int out_bits, int call_words){
+	struct pdm_fir_filter f;
+	char name[64];
+	int i, n = 0, n_ref = 0;
+	const int len = BENCH_WORDS / 4 - (BENCH_WORDS / 4) % call_words;
+	pdm_fir_flt_init(&f);
+	for(i = 0; i < len; i++){
+		pdm_fir_flt_put(&f, words[i]);
+		if((i + 1) % dec_words == 0){
+			ref[n_ref++] = pdm_fir_flt_get(&f, out_bits);
+		}
+	}
+	pdm_fir_flt_init(&f);
+	for(i = 0; i < len; i += call_words){
+		n += pdm_fir_flt_decimate(&f, &words[i], call_words, dec_words, &out[n], out_bits);
+	}
+	snprintf(name, sizeof(name), "flt dec_words %d out_bits %d call %d", dec_words, out_bits, call_words);
+	bench_compare(name, out, ref, n, n_ref);
+}
+
+/** @brief Checks pdm_fir_dec2_decimate against the direct form of the filter */
+static void bench_check_dec2(int call_len){
+	static int in[BENCH_WORDS / 4];
+	struct pdm_fir_dec2 f;
+	char name[64];
+	int i, t, n = 0, n_ref = 0;
+	const int len = NUMEL(in) - NUMEL(in) % call_len;
+	for(i = 0; i < len; i++){
+		in[i] = (int) (bench_rand() % 70001) - 35000;
+	}
+	for(i = 1; i < len; i += 2){
+		int64_t acc = 0;
+		for(t = 0; t < PDM_FTL_DEC2_TAPS; t++){
+			//The history before the first value is zero
+			if(i - t >= 0){
+				acc += (int64_t) dec2_coeff[t] * in[i - t];
+			}
+		}
+		ref[n_ref++] = (int) (acc >> PDM_FTL_DEC2_SCALE_BITS);
+	}
+	pdm_fir_dec2_init(&f);
+	for(i = 0; i < len; i += call_len){
+		n += pdm_fir_dec2_decimate(&f, &in[i], call_len, &out[n]);
+	}
+	snprintf(name, sizeof(name), "dec2 call %d", call_len);
+	bench_compare(name, out, ref, n, n_ref);
+}
+
+/** @brief Prints the throughput of the old put/get loop, each stage and both stages as in microphone.c */
+static void bench_throughput(void){
+	struct pdm_fir_filter f;
+	struct pdm_fir_dec2 f2;
+	int r, i, k, n;
+	double t, dt;
+	const double samples = (double) BENCH_REPEAT * BENCH_WORDS / BENCH_DEC_WORDS;
+	volatile int sink = 0;
+
+	pdm_fir_flt_init(&f);
+	t = bench_seconds();
+	for(r = 0; r < BENCH_REPEAT; r++){
+		for(i = 0; i < BENCH_WORDS; i++){
+			pdm_fir_flt_put(&f, words[i]);
+			if((i + 1) % BENCH_DEC_WORDS == 0){
+				sink += pdm_fir_flt_get(&f, 16);
+			}
+		}
+	}
+	dt = bench_seconds() - t;
+	bench_print("put/get, one stage:", samples, dt);
+
+	pdm_fir_flt_init(&f);
+	t = bench_seconds();
+	for(r = 0; r < BENCH_REPEAT; r++){
+		for(i = 0; i < BENCH_WORDS; i += BENCH_BLOCK_WORDS){
+			pdm_fir_flt_decimate(&f, &words[i], BENCH_BLOCK_WORDS, BENCH_DEC_WORDS, out, 16);
+		}
+		sink += out[0];
+	}
+	dt = bench_seconds() - t;
+	bench_print("decimate, one stage:", samples, dt);
+
+	pdm_fir_flt_init(&f);
+	t = bench_seconds();
+	for(r = 0; r < BENCH_REPEAT; r++){
+		for(i = 0; i < BENCH_WORDS; i += BENCH_BLOCK_WORDS){
+			pdm_fir_flt_decimate(&f, &words[i], BENCH_BLOCK_WORDS, BENCH_DEC_WORDS / 2, out, 16);
+		}
+		sink += out[0];
+	}
+	dt = bench_seconds() - t;
+	bench_print("decimate, first stage:", samples, dt);
+
+	pdm_fir_dec2_init(&f2);
+	for(k = 0; k < BENCH_BLOCK_WORDS; k++){
+		ref[k] = (int) (bench_rand() % 65536) - 32768;
+	}
+	t = bench_seconds();
+	for(r = 0; r < BENCH_REPEAT; r++){
+		for(i = 0; i < BENCH_WORDS; i += BENCH_BLOCK_WORDS){
+			pdm_fir_dec2_decimate(&f2, ref, 2 * BENCH_BLOCK_WORDS / BENCH_DEC_WORDS, out);
+		}
+		sink += out[0];
+	}
+	dt = bench_seconds() - t;
+	bench_print("second stage:", samples, dt);
+
+	pdm_fir_flt_init(&f);
+	pdm_fir_dec2_init(&f2);
+	t = bench_seconds();
+	for(r = 0; r < BENCH_REPEAT; r++){
+		for(i = 0; i < BENCH_WORDS; i += BENCH_BLOCK_WORDS){
+			n = pdm_fir_flt_decimate(&f, &words[i], BENCH_BLOCK_WORDS, BENCH_DEC_WORDS / 2, ref, 16);
+			pdm_fir_dec2_decimate(&f2, ref, n, out);
+		}
+		sink += out[0];
+	}
+	dt = bench_seconds() - t;
+	bench_print("both stages, as microphone.c:", samples, dt);
+	(void) sink;
+}
+
+int main(void){
+	const int dec_words[] = {1, 2, 3, 4, 8};
+	const int out_bits[] = {16, 24};
+	const int call_words[] = {24, 64, PDM_FTL_BLOCK_WORDS, 3 * PDM_FTL_BLOCK_WORDS + 24};
+	const int call_len[] = {2, 32, 64, 66, 1000};
+	unsigned i, j, k;
+	for(i = 0; i < NUMEL(words); i++){
+		words[i] = (uint16_t) bench_rand();
+	}
+	for(i = 0; i < NUMEL(dec_words); i++){
+		for(j = 0; j < NUMEL(out_bits); j++){
+			for(k = 0; k < NUMEL(call_words); k++){
+				//The number of words in a call must be a multiple of dec_words
+				if(call_words[k] % dec_words[i] == 0){
+					bench_check_flt(dec_words[i], out_bits[j], call_words[k]);
+				}
+			}
+		}
+	}
+	for(i = 0; i < NUMEL(call_len); i++){
+		bench_check_dec2(call_len[i]);
+	}
+	//All zero and all one bytes give opposite outputs, and the second stage taps are symmetric
+	for(i = 0; i < NUMEL(byte_coeff); i++){
+		bench_failures += (byte_coeff[i][0] != -byte_coeff[i][255]);
+	}
+	for(i = 0; i < NUMEL(dec2_coeff); i++){
+		bench_failures += (dec2_coeff[i] != dec2_coeff[NUMEL(dec2_coeff) - 1 - i]);
+	}
+	printf("%lu checks failed\n", bench_failures);
+	bench_throughput();
+	return bench_failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
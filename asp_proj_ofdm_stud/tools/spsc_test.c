@@ -0,0 +1,335 @@
+/** @file Unit test and throughput benchmark of the SPSC ring on the PC.
+ * Checks src/backend/spsc.c for empty and full buffers, wrap-around of the
+ * buffer memory and of the free-running indices, spans and commits across
+ * the end of the pool and peeking, then runs a producer and a consumer
+ * thread against each other with every access method while checking that
+ * the sequence arrives intact. Finally prints the bulk throughput of
+ * spsc_write_block/spsc_read_block. The exit status is nonzero if any check
+ * fails.
+ *
+ * Build and run from the asp_proj_ofdm_stud directory:
+ *
+ *	gcc -O2 -std=gnu11 -pthread -o spsc_test tools/spsc_test.c src/backend/spsc.c \
+ *		-Isrc -Isrc/backend
+ *	./spsc_test
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include "spsc.h"
+#include "macro.h"
+
+/** @brief Number of elements of the buffer used by the tests, a power of two */
+#define SPSC_TEST_LEN		(64)
+
+/** @brief Number of elements passed between the threads of the stress test */
+#define SPSC_TEST_STRESS	(20000000UL)
+
+/** @brief Block size and number of elements of the throughput benchmark */
+#define SPSC_TEST_BLOCK		(256)
+#define SPSC_TEST_BULK		(200000000UL)
+
+static int spsc_test_checks, spsc_test_failures;
+
+/** @brief Counts a check, printing it if it fails */
+#define CHECK(cond)	do{																\
+		spsc_test_checks++;															\
+		if(!(cond)){																\
+			spsc_test_failures++;													\
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);			\
+		}																			\
+	}while(0)
+
+/** @brief Returns the time since an arbitrary point [s] */
+static double spsc_test_seconds(void){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/** @brief Initializes cb on pool with both indices at start, to test wrap-around of the indices */
+static void spsc_test_new_at(spsc_s * const cb, spsc_elem_t * const pool, const spsc_idx_t start){
+	CHECK(spsc_new(cb, pool, SPSC_TEST_LEN));
+	cb->head = start;
+	cb->tail = start;
+}
+
+static void spsc_test_new(void){
+	spsc_elem_t pool[SPSC_TEST_LEN];
+	spsc_s cb;
+	CHECK(!spsc_new(&cb, pool, 0));
+	CHECK(!spsc_new(&cb, pool, 48));
+	CHECK(!spsc_new(&cb, NULL, SPSC_TEST_LEN));
+	CHECK(spsc_new(&cb, pool, 1));
+	CHECK(spsc_new(&cb, pool, SPSC_TEST_LEN));
+}
+
+static void spsc_test_empty_full(const spsc_idx_t start){
+	spsc_elem_t pool[SPSC_TEST_LEN], block[SPSC_TEST_LEN + 1], x;
+	const spsc_elem_t * rspan;
+	spsc_elem_t * wspan;
+	spsc_s cb;
+	spsc_idx_t i;
+	spsc_test_new_at(&cb, pool, start);
+	//Empty
+	CHECK(spsc_elems_used(&cb) == 0);
+	CHECK(spsc_elems_free(&cb) == SPSC_TEST_LEN);
+	CHECK(!spsc_read(&cb, &x));
+	CHECK(!spsc_peek(&cb, 0, &x));
+	CHECK(spsc_read_span(&cb, &rspan) == 0);
+	CHECK(spsc_read_block(&cb, block, 1) == 0);
+	//Full
+	for(i = 0; i < SPSC_TEST_LEN; i++){
+		CHECK(spsc_write(&cb, i));
+	}
+	CHECK(!spsc_write(&cb, 0xFFFF));
+	CHECK(spsc_elems_used(&cb) == SPSC_TEST_LEN);
+	CHECK(spsc_elems_free(&cb) == 0);
+	CHECK(spsc_write_span(&cb, &wspan) == 0);
+	CHECK(spsc_write_block(&cb, block, 1) == 0);
+	CHECK(spsc_peek(&cb, SPSC_TEST_LEN - 1, &x) && x == SPSC_TEST_LEN - 1);
+	CHECK(!spsc_peek(&cb, SPSC_TEST_LEN, &x));
+	//A full buffer reads back completely and in order, and a longer read is truncated
+	CHECK(spsc_read_block(&cb, block, SPSC_TEST_LEN + 1) == SPSC_TEST_LEN);
+	for(i = 0; i < SPSC_TEST_LEN; i++){
+		CHECK(block[i] == i);
+	}
+	CHECK(spsc_elems_used(&cb) == 0);
+	//A longer write is truncated to the free space
+	CHECK(spsc_write_block(&cb, block, SPSC_TEST_LEN + 1) == SPSC_TEST_LEN);
+	CHECK(spsc_elems_free(&cb) == 0);
+}
+
+static void spsc_test_spans(void){
+	spsc_elem_t pool[SPSC_TEST_LEN], block[SPSC_TEST_LEN], x;
+	const spsc_elem_t * rspan;
+	spsc_elem_t * wspan;
+	spsc_s cb;
+	spsc_idx_t i, n;
+	//Start three elements before the end of the pool
+	spsc_test_new_at(&cb, pool, SPSC_TEST_LEN - 3);
+	n = spsc_write_span(&cb, &wspan);
+	CHECK(n == 3 && wspan == &pool[SPSC_TEST_LEN - 3]);
+	for(i = 0; i < n; i++){
+		wspan[i] = 100 + i;
+	}
+	//Nothing is visible to the consumer before the commit
+	CHECK(spsc_read_span(&cb, &rspan) == 0);
+	spsc_write_commit(&cb, n);
+	//The next span continues at the start of the pool, up to the tail
+	n = spsc_write_span(&cb, &wspan);
+	CHECK(n == SPSC_TEST_LEN - 3 && wspan == &pool[0]);
+	wspan[0] = 103;
+	wspan[1] = 104;
+	spsc_write_commit(&cb, 2);
+	CHECK(spsc_elems_used(&cb) == 5);
+	//Peeking crosses the end of the pool
+	for(i = 0; i < 5; i++){
+		CHECK(spsc_peek(&cb, i, &x) && x == 100 + i);
+	}
+	//Reading spans stops at the end of the pool, partial commits are allowed
+	n = spsc_read_span(&cb, &rspan);
+	CHECK(n == 3 && rspan == &pool[SPSC_TEST_LEN - 3] && rspan[0] == 100);
+	spsc_read_commit(&cb, 1);
+	n = spsc_read_span(&cb, &rspan);
+	CHECK(n == 2 && rspan[0] == 101 && rspan[1] == 102);
+	spsc_read_commit(&cb, n);
+	n = spsc_read_span(&cb, &rspan);
+	CHECK(n == 2 && rspan == &pool[0] && rspan[0] == 103 && rspan[1] == 104);
+	spsc_read_commit(&cb, n);
+	CHECK(spsc_elems_used(&cb) == 0);
+
+	//Blocks are split across the end of the pool
+	spsc_test_new_at(&cb, pool, SPSC_TEST_LEN - 5);
+	for(i = 0; i < SPSC_TEST_LEN; i++){
+		block[i] = 1000 + i;
+	}
+	CHECK(spsc_write_block(&cb, block, 10) == 10);
+	CHECK(pool[SPSC_TEST_LEN - 1] == 1004 && pool[0] == 1005 && pool[4] == 1009);
+	memset(block, 0, sizeof(block));
+	CHECK(spsc_read_block(&cb, block, 10) == 10);
+	for(i = 0; i < 10; i++){
+		CHECK(block[i] == 1000 + i);
+	}
+}
+
+/** @brief Writes and reads blocks of every size for many times the length of the buffer,
+ * starting with the indices shortly before they overflow */
+static void spsc_test_wrap(const spsc_idx_t start){
+	spsc_elem_t pool[SPSC_TEST_LEN], block[SPSC_TEST_LEN];
+	spsc_s cb;
+	spsc_elem_t next_write = 0, next_read = 0;
+	spsc_idx_t len, i;
+	bool ok = true;
+	spsc_test_new_at(&cb, pool, start);
+	for(len = 1; len <= SPSC_TEST_LEN; len++){
+		for(i = 0; i < 3 * SPSC_TEST_LEN; i++){
+			spsc_idx_t j;
+			const spsc_idx_t n = MIN(len, spsc_elems_free(&cb));
+			for(j = 0; j < n; j++){
+				block[j] = next_write++;
+			}
+			ok &= (spsc_write_block(&cb, block, n) == n);
+			//Leave a varying number of elements in the buffer
+			const spsc_idx_t m = (i % 2) ? spsc_elems_used(&cb) : spsc_elems_used(&cb) / 2;
+			ok &= (spsc_read_block(&cb, block, m) == m);
+			for(j = 0; j < m; j++){
+				ok &= (block[j] == next_read++);
+			}
+		}
+	}
+	CHECK(ok);
+	CHECK(cb.head - cb.tail == spsc_elems_used(&cb));
+}
+
+/* Stress test with a producer and a consumer thread */
+
+static spsc_s stress_cb;
+static spsc_elem_t stress_pool[SPSC_TEST_LEN];
+
+/** @brief Produces SPSC_TEST_STRESS sequence numbers, cycling through the access methods */
+static void * spsc_test_producer(void * arg){
+	unsigned long sent = 0;
+	spsc_elem_t block[SPSC_TEST_LEN];
+	unsigned method = 0;
+	(void) arg;
+	while(sent < SPSC_TEST_STRESS){
+		const unsigned long before = sent;
+		switch(method++ % 3){
+		case 0:
+			if(spsc_write(&stress_cb, (spsc_elem_t) sent)){
+				sent++;
+			}
+			break;
+		case 1:
+		{
+			const spsc_idx_t n = MIN(1 + method % SPSC_TEST_LEN, SPSC_TEST_STRESS - sent);
+			spsc_idx_t i;
+			for(i = 0; i < n; i++){
+				block[i] = (spsc_elem_t) (sent + i);
+			}
+			sent += spsc_write_block(&stress_cb, block, n);
+			break;
+		}
+		default:
+		{
+			spsc_elem_t * span;
+			const spsc_idx_t n = MIN(spsc_write_span(&stress_cb, &span), SPSC_TEST_STRESS - sent);
+			spsc_idx_t i;
+			for(i = 0; i < n; i++){
+				span[i] = (spsc_elem_t) (sent + i);
+			}
+			spsc_write_commit(&stress_cb, n);
+			sent += n;
+			break;
+		}
+		}
+		//Let the consumer run when the buffer is full, also on a single core
+		if(sent == before){
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+/** @brief Consumes the sequence, cycling through the access methods
+ * @return The number of elements out of sequence, cast to a pointer */
+static void * spsc_test_consumer(void * arg){
+	unsigned long received = 0, errors = 0;
+	spsc_elem_t block[SPSC_TEST_LEN], x;
+	unsigned method = 0;
+	(void) arg;
+	while(received < SPSC_TEST_STRESS){
+		spsc_idx_t i, n = 0;
+		switch(method++ % 3){
+		case 0:
+			if(spsc_peek(&stress_cb, 0, &x)){
+				errors += (x != (spsc_elem_t) received);
+				errors += !spsc_read(&stress_cb, &x) || (x != (spsc_elem_t) received);
+				n = 1;
+			}
+			break;
+		case 1:
+			n = spsc_read_block(&stress_cb, block, 1 + method % SPSC_TEST_LEN);
+			for(i = 0; i < n; i++){
+				errors += (block[i] != (spsc_elem_t) (received + i));
+			}
+			break;
+		default:
+		{
+			const spsc_elem_t * span;
+			n = spsc_read_span(&stress_cb, &span);
+			for(i = 0; i < n; i++){
+				errors += (span[i] != (spsc_elem_t) (received + i));
+			}
+			spsc_read_commit(&stress_cb, n);
+			break;
+		}
+		}
+		received += n;
+		if(n == 0){
+			sched_yield();
+		}
+	}
+	return (void *) (uintptr_t) errors;
+}
+
+static void spsc_test_stress(void){
+	pthread_t producer, consumer;
+	void * errors;
+	spsc_test_new_at(&stress_cb, stress_pool, (spsc_idx_t) -1000);
+	const double t = spsc_test_seconds();
+	pthread_create(&consumer, NULL, spsc_test_consumer, NULL);
+	pthread_create(&producer, NULL, spsc_test_producer, NULL);
+	pthread_join(producer, NULL);
+	pthread_join(consumer, &errors);
+	const double dt = spsc_test_seconds() - t;
+	CHECK((uintptr_t) errors == 0);
+	CHECK(spsc_elems_used(&stress_cb) == 0);
+	printf("stress: %lu elements between two threads, %lu out of sequence, %.1f Melem/s\n",
+			SPSC_TEST_STRESS, (unsigned long) (uintptr_t) errors, SPSC_TEST_STRESS / dt * 1e-6);
+}
+
+/** @brief Prints the throughput of moving blocks through the buffer in a single thread */
+static void spsc_test_throughput(void){
+	static spsc_elem_t pool[4 * SPSC_TEST_BLOCK], in[SPSC_TEST_BLOCK], out[SPSC_TEST_BLOCK];
+	spsc_s cb;
+	unsigned long n;
+	spsc_idx_t i;
+	unsigned sum = 0;
+	CHECK(spsc_new(&cb, pool, NUMEL(pool)));
+	for(i = 0; i < SPSC_TEST_BLOCK; i++){
+		in[i] = i;
+	}
+	//Odd block sizes keep the copies crossing the end of the pool
+	const spsc_idx_t len = SPSC_TEST_BLOCK - 1;
+	const double t = spsc_test_seconds();
+	for(n = 0; n < SPSC_TEST_BULK; n += len){
+		spsc_write_block(&cb, in, len);
+		spsc_read_block(&cb, out, len);
+		sum += out[len - 1];
+	}
+	const double dt = spsc_test_seconds() - t;
+	CHECK(sum == (unsigned) (n / len) * (len - 1));
+	printf("bulk: blocks of %u elements, %.0f Melem/s, %.2f ns per element written and read\n",
+			(unsigned) len, n / dt * 1e-6, dt / n * 1e9);
+}
+
+int main(void){
+	spsc_test_new();
+	spsc_test_empty_full(0);
+	spsc_test_empty_full((spsc_idx_t) -SPSC_TEST_LEN / 2);
+	spsc_test_spans();
+	spsc_test_wrap(0);
+	spsc_test_wrap((spsc_idx_t) -7);
+	spsc_test_stress();
+	spsc_test_throughput();
+	printf("%d of %d checks failed\n", spsc_test_failures, spsc_test_checks);
+	return spsc_test_failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Decodes the binary telemetry records in a log of the serial output.
+
+Telemetry is enabled with the 't' key in the OFDM lab, after which the
+receiver results and the 'p' key profiler output are sent as binary records
+(see src/backend/telemetry/telemetry.h). Log the serial output to a file with
+any terminal program that saves raw bytes, or read the port directly
+(requires pyserial):
+
+    python3 telemetry_decode.py log.bin
+    python3 telemetry_decode.py --port /dev/ttyACM0 --seconds 30 --vectors out
+
+Every record is printed as one line. With --vectors, complex vectors are also
+written to <dir>/<time>_<name>.csv as one real,imag pair per line, ready for
+plotting a constellation. With --text, the text in between records is printed
+as well.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+from capture2wav import frames, read_port
+
+TYPE_OFDM_RX = 0x10
+TYPE_CVECTOR = 0x11
+TYPE_PROFILE = 0x12
+TYPE_HEADROOM = 0x13
+VECTOR_NAMES = {0x01: 'soft_symbols', 0x02: 'channel'}
+
+
+def cstring(b):
+    return b.split(b'\0', 1)[0].decode('latin-1')
+
+
+def decode(ftype, payload, vectors):
+    """Returns a line describing one record, or None if ftype is not a telemetry record."""
+    (stamp,) = struct.unpack_from('<I', payload)
+    t = '%10.3f s' % (stamp * 1e-6)
+    body = payload[4:]
+    if ftype == TYPE_OFDM_RX:
+        band, freq, rmse, n = struct.unpack_from('<BffB', body)
+        tx = cstring(body[10:10 + n])
+        rx = cstring(body[10 + n:10 + 2 * n])
+        return '%s ofdm_rx band %d at %.0f Hz: RMSE %.6f, sent "%s", received "%s"%s' % (
+            t, band + 1, freq, rmse, tx, rx, '' if tx == rx else '  MISMATCH')
+    if ftype == TYPE_CVECTOR:
+        vid, n, scale = struct.unpack_from('<BHf', body)
+        vals = struct.unpack_from('<%dh' % (2 * n), body, 7)
+        points = [(vals[2 * i] * scale, vals[2 * i + 1] * scale) for i in range(n)]
+        name = VECTOR_NAMES.get(vid, 'vector%d' % vid)
+        if vectors:
+            path = os.path.join(vectors, '%010d_%s.csv' % (stamp, name))
+            with open(path, 'w') as f:
+                f.writelines('%g,%g\n' % p for p in points)
+        mean_pow = sum(re * re + im * im for re, im in points) / max(n, 1)
+        return '%s cvector %s: %d values, mean power %.4g' % (t, name, n, mean_pow)
+    if ftype == TYPE_PROFILE:
+        block, calls, vmin, mean, vmax, n = struct.unpack_from('<5IB', body)
+        name = body[21:21 + n].decode('latin-1')
+        return '%s profile %-20s %10d calls %10d min %10d mean %10d max %6.1f %% of block' % (
+            t, name, calls, vmin, mean, vmax, 100.0 * vmax / block)
+    if ftype == TYPE_HEADROOM:
+        (bins,) = struct.unpack_from('<B', body)
+        counts = struct.unpack_from('<%dI' % bins, body, 1)
+        return '%s headroom overrun %d, bins %s' % (t, counts[0], ' '.join(str(c) for c in counts[1:]))
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('log', nargs='?', help='file with the raw serial output')
+    parser.add_argument('--port', help='read from this serial port instead of a file')
+    parser.add_argument('--baudrate', type=int, default=921600, help='see DEBUG_USART_BAUDRATE (default %(default)s)')
+    parser.add_argument('--seconds', type=float, default=10, help='time to read from the port (default %(default)s)')
+    parser.add_argument('--vectors', help='directory to write complex vectors to as CSV')
+    parser.add_argument('--text', action='store_true', help='print the text in between records')
+    args = parser.parse_args()
+    if args.port:
+        data = read_port(args.port, args.baudrate, args.seconds)
+    elif args.log:
+        with open(args.log, 'rb') as f:
+            data = f.read()
+    else:
+        parser.error('either a log file or --port is required')
+    if args.vectors:
+        os.makedirs(args.vectors, exist_ok=True)
+    count = 0
+    for ftype, payload in frames(data):
+        if ftype is None:
+            if args.text:
+                sys.stdout.write(payload.decode('latin-1'))
+            continue
+        try:
+            line = decode(ftype, payload, args.vectors)
+        except struct.error:
+            line = 'Malformed record of type 0x%02x' % ftype
+        if line is not None:
+            print(line)
+            count += 1
+    if count == 0:
+        print('No telemetry records found', file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,135 @@
+function export_golden_vectors( dirname, fs, fcm )
+%EXPORT_GOLDEN_VECTORS Export the signals of every OFDM stage for the C code
+%   Runs one frame through the reference chain of project1B.m and writes the
+%   input and output of every stage of lab_ofdm_process.c to CSV files in
+%   dirname, which tools/ofdm_sweep.c checks the C stages against:
+%       ofdm_sweep --golden dirname
+%   Complex vectors are written as one real,imag pair per line, real
+%   vectors and characters as one value per line. The vectors committed in
+%   golden/ are checked by default; tools/export_golden_vectors.py is a
+%   transcription of this script for regenerating them without MATLAB.
+%   dirname: output directory (default 'golden')
+%   fs: audio sample rate (default 16000)
+%   fcm: center frequency (default 4000)
+%
+%   The C code differs from project1B.m in a few conventions, followed here:
+%   - Messages are strings of N/4 characters sent least significant bit
+%     first, and the pilot is the string "Pilot Signal!" instead of a PN code
+%   - QPSK symbols are +-1+-1i, i.e. bits2sym scaled by sqrt(2)
+%   - The demodulated signal is doubled, restoring the amplitude of zi
+%   - Interpolation and decimation keep the first N_z*R samples of the
+%     convolution, which is what the CMSIS FIR functions compute
+%   The channel is the audio channel of simulate_audio_channel.m at fs,
+%   without delay and noise, so that the frame decodes without errors.
+
+if nargin<1 || isempty(dirname),
+    dirname = 'golden';
+end
+if nargin<2 || isempty(fs),
+    fs = 16000;
+end
+if nargin<3 || isempty(fcm),
+    fcm = 4000;
+end
+
+%% Constants, as in lab_ofdm_process.h
+N = 64;
+N_cp = 32;
+R = 8; % LAB_OFDM_UPSAMPLE_RATE, the only rate for which the C code uses B
+f0 = 4000; % Resonance of the audio channel
+
+message = char_block('Hello World!AAA', N);
+pilot = char_block('Pilot Signal!', N);
+
+%% Encode
+symbol = sqrt(2)*bits2sym(char2bits(message));
+pilot_symbol = sqrt(2)*bits2sym(char2bits(pilot));
+
+%% Generate OFDM frame
+z = [OFDM_gen(pilot_symbol,N,N_cp) OFDM_gen(symbol,N,N_cp)];
+
+%% Interpolate
+N_z = length(z);
+zu = zeros(1,N_z*R);
+zu(1:R:end) = z;
+B = firpm(63,2*[0 0.5/R 0.5/R*1.6 1/2],[1 1 0 0]);
+zi = conv(zu,B);
+zi = zi(1:N_z*R);
+
+%% Modulate
+n = (0:length(zi)-1);
+zmr = real(zi.*exp(1i*2*pi*fcm/fs*n));
+
+%% Channel
+z0 = 0.9*exp(1i*2*pi*f0/fs);
+a_chan = real(conv([1 -z0],[1 -conj(z0)]));
+b_chan = conv([1 -1],[1 1]);
+yrec = filter(b_chan,a_chan,zmr/max(abs(zmr)));
+
+%% Demodulate
+yib = 2*yrec.*exp(-1i*2*pi*fcm/fs*n);
+
+%% Decimate
+yi = conv(yib,B);
+y = yi(1:R:N_z*R);
+
+%% FFT, equalize and decode
+pilot_fft = fft(y(N_cp+1:N_cp+N));
+message_fft = fft(y(2*N_cp+N+1:2*N_cp+2*N));
+[H_hat, symbol_] = OFDM_equalization(y,pilot_symbol,N,N_cp);
+soft_symbol = symbol_./abs(H_hat).^2;
+decoded = bits2char(sym2bits(symbol_));
+if ~isequal(decoded, message)
+    warning('The reference chain did not decode the message');
+end
+
+%% Export
+if ~exist(dirname,'dir')
+    mkdir(dirname);
+end
+write_vector(dirname,'params',[fs fcm R N N_cp]);
+write_vector(dirname,'message',double(message));
+write_vector(dirname,'pilot',double(pilot));
+write_vector(dirname,'symbols',symbol);
+write_vector(dirname,'pilot_symbols',pilot_symbol);
+write_vector(dirname,'frame',z);
+write_vector(dirname,'filter',B);
+write_vector(dirname,'interpolated',zi);
+write_vector(dirname,'tx',zmr);
+write_vector(dirname,'rx',yrec);
+write_vector(dirname,'demodulated',yib);
+write_vector(dirname,'baseband',y);
+write_vector(dirname,'pilot_fft',pilot_fft);
+write_vector(dirname,'message_fft',message_fft);
+write_vector(dirname,'hhat_conj',conj(H_hat));
+write_vector(dirname,'equalized',symbol_);
+write_vector(dirname,'soft_symbols',soft_symbol);
+write_vector(dirname,'decoded',double(decoded));
+end
+
+function [ block ] = char_block( s, N )
+% Pad the string s with zero characters to the N/4 characters of a block
+block = char(zeros(1,N/4));
+block(1:length(s)) = s;
+end
+
+function [ bits ] = char2bits( s )
+% Bits of the characters in s, least significant bit first
+bits = bitget(kron(double(s),ones(1,8)),repmat(1:8,1,length(s)));
+end
+
+function [ s ] = bits2char( bits )
+% Inverse of char2bits
+s = char((2.^(0:7))*reshape(double(bits),8,[]));
+end
+
+function write_vector( dirname, name, x )
+% Write x to dirname/name.csv, as real,imag pairs if x is complex
+x = x(:);
+if isreal(x)
+    v = x;
+else
+    v = [real(x) imag(x)];
+end
+dlmwrite(fullfile(dirname,[name '.csv']),v,'precision','%.9g');
+end